@@ -43,6 +43,10 @@
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 
+//---- Don't use SIMD intrinsics in the font atlas post-processing kernels (alpha multiply, RGBA32 expansion). Plain scalar loops are used instead.
+//#define IMGUI_DISABLE_SSE                                 // [x86/x64] Disable the SSE2 kernels and the AVX2 runtime dispatch.
+//#define IMGUI_DISABLE_NEON                                // [AArch64] Disable the NEON kernels.
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
 
@@ -72,6 +76,9 @@
 // The only purpose of this define is if you want force compilation of the stb_truetype backend ALONG with the FreeType backend.
 //#define IMGUI_ENABLE_STB_TRUETYPE
 
+//---- Rasterize glyphs on a single thread in the stb_truetype builder, ignoring ImFontAtlas::BuildThreadsCount (for platforms without std::thread)
+//#define IMGUI_DISABLE_THREADED_FONT_BUILD
+
 //---- Define constructor and implicit cast operators to convert back<>forth between your math types and ImVec2/ImVec4.
 // This will be inlined as part of ImVec2 and ImVec4 class declarations.
 /*
@@ -881,6 +881,7 @@ namespace ImGui
     // - All those functions are not reliant on the current context.
     // - If you reload the contents of imgui.cpp at runtime, you may need to call SetCurrentContext() + SetAllocatorFunctions() again because we use global storage for those.
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
+    IMGUI_API void          GetAllocatorFunctions(void* (**p_alloc_func)(size_t sz, void* user_data), void (**p_free_func)(void* ptr, void* user_data), void** p_user_data);
     IMGUI_API void* MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
 
@@ -2664,6 +2665,7 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    int                         BuildThreadsCount;  // Number of threads rasterizing glyphs during Build() with stb_truetype. Defaults to 0 (= calling thread only), opt in with a count > 1 (e.g. std::thread::hardware_concurrency() for large atlases). Output is identical whatever the count.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -39,6 +39,13 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#if defined(IMGUI_ENABLE_STB_TRUETYPE) && !defined(IMGUI_DISABLE_THREADED_FONT_BUILD)
+#include <atomic>       // std::atomic (glyph rasterization work queue)
+#include <thread>       // std::thread (glyph rasterization workers)
+#endif
+#if defined(IMGUI_ENABLE_SSE) && defined(_MSC_VER)
+#include <intrin.h>     // __cpuid, __cpuidex, _xgetbv (AVX2 runtime detection)
+#endif
 #if !defined(alloca)
 #if defined(__GLIBC__) || defined(__sun) || defined(__APPLE__) || defined(__NEWLIB__)
 #include <alloca.h>     // alloca (glibc uses <alloca.h>. Note that Cygwin may have _WIN32 defined, so the order matters here)
@@ -136,10 +143,22 @@ namespace IMGUI_STB_NAMESPACE
 #endif
 
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
+// Allocator of the glyph rasterization workers, passed as the stb_truetype allocation user data (NULL everywhere else).
+// It calls the allocator functions directly: ImGui::MemAlloc() would update the MetricsActiveAllocations counter of the
+// current context from several threads. Workers free everything they allocate, so that counter stays balanced anyway.
+struct ImFontBuildAllocator
+{
+    void*   (*AllocFunc)(size_t sz, void* user_data);
+    void    (*FreeFunc)(void* ptr, void* user_data);
+    void*   UserData;
+};
+static inline void* ImFontBuildAlloc(size_t size, void* u)  { ImFontBuildAllocator* a = (ImFontBuildAllocator*)u; return a ? a->AllocFunc(size, a->UserData) : IM_ALLOC(size); }
+static inline void  ImFontBuildFree(void* ptr, void* u)     { ImFontBuildAllocator* a = (ImFontBuildAllocator*)u; if (a) a->FreeFunc(ptr, a->UserData); else IM_FREE(ptr); }
+
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#define STBTT_malloc(x,u)   ImFontBuildAlloc(x,u)
+#define STBTT_free(x,u)     ImFontBuildFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -1750,10 +1769,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
         if (pixels)
         {
             TexPixelsRGBA32 = (unsigned int*)IM_ALLOC((size_t)TexWidth * (size_t)TexHeight * 4);
-            const unsigned char* src = pixels;
-            unsigned int* dst = TexPixelsRGBA32;
-            for (int n = TexWidth * TexHeight; n > 0; n--)
-                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+            ImFontAtlasBuildExpandAlpha8ToRGBA32(pixels, TexPixelsRGBA32, TexWidth * TexHeight);
         }
     }
 
@@ -1982,14 +1998,169 @@ void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], fl
     }
 }
 
+// SIMD kernels for the atlas post-processing passes below.
+// - SSE2 (x64 baseline) and NEON (AArch64) are selected at compile time. AVX2 is selected at runtime when both the CPU and the OS support it.
+// - Each kernel returns how many pixels (per row) it processed: the scalar loops finish the remainder, so every path outputs the same bytes.
+// - SSE2 has no byte shuffle, so the 256 entries table lookup of ImFontAtlasBuildMultiplyRectAlpha8() stays scalar there.
+#ifdef IMGUI_ENABLE_SSE
+#if defined(__GNUC__) || defined(__clang__)
+#define IM_TARGET_AVX2  __attribute__((target("avx2")))
+#else
+#define IM_TARGET_AVX2
+#endif
+
+static bool ImFontAtlasBuildCpuHasAvx2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    const int osxsave_avx = (1 << 27) | (1 << 28);
+    if ((info[2] & osxsave_avx) != osxsave_avx || (_xgetbv(0) & 0x06) != 0x06) // OS must save the YMM registers
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+static bool ImFontAtlasBuildUseAvx2()
+{
+    static const bool use_avx2 = ImFontAtlasBuildCpuHasAvx2();
+    return use_avx2;
+}
+
+IM_TARGET_AVX2 static int ImFontAtlasBuildMultiplyRectAlpha8_AVX2(const unsigned char table[256], unsigned char* data, int w, int h, int stride)
+{
+    // 256 entries lookup as 16 x 16 entries PSHUFB lookups: the low nibble indexes a row of the table, the high nibble selects which row to keep.
+    const int w_simd = w & ~31;
+    if (w_simd == 0)
+        return 0;
+    __m256i table_rows[16];
+    for (int k = 0; k < 16; k++)
+        table_rows[k] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(table + k * 16)));
+    const __m256i mask_lo = _mm256_set1_epi8(0x0F);
+    for (int j = h; j > 0; j--, data += stride)
+        for (int i = 0; i < w_simd; i += 32)
+        {
+            const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+            const __m256i lo = _mm256_and_si256(v, mask_lo);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), mask_lo);
+            __m256i out = _mm256_setzero_si256();
+            for (int k = 0; k < 16; k++)
+                out = _mm256_or_si256(out, _mm256_and_si256(_mm256_shuffle_epi8(table_rows[k], lo), _mm256_cmpeq_epi8(hi, _mm256_set1_epi8((char)k))));
+            _mm256_storeu_si256((__m256i*)(data + i), out);
+        }
+    return w_simd;
+}
+
+IM_TARGET_AVX2 static int ImFontAtlasBuildExpandAlpha8ToRGBA32_AVX2(const unsigned char* src, unsigned int* dst, int count)
+{
+    const __m256i white = _mm256_set1_epi32((int)IM_COL32(255, 255, 255, 0));
+    int n = 0;
+    for (; n + 32 <= count; n += 32)
+        for (int k = 0; k < 32; k += 8)
+        {
+            const __m256i a = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + n + k)));
+            _mm256_storeu_si256((__m256i*)(dst + n + k), _mm256_or_si256(white, _mm256_slli_epi32(a, IM_COL32_A_SHIFT)));
+        }
+    return n;
+}
+
+static int ImFontAtlasBuildExpandAlpha8ToRGBA32_SSE2(const unsigned char* src, unsigned int* dst, int count)
+{
+    // Interleaving zeroes twice moves each alpha byte to the top of a 32-bit lane, which is where IM_COL32_A_SHIFT puts it.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i white = _mm_set1_epi32((int)IM_COL32(255, 255, 255, 0));
+    int n = 0;
+    for (; n + 16 <= count; n += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(src + n));
+        const __m128i a_lo = _mm_unpacklo_epi8(zero, a);
+        const __m128i a_hi = _mm_unpackhi_epi8(zero, a);
+        _mm_storeu_si128((__m128i*)(dst + n +  0), _mm_or_si128(white, _mm_unpacklo_epi16(zero, a_lo)));
+        _mm_storeu_si128((__m128i*)(dst + n +  4), _mm_or_si128(white, _mm_unpackhi_epi16(zero, a_lo)));
+        _mm_storeu_si128((__m128i*)(dst + n +  8), _mm_or_si128(white, _mm_unpacklo_epi16(zero, a_hi)));
+        _mm_storeu_si128((__m128i*)(dst + n + 12), _mm_or_si128(white, _mm_unpackhi_epi16(zero, a_hi)));
+    }
+    return n;
+}
+#endif
+
+#ifdef IMGUI_ENABLE_NEON
+static int ImFontAtlasBuildMultiplyRectAlpha8_NEON(const unsigned char table[256], unsigned char* data, int w, int h, int stride)
+{
+    // 256 entries lookup as 4 x 64 entries TBL/TBX lookups: out of range indices return 0 (TBL) or leave the destination untouched (TBX).
+    const int w_simd = w & ~15;
+    if (w_simd == 0)
+        return 0;
+    uint8x16x4_t table_quarters[4];
+    for (int k = 0; k < 4; k++)
+        for (int q = 0; q < 4; q++)
+            table_quarters[k].val[q] = vld1q_u8(table + k * 64 + q * 16);
+    const uint8x16_t step = vdupq_n_u8(64);
+    for (int j = h; j > 0; j--, data += stride)
+        for (int i = 0; i < w_simd; i += 16)
+        {
+            uint8x16_t v = vld1q_u8(data + i);
+            uint8x16_t out = vqtbl4q_u8(table_quarters[0], v);
+            v = vsubq_u8(v, step); out = vqtbx4q_u8(out, table_quarters[1], v);
+            v = vsubq_u8(v, step); out = vqtbx4q_u8(out, table_quarters[2], v);
+            v = vsubq_u8(v, step); out = vqtbx4q_u8(out, table_quarters[3], v);
+            vst1q_u8(data + i, out);
+        }
+    return w_simd;
+}
+
+static int ImFontAtlasBuildExpandAlpha8ToRGBA32_NEON(const unsigned char* src, unsigned int* dst, int count)
+{
+    // Interleaved store of { 255, 255, 255, alpha } bytes, which is IM_COL32(255, 255, 255, alpha) on little-endian targets.
+    uint8x16x4_t px;
+    px.val[0] = px.val[1] = px.val[2] = vdupq_n_u8(255);
+    int n = 0;
+    for (; n + 16 <= count; n += 16)
+    {
+        px.val[3] = vld1q_u8(src + n);
+        vst4q_u8((uint8_t*)(dst + n), px);
+    }
+    return n;
+}
+#endif
+
 void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride)
 {
     unsigned char* data = pixels + x + y * stride;
+    int i_start = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    if (ImFontAtlasBuildUseAvx2())
+        i_start = ImFontAtlasBuildMultiplyRectAlpha8_AVX2(table, data, w, h, stride);
+#elif defined(IMGUI_ENABLE_NEON)
+    i_start = ImFontAtlasBuildMultiplyRectAlpha8_NEON(table, data, w, h, stride);
+#endif
     for (int j = h; j > 0; j--, data += stride)
-        for (int i = 0; i < w; i++)
+        for (int i = i_start; i < w; i++)
             data[i] = table[data[i]];
 }
 
+void    ImFontAtlasBuildExpandAlpha8ToRGBA32(const unsigned char* src, unsigned int* dst, int count)
+{
+    IM_STATIC_ASSERT(IM_COL32_A_SHIFT == 24);
+    int n = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    if (ImFontAtlasBuildUseAvx2())
+        n = ImFontAtlasBuildExpandAlpha8ToRGBA32_AVX2(src, dst, count);
+    else
+        n = ImFontAtlasBuildExpandAlpha8ToRGBA32_SSE2(src, dst, count);
+#elif defined(IMGUI_ENABLE_NEON)
+    n = ImFontAtlasBuildExpandAlpha8ToRGBA32_NEON(src, dst, count);
+#endif
+    for (; n < count; n++)
+        dst[n] = IM_COL32(255, 255, 255, (unsigned int)src[n]);
+}
+
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 // Temporary data for one source font (multiple source fonts can be merged into one destination ImFont)
 // (C++03 doesn't allow instancing ImVector<> with function-local types so we declare the type here.)
@@ -2016,6 +2187,14 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// A slice of consecutive glyphs of one source font, rasterized as a single unit of work.
+struct ImFontBuildRenderChunk
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[] and src_tmp_array[]
+    int                 GlyphBegin;         // First glyph in src_tmp.GlyphsList[]
+    int                 GlyphEnd;           // One past the last glyph
+};
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2028,6 +2207,37 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Rasterize a chunk of glyphs into their packed rectangles. Every glyph only writes within its own rectangle,
+// so chunks may run concurrently and in any order while producing the exact same texture as a serial build.
+static void ImFontAtlasBuildRenderChunk(ImFontAtlas* atlas, const stbtt_pack_context* spc_template, ImFontBuildSrcData* src_tmp_array, const ImFontBuildRenderChunk& chunk, ImFontBuildAllocator* allocator)
+{
+    ImFontConfig& cfg = atlas->ConfigData[chunk.SrcIndex];
+    ImFontBuildSrcData& src_tmp = src_tmp_array[chunk.SrcIndex];
+
+    // stbtt_PackFontRangesRenderIntoRects() temporarily writes the oversampling into the context, so each chunk works on a copy.
+    // The font info is copied too, to carry the allocator (NULL on the calling thread alone)
+    stbtt_pack_context spc = *spc_template;
+    spc.user_allocator_context = allocator;
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = allocator;
+    stbtt_pack_range range = src_tmp.PackRange;
+    range.array_of_unicode_codepoints += chunk.GlyphBegin;
+    range.chardata_for_range += chunk.GlyphBegin;
+    range.num_chars = chunk.GlyphEnd - chunk.GlyphBegin;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &range, 1, src_tmp.Rects + chunk.GlyphBegin);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = &src_tmp.Rects[chunk.GlyphBegin];
+        for (int glyph_i = chunk.GlyphBegin; glyph_i < chunk.GlyphEnd; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2212,27 +2422,52 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Glyphs are split in fixed-size chunks, rasterized by atlas->BuildThreadsCount threads pulling from a shared counter.
+    const int GLYPHS_PER_CHUNK = 64;
+    ImVector<ImFontBuildRenderChunk> chunks;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += GLYPHS_PER_CHUNK)
+        {
+            ImFontBuildRenderChunk chunk;
+            chunk.SrcIndex = src_i;
+            chunk.GlyphBegin = glyph_i;
+            chunk.GlyphEnd = ImMin(glyph_i + GLYPHS_PER_CHUNK, src_tmp_array[src_i].GlyphsCount);
+            chunks.push_back(chunk);
+        }
 
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
+#ifndef IMGUI_DISABLE_THREADED_FONT_BUILD
+    const int THREADS_MAX = 32;
+    // Opt-in: spawning threads costs more than it saves on small atlases (e.g. the default font alone)
+    const int threads_count = ImClamp(ImMin(atlas->BuildThreadsCount, chunks.Size), 1, THREADS_MAX);
+    if (threads_count > 1)
+    {
+        // Allocations made by stb_truetype in the workers bypass ImGui::MemAlloc(), see ImFontBuildAllocator.
+        // The current context is left alone: it is global to the process, other threads may be using it.
+        ImFontBuildAllocator allocator;
+        ImGui::GetAllocatorFunctions(&allocator.AllocFunc, &allocator.FreeFunc, &allocator.UserData);
 
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        std::atomic<int> next_chunk(0);
+        auto worker_func = [&]()
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
-        }
-        src_tmp.Rects = NULL;
+            for (int chunk_i = next_chunk++; chunk_i < chunks.Size; chunk_i = next_chunk++)
+                ImFontAtlasBuildRenderChunk(atlas, &spc, src_tmp_array.Data, chunks[chunk_i], &allocator);
+        };
+        std::thread workers[THREADS_MAX - 1];
+        for (int thread_i = 0; thread_i < threads_count - 1; thread_i++)
+            workers[thread_i] = std::thread(worker_func);
+        worker_func(); // The calling thread takes its share
+        for (int thread_i = 0; thread_i < threads_count - 1; thread_i++)
+            workers[thread_i].join();
     }
+    else
+#endif
+    {
+        for (int chunk_i = 0; chunk_i < chunks.Size; chunk_i++)
+            ImFontAtlasBuildRenderChunk(atlas, &spc, src_tmp_array.Data, chunks[chunk_i], NULL);
+    }
+
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
@@ -0,0 +1,691 @@
+// dear imgui: Renderer Backend for a CPU software rasterizer
+// This needs no GPU and no Platform Backend: draw data is rasterized into a caller-owned RGBA buffer (headless tests, benchmarks, CI)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoft_Texture*' as ImTextureID (see ImGui_ImplSoft_GetTextureID). Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded tile binning and rasterization, SSE2 accelerated. The output doesn't depend on the thread count or on SSE2.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// How it works:
+// - Draw commands are gathered into batches until a user callback (or the end of the draw data) forces a flush.
+// - Flush, pass 1: every thread sets up a contiguous range of triangles (snapped edge functions, attribute planes) and appends
+//   their indices to its own per-tile bins. Ranges are in submission order, so reading the bins of thread 0, 1, ... keeps that order.
+// - Flush, pass 2: threads pull 64x64 tiles from an atomic counter and rasterize the triangles binned to them, in order.
+//   A tile is only ever touched by one thread, so no pixel needs synchronization and the result is deterministic.
+// - Inside a tile, edges that don't cross it are skipped, the others are evaluated 4 pixels at a time (SSE2) in int32.
+//   Solid color + solid texel triangles (most of Dear ImGui's geometry) are blended 4 pixels at a time too.
+
+#include "imgui.h"
+#include "imgui_impl_soft.h"
+#include "imgui_internal.h"     // IMGUI_ENABLE_SSE
+#include <math.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+#define IMGUI_IMPL_SOFT_TILE_SIZE       64          // Pixels, power of 2
+#define IMGUI_IMPL_SOFT_SUBPIXEL        16          // Vertices are snapped to 1/16 pixel
+#define IMGUI_IMPL_SOFT_GUARD_BAND      16384.0f    // Vertices are clamped to +/- this many pixels, keeping edge functions within int32 inside a tile
+#define IMGUI_IMPL_SOFT_MIN_TRIS_PER_THREAD 512     // Below this, setup and binning run on fewer threads
+
+struct ImGui_ImplSoft_Triangle
+{
+    int                             MinX, MinY, MaxX, MaxY;     // Pixels covered: bounding box clipped to the scissor and the target (max exclusive). Empty if culled
+    int                             EdgeA[3], EdgeB[3];         // Edge functions in subpixels: E = A * x + B * y + C, >= 0 inside (top-left rule folded in C)
+    ImS64                           EdgeC[3];
+    const ImGui_ImplSoft_Texture*   Texture;
+    bool                            FlatColor;                  // All vertices share the same color
+    bool                            FlatUV;                     // All vertices share the same uv (solid fills sample the white pixel)
+    ImU32                           Color;                      // If FlatColor
+    ImU32                           Texel;                      // If FlatUV
+    ImU32                           Source;                     // Color * Texel if both are flat
+    float                           OriginX, OriginY;           // Vertex 0, pixels
+    float                           Plane[6][3];                // r, g, b, a (0-255), u, v: value at the origin, d/dx, d/dy
+};
+
+struct ImGui_ImplSoft_Batch
+{
+    const ImDrawVert*               VtxBuffer;
+    const ImDrawIdx*                IdxBuffer;
+    const ImGui_ImplSoft_Texture*   Texture;
+    int                             FirstTriangle;              // Index of the first triangle in g_Triangles
+    int                             ClipMinX, ClipMinY, ClipMaxX, ClipMaxY;
+};
+
+struct ImGui_ImplSoft_Target
+{
+    ImU32*                          Pixels;
+    int                             Width;
+    int                             Height;
+    int                             Stride;
+    ImVec2                          DisplayPos;
+    ImVec2                          Scale;
+    int                             TilesX;
+    int                             TilesY;
+};
+
+// Rasterizer data
+static int                                      g_NumThreads = 0;
+static ImGui_ImplSoft_Texture                   g_FontTexture = {};
+static std::vector<ImU32>                       g_FontPixels;
+static std::vector<ImGui_ImplSoft_Batch>        g_Batches;
+static std::vector<ImGui_ImplSoft_Triangle>     g_Triangles;
+static std::vector<std::vector<std::vector<int> > > g_Bins;    // [thread][tile] -> triangle indices
+static int                                      g_BinThreads = 0;
+static std::atomic<int>                         g_NextTile(0);
+
+// Workers (thread 0 is the caller of ImGui_ImplSoft_RenderDrawData)
+static std::vector<std::thread>                 g_Workers;
+static std::mutex                               g_WorkMutex;
+static std::condition_variable                  g_WorkCond;
+static std::condition_variable                  g_DoneCond;
+static std::function<void(int)>                 g_Job;
+static int                                      g_JobThreads = 0;
+static unsigned int                             g_JobGeneration = 0;
+static int                                      g_JobPending = 0;
+static bool                                     g_WorkersQuit = false;
+
+static void ImGui_ImplSoft_WorkerMain(int thread_index)
+{
+    unsigned int generation = 0;
+    std::unique_lock<std::mutex> lock(g_WorkMutex);
+    for (;;)
+    {
+        g_WorkCond.wait(lock, [&] { return g_WorkersQuit || g_JobGeneration != generation; });
+        if (g_WorkersQuit)
+            return;
+        generation = g_JobGeneration;
+        if (thread_index >= g_JobThreads)
+            continue;
+
+        lock.unlock();
+        g_Job(thread_index);
+        lock.lock();
+        if (--g_JobPending == 0)
+            g_DoneCond.notify_one();
+    }
+}
+
+// Run job(0) .. job(num_threads - 1) in parallel and wait for all of them
+static void ImGui_ImplSoft_RunJob(int num_threads, const std::function<void(int)>& job)
+{
+    if (num_threads <= 1 || g_Workers.empty())
+    {
+        for (int n = 0; n < num_threads; n++)
+            job(n);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_WorkMutex);
+        g_Job = job;
+        g_JobThreads = num_threads;
+        g_JobPending = num_threads - 1;
+        g_JobGeneration++;
+    }
+    g_WorkCond.notify_all();
+    job(0);
+
+    std::unique_lock<std::mutex> lock(g_WorkMutex);
+    g_DoneCond.wait(lock, [] { return g_JobPending == 0; });
+    g_Job = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Pixel math, shared by the scalar and SSE2 paths so both give the same bits
+//-----------------------------------------------------------------------------
+
+// Exact round(x / 255) for x in [0, 255 * 255]
+static inline ImU32 ImGui_ImplSoft_Div255(ImU32 x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+static inline ImU32 ImGui_ImplSoft_Modulate(ImU32 a, ImU32 b)
+{
+    if (b == 0xFFFFFFFF)
+        return a;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoft_Div255(((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+static inline ImU32 ImGui_ImplSoft_Blend(ImU32 src, ImU32 dst)
+{
+    const ImU32 src_a = src >> 24;
+    if (src_a == 255)
+        return src;
+    if (src_a == 0)
+        return dst;
+    const ImU32 inv_a = 255 - src_a;
+    const ImU32 r = ImGui_ImplSoft_Div255(((src >> 0) & 0xFF) * src_a + ((dst >> 0) & 0xFF) * inv_a);
+    const ImU32 g = ImGui_ImplSoft_Div255(((src >> 8) & 0xFF) * src_a + ((dst >> 8) & 0xFF) * inv_a);
+    const ImU32 b = ImGui_ImplSoft_Div255(((src >> 16) & 0xFF) * src_a + ((dst >> 16) & 0xFF) * inv_a);
+    const ImU32 a = ImGui_ImplSoft_Div255(255 * src_a + (dst >> 24) * inv_a);
+    return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static inline ImU32 ImGui_ImplSoft_Fetch(const ImGui_ImplSoft_Texture* tex, int x, int y)
+{
+    x = x < 0 ? 0 : x >= tex->Width ? tex->Width - 1 : x;
+    y = y < 0 ? 0 : y >= tex->Height ? tex->Height - 1 : y;
+    return tex->Pixels[y * tex->Width + x];
+}
+
+static ImU32 ImGui_ImplSoft_Sample(const ImGui_ImplSoft_Texture* tex, float u, float v)
+{
+    if (!tex)
+        return 0xFFFFFFFF;
+
+    const float fx = u * tex->Width - 0.5f;
+    const float fy = v * tex->Height - 0.5f;
+    const float x0f = floorf(fx);
+    const float y0f = floorf(fy);
+    const int x0 = (int)x0f;
+    const int y0 = (int)y0f;
+    const ImU32 wx = (ImU32)((fx - x0f) * 256.0f + 0.5f);
+    const ImU32 wy = (ImU32)((fy - y0f) * 256.0f + 0.5f);
+    if (wx == 0 && wy == 0)
+        return ImGui_ImplSoft_Fetch(tex, x0, y0);
+
+    const ImU32 c00 = ImGui_ImplSoft_Fetch(tex, x0, y0), c10 = ImGui_ImplSoft_Fetch(tex, x0 + 1, y0);
+    const ImU32 c01 = ImGui_ImplSoft_Fetch(tex, x0, y0 + 1), c11 = ImGui_ImplSoft_Fetch(tex, x0 + 1, y0 + 1);
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        const ImU32 top = ((c00 >> shift) & 0xFF) * (256 - wx) + ((c10 >> shift) & 0xFF) * wx;
+        const ImU32 bottom = ((c01 >> shift) & 0xFF) * (256 - wx) + ((c11 >> shift) & 0xFF) * wx;
+        out |= ((top * (256 - wy) + bottom * wy + 32768) >> 16) << shift;
+    }
+    return out;
+}
+
+static inline ImU32 ImGui_ImplSoft_Shade(const ImGui_ImplSoft_Triangle& tri, int x, int y)
+{
+    if (tri.FlatColor && tri.FlatUV)
+        return tri.Source;
+
+    const float dx = (float)x + 0.5f - tri.OriginX;
+    const float dy = (float)y + 0.5f - tri.OriginY;
+    ImU32 color = tri.Color;
+    if (!tri.FlatColor)
+    {
+        color = 0;
+        for (int c = 0; c < 4; c++)
+        {
+            const float value = tri.Plane[c][0] + tri.Plane[c][1] * dx + tri.Plane[c][2] * dy;
+            const int channel = (int)(value + 0.5f);
+            color |= (ImU32)(channel < 0 ? 0 : channel > 255 ? 255 : channel) << (c * 8);
+        }
+    }
+    ImU32 texel = tri.Texel;
+    if (!tri.FlatUV)
+        texel = ImGui_ImplSoft_Sample(tri.Texture, tri.Plane[4][0] + tri.Plane[4][1] * dx + tri.Plane[4][2] * dy, tri.Plane[5][0] + tri.Plane[5][1] * dx + tri.Plane[5][2] * dy);
+    return ImGui_ImplSoft_Modulate(color, texel);
+}
+
+//-----------------------------------------------------------------------------
+// Triangle setup and binning
+//-----------------------------------------------------------------------------
+
+static inline int ImGui_ImplSoft_Snap(float v)
+{
+    v = v < -IMGUI_IMPL_SOFT_GUARD_BAND ? -IMGUI_IMPL_SOFT_GUARD_BAND : v > IMGUI_IMPL_SOFT_GUARD_BAND ? IMGUI_IMPL_SOFT_GUARD_BAND : v;
+    return (int)floorf(v * IMGUI_IMPL_SOFT_SUBPIXEL + 0.5f);
+}
+
+// First pixel whose center (x * 16 + 8) is >= v, v in subpixels
+static inline int ImGui_ImplSoft_FirstPixel(int v)
+{
+    const int n = v - IMGUI_IMPL_SOFT_SUBPIXEL / 2;
+    return n >= 0 ? (n + IMGUI_IMPL_SOFT_SUBPIXEL - 1) / IMGUI_IMPL_SOFT_SUBPIXEL : -((-n) / IMGUI_IMPL_SOFT_SUBPIXEL);
+}
+
+static void ImGui_ImplSoft_SetupTriangle(ImGui_ImplSoft_Triangle& tri, const ImGui_ImplSoft_Batch& batch, const ImGui_ImplSoft_Target& target, int batch_triangle)
+{
+    tri.MinX = tri.MaxX = 0;
+
+    const ImDrawVert* v[3];
+    for (int n = 0; n < 3; n++)
+        v[n] = &batch.VtxBuffer[batch.IdxBuffer[batch_triangle * 3 + n]];
+
+    int sx[3], sy[3];
+    for (int n = 0; n < 3; n++)
+    {
+        sx[n] = ImGui_ImplSoft_Snap((v[n]->pos.x - target.DisplayPos.x) * target.Scale.x);
+        sy[n] = ImGui_ImplSoft_Snap((v[n]->pos.y - target.DisplayPos.y) * target.Scale.y);
+    }
+
+    ImS64 area = (ImS64)(sx[1] - sx[0]) * (sy[2] - sy[0]) - (ImS64)(sy[1] - sy[0]) * (sx[2] - sx[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        // Both windings are drawn, make the interior positive
+        ImSwap(v[1], v[2]);
+        ImSwap(sx[1], sx[2]);
+        ImSwap(sy[1], sy[2]);
+        area = -area;
+    }
+
+    // Covered pixels: centers within the snapped bounding box, then the scissor and the target
+    tri.MinX = ImMax(ImGui_ImplSoft_FirstPixel(ImMin(sx[0], ImMin(sx[1], sx[2]))), batch.ClipMinX);
+    tri.MinY = ImMax(ImGui_ImplSoft_FirstPixel(ImMin(sy[0], ImMin(sy[1], sy[2]))), batch.ClipMinY);
+    tri.MaxX = ImMin(ImGui_ImplSoft_FirstPixel(ImMax(sx[0], ImMax(sx[1], sx[2])) + 1), batch.ClipMaxX);
+    tri.MaxY = ImMin(ImGui_ImplSoft_FirstPixel(ImMax(sy[0], ImMax(sy[1], sy[2])) + 1), batch.ClipMaxY);
+    if (tri.MinX >= tri.MaxX || tri.MinY >= tri.MaxY)
+    {
+        tri.MinX = tri.MaxX = 0;
+        return;
+    }
+
+    for (int n = 0; n < 3; n++)
+    {
+        const int a = n, b = (n + 1) % 3;
+        const int dx = sx[b] - sx[a];
+        const int dy = sy[b] - sy[a];
+        const bool top_left = dy < 0 || (dy == 0 && dx > 0);
+        tri.EdgeA[n] = -dy;
+        tri.EdgeB[n] = dx;
+        tri.EdgeC[n] = (ImS64)dy * sx[a] - (ImS64)dx * sy[a] - (top_left ? 0 : 1);
+    }
+
+    tri.Texture = batch.Texture;
+    tri.FlatColor = v[0]->col == v[1]->col && v[0]->col == v[2]->col;
+    tri.FlatUV = v[0]->uv.x == v[1]->uv.x && v[0]->uv.x == v[2]->uv.x && v[0]->uv.y == v[1]->uv.y && v[0]->uv.y == v[2]->uv.y;
+    tri.Color = v[0]->col;
+    tri.Texel = tri.FlatUV ? ImGui_ImplSoft_Sample(tri.Texture, v[0]->uv.x, v[0]->uv.y) : 0xFFFFFFFF;
+    tri.Source = ImGui_ImplSoft_Modulate(tri.Color, tri.Texel);
+    if (tri.FlatColor && tri.FlatUV && (tri.Source >> 24) == 0)
+    {
+        tri.MinX = tri.MaxX = 0; // Invisible
+        return;
+    }
+
+    // Attribute planes, from the snapped positions
+    const float x0 = sx[0] / (float)IMGUI_IMPL_SOFT_SUBPIXEL, y0 = sy[0] / (float)IMGUI_IMPL_SOFT_SUBPIXEL;
+    const float x1 = sx[1] / (float)IMGUI_IMPL_SOFT_SUBPIXEL - x0, y1 = sy[1] / (float)IMGUI_IMPL_SOFT_SUBPIXEL - y0;
+    const float x2 = sx[2] / (float)IMGUI_IMPL_SOFT_SUBPIXEL - x0, y2 = sy[2] / (float)IMGUI_IMPL_SOFT_SUBPIXEL - y0;
+    const float inv_area = (float)(IMGUI_IMPL_SOFT_SUBPIXEL * IMGUI_IMPL_SOFT_SUBPIXEL) / (float)area;
+    tri.OriginX = x0;
+    tri.OriginY = y0;
+    for (int c = 0; c < 6; c++)
+    {
+        float a[3];
+        for (int n = 0; n < 3; n++)
+            a[n] = c < 4 ? (float)((v[n]->col >> (c * 8)) & 0xFF) : c == 4 ? v[n]->uv.x : v[n]->uv.y;
+        const float d1 = a[1] - a[0], d2 = a[2] - a[0];
+        tri.Plane[c][0] = a[0];
+        tri.Plane[c][1] = (d1 * y2 - d2 * y1) * inv_area;
+        tri.Plane[c][2] = (d2 * x1 - d1 * x2) * inv_area;
+    }
+}
+
+static void ImGui_ImplSoft_SetupAndBin(const ImGui_ImplSoft_Target& target, int thread_index, int first, int last)
+{
+    std::vector<std::vector<int> >& bins = g_Bins[thread_index];
+    for (std::vector<int>& bin : bins)
+        bin.clear();
+    if (first >= last)
+        return;
+
+    // Batch of the first triangle of the range
+    int batch_index = 0;
+    int lo = 0, hi = (int)g_Batches.size() - 1;
+    while (lo <= hi)
+    {
+        const int mid = (lo + hi) / 2;
+        if (g_Batches[mid].FirstTriangle <= first)
+        {
+            batch_index = mid;
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    const int tile_shift = 6; // log2(IMGUI_IMPL_SOFT_TILE_SIZE)
+    IM_STATIC_ASSERT((1 << tile_shift) == IMGUI_IMPL_SOFT_TILE_SIZE);
+    for (int n = first; n < last; n++)
+    {
+        while (batch_index + 1 < (int)g_Batches.size() && g_Batches[batch_index + 1].FirstTriangle <= n)
+            batch_index++;
+        const ImGui_ImplSoft_Batch& batch = g_Batches[batch_index];
+
+        ImGui_ImplSoft_Triangle& tri = g_Triangles[n];
+        ImGui_ImplSoft_SetupTriangle(tri, batch, target, n - batch.FirstTriangle);
+        if (tri.MinX >= tri.MaxX)
+            continue;
+
+        // Bounding box binning: Dear ImGui triangles are small or axis-aligned, the rasterizer rejects the few empty tiles quickly
+        const int tx0 = tri.MinX >> tile_shift, tx1 = (tri.MaxX - 1) >> tile_shift;
+        const int ty0 = tri.MinY >> tile_shift, ty1 = (tri.MaxY - 1) >> tile_shift;
+        for (int ty = ty0; ty <= ty1; ty++)
+            for (int tx = tx0; tx <= tx1; tx++)
+                bins[ty * target.TilesX + tx].push_back(n);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoft_RasterizeTriangle(const ImGui_ImplSoft_Target& target, const ImGui_ImplSoft_Triangle& tri, int tile_x, int tile_y)
+{
+    const int x0 = ImMax(tri.MinX, tile_x), x1 = ImMin(tri.MaxX, tile_x + IMGUI_IMPL_SOFT_TILE_SIZE);
+    const int y0 = ImMax(tri.MinY, tile_y), y1 = ImMin(tri.MaxY, tile_y + IMGUI_IMPL_SOFT_TILE_SIZE);
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    // Edge values at the first pixel center. Edges not crossing the rectangle are either fully outside (nothing to draw) or fully inside (skipped),
+    // the crossing ones are bounded by the rectangle size, so int32 is enough from here on
+    int edges_count = 0;
+    int row_value[3] = {}, step_x[3] = {}, step_y[3] = {}; // Only the first edges_count are stepped, the rest stay 0
+    for (int n = 0; n < 3; n++)
+    {
+        const ImS64 a = (ImS64)tri.EdgeA[n] * IMGUI_IMPL_SOFT_SUBPIXEL;
+        const ImS64 b = (ImS64)tri.EdgeB[n] * IMGUI_IMPL_SOFT_SUBPIXEL;
+        const ImS64 value = (ImS64)tri.EdgeA[n] * (x0 * IMGUI_IMPL_SOFT_SUBPIXEL + IMGUI_IMPL_SOFT_SUBPIXEL / 2) + (ImS64)tri.EdgeB[n] * (y0 * IMGUI_IMPL_SOFT_SUBPIXEL + IMGUI_IMPL_SOFT_SUBPIXEL / 2) + tri.EdgeC[n];
+        const ImS64 span_x = a * (x1 - 1 - x0), span_y = b * (y1 - 1 - y0);
+        const ImS64 min_value = value + ImMin(span_x, (ImS64)0) + ImMin(span_y, (ImS64)0);
+        const ImS64 max_value = value + ImMax(span_x, (ImS64)0) + ImMax(span_y, (ImS64)0);
+        if (max_value < 0)
+            return;
+        if (min_value >= 0)
+            continue;
+        row_value[edges_count] = (int)value;
+        step_x[edges_count] = (int)a;
+        step_y[edges_count] = (int)b;
+        edges_count++;
+    }
+
+    const bool flat = tri.FlatColor && tri.FlatUV;
+    ImU32* row = target.Pixels + (size_t)y0 * target.Stride;
+    for (int y = y0; y < y1; y++, row += target.Stride)
+    {
+        int value[3] = { row_value[0], row_value[1], row_value[2] };
+        int x = x0;
+
+#ifdef IMGUI_ENABLE_SSE
+        __m128i edge[3], edge_step[3];
+        for (int n = 0; n < edges_count; n++)
+        {
+            edge[n] = _mm_add_epi32(_mm_set1_epi32(value[n]), _mm_set_epi32(step_x[n] * 3, step_x[n] * 2, step_x[n], 0));
+            edge_step[n] = _mm_set1_epi32(step_x[n] * 4);
+        }
+
+        if (flat)
+        {
+            // Solid source: blend 4 pixels at once, with the same integer math as ImGui_ImplSoft_Blend()
+            const ImU32 src = tri.Source;
+            const ImU32 src_a = src >> 24;
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i src_term = _mm_set_epi16(
+                (short)(255 * src_a), (short)(((src >> 16) & 0xFF) * src_a), (short)(((src >> 8) & 0xFF) * src_a), (short)((src & 0xFF) * src_a),
+                (short)(255 * src_a), (short)(((src >> 16) & 0xFF) * src_a), (short)(((src >> 8) & 0xFF) * src_a), (short)((src & 0xFF) * src_a));
+            const __m128i inv_a = _mm_set1_epi16((short)(255 - src_a));
+            const __m128i bias = _mm_set1_epi16(128);
+            const __m128i src4 = _mm_set1_epi32((int)src);
+
+            for (; x + 4 <= x1; x += 4)
+            {
+                __m128i mask = _mm_set1_epi32(-1);
+                for (int n = 0; n < edges_count; n++)
+                {
+                    mask = _mm_and_si128(mask, _mm_cmpgt_epi32(edge[n], _mm_set1_epi32(-1)));
+                    edge[n] = _mm_add_epi32(edge[n], edge_step[n]);
+                }
+                const int bits = _mm_movemask_ps(_mm_castsi128_ps(mask));
+                if (bits == 0)
+                    continue;
+
+                __m128i* dst = (__m128i*)(row + x);
+                const __m128i d = _mm_loadu_si128(dst);
+                __m128i out;
+                if (src_a == 255)
+                {
+                    out = src4;
+                }
+                else
+                {
+                    __m128i lo = _mm_add_epi16(_mm_add_epi16(src_term, _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_a)), bias);
+                    __m128i hi = _mm_add_epi16(_mm_add_epi16(src_term, _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_a)), bias);
+                    lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+                    hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+                    out = _mm_packus_epi16(lo, hi);
+                }
+                if (bits != 0xF)
+                    out = _mm_or_si128(_mm_and_si128(mask, out), _mm_andnot_si128(mask, d));
+                _mm_storeu_si128(dst, out);
+            }
+        }
+        else
+        {
+            // Varying source: coverage 4 pixels at once, shading per covered pixel
+            for (; x + 4 <= x1; x += 4)
+            {
+                __m128i mask = _mm_set1_epi32(-1);
+                for (int n = 0; n < edges_count; n++)
+                {
+                    mask = _mm_and_si128(mask, _mm_cmpgt_epi32(edge[n], _mm_set1_epi32(-1)));
+                    edge[n] = _mm_add_epi32(edge[n], edge_step[n]);
+                }
+                const int bits = _mm_movemask_ps(_mm_castsi128_ps(mask));
+                for (int lane = 0; lane < 4; lane++)
+                    if (bits & (1 << lane))
+                        row[x + lane] = ImGui_ImplSoft_Blend(ImGui_ImplSoft_Shade(tri, x + lane, y), row[x + lane]);
+            }
+        }
+
+        for (int n = 0; n < edges_count; n++)
+            value[n] += step_x[n] * (x - x0);
+#endif
+
+        // Scalar path, and the last pixels of the row
+        for (; x < x1; x++)
+        {
+            bool inside = true;
+            for (int n = 0; n < edges_count; n++)
+            {
+                inside &= value[n] >= 0;
+                value[n] += step_x[n];
+            }
+            if (inside)
+                row[x] = ImGui_ImplSoft_Blend(flat ? tri.Source : ImGui_ImplSoft_Shade(tri, x, y), row[x]);
+        }
+
+        for (int n = 0; n < edges_count; n++)
+            row_value[n] += step_y[n];
+    }
+}
+
+static void ImGui_ImplSoft_RasterizeTiles(const ImGui_ImplSoft_Target& target)
+{
+    const int tiles_count = target.TilesX * target.TilesY;
+    for (int tile = g_NextTile++; tile < tiles_count; tile = g_NextTile++)
+    {
+        const int tile_x = (tile % target.TilesX) * IMGUI_IMPL_SOFT_TILE_SIZE;
+        const int tile_y = (tile / target.TilesX) * IMGUI_IMPL_SOFT_TILE_SIZE;
+        for (int thread_index = 0; thread_index < g_BinThreads; thread_index++)
+            for (int n : g_Bins[thread_index][tile])
+                ImGui_ImplSoft_RasterizeTriangle(target, g_Triangles[n], tile_x, tile_y);
+    }
+}
+
+// Rasterize the batches gathered so far
+static void ImGui_ImplSoft_Flush(const ImGui_ImplSoft_Target& target, int triangles_count)
+{
+    if (g_Batches.empty())
+        return;
+
+    if ((int)g_Triangles.size() < triangles_count)
+        g_Triangles.resize(triangles_count);
+
+    const int tiles_count = target.TilesX * target.TilesY;
+    for (std::vector<std::vector<int> >& bins : g_Bins)
+        if ((int)bins.size() < tiles_count)
+            bins.resize(tiles_count);
+
+    // Pass 1: setup and binning, one contiguous range per thread
+    g_BinThreads = ImClamp(triangles_count / IMGUI_IMPL_SOFT_MIN_TRIS_PER_THREAD, 1, g_NumThreads);
+    const int bin_threads = g_BinThreads;
+    ImGui_ImplSoft_RunJob(bin_threads, [&](int thread_index)
+    {
+        const int first = (int)((ImS64)triangles_count * thread_index / bin_threads);
+        const int last = (int)((ImS64)triangles_count * (thread_index + 1) / bin_threads);
+        ImGui_ImplSoft_SetupAndBin(target, thread_index, first, last);
+    });
+
+    // Pass 2: tiles
+    g_NextTile = 0;
+    ImGui_ImplSoft_RunJob(ImMin(g_NumThreads, tiles_count), [&](int) { ImGui_ImplSoft_RasterizeTiles(target); });
+
+    g_Batches.resize(0);
+}
+
+void ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride)
+{
+    IM_ASSERT(g_NumThreads > 0 && "Did you call ImGui_ImplSoft_Init()?");
+
+    // Avoid rendering when minimized
+    if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f || width <= 0 || height <= 0)
+        return;
+
+    ImGui_ImplSoft_Target target;
+    target.Pixels = pixels;
+    target.Width = width;
+    target.Height = height;
+    target.Stride = stride > 0 ? stride : width;
+    target.DisplayPos = draw_data->DisplayPos;
+    target.Scale = draw_data->FramebufferScale;
+    target.TilesX = (width + IMGUI_IMPL_SOFT_TILE_SIZE - 1) / IMGUI_IMPL_SOFT_TILE_SIZE;
+    target.TilesY = (height + IMGUI_IMPL_SOFT_TILE_SIZE - 1) / IMGUI_IMPL_SOFT_TILE_SIZE;
+
+    // Render command lists
+    // Batches are only rasterized when a user callback needs the pixels drawn before it, or at the end
+    int triangles_count = 0;
+    g_Batches.resize(0);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                {
+                    ImGui_ImplSoft_Flush(target, triangles_count);
+                    triangles_count = 0;
+                    pcmd->UserCallback(cmd_list, pcmd);
+                }
+                continue;
+            }
+
+            // Scissor in framebuffer pixels, truncated like the GPU backends
+            ImGui_ImplSoft_Batch batch;
+            batch.ClipMinX = ImMax((int)((pcmd->ClipRect.x - target.DisplayPos.x) * target.Scale.x), 0);
+            batch.ClipMinY = ImMax((int)((pcmd->ClipRect.y - target.DisplayPos.y) * target.Scale.y), 0);
+            batch.ClipMaxX = ImMin((int)((pcmd->ClipRect.z - target.DisplayPos.x) * target.Scale.x), width);
+            batch.ClipMaxY = ImMin((int)((pcmd->ClipRect.w - target.DisplayPos.y) * target.Scale.y), height);
+            if (batch.ClipMaxX <= batch.ClipMinX || batch.ClipMaxY <= batch.ClipMinY || pcmd->ElemCount < 3)
+                continue;
+
+            batch.VtxBuffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            batch.IdxBuffer = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            batch.Texture = (const ImGui_ImplSoft_Texture*)(intptr_t)pcmd->TextureId;
+            batch.FirstTriangle = triangles_count;
+            triangles_count += pcmd->ElemCount / 3;
+            g_Batches.push_back(batch);
+        }
+    }
+    ImGui_ImplSoft_Flush(target, triangles_count);
+}
+
+static void ImGui_ImplSoft_CreateFontsTexture()
+{
+    // Build texture atlas, copied so the atlas can free its own copy
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    g_FontPixels.assign((const ImU32*)pixels, (const ImU32*)pixels + width * height);
+    g_FontTexture.Pixels = g_FontPixels.data();
+    g_FontTexture.Width = width;
+    g_FontTexture.Height = height;
+
+    // Store our identifier
+    io.Fonts->SetTexID(ImGui_ImplSoft_GetTextureID(&g_FontTexture));
+}
+
+bool    ImGui_ImplSoft_CreateDeviceObjects()
+{
+    ImGui_ImplSoft_CreateFontsTexture();
+    return true;
+}
+
+void    ImGui_ImplSoft_InvalidateDeviceObjects()
+{
+    g_FontPixels.clear();
+    g_FontPixels.shrink_to_fit();
+    g_FontTexture = ImGui_ImplSoft_Texture();
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.Fonts->SetTexID(0); // We copied &g_FontTexture to io.Fonts->TexID so let's clear that as well.
+}
+
+bool    ImGui_ImplSoft_Init(int num_threads)
+{
+    // Setup backend capabilities flags
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_impl_soft";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    if (num_threads <= 0)
+        num_threads = ImMax((int)std::thread::hardware_concurrency(), 1);
+    g_NumThreads = num_threads;
+    g_Bins.resize(num_threads);
+
+    g_WorkersQuit = false;
+    for (int n = 1; n < num_threads; n++)
+        g_Workers.emplace_back(ImGui_ImplSoft_WorkerMain, n);
+
+    return true;
+}
+
+void    ImGui_ImplSoft_Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_WorkMutex);
+        g_WorkersQuit = true;
+    }
+    g_WorkCond.notify_all();
+    for (std::thread& worker : g_Workers)
+        worker.join();
+    g_Workers.clear();
+
+    ImGui_ImplSoft_InvalidateDeviceObjects();
+    g_NumThreads = 0;
+    g_Bins.clear();
+    g_Batches.clear();
+    g_Triangles.clear();
+}
+
+void    ImGui_ImplSoft_NewFrame()
+{
+    if (!g_FontTexture.Pixels)
+        ImGui_ImplSoft_CreateDeviceObjects();
+}
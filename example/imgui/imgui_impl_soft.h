@@ -0,0 +1,44 @@
+// dear imgui: Renderer Backend for a CPU software rasterizer
+// This needs no GPU and no Platform Backend: draw data is rasterized into a caller-owned RGBA buffer (headless tests, benchmarks, CI)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoft_Texture*' as ImTextureID (see ImGui_ImplSoft_GetTextureID). Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded tile binning and rasterization, SSE2 accelerated. The output doesn't depend on the thread count or on SSE2.
+
+// Output pixels are RGBA8 in the IM_COL32 layout (R in the lowest byte), blended like the GPU backends:
+//   rgb = src.rgb * src.a + dst.rgb * (1 - src.a), a = src.a + dst.a * (1 - src.a)
+// Textures are sampled bilinearly with clamp-to-edge addressing. Vertices are snapped to 1/16 pixel, pixel centers are at +0.5 and
+// edges follow the top-left rule, so triangles sharing an edge never blend a pixel twice.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#include <stdint.h>     // intptr_t
+
+// A texture the rasterizer can sample, pixels are owned by the caller and must outlive the frames using it
+struct ImGui_ImplSoft_Texture
+{
+    const ImU32*    Pixels;     // RGBA8, IM_COL32 layout, Width * Height
+    int             Width;
+    int             Height;
+};
+
+// num_threads: workers binning and rasterizing tiles (including the calling thread), 0 for one per hardware thread.
+IMGUI_IMPL_API bool     ImGui_ImplSoft_Init(int num_threads = 0);
+IMGUI_IMPL_API void     ImGui_ImplSoft_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoft_NewFrame();
+
+// Blend draw_data over pixels (width * height, stride in pixels between rows, 0 for width). Clear the buffer yourself beforehand.
+// User callbacks are invoked on the calling thread, after everything submitted before them is rasterized.
+IMGUI_IMPL_API void     ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride = 0);
+
+// Use if you want to reset your rendering device without losing Dear ImGui state.
+IMGUI_IMPL_API void     ImGui_ImplSoft_InvalidateDeviceObjects();
+IMGUI_IMPL_API bool     ImGui_ImplSoft_CreateDeviceObjects();
+
+// Works whether ImTextureID is a pointer or a 64-bit integer
+inline ImTextureID      ImGui_ImplSoft_GetTextureID(const ImGui_ImplSoft_Texture* texture) { return (ImTextureID)(intptr_t)texture; }
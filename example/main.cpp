@@ -16,6 +16,7 @@
 #endif
 #include <ctime>
 #include <fstream>
+#include <thread>
 
 struct FrameContext
 {
@@ -69,6 +70,14 @@ void init()
 
 	// Initialize notify
 	ImGui::MergeIconsWithLatestFont(16.f, false);
+
+	// Optional: build the atlas now, later launches restore it from this file instead of rasterizing every glyph again
+	ImGui::BuildFontAtlasCached("imgui_fonts.cache");
+
+#ifdef NOTIFY_USE_JOURNAL
+	// Optional: keep every toast on disk (notifications.idx/.str), previous sessions show up in the history window
+	ImGui::OpenNotificationJournal("notifications");
+#endif
 }
 
 void render()
@@ -107,6 +116,57 @@ void render()
 		{
 			ImGui::InsertNotification({ ImGuiToastType_Info, 3000, "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation" });
 		}
+
+		if (ImGui::Button("Counter (updated in place)"))
+		{
+			static ImGuiToastHandle counter = 0;
+			static int clicks = 0;
+
+			if (!ImGui::UpdateNotification(counter, "Clicked %d times", ++clicks))
+				counter = ImGui::InsertNotification({ ImGuiToastType_Info, 3000, "Clicked %d times", clicks = 1 });
+		}
+
+		ImGui::SameLine();
+		if (ImGui::Button("Progress (worker thread)"))
+		{
+			static std::atomic<float> progress = 1.f;
+
+			if (progress.load() >= 1.f)
+			{
+				progress = 0.f;
+
+				ImGuiToast toast(ImGuiToastType_Info, 1000, "Working in the background...");
+				toast.set_progress(&progress);
+				ImGui::InsertNotification(toast);
+
+				std::thread([] {
+					for (int step = 1; step <= 100; step++)
+					{
+						std::this_thread::sleep_for(std::chrono::milliseconds(30));
+						progress.store(step / 100.f, std::memory_order_relaxed);
+					}
+				}).detach();
+			}
+		}
+
+		ImGui::SameLine();
+		if (ImGui::Button("Actions"))
+		{
+			ImGuiToast toast(ImGuiToastType_Error, 5000, "Upload failed");
+			const int attempt = 1;
+			toast.add_action("Retry", [](ImGuiToastHandle, int, void* user_data) { NOTIFY_LOG(ImGuiNotifyLogLevel_Warning, "upload", "Retrying (attempt %d)...", *(int*)user_data + 1); }, &attempt, sizeof(attempt)); // Runs on the executor thread: log, don't insert
+			toast.add_action("Dismiss", [](ImGuiToastHandle, int, void*) {});
+			ImGui::InsertNotification(toast);
+		}
+
+		ImGui::SameLine();
+		if (ImGui::Button("Markup"))
+		{
+			ImGuiToast toast(ImGuiToastType_Success, 5000);
+			toast.set_markup(true);
+			toast.set_content("Deployed **v%d.%d** to {#40C0FF}staging{/} " ICON_FA_ROCKET "\n{error}%d checks failed{/}, see the log", 2, 4, 2);
+			ImGui::InsertNotification(toast);
+		}
 	}
 
 	if (ImGui::CollapsingHeader("Do it yourself", ImGuiTreeNodeFlags_DefaultOpen))
@@ -160,8 +220,20 @@ void render()
 		}
 	}
 
+	static bool show_history = false;
+	ImGui::Checkbox("Show history", &show_history);
+
+	static bool show_metrics = false;
+	ImGui::Checkbox("Show metrics", &show_metrics);
+
 	ImGui::End();
 
+	if (show_history)
+		ImGui::ShowNotificationHistory(&show_history);
+
+	if (show_metrics)
+		ImGui::ShowMetricsWindowWithNotifications(&show_metrics);
+
 	// Render toasts on top of everything, at the end of your code!
 	// You should push style vars here
 	ImGui::PushStyleVar(ImGuiStyleVar_WindowRounding, 5.f);
@@ -222,6 +294,14 @@ int main(int, char**)
 			continue;
 		}
 
+		// Rasterize icons requested by new toasts (NOTIFY_USE_DYNAMIC_ICONS), the font texture must then be uploaded again
+		if (ImGui::UpdateNotificationIcons())
+		{
+			WaitForLastSubmittedFrame();
+			ImGui_ImplDX12_InvalidateDeviceObjects();
+			ImGui_ImplDX12_CreateDeviceObjects();
+		}
+
 		// Start the Dear ImGui frame
 		{
 			ImGui_ImplDX12_NewFrame();
@@ -275,6 +355,9 @@ int main(int, char**)
 	WaitForLastSubmittedFrame();
 
 	// Cleanup
+#ifdef NOTIFY_USE_JOURNAL
+	ImGui::CloseNotificationJournal();
+#endif
 	ImGui_ImplDX12_Shutdown();
 	ImGui_ImplWin32_Shutdown();
 	ImGui::DestroyContext();
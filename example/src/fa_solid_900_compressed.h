@@ -0,0 +1,2945 @@
+#pragma once
+
+// Font Awesome 5 (solid) TTF, stb-compressed. Load with ImFontAtlas::AddFontFromMemoryCompressedTTF()
+const unsigned int fa_solid_900_compressed_size = 141004;
+const unsigned int fa_solid_900_compressed_data[35251] =
+{
+    0x0000bc57, 0x00000000, 0xf8170300, 0x00000400, 0x00010037, 0x000d0000, 0x00030080, 0x54464650, 0x5dc5944d, 0x170300f1, 0x281582dc, 0x4544471c,
+    0x032a0046, 0x200f82f2, 0x2c0f82bc, 0x2f534f1e, 0x56873332, 0x01000060, 0x360f8258, 0x616d6360, 0xfe6af170, 0x11000034, 0x0c000068, 0x736167ce,
+    0x82ffff70, 0x17032249, 0x381f82b4, 0x796c6708, 0x94c95466, 0x2d0000b9, 0xb30200ec, 0x6165686c, 0xbdd71b64, 0x831b827e, 0x6836215f, 0x04231082,
+    0x822d0643, 0x8214204f, 0x68242813, 0xc478746d, 0x820903d5, 0x00b8300f, 0x6cb00f00, 0x0561636f, 0x00446a03, 0x82381e00, 0x6db4280f, 0x04707861,
+    0x825d014e, 0x2c0f821f, 0x616e2000, 0xb225656d, 0x02001e31, 0x318f82e1, 0x6f702b05, 0xf0027473, 0x02006146, 0x000084e6, 0xdb832e31, 0x854b012f,
+    0x2b7b65e3, 0x3c0f5feb, 0x020b00f5, 0x23008300, 0x8a7b76dc, 0x92280786, 0xb4ffecff, 0xcd019502, 0x08220f82, 0x31830200, 0x012c0982, 0xc0010000,
+    0x0000c0ff, 0xecff8002, 0x95200582, 0x1a821786, 0x03210285, 0x251183ec, 0x5a01ec03, 0x11842000, 0x82000221, 0x20258432, 0x83098240, 0x01042602,
+    0x008403fb, 0x22168205, 0x8266014c, 0x01472110, 0xf5250785, 0x84001900, 0x216a8200, 0x15820305, 0x50290292, 0x00644566, 0xf805e080, 0x248384ff,
+    0x00cc012e, 0x20268254, 0x24038201, 0x013a0100, 0x240782a5, 0x02010020, 0x20008600, 0x824b83aa, 0x86802003, 0x82002003, 0x82002007, 0x20878203,
+    0x22138302, 0x84200040, 0x880b8307, 0xfdff2223, 0x85238b02, 0x22ed8227, 0x82010000, 0x2303830b, 0x0f000002, 0x00200382, 0x01270383, 0x020d00c0,
+    0x8cfbff80, 0x82002047, 0xff802263, 0x821383fa, 0x8300201f, 0x00022103, 0x17832382, 0xff250384, 0x004002fe, 0x8217850f, 0x8517882b, 0x6001210b,
+    0x0720138c, 0x18264782, 0x10000002, 0x17844002, 0x40020824, 0xa388fcff, 0x07000022, 0x00208b8a, 0x08200b82, 0xeb829784, 0xbb860120, 0x1382678c,
+    0x07829384, 0x0124378b, 0x01120080, 0x03825f83, 0xc0201f84, 0x038aef82, 0x0f865384, 0x87850220, 0x85010021, 0x84082043, 0x203785af, 0x87538c40,
+    0x868b822f, 0x0140243f, 0x82f8ffc0, 0x831b2067, 0x83ab8603, 0x20038faf, 0x8a1b8300, 0x82052087, 0x8b05200b, 0x821b8783, 0x86132013, 0x02002547,
+    0x01feff40, 0x820aaf41, 0x82f9200f, 0x83ff2003, 0x0002272b, 0x00020000, 0x4386ffff, 0x80234f85, 0x86020300, 0x200788cb, 0x82278300, 0xff802203,
+    0x823b83fb, 0x880f2017, 0x20438553, 0x204782fd, 0x417f88fd, 0x3f84062f, 0xff214b84, 0x080341fe, 0x01208b82, 0xe78f0382, 0x41f00121, 0xcb410bdf,
+    0x42002006, 0x33820aa3, 0xffc00123, 0x20ff8af5, 0x200b8b00, 0x41878802, 0x0f8505a3, 0x2309e742, 0x07004001, 0x00230383, 0x821700c0, 0x84002003,
+    0x004023f3, 0x0386010d, 0x00202f88, 0x40233f82, 0x8202ffff, 0x0727416f, 0x8d600121, 0xc0012153, 0xff215783, 0x430785fa, 0x9b8e094f, 0x0f821820,
+    0x5f821820, 0x03840020, 0x18000023, 0x20038301, 0x824b8240, 0x43022003, 0x3384066f, 0x8a063b42, 0x01082283, 0x862782f0, 0x848b8503, 0x84082067,
+    0xff80220b, 0x203f84fb, 0x05274100, 0x4f410120, 0x82002005, 0x00182a07, 0x000000c0, 0x021000c0, 0x202f8400, 0x82078400, 0x21c3835f, 0xb3858002,
+    0x41c00121, 0x834105f3, 0x41ef880f, 0x0820058b, 0xc3834782, 0x200f7742, 0x847b8300, 0x06cb429f, 0x07830120, 0x0123d786, 0x84fdff20, 0x008023ef,
+    0x97830113, 0x07821783, 0x01230b83, 0x83feffc0, 0x00022303, 0x0383feff, 0xab850f89, 0x00000123, 0x079b4105, 0x00000223, 0x14c3431b, 0x83069344,
+    0x201f8273, 0x08634410, 0xa3410020, 0x83012005, 0x0617411f, 0x13420220, 0x23ef8508, 0xfcff8001, 0x2382ab84, 0x079a8f84, 0x44061b41, 0x08200747,
+    0x10200f82, 0x20203b82, 0x840cf343, 0x8300205f, 0x8400201b, 0x0a674317, 0x200c2342, 0x89238400, 0x85c02027, 0x200221ef, 0x200a5745, 0x0d8f4540,
+    0x27423f84, 0x8002210e, 0x0225c785, 0x01ffff00, 0x82ef8220, 0x2007886f, 0x0eef41e0, 0x17821b87, 0x2f822384, 0x4f430220, 0x0a434107, 0x0f866784,
+    0x82084b41, 0x8201200f, 0x8301207b, 0x8303832f, 0x41b3870b, 0xfb841233, 0xe343c020, 0x063b4406, 0x2006db41, 0x205384fd, 0x83ff8200, 0x133f4537,
+    0xff219784, 0x0a6b44fa, 0xe7440820, 0x20138307, 0x21338401, 0x1384fdff, 0x6b844382, 0xf5ff8022, 0x00265786, 0xfbff8002, 0xd7410002, 0x40022305,
+    0x1787f9ff, 0xa7423783, 0x86378308, 0x470120cf, 0x0787061a, 0xe3860220, 0x73462f84, 0x83c0200f, 0x0000245b, 0x4300a001, 0x87840803, 0x5f43c020,
+    0x0523420c, 0xff21f784, 0x054f45ff, 0x82ffff21, 0x830d205f, 0x21038453, 0x0b850000, 0x0f82bf87, 0x42107b43, 0xa34106bf, 0x2353820c, 0xfeff4001,
+    0x02200383, 0x3f820b83, 0x82600121, 0x072b428f, 0xfaff8023, 0x23538601, 0x10000002, 0x4020c384, 0x0383ab82, 0x2382d788, 0x4b44c020, 0x07674509,
+    0xa7410120, 0x411b8208, 0x5b4106ef, 0x833f8205, 0x88f0200f, 0x410020f7, 0xa747086b, 0xc0012306, 0x1388feff, 0xeb434787, 0x07e7470e, 0x4108e744,
+    0x0f8406ff, 0x0b833386, 0x3b92bf84, 0x21088b42, 0x4342ff00, 0x01002207, 0x877786e0, 0x200783f3, 0x06734180, 0x46065b48, 0x074108d3, 0x0a434307,
+    0x42800221, 0x078306a3, 0xfeff4022, 0x200a0745, 0x82fb8400, 0x827785f3, 0x245b8553, 0xff2001fa, 0x073745fc, 0x430ccf48, 0x17870a43, 0x48094b43,
+    0x338c09e7, 0x490f4349, 0x00220c63, 0x7f880100, 0x43068341, 0x4f420e2f, 0x8c178208, 0x86578773, 0x82012007, 0x868b85df, 0x824020c7, 0x8f6b825b,
+    0x0cef439f, 0x00225383, 0x6384f8ff, 0x9b419786, 0x07374108, 0x93474783, 0x0002210e, 0x0020ab82, 0x68220382, 0x8b43f5ff, 0x0a874405, 0xffff8022,
+    0x83086742, 0x823f83db, 0x8b9f8367, 0x420120bf, 0x002109c3, 0x46c38402, 0x0b8405d7, 0x4f860020, 0x23482382, 0x0a77420c, 0x830b8b48, 0x2003870b,
+    0x84238202, 0x0617411b, 0xff000225, 0x824002ff, 0x858b8293, 0xfbff214b, 0x900b6747, 0x43f8200b, 0x02210937, 0x099f4100, 0xff462790, 0x87022006,
+    0x862020ab, 0x06a743b3, 0x4f8a2f88, 0x02201387, 0x83068f4a, 0x229f84ab, 0x88feff00, 0x0e8f4a2f, 0xc7835f88, 0x2006fb42, 0x06174101, 0x21093b42,
+    0x0b88faff, 0x00227f83, 0x3788f5ff, 0xfcff1822, 0x67442f87, 0x8580200c, 0xc0012333, 0x8f84f6ff, 0x2b82c784, 0x87412020, 0x20178205, 0x200382fd,
+    0x821b88ed, 0x46012057, 0x8020076f, 0x23096342, 0x00000002, 0x880f1349, 0x82538467, 0x86e0201f, 0x21bf852f, 0x034301fe, 0x0623420f, 0x41089b42,
+    0x278406bb, 0x420e9f45, 0xff230d6f, 0x454002fe, 0x00220a03, 0x8f83f4ff, 0x00201382, 0xaf824b8c, 0x43071f41, 0x5348084f, 0x0583420d, 0x63490020,
+    0x20b38207, 0x0acb4cd0, 0x00000022, 0x84078747, 0x82af8b47, 0xc001231b, 0xf344fdff, 0x21eb8208, 0x2f82c001, 0x20004022, 0xfd203382, 0xc3828f84,
+    0x0387cb83, 0x17849f88, 0x200a4b41, 0x06db4540, 0xf2ff8022, 0x8024bf88, 0x0002faff, 0x82069745, 0x206b82b3, 0x215782ff, 0x2b8202fa, 0x0b820382,
+    0x460e7f41, 0x63840603, 0x5f820b84, 0x3741af82, 0x84bf870c, 0x0d834817, 0x17827784, 0xff430120, 0x057f4808, 0x21073741, 0xc7490002, 0x08034405,
+    0x1f824020, 0x23858020, 0x37843b84, 0x84056f43, 0x000022b7, 0x20338220, 0x200382fc, 0x097b45ff, 0x82052f41, 0x84f7200f, 0x09f34a23, 0x8f822b82,
+    0xf9ff0022, 0x20082f41, 0x87ff83c0, 0x471b84c3, 0x6f83086f, 0x03462787, 0x20a78307, 0x42df8b02, 0x1f85064b, 0xf5223f84, 0xaf448001, 0x846f8508,
+    0x20b3820f, 0x44ab82c0, 0x4f830e97, 0xbf440387, 0x0cd34d0c, 0x89092341, 0x16f74a23, 0x220b7341, 0x86fcff80, 0x8308208b, 0x00002337, 0x03860300,
+    0x01001c22, 0x00240982, 0x0300c40a, 0x1c240984, 0xa80a0400, 0xd80ab582, 0x000002a6, 0xe0a60008, 0xe041e005, 0xf086e076, 0xf005f002, 0xf013f00e,
+    0xf019f015, 0xf01ef01c, 0xf044f03e, 0xf05bf04e, 0xf06ef05e, 0xf080f07c, 0xf089f086, 0xf091f08d, 0xf098f095, 0xf0a1f09e, 0xf0b2f0ae, 0xf0d1f0ce,
+    0xf0e0f0de, 0xf0ebf0e3, 0xf1fef0f4, 0xf10ef10b, 0xf11cf111, 0xf122f11e, 0xf131f12e, 0xf13af135, 0xf144f13e, 0xf14bf146, 0xf159f14e, 0xf165f15e,
+    0xf188f183, 0xf195f193, 0xf199f197, 0xf1aef19d, 0xf1b3f1b0, 0xf1c9f1bb, 0xf1d8f1ce, 0xf1def1da, 0xf1ecf1e6, 0xf2fef1f6, 0xf207f201, 0xf218f20b,
+    0xf22df21e, 0xf239f236, 0xf24ef249, 0xf26cf25d, 0xf27af277, 0xf28df28b, 0xf295f292, 0xf29ef29a, 0xf2a8f2a4, 0xf2b9f2b6, 0xf2bdf2bb, 0xf2cef2c2,
+    0xf2dcf2d2, 0xf2e7f2e5, 0xf2edf2ea, 0xf2f6f2f2, 0xf3fef2f9, 0xf30cf305, 0xf328f31e, 0xf35bf338, 0xf360f35d, 0xf382f362, 0xf3bff3a5, 0xf3c5f3c1,
+    0xf3cdf3c9, 0xf3ddf3d1, 0xf3e5f3e0, 0xf3faf3ed, 0xf4fff3fd, 0xf410f406, 0xf424f422, 0xf436f434, 0xf43cf43a, 0xf441f43f, 0xf445f443, 0xf44bf447,
+    0xf450f44e, 0xf458f453, 0xf45ff45d, 0xf466f462, 0xf472f46d, 0xf479f474, 0xf482f47f, 0xf48bf487, 0xf494f48e, 0xf49ef497, 0xf4b3f4ad, 0xf4bef4ba,
+    0xf4c4f4c2, 0xf4d3f4ce, 0xf4dff4db, 0xf509f5e3, 0xf59df591, 0xf5a7f5a2, 0xf5b4f5b1, 0xf5bdf5b8, 0xf5cbf5c5, 0xf5d2f5ce, 0xf5daf5d7, 0xf5dff5dc,
+    0xf5e4f5e1, 0xf5ebf5e7, 0xf6fdf5ee, 0xf610f604, 0xf619f613, 0xf621f61f, 0xf637f630, 0xf641f63c, 0xf647f644, 0xf64ff64a, 0xf655f651, 0xf65ef658,
+    0xf666f662, 0xf66df66b, 0xf674f66f, 0xf679f676, 0xf67ff67c, 0xf689f684, 0xf69bf696, 0xf6a7f6a1, 0xf6adf6a9, 0xf6bbf6b7, 0xf6c0f6be, 0xf6cff6c4,
+    0xf6d3f6d1, 0xf6d7f6d5, 0xf6def6d9, 0xf6e6f6e3, 0xf6edf6e8, 0xf6faf6f2, 0xf700f7fc, 0xf70ef70c, 0xf717f715, 0xf722f71e, 0xf72ff729, 0xf740f73d,
+    0xf747f743, 0xf753f74d, 0xf75bf756, 0xf769f75f, 0xf773f76b, 0xf781f77d, 0xf788f784, 0xf794f78c, 0xf79cf796, 0xf7a2f7a0, 0xf7abf7a6, 0xf7b6f7ae,
+    0xf7bdf7ba, 0xf7c2f7c0, 0xf7caf7c5, 0xf7d0f7ce, 0xf7daf7d2, 0xf7ecf7e6, 0xf7f2f7ef, 0xf7f7f7f5, 0xf807f8fb, 0xf810f80d, 0xf816f812, 0xf82af818,
+    0xf83ef82f, 0xf84cf84a, 0xf853f850, 0xf86df863, 0xf87df879, 0xf887f882, 0xf897f891, 0xf8ccf8c1, 0xfffff8d9, 0xe00000ff, 0xe041e005, 0xf085e059,
+    0xf004f000, 0xf010f007, 0xf017f015, 0xf01ef01c, 0xf041f021, 0xf050f048, 0xf060f05e, 0xf080f070, 0x06a74283, 0xf0934408, 0xf09cf098, 0xf0a3f0a0,
+    0xf0c0f0b0, 0xf0d6f0d0, 0xf0e2f0e0, 0xf0f0f0e7, 0xf100f1f8, 0xf110f10d, 0xf11ef118, 0xf124f120, 0xf133f130, 0xf13df137, 0xf146f140, 0xf14df14a,
+    0xf15bf150, 0xf182f160, 0x4291f185, 0x480806a7, 0xf1abf19c, 0xf1b2f1b0, 0xf1c0f1b8, 0xf1d8f1cd, 0xf1dcf1da, 0xf1eaf1e0, 0xf2f8f1f6, 0xf204f200,
+    0xf217f20a, 0xf221f21a, 0xf238f233, 0xf24df240, 0xf26cf251, 0xf279f271, 0xf28df28b, 0xf295f290, 0xf29df29a, 0xf2a7f2a0, 0x06a742b5, 0xc7f2c126,
+    0xdbf2d0f2, 0x3208a742, 0xf2f5f2f1, 0xf3fef2f9, 0xf309f302, 0xf328f31e, 0x4258f337, 0x812406a7, 0xbef3a5f3, 0x2420a742, 0xf436f433, 0x16a74239,
+    0x5ff45c3c, 0x66f461f4, 0x70f468f4, 0x77f474f4, 0x81f47df4, 0x8bf484f4, 0x90f48df4, 0xa74296f4, 0xb82a0806, 0xc0f4bdf4, 0xcdf4c4f4, 0xd6f4d3f4,
+    0xe2f4def4, 0x15f5faf4, 0x9ff593f5, 0xaaf5a4f5, 0xb6f5b3f5, 0xbff5baf5, 0xcdf5c7f5, 0xa742d0f5, 0x42de2006, 0xfc200aa7, 0x240ca742, 0xf637f62e,
+    0x0ca7423b, 0x58f6532a, 0x62f65df6, 0x69f664f6, 0x2e08a742, 0xf67bf678, 0xf681f67f, 0xf696f687, 0x42a0f698, 0xb62006a7, 0x2006a742, 0x0ca742c3,
+    0xe2f6dd36, 0xe8f6e6f6, 0xf0f6ecf6, 0xfcf6faf6, 0x0bf7fff6, 0x14f70ef7, 0x2406a742, 0xf72ef728, 0x0ca7423b, 0xf75a3a08, 0xf769f75e, 0xf772f76b,
+    0xf780f77c, 0xf786f783, 0xf793f78c, 0xf79cf796, 0xf7a2f79f, 0xf7a9f7a4, 0xf7b5f7ad, 0xf7bdf7b9, 0xf7c2f7bf, 0xf7c9f7c4, 0xf7d0f7cc, 0xf7d7f7d2,
+    0x0aa742e4, 0x05f8fa2e, 0x0ff80df8, 0x15f812f8, 0x29f818f8, 0x2a12a742, 0xf881f87b, 0xf891f884, 0x42c0f897, 0xa60a07a7, 0xc31ffe1f, 0x9e1fac1f,
+    0x24102510, 0x22102310, 0x20102110, 0x1d101e10, 0x19101b10, 0x15101610, 0x12101310, 0x0e101110, 0x0a100c10, 0x04100710, 0x01100310, 0xfd0ffe0f,
+    0xfb0ffc0f, 0xed0fee0f, 0xe80fe90f, 0xe40fe70f, 0xdd0fe00f, 0xdb0fdc0f, 0xd40fda0f, 0xd20fd30f, 0xd00fd10f, 0xce0fcf0f, 0xcb0fcc0f, 0xc70fca0f,
+    0xc50fc60f, 0xc30fc40f, 0xa60fa70f, 0x9d0f9e0f, 0x9b0f9c0f, 0x8c0f990f, 0x8a0f8b0f, 0x820f860f, 0x760f7f0f, 0x740f750f, 0x700f730f, 0x660f670f,
+    0x630f650f, 0x560f610f, 0x530f550f, 0x4d0f4e0f, 0x440f470f, 0x340f420f, 0x2f0f300f, 0x1e0f1f0f, 0x1a0f1c0f, 0x140f160f, 0x110f130f, 0x030f050f,
+    0x010f020f, 0xfa0efe0e, 0xf10ef90e, 0xe80ee90e, 0xe40ee60e, 0xdf0ee10e, 0xd90edd0e, 0xd30ed60e, 0xb90ec20e, 0x8c0eab0e, 0x890e8b0e, 0x6a0e880e,
+    0x300e480e, 0x2c0e2f0e, 0x260e290e, 0x180e230e, 0x120e160e, 0xff0d0b0e, 0xfc0dfd0d, 0xed0df60d, 0xdb0ddc0d, 0xcc0dcd0d, 0xc90dca0d, 0xc60dc70d,
+    0xc40dc50d, 0xc00dc30d, 0xbd0dbe0d, 0xb70dbb0d, 0xb30db40d, 0xaf0db20d, 0xac0dae0d, 0xa90dab0d, 0xa50da60d, 0xa10da40d, 0x9f0da00d, 0x980d9e0d,
+    0x850d8a0d, 0x7f0d810d, 0x7d0d7e0d, 0x710d750d, 0x6d0d6f0d, 0x550d6b0d, 0x490d4a0d, 0x470d480d, 0x440d450d, 0x420d430d, 0x400d410d, 0x3e0d3f0d,
+    0x380d3a0d, 0x360d370d, 0x330d350d, 0x2e0d310d, 0x1f0d2c0d, 0x0e0d190d, 0x070d0c0d, 0x010d020d, 0xef0cf50c, 0xe80cec0c, 0xe40ce60c, 0xde0ce20c,
+    0xdc0cdd0c, 0xd60cda0c, 0xd20cd30c, 0xcf0cd00c, 0xca0cce0c, 0xc80cc90c, 0xc50cc70c, 0xc20cc40c, 0xb50cb60c, 0xac0cb10c, 0xa80cab0c, 0x9d0ca00c,
+    0x9a0c9b0c, 0x8e0c980c, 0x8c0c8d0c, 0x8a0c8b0c, 0x860c890c, 0x810c830c, 0x7d0c800c, 0x740c7b0c, 0x710c730c, 0x660c670c, 0x600c610c, 0x570c5a0c,
+    0x4e0c520c, 0x410c430c, 0x3c0c3f0c, 0x320c370c, 0x2d0c300c, 0x220c2b0c, 0x1b0c210c, 0x110c130c, 0x0f0c100c, 0x060c0c0c, 0x000c050c, 0xfd0bfe0b,
+    0xfa0bfc0b, 0xf30bf90b, 0xef0bf10b, 0xed0bee0b, 0xe90bec0b, 0xe70be80b, 0xe20be60b, 0xd40bd90b, 0xd00bd20b, 0xcd0bce0b, 0xc20bcb0b, 0xbc0bbd0b,
+    0xb90bbb0b, 0xa80bb80b, 0x960ba40b, 0x8a0b8b0b, 0x850b870b, 0x6d0b760b, 0x610b620b, 0x5d0b5e0b, 0x4f0b540b, 0x1d0b270b, 0xec0a110b, 0x10000100,
+    0xa5020000, 0x0a020623, 0x21008200, 0xb1420001, 0x00012310, 0x00850002, 0x00200787, 0x01200096, 0x00101796, 0x218c0116, 0x8e41eb03, 0x00b02c32,
+    0x00980100, 0x00300500, 0x82100700, 0x9c280803, 0x64080000, 0xd4090000, 0x940b0000, 0x700c0000, 0x7c0d0000, 0x740e0000, 0x680f0000, 0x08100000,
+    0x54110000, 0x14120000, 0xec230382, 0x82150000, 0x1c162472, 0x82160000, 0xa417302f, 0x44180000, 0x8c190000, 0x581a0000, 0x821b0000, 0x281c3817,
+    0xd81c0000, 0xa81d0000, 0x701e0000, 0x741f0000, 0x90200000, 0x82210000, 0x8223200f, 0x60242577, 0x80250000, 0xcc240382, 0x2c260000, 0x94200382,
+    0xdc240382, 0x38270000, 0x27820382, 0x00e02824, 0x4f822900, 0x00fc2a24, 0x03822b00, 0x00482c28, 0x00bc2c00, 0x37822d00, 0x00e42d24, 0x3b822e00,
+    0x6b822f20, 0x3b823020, 0x00e83024, 0x7f823100, 0x00f83128, 0x00a43200, 0x9b823300, 0x4f823320, 0x77823420, 0x003c3529, 0x00983500, 0x820c3600,
+    0x29578203, 0x0000cc36, 0x00004037, 0x03823038, 0x0000b024, 0x03827c39, 0x0000d024, 0x0382543a, 0x0000f023, 0x20bb823b, 0x2067823b, 0x2437823c,
+    0x0000c03c, 0x2457823d, 0x0000ac3d, 0x20bf823e, 0x249b823f, 0x0000e83f, 0x204f8240, 0x248f8241, 0x0000f841, 0x24038242, 0x0000c843, 0x20138244,
+    0x243f8244, 0x00006445, 0x242f8245, 0x0000e045, 0x24238246, 0x0000f446, 0x20378247, 0x208f8247, 0x203b8247, 0x205f8248, 0x25738248, 0x0000b448,
+    0x03820849, 0x03826820, 0x4a208782, 0x4a209f82, 0x4a20cf82, 0x4b24bf82, 0x4b000004, 0x4b207782, 0x4c247f82, 0x4c000018, 0x4d204f82, 0x4d253782,
+    0x4e0000fc, 0x82038250, 0x824f203b, 0x784f2817, 0xdc4f0000, 0x82500000, 0x825020cf, 0x8251205b, 0x825120df, 0x28522983, 0xd4520000, 0x34530000,
+    0xec230382, 0x82540000, 0x82542093, 0x825520a3, 0x8256203b, 0x88562447, 0x82570000, 0x14582463, 0x82580000, 0x00592563, 0xa8590000, 0xab820382,
+    0x4b825a20, 0x1b825b20, 0x008c5b24, 0x33825b00, 0x4b825c20, 0x0f825d20, 0x00d85d24, 0x3f825e00, 0x00d06024, 0x07826100, 0x1f826120, 0xbf826220,
+    0x23826220, 0x87826320, 0x00206424, 0x07826400, 0x2b826520, 0x00706524, 0x77826500, 0x0f826620, 0x5b826720, 0xfb826720, 0xdb826820, 0xe3826920,
+    0x6f826920, 0x00746a24, 0x57826b00, 0x009c6b25, 0x82106c00, 0x82842003, 0x00f82703, 0x00c46d00, 0xf7826e00, 0x00606f28, 0x00a06f00, 0xe3827000,
+    0x2f827020, 0x6b827120, 0x4b827220, 0x00cc7225, 0x82387300, 0x00e02303, 0x23827400, 0x5b827520, 0x007c752c, 0x00b47500, 0x003c7600, 0x8f827700,
+    0x4b827820, 0x6b827920, 0x1b827a20, 0x00687a24, 0x8f827b00, 0x00b07b24, 0x37827c00, 0x826c7c21, 0x24578207, 0x0000d47c, 0x2017827d, 0x2127827d,
+    0x0b82ac7d, 0x0000dc23, 0x209b827e, 0x2427827e, 0x00002c7f, 0x20eb827f, 0x20078280, 0x20238281, 0x20df8281, 0x2d478282, 0x0000f482, 0x0000e883,
+    0x0000b884, 0x03822485, 0x86244782, 0x8700001c, 0x8820c782, 0x88203b82, 0x89245382, 0x89000050, 0x8a242782, 0x8a000080, 0x8b280782, 0x8b000078,
+    0x8c0000fc, 0x8d200f82, 0x8d254b82, 0x8d00004c, 0x82038294, 0x828e20bf, 0x988e2437, 0x828f0000, 0x828f20ff, 0x828f20cb, 0x8290207b, 0x829020fb,
+    0x8891248b, 0x82910000, 0x82922097, 0xa4922423, 0x82930000, 0xa89324d7, 0x82950000, 0x8396200f, 0x009c2303, 0xcf829700, 0x00c49724, 0xe7829800,
+    0x04829820, 0x007c9925, 0x82489a00, 0x20bb8203, 0x2447829b, 0x0000909b, 0x20ef829c, 0x200b829d, 0x20ab829d, 0x2063829e, 0x242b829f, 0x0000c09f,
+    0x203b82a0, 0x20cb82a0, 0x209782a1, 0x288b82a1, 0x000040a2, 0x0000a0a2, 0x20a382a3, 0x203f82a3, 0x202b82a4, 0x24f782a4, 0x000018a5, 0x25fb82a5,
+    0x000014a6, 0x03825ca6, 0x0000b424, 0x038220a7, 0xa8288b82, 0xa8000064, 0xa90000cc, 0xa9208f82, 0xa9204782, 0xaa20b782, 0xab208782, 0xab243382,
+    0xac0000d0, 0xac282f82, 0xad0000f4, 0xae000074, 0xae248b82, 0xaf0000e4, 0xb020d782, 0xb1249382, 0xb2000050, 0xb3208382, 0xb4244b82, 0xb400000c,
+    0xb5242782, 0xb60000b8, 0xb620c382, 0xb7242782, 0xb800004c, 0xb820ab82, 0x08820783, 0x0078b929, 0x00d4b900, 0x8210ba00, 0x245b8203, 0x000070bb,
+    0x200b82bc, 0x20ff82bc, 0x206782bd, 0x203f82bd, 0x25a382bf, 0x000034c0, 0x038224c1, 0xc220cb82, 0xc224f782, 0xc30000ac, 0xc420cb82, 0xc5200382,
+    0xc6240382, 0xc6000030, 0xc7244f82, 0xc800001c, 0xc8207782, 0xc9244b82, 0xca000084, 0xca20c382, 0xcb20db82, 0xcc2cc782, 0xcc000054, 0xcd0000ec,
+    0xce0000f8, 0xce251b82, 0xcf0000f0, 0x82038248, 0xa8d02813, 0x08d10000, 0x82d20000, 0x82d2206b, 0x82d3201b, 0x82d420bf, 0xa0d42487, 0x82d60000,
+    0x82d720d3, 0x82d720b3, 0x58d824c3, 0x82d80000, 0x82da202f, 0x82da201b, 0x82db2057, 0x82db2027, 0x82dc2007, 0x82dc201b, 0x74dd24ab, 0x82de0000,
+    0x82de2023, 0x2cdf2813, 0xc8df0000, 0x82e00000, 0x6ce02883, 0x94e10000, 0x82e20000, 0x38e3241f, 0x82e30000, 0xbce424f3, 0x82e50000, 0x3ce62497,
+    0x82e70000, 0x82e82003, 0x82e920fb, 0x82e9204f, 0x82ea208b, 0x82ea20c7, 0x82eb2087, 0xd8eb2417, 0x82ec0000, 0x82ed2047, 0x82ee2017, 0x82ef202f,
+    0x82ef205f, 0x88f0246b, 0x82f10000, 0x64f12187, 0xa7820782, 0x00b0f228, 0x005cf300, 0xc782f400, 0x2782f420, 0x1b82f520, 0x00dcf525, 0x824cf600,
+    0x206b8203, 0x288f82f7, 0x000098f7, 0x0000fcf7, 0x201382f8, 0x20d382f9, 0x203382f9, 0x206782fa, 0x256382fa, 0x000040fb, 0x038244fc, 0x0000d023,
+    0x248b82fd, 0x0000f8fd, 0x200782fe, 0x254782ff, 0x01009cff, 0x03821c00, 0x01008824, 0x03825401, 0x0100f828, 0x01007802, 0x03823c03, 0x0100b824,
+    0x03822c04, 0x0100e028, 0x01007405, 0x03824406, 0x0100f023, 0x25078207, 0x0100a407, 0x03824808, 0x08253f82, 0x090100e4, 0x82038258, 0x200a2c13,
+    0xfc0a0100, 0xc80b0100, 0x820c0100, 0x340d2413, 0x820d0100, 0xc00e240f, 0x820f0100, 0xdc102c03, 0xec110100, 0x6c130100, 0x82140100, 0x8215206f,
+    0x82162077, 0x60172527, 0x24180100, 0xd4230382, 0x82190100, 0x0c1a2847, 0xac1a0100, 0x821b0100, 0x821c201f, 0x821c208b, 0x821d2033, 0x4c1e246b,
+    0x821e0100, 0x8220200b, 0x8c21254b, 0x90220100, 0x9f820382, 0x00182328, 0x00942301, 0x8b822401, 0x00cc2624, 0xd3822701, 0x07822720, 0x00402825,
+    0x82082901, 0x00b02403, 0x82382a01, 0x20378203, 0x20bf822b, 0x20db822b, 0x203f822c, 0x24df822d, 0x0100bc2d, 0x2023822e, 0x20f7822e, 0x2417822e,
+    0x0100f82e, 0x2573822f, 0x0100802f, 0x03822c30, 0x0100a424, 0x03820031, 0x3120a782, 0x32244782, 0x32010004, 0x32200b82, 0x33209f82, 0x33204b82,
+    0x34203382, 0x34202f82, 0x3520f382, 0x3524d382, 0x360100c4, 0x36208f82, 0x3624e382, 0x370100d8, 0x38207782, 0x38245f82, 0x39010074, 0x39202f82,
+    0x3a20e382, 0x3a252782, 0x3b0100b4, 0x23038214, 0x3c010084, 0x3c242b82, 0x3d0100f4, 0x3d25df82, 0x3e0100dc, 0x8203825c, 0x703f243b, 0x82400100,
+    0x8240204b, 0x8241208b, 0x824220db, 0x824320a3, 0x82442027, 0x3045240f, 0x82450100, 0x824620bb, 0x824720c7, 0x8248200b, 0x82492097, 0x8249204f,
+    0x0c4a24f7, 0x824a0100, 0x824a20ab, 0x504b290b, 0x104c0100, 0x484d0100, 0x3b820382, 0x63824e20, 0x07824e20, 0x00884f24, 0x1f824f01, 0x0060502c,
+    0x00f05001, 0x00e05101, 0x07825201, 0x77825320, 0x00945424, 0xab825501, 0xab825520, 0x83825620, 0x00fc5625, 0x82285801, 0x24338203, 0x01002c59,
+    0x202b8259, 0x2077825a, 0x2567825b, 0x0100905b, 0x0382205c, 0x5d209f82, 0x5e202f82, 0x5f209382, 0x60282782, 0x6001001c, 0x610100a4, 0x61249782,
+    0x620100ac, 0x6220d382, 0x64207782, 0x64244782, 0x650100c0, 0x65205f82, 0x66200782, 0x67241782, 0x68010074, 0x6820a382, 0x6920d782, 0x6a205f82,
+    0x6a20b382, 0x6b206382, 0x6c243782, 0x6c010064, 0x6e253782, 0x6f01003c, 0x23038224, 0x700100b4, 0x70252f82, 0x710100c4, 0x23038238, 0x720100c8,
+    0x7220ff82, 0x7324cb82, 0x74010098, 0x74207782, 0x74201f82, 0x75248f82, 0x760100e8, 0x7724bf82, 0x78010000, 0x78206782, 0x79204782, 0x7a20db82,
+    0x7a244b82, 0x7b0100f8, 0x7b202782, 0x7c240782, 0x7d01009c, 0x7d20cb82, 0x7e206f82, 0x7f240782, 0x800100b0, 0x8120c782, 0x82245b82, 0x82010078,
+    0x84204782, 0x84245782, 0x850100a8, 0x8520a782, 0x86200782, 0x8620a382, 0x87203b82, 0x87245782, 0x880100f0, 0x89204382, 0x8a20f782, 0x8a208b82,
+    0x8b289b82, 0x8b010014, 0x8c0100d4, 0x8c202782, 0x8d20b382, 0x8d200f82, 0x8d204b82, 0x8e283382, 0x8e010058, 0x8f0100d0, 0x90242f82, 0x91010044,
+    0x91200f82, 0x92247b82, 0x92010028, 0x93203382, 0x93201382, 0x94242782, 0x9401004c, 0x95208382, 0x96202782, 0x9720c782, 0x972d5b82, 0x980100a4,
+    0x99010064, 0x9a010084, 0x82038218, 0x389b24a7, 0x829b0100, 0x349c2417, 0x829d0100, 0xcc9d24eb, 0x829e0100, 0x829f2033, 0xc09f2417, 0x82a00100,
+    0x82a02017, 0x82a120c3, 0xdca124f7, 0x82a20100, 0x48a32887, 0xe4a30100, 0x82a40100, 0x82a420bf, 0x82a72007, 0x82a7204b, 0x82a8201b, 0x82a9208b,
+    0x82a92027, 0x7caa258f, 0x04ab0100, 0x3b820382, 0x0054ad28, 0x00ecad01, 0x0b82ae01, 0x0098af24, 0x1782b001, 0x0008b124, 0x6f82b201, 0x6b82b220,
+    0x000cb324, 0x9382b301, 0x6b82b420, 0x00e0b42c, 0x0068b501, 0x006cb601, 0x4b82b701, 0x1b82b820, 0x5b82b820, 0x4f82b920, 0x3f82b920, 0x6f82ba20,
+    0xcf82bb20, 0x4382bc20, 0x4b82bc20, 0x0b82bd20, 0x0090be24, 0x2f82bf01, 0x0050c024, 0x2b82c001, 0x0060c124, 0x5b82c201, 0x1f82c320, 0x2782c420,
+    0x0094c425, 0x8210c501, 0x24578203, 0x01008cc6, 0x29e382c7, 0x0100f8c8, 0x0100d0c9, 0x03824cca, 0x0100f027, 0x01009ccb, 0x248382cc, 0x010044cd,
+    0x206382cd, 0x209f82cf, 0x24b382cf, 0x010020d1, 0x200782d1, 0x245782d2, 0x0100d8d3, 0x206782d4, 0x205f82d5, 0x2cfb82d6, 0x0100fcd6, 0x0100b4d7,
+    0x01001cd8, 0x287b82d9, 0x0100c8da, 0x010098db, 0x20b782dc, 0x286f82dd, 0x010028de, 0x0100a0de, 0x206382df, 0x20bb82df, 0x24c382e0, 0x010054e1,
+    0x244b82e1, 0x010078e2, 0x201382e2, 0x209b82e3, 0x206f82e3, 0x200f82e4, 0x244f82e4, 0x010080e5, 0x20b382e6, 0x201382e6, 0x245382e7, 0x0100c4e7,
+    0x2c3782e8, 0x01000ce9, 0x0100a4e9, 0x010040ea, 0x200b82eb, 0x20af82eb, 0x24ab82ec, 0x0100f8ec, 0x206382ed, 0x209382ee, 0x24a782ee, 0x010064ef,
+    0x203782f0, 0x20e382f0, 0x200782f1, 0x28c782f2, 0x010070f2, 0x010018f3, 0x24a782f4, 0x010030f5, 0x202f82f5, 0x204782f6, 0x206382f6, 0x20f382f7,
+    0x283382f8, 0x0100d0f8, 0x010038f9, 0x206b82fa, 0x24b782fb, 0x010048fc, 0x203382fd, 0x206782fd, 0x39f382fe, 0x02004cff, 0x02000800, 0x0200cc01,
+    0x02007802, 0x02008c03, 0x02000404, 0x03821405, 0x0200f02c, 0x02009006, 0x02007c07, 0x03823808, 0x09200f82, 0x09242382, 0x0a0200e8, 0x0b282782,
+    0x0d0200dc, 0x0e020054, 0x0f202382, 0x11294782, 0x120200b4, 0x13020080, 0x27038250, 0x140200d0, 0x15020084, 0x16283782, 0x170200d8, 0x180200c4,
+    0x19242f82, 0x1a020040, 0x1b204782, 0x1c241f82, 0x1c020034, 0x1d241782, 0x1e0200b8, 0x1f282382, 0x2002009c, 0x21020074, 0x23240b82, 0x2402006c,
+    0x25200b82, 0x26280b82, 0x27020070, 0x29020044, 0x29209382, 0x2b203b82, 0x2d295f82, 0x2d02003c, 0x2e0200a8, 0x8203822c, 0x822f2057, 0x1030248f,
+    0x82300200, 0x8231201f, 0x8232200f, 0x82332037, 0x823420ab, 0x82342033, 0x823520db, 0x2836280b, 0xf4360200, 0x82380200, 0x82382013, 0x823920ab,
+    0x183a249f, 0x823a0200, 0x823b203b, 0x823c206f, 0x823c20e7, 0xb03d253f, 0x483e0200, 0xf8300382, 0xec3f0200, 0xe0400200, 0x58410200, 0x00420200,
+    0xd4230382, 0x82430200, 0x824520f3, 0x8246207f, 0x82472013, 0x82482033, 0x98482477, 0x824a0200, 0x824b2053, 0x244c2417, 0x824c0200, 0x824d207f,
+    0x824e200f, 0x824f202b, 0x824f204b, 0x8250200f, 0x0851247f, 0x82510200, 0x8252209f, 0x0c532427, 0x82530200, 0x64542483, 0x82540200, 0x825620fb,
+    0x82562097, 0x8258206f, 0x8258201b, 0x825920a7, 0x745a28b3, 0xe85a0200, 0x825b0200, 0x1c5d2483, 0x825d0200, 0x825f201f, 0x826020b3, 0x8262202f,
+    0x90632827, 0x50640200, 0x82650200, 0x2c66248b, 0x82670200, 0x8868281b, 0x4c690200, 0x826a0200, 0xc46a246b, 0x826b0200, 0xe46c30db, 0xa86d0200,
+    0x686e0200, 0xb86f0200, 0x82700200, 0x82712077, 0x8271204f, 0x827220a3, 0x827320bb, 0x8274203b, 0x827520a3, 0x82762003, 0xb077285b, 0x34780200,
+    0x82790200, 0x827a20df, 0xa47a24c3, 0x827c0200, 0x827c20d7, 0x827c2037, 0x8c7d244b, 0x827d0200, 0x827f2097, 0xcc7f2413, 0x82800200, 0xd880293f,
+    0x40810200, 0x00820200, 0x43820382, 0x00608324, 0x9b828402, 0x00208524, 0xb7828502, 0x1b828620, 0x23828620, 0x00c08724, 0x1f828802, 0xa7828920,
+    0x63828a20, 0x27828b20, 0x03828c20, 0x00d08d28, 0x00fc8e02, 0x6f828f02, 0xff828f20, 0xbb829020, 0x7f829120, 0x6f829120, 0x00d49225, 0x82709302,
+    0x20978203, 0x201b8293, 0x20c38294, 0x20ff8295, 0x244f8295, 0x02009496, 0x242b8296, 0x02008097, 0x20ff8298, 0x20a38298, 0x204b8299, 0x2013829a,
+    0x207b829b, 0x2d0b829b, 0x0200649c, 0x0200f09c, 0x0200909d, 0x0382309e, 0x9f201382, 0x9f282f82, 0xa00200f8, 0xa10200c8, 0xa4241382, 0xa502006c,
+    0xa6249b82, 0xa702004c, 0xa7206b82, 0xa8207382, 0xa9259782, 0xaa02005c, 0x82038210, 0x82ab203f, 0x82ac2013, 0xa0ad2d7b, 0x8cae0200, 0x78af0200,
+    0x74b00200, 0xa3820382, 0x0782b120, 0x4f82b120, 0x0044b228, 0x00acb202, 0x4f82b302, 0x00820020, 0x01000238, 0x00230080, 0x2500003e, 0x14151632,
+    0x22012b06, 0x2b263426, 0x07820e01, 0x22232733, 0x34013d26, 0x36013b36, 0x17373537, 0x27171615, 0x22108406, 0x8335011f, 0x16322515, 0x3637011d,
+    0x2c080482, 0x012f0614, 0x5e426001, 0x0d400d13, 0x0d0d1313, 0x3d4c3d10, 0x09075d10, 0x17770709, 0x21202022, 0x0b07e718, 0x096e070b, 0x09072007,
+    0x230a836e, 0x425ec08e, 0x1a3c2982, 0x23231d13, 0x6007091d, 0x08140907, 0x30030330, 0x01601408, 0x081e080a, 0x1c0c010a, 0x1c213e83, 0x2e0e860c,
+    0x0000000f, 0xff000008, 0x018002e0, 0x821a0080, 0x002d22b1, 0x24b58236, 0x004e0046, 0x2abb8456, 0x0614011d, 0x012e2123, 0x82070622, 0x113525b6,
+    0x21333634, 0x2522a083, 0xd3823435, 0xc2831d20, 0x32210886, 0x20128617, 0x20088716, 0x24108633, 0x14163220, 0x29ff8206, 0x34363216, 0x14062226,
+    0x84837002, 0x06aefe27, 0x063e543e, 0x2a0b8332, 0x09070002, 0x100840fe, 0x82710f08, 0x080c2204, 0x2105826c, 0x04826f11, 0x03828020, 0x42cffe2d,
+    0x2f422f2f, 0x13131a43, 0x8480131a, 0x372926ed, 0x07092937, 0x31f78201, 0x4cf00709, 0x8008086c, 0x08591b0c, 0x28015908, 0x3c820880, 0x08b84424,
+    0x0383b808, 0x2f223682, 0x36824142, 0x001a1323, 0x2ee78205, 0x018002bf, 0x00a000c1, 0x01b000a8, 0x82590151, 0x230624e1, 0x822f2231, 0x060721e3,
+    0x14250184, 0x16173106, 0x82f28215, 0x20118314, 0x33b98317, 0x2306012f, 0x07232230, 0x26222306, 0x013f3435, 0x22072726, 0x34260a86, 0x36373435,
+    0x16822737, 0x32333624, 0x0a85011f, 0x0b963720, 0x06821686, 0x22833320, 0x0f276782, 0x37171601, 0x85323332, 0x1415220a, 0x827c8e07, 0x06334189,
+    0x07863620, 0x2a840520, 0x2a821420, 0x2c8b0620, 0x0a83378a, 0xb582aa83, 0x23204e8c, 0xcc88c18d, 0xbf8ac182, 0x3421c18b, 0x83db8236, 0x36342203,
+    0x21228e31, 0xed833634, 0x32303322, 0x3122c98e, 0xa8860632, 0x10016108, 0x050b0403, 0x05010304, 0x04050605, 0x0a090204, 0x0304080a, 0x03010309,
+    0x0b050909, 0x1508060e, 0x03010219, 0x0b070e03, 0x0d180301, 0x0802030b, 0x010b0d0a, 0x0c0b0602, 0x0303070b, 0x080d0a0a, 0x09050408, 0x10080506,
+    0x07040613, 0x05090605, 0x04171507, 0x0d070b01, 0x0b160304, 0x02010707, 0x0c3e3c8e, 0x06090c01, 0x0507070a, 0x0612100a, 0xa8020407, 0x1a13131a,
+    0x090e6913, 0x01090e09, 0x5c8f01bf, 0xad080a21, 0x060a215b, 0x5b877482, 0xdba30b20, 0x880d0421, 0xe80d21db, 0x60088c84, 0x090b02de, 0x03010101,
+    0x04060604, 0x04020105, 0x0a080b05, 0x08080402, 0x05090e11, 0x09050a0f, 0x0b0d0b0e, 0x0b020207, 0x0a04180c, 0x04030e07, 0x07060303, 0x04041608,
+    0x010a080c, 0x07151704, 0x05060905, 0x13060407, 0x06050910, 0x07030509, 0x0a090e08, 0x0b070303, 0x0206090c, 0x0a0d0b01, 0x373b8708, 0x0204040d,
+    0x09141703, 0x0b070805, 0x030b0905, 0x03090201, 0x13220c04, 0x4d288583, 0x09090e09, 0x0203360e, 0x08216094, 0x215f900a, 0x5f8e0a08, 0x070b0122,
+    0x04206095, 0xdf20dfa9, 0x00208b84, 0x03310082, 0xc0ff0000, 0xc1010002, 0xa7009f00, 0x0000af00, 0x08e24201, 0x09821720, 0x89430620, 0x43152008,
+    0x22200596, 0x2405a943, 0x010e0706, 0x112e4315, 0x23282d83, 0x0723012a, 0x27222306, 0x4207ad43, 0xad4307eb, 0x28ac4314, 0x16071524, 0x2d823717,
+    0x92430020, 0x0174080e, 0x101101ff, 0x0e080d0f, 0x140e0713, 0x05080819, 0x0f0a0e02, 0x03010506, 0x09060701, 0x01050507, 0x0e0e0c02, 0x0c05050a,
+    0x0d030204, 0x140e060d, 0x211c0b07, 0x04010201, 0x03031304, 0x20040112, 0x03040f10, 0x0f110e0a, 0x0d060401, 0x040a0e11, 0x120d0d04, 0x090e0a0b,
+    0x150b0609, 0x0a05081a, 0x070c0806, 0x041e1c08, 0x100a0e01, 0x17160406, 0x02020909, 0x09213c82, 0x3a3a850e, 0x2892fe12, 0x1c281c1c, 0x0e0e1476,
+    0x59010e14, 0x05110403, 0x1f040305, 0x82070c1a, 0x0c073445, 0x0302040e, 0x0a05040c, 0x020c0e0e, 0x07050501, 0x82070509, 0x0606337d, 0x030e0a0f,
+    0x170a0a05, 0x09070c13, 0x0b070e0a, 0x8c820e12, 0x0e239282, 0x82052010, 0x05113b6a, 0x09040405, 0x04141508, 0x0e0a1106, 0x1c1e0402, 0x0a0d0708,
+    0x1908050e, 0x91830b16, 0x0b09043b, 0x040c0d13, 0x100e0a04, 0x0203070c, 0x0a0e120e, 0x100e0303, 0xfe01041f, 0x228d82e6, 0x826c281c, 0x140e258d,
+    0xffff0300, 0x0806df41, 0x1300094e, 0x00002d00, 0x33032125, 0x3b021e32, 0x21350101, 0x23061415, 0x01262221, 0x011d1632, 0x36343521, 0x2317013b,
+    0x16140622, 0x36322133, 0x012b2634, 0xff800137, 0x178d4000, 0x16250e25, 0x0240fe6e, 0xfe0d1300, 0x01130d40, 0xfe130de0, 0x31280b82, 0x09070f0e,
+    0x60010709, 0x0e2a0583, 0x2001a015, 0xfe1b2a1b, 0x22824080, 0x0d011331, 0x80800d13, 0x0940130d, 0x0d0a0a0d, 0x82004009, 0x84022000, 0x0140298b,
+    0x002300c1, 0x1300004b, 0x47078847, 0x33200877, 0x14238883, 0x47012b06, 0x3d2106b3, 0x05704501, 0xb447a584, 0x82372005, 0x163228a4, 0x0e071415,
+    0x83012b01, 0x013b26ab, 0x32333637, 0x258283a0, 0x40070940, 0x02820907, 0x0a840782, 0x08580128, 0x221c8710, 0x1d83a5fe, 0x202f3724, 0xbc82a02a,
+    0x0c140123, 0x280f834e, 0x0d0b7878, 0x0a100114, 0x24338b06, 0x06400a06, 0x2012820a, 0x241b82a0, 0x0a14640c, 0x27db8206, 0x0d131a26, 0x0f0c0203,
+    0x5822c982, 0x00820008, 0x00000430, 0x8002c0ff, 0x1500c001, 0x73005f00, 0xcb828b00, 0x2206072d, 0x3526022f, 0x36023f34, 0x83021f32, 0x170121a0,
+    0x2222c882, 0x9d46012f, 0x84e58207, 0x013b22de, 0x9bca8332, 0x011c2f0b, 0x15070615, 0x0623030f, 0x27011f14, 0x59823436, 0x020f2222, 0x022a0c82,
+    0x013f3216, 0x0f143105, 0x708e3101, 0x02156b29, 0x31150208, 0x87310404, 0x3b013408, 0xc61e0d26, 0x087d0f18, 0x0c141117, 0x131a1318, 0x8e081008,
+    0x060d3305, 0x01260f01, 0x01151501, 0x1e020278, 0x0204020c, 0x08871e0c, 0x89400121, 0x2054874b, 0x21618601, 0x6b870404, 0xfe340982, 0x141d10c3,
+    0x110d0bac, 0xf1201117, 0x0d13130d, 0xb8080898, 0xb8230783, 0x86980808, 0x8348200f, 0x01b03207, 0x0b060102, 0x0f260101, 0x0a300b01, 0x05027f01,
+    0x216e8501, 0x77850501, 0x568b5020, 0x33086a86, 0x06000000, 0xc0ff2000, 0xc1012102, 0x16000700, 0x97005200, 0xa7009f00, 0x22240000, 0x32363426,
+    0x07271416, 0x17013e37, 0x1415011e, 0x2326010f, 0x012e0722, 0x21055f41, 0x17891715, 0x14151426, 0x013f3233, 0x0f8e2788, 0x010e022a, 0x2230011d,
+    0x17163225, 0x06261982, 0x1422012b, 0x0c96013b, 0x3536272b, 0x35272634, 0x013f3634, 0x063b4836, 0x37880682, 0x86123321, 0x49002096, 0x023d0677,
+    0x1c1c2804, 0x10e91c28, 0x090e0315, 0x0f010c09, 0xe2080a09, 0x140f221c, 0x023c020e, 0x2f11830f, 0x02060827, 0x080f032f, 0x2c010d09, 0x22010608,
+    0x222f2785, 0x023c2f4a, 0x0e09a901, 0xa00a0e02, 0x847f0808, 0x08802308, 0x08845f08, 0x1d21d02f, 0x301c2406, 0x04036c25, 0x2f110e0a, 0x821484c7,
+    0x1a45271d, 0x131a1313, 0x73849cfe, 0x7782e020, 0x12281c3a, 0x0a084205, 0x0a0d0101, 0x03300403, 0x213810d2, 0x0e0d0a71, 0x09be320a, 0x0e291482,
+    0x7a040409, 0x06080101, 0x210d8697, 0x0d828a03, 0x836b0521, 0x2e1b8230, 0x10176c03, 0x321a3351, 0x0203080b, 0x8c100e0a, 0x0e123006, 0x052c1d10,
+    0x0d40291a, 0x0a0e0121, 0x86110512, 0x1001211d, 0x13238082, 0x848dfe1a, 0x8200207c, 0x00023800, 0x02c0ff00, 0x00c00181, 0x004c0037, 0x36372500,
+    0x23263435, 0x43020f22, 0x223207dd, 0x35260127, 0x36013f34, 0x011f3233, 0x013b3637, 0x05831707, 0x11440c82, 0x27262a08, 0x07013325, 0x2f222306,
+    0x4b048401, 0x013406c5, 0x09051a67, 0x1b050607, 0x064b0121, 0x08051403, 0xb3fd0405, 0x26080886, 0x0d091575, 0x581a4c54, 0x0d560d09, 0x07703709,
+    0x62070909, 0x18fe1204, 0x097e0108, 0x0a0d120b, 0x171f1312, 0x82825b11, 0x18fc2917, 0x09070705, 0xff1e1904, 0x05254082, 0x01030619, 0x390886c7,
+    0x4509155b, 0x09085114, 0xc0070937, 0x0f170a06, 0x0ad8feba, 0x1810080e, 0x1082520e, 0x00090724, 0xdb820600, 0xdb84bf20, 0x0f00073f, 0x24001d00,
+    0x5b002c00, 0x33110000, 0x06141517, 0x2236012b, 0x32161406, 0x35173436, 0x22bc8a05, 0x82113325, 0x3a3522bf, 0x05914b01, 0x07412520, 0x26152321,
+    0x3641012f, 0x18072e06, 0x400d1348, 0x09090e37, 0x0140090e, 0x26ca8a16, 0x40608e01, 0x8429130d, 0xeffe2119, 0x2f1f1041, 0x1a920404, 0x06070905,
+    0x38400104, 0x40130da8, 0x09244e82, 0xd78f170e, 0xe024df86, 0x0d1300ff, 0x8c201384, 0x24191541, 0x760305c2, 0x22d98218, 0x8200040a, 0x45082000,
+    0x072e0817, 0x17000f00, 0x27001f00, 0x50002f00, 0xab435800, 0x43062009, 0x26200614, 0x4c08944c, 0x3620059c, 0x2728178e, 0x06141516, 0x2315012b,
+    0x8505e245, 0x2635210b, 0x23062946, 0x26011e17, 0x27060648, 0x0e147202, 0x620e140e, 0x32200584, 0x8e200584, 0x14820584, 0x11850282, 0x1303333e,
+    0x0d60200d, 0x600d1313, 0xe0401a26, 0x2a507040, 0x0e1d5934, 0x131ac435, 0x90131a13, 0x7e202a84, 0x46200584, 0x5a200584, 0x76200584, 0x36200584,
+    0x3b250584, 0x130d0706, 0x2c2c8220, 0xb120261a, 0x7050553a, 0x9914292f, 0x210f8225, 0x03421a13, 0x00202e0b, 0x00300028, 0x004b0038, 0x25000053,
+    0x23c48217, 0x2306010f, 0x240cde42, 0x32013b36, 0x23c08216, 0x27061617, 0x21050743, 0x31440407, 0x86062006, 0x14042407, 0x89013b16, 0x053724f2,
+    0x41042223, 0x0122061f, 0xe642b4c6, 0x3127220f, 0x2ccd853b, 0x9c0f0706, 0x0f0d1307, 0x146a0109, 0x20b5820e, 0x2105844e, 0xf587e0fe, 0x3f011526,
+    0x2b010d14, 0x81211584, 0x0fe9428b, 0x83211e21, 0x0e0e29d2, 0x09096a1b, 0x840c130d, 0x4e20f684, 0x11220584, 0xf685131a, 0xf6282e23, 0x3d118408,
+    0xff040000, 0x02c0fffc, 0x00c00100, 0x00170007, 0x0036001f, 0x37361100, 0x35231517, 0xf6820526, 0x27213124, 0xe986013e, 0x2007aa41, 0x05cb4117,
+    0xd3410720, 0x0e073606, 0x35012b01, 0x03010721, 0x0243a0dc, 0xeffe0300, 0x3e6716e2, 0x0a984142, 0x09073027, 0x0a950709, 0x3706838b, 0x21070180,
+    0x00019215, 0x0e080110, 0xb1c3a10e, 0x0606013d, 0x4537a401, 0x24098741, 0x090e09a3, 0x25038220, 0xc0181404, 0xa3470030, 0x279f8505, 0x0029000f,
+    0x24000079, 0x830e6342, 0x076b48a7, 0x42211521, 0x27200b5c, 0x2d05fe48, 0x013f2622, 0x22263436, 0x2606010f, 0x0882013d, 0x011d0627, 0x012f0614,
+    0x22c88226, 0x8216011f, 0x21d1853b, 0x21821632, 0x32161422, 0x16202d82, 0x16222182, 0x2d823632, 0x21823620, 0x2d824682, 0x01333622, 0x02829682,
+    0x2e05b343, 0x13033d01, 0x1a26200d, 0x4000ff40, 0x844a5070, 0x838720ef, 0x160c2be2, 0x05090f10, 0x08050d0a, 0x2d82280f, 0x080f282b, 0x050a0d05,
+    0x16100f09, 0x201e9d0c, 0x205e84d0, 0x32058449, 0x0d07065a, 0x261a4013, 0x5639b140, 0x292f7050, 0xac159815, 0x4c6a904b, 0x402e0823, 0x2b00c001,
+    0x41003300, 0x16250000, 0xf2820617, 0x2f260723, 0x06424a01, 0x07013d23, 0x260e8306, 0x37343526, 0x51323625, 0x26200a4b, 0x08070145, 0x35363247,
+    0x012b2634, 0x14150622, 0x3b023316, 0x03010104, 0x06060516, 0x0d131005, 0x130d80fe, 0x07050510, 0x05041605, 0x1e0c0001, 0x0709650c, 0xc6090740,
+    0x34262634, 0x09073026, 0x28402838, 0xd4070938, 0x05060705, 0x3b388318, 0x130dd20e, 0x0ed20d13, 0x04010103, 0x07060518, 0x0a0ae205, 0x0907345a,
+    0x08880709, 0x262a3282, 0x0709ea34, 0x28383828, 0xbe820907, 0x44030021, 0x33240897, 0x51004d00, 0x1523bf82, 0x83262223, 0x222322b2, 0x0679462f,
+    0xb743b28b, 0x22232205, 0x21b08607, 0xb182011d, 0x16320522, 0x894a0782, 0x08b54a0a, 0x23352328, 0xb0100115, 0xbd82130d, 0x12050635, 0x0ad40504,
+    0x09580a1b, 0x09072007, 0x0604053b, 0x84121b89, 0x07093dcd, 0x0605a501, 0xd6fe1219, 0x05061912, 0xe60c1125, 0xc030110c, 0x0d1380a0, 0x040313a4,
+    0xbb243b84, 0x274e0909, 0x6028c583, 0x05060534, 0x25150804, 0x402e0c83, 0x06a00907, 0x19120a05, 0x050a1219, 0xf983a006, 0x9090a022, 0x0620d882,
+    0xb634d782, 0xc0018002, 0x39000b00, 0x91008900, 0xc7009900, 0x26010000, 0x3637b983, 0x1632013b, 0x33160315, 0x0f063732, 0x35260601, 0x37363734,
+    0x8333083e, 0x232626c6, 0x1f140622, 0x07884301, 0x36140628, 0x012f2206, 0xe0830626, 0x3d262225, 0x82263401, 0x26222831, 0x36013f34, 0x82012b26,
+    0x204c8308, 0x26218236, 0x1f323634, 0x4a361601, 0x162008bf, 0x32222182, 0x2d821416, 0x6e831620, 0x82061421, 0x8206202d, 0x07f24321, 0x24077352,
+    0x14151605, 0x203f8206, 0x258e8227, 0x2f343536, 0x61433301, 0x36372205, 0x088b8234, 0x3435073b, 0x1e323336, 0x01161707, 0x0b1a0b58, 0x07100709,
+    0x140d9409, 0x20140404, 0x044e2f3c, 0x0c014521, 0x0b040b02, 0x070d0b08, 0x0f0c291d, 0x080f1c14, 0x1c1c140c, 0x0e080c14, 0x322e43f5, 0x260ae242,
+    0x09090e92, 0x8449090e, 0x2c012605, 0x3c2f4e04, 0x89768320, 0x1d0f2860, 0x290c0f13, 0x820d071d, 0x043a087d, 0x010c020b, 0x07290145, 0x09078707,
+    0x54fe0709, 0x091a010f, 0x2e370d0f, 0x6c7b0f0f, 0x0f041202, 0x05030a04, 0x1b1c2602, 0x0e281c08, 0x1c281c09, 0x0d270e09, 0x0f09050a, 0x72851511,
+    0x43111521, 0x64202edf, 0x2c0ad843, 0x2e0f0f1f, 0x090f0d37, 0x141c011a, 0x285e8714, 0x1c1b081d, 0x03050226, 0x3a7c820a, 0x006c0212, 0x00050000,
+    0x02c0ff00, 0x00c00140, 0x00230007, 0x0047002b, 0x4a000067, 0x06220792, 0x5a4d1f14, 0x26222109, 0x2805514d, 0x14171632, 0x24010f06, 0x054d4b22,
+    0xe7420720, 0x08824d06, 0x34363730, 0x012e012f, 0x33013e35, 0x0f141607, 0x38830601, 0x1e822320, 0x012f2227, 0x013f3426, 0x08308336, 0x34353320,
+    0x7a173236, 0x34262634, 0x320e4026, 0x0d400d13, 0x26130d13, 0x2014401a, 0x48010407, 0x19848c01, 0x261a2022, 0x1b831582, 0x0e0e3234, 0x07040148,
+    0x04041420, 0x0a034804, 0x0a078007, 0x0a894803, 0x82400121, 0x34263747, 0x300d26c3, 0x13130d60, 0x0d13800d, 0x16261a60, 0x01020112, 0x1a849044,
+    0x1a264622, 0x80201982, 0x60251c83, 0x0d260d30, 0x2f1a8244, 0x04871612, 0x0344040a, 0x24240507, 0x44030705, 0x00200c8b, 0x2e0c874a, 0x0040001a,
+    0x35341300, 0x07053734, 0x54012b06, 0x23200558, 0x35210a87, 0x14904937, 0x7e482720, 0x011f2506, 0x14163233, 0x20353682, 0x42450102, 0x06420905,
+    0x6731010a, 0x2808052b, 0x02200907, 0x0f9f473a, 0x0125be3e, 0x0942060a, 0x1e726905, 0x391e4242, 0x02022c01, 0x75fb0404, 0x02070908, 0x063aac02,
+    0x6c210683, 0x0f8d47ca, 0x0282932b, 0x08090702, 0x273227b8, 0x05c34f00, 0x01800130, 0x001300c1, 0x004e0037, 0x16321300, 0xa84c011f, 0x2a948206,
+    0x013e3735, 0x34351733, 0x44012b26, 0x232908b1, 0x011d0622, 0x013b1614, 0x22048315, 0x823d3632, 0x373621b4, 0x2405bf41, 0x1523012f, 0x06be4423,
+    0x3233153d, 0x2518ec17, 0x1a261502, 0x15251bc0, 0x9c192402, 0x08280508, 0x08061a06, 0x8a080528, 0x8b24080a, 0x05160505, 0x432b050d, 0x400d1380,
+    0x1a43130d, 0x21200113, 0x0303e019, 0x1a26261a, 0x19e00303, 0x051bad21, 0x052b3387, 0x2807061b, 0x06080806, 0x82f50728, 0x05162334, 0x7f492b05,
+    0x00132105, 0x03240082, 0xc0ff0000, 0xc020cf82, 0x1f22cf82, 0xcf953600, 0x3632122c, 0x26273435, 0x15060722, 0xb7960114, 0x84241921, 0x261a21b7,
+    0x3329b783, 0x03342332, 0x0134030a, 0x21a99217, 0xa9841822, 0x821b2521, 0x22182ea9, 0x192200ff, 0x0404451c, 0x01191b46, 0x229f9120, 0x820f0004,
+    0x01f02d9f, 0x000700c0, 0x006f001f, 0x12000077, 0x2b063b48, 0x14151625, 0x0607020e, 0x032e2722, 0x2107024e, 0x2e48011f, 0x8622204e, 0x44d9206c,
+    0x02340597, 0x48462c1e, 0x08140824, 0x27404d2a, 0x09c00e10, 0x6e080a09, 0x471d1148, 0x034810c5, 0x855b200d, 0x82002058, 0x0e093715, 0x4e200c75,
+    0x0e3c5b89, 0x43110404, 0x0f47825f, 0x04500518, 0x308dfc04, 0x1e934f9e, 0x000e0925, 0x52000002, 0x5023087b, 0x52370000, 0x25200870, 0x59104b47,
+    0x4c440894, 0x36372207, 0x22248533, 0x4922012b, 0x3320087c, 0x35087347, 0x012b0614, 0xc0012015, 0x00ff2838, 0xd0013828, 0x07090907, 0x058320fe,
+    0x83406021, 0x0d502b05, 0x222b4013, 0x38280a09, 0x16820709, 0x131a1326, 0x500d1340, 0x40271983, 0x28202020, 0x84a83838, 0x2f048417, 0x10070920,
+    0x0d130907, 0x3824bc30, 0x28380206, 0x11820c82, 0x13130d27, 0x0d30c00d, 0x201c8413, 0x06574520, 0xc0010024, 0xe34b2000, 0x00442306, 0xc78f0100,
+    0x3f531420, 0x013b2905, 0x34353632, 0x06362726, 0x20065445, 0x20078626, 0x20078636, 0x06414405, 0x01210e83, 0x228e82a0, 0x83c0fe28, 0x19802205,
+    0x82068359, 0x1c23280b, 0x2634461f, 0x4f263426, 0x8d2205c9, 0xc382131a, 0xc000ff26, 0x1a26261a, 0x01240483, 0x80283800, 0x282d3284, 0x381b2538,
+    0x28383850, 0x1c0a321e, 0x28318216, 0x1c7a3426, 0x281c1c28, 0x22318204, 0x84f31a13, 0x00262111, 0x04260082, 0xbeff0d00, 0xc382b101, 0x53002926,
+    0x67005e00, 0x162bc182, 0x27061415, 0x3e37012e, 0x41353701, 0x143b0c84, 0x15012b06, 0x36371716, 0x16011f32, 0x23020f14, 0x023e3736, 0x22233435,
+    0x8214011d, 0x353722df, 0x82c38234, 0x0e07293c, 0x15140701, 0x30331614, 0x8205d852, 0x84262018, 0x32332324, 0x2b823226, 0x3d222335, 0x228e0101,
+    0x7956577c, 0x49650202, 0x09090720, 0x82078007, 0x203c0804, 0x05182c38, 0x0417050d, 0x31c31b04, 0x0a0e1803, 0x0838380a, 0x0c010819, 0x12090408,
+    0x0a021113, 0x09520106, 0x381c1c83, 0x1a453937, 0x01010d0d, 0x7a573e33, 0x55800101, 0x220c704c, 0x2609bd41, 0x19240922, 0x82170404, 0x1a3f0849,
+    0x132014bc, 0x3d111d10, 0x0808043c, 0x0e0b1705, 0x1b191411, 0x01011927, 0x16080a06, 0x1d6b1a08, 0x3f6a3f20, 0x157413c2, 0x00007414, 0xfffaff03,
+    0x018602c0, 0x000500c1, 0x003a002c, 0x82171300, 0x013721fe, 0x3314b34d, 0x21333637, 0x16011f32, 0x17212306, 0x35171533, 0x17350533, 0x2b06f84a,
+    0x15331135, 0x134a5812, 0x3a020b12, 0x0810fa45, 0x090b2323, 0x11960111, 0x120a5609, 0x29c2fe13, 0xff408035, 0x0d134000, 0x130d00ff, 0x44440140,
+    0xf1fe1022, 0x0ff9452d, 0x101b3e08, 0x10800e0e, 0x63292022, 0x321ba08c, 0x13130d49, 0xa000010d, 0x00000300, 0x6002c0ff, 0x0d00c001, 0x46001600,
+    0x33370000, 0x26222117, 0x1716013d, 0x37323316, 0x27222327, 0x1737012e, 0x14b94606, 0x0721bf88, 0x83278206, 0x35172103, 0x23083583, 0x7a153736,
+    0x61fe9ee2, 0x0807120c, 0x0e0e0909, 0x0706011c, 0x8617242b, 0x06d8011c, 0x08041303, 0xd1fd0405, 0x22210886, 0x3eca8209, 0x3d091180, 0x062d2419,
+    0x1c1c2a07, 0x890c0d2a, 0x09090e0e, 0x80400708, 0x03c50d13, 0x82040101, 0x2859233e, 0xcc461b6d, 0x101c3210, 0x28680f0f, 0x2101065a, 0x50700421,
+    0x03010104, 0x20cf8682, 0x2bcf8281, 0x003b0014, 0x13000043, 0x06053734, 0xd4829f82, 0x37343525, 0x9435053e, 0x333631c9, 0x1d010e21, 0x35261701,
+    0x16323634, 0x07061415, 0x32076a4a, 0x3c010140, 0x17071204, 0x0907e7fe, 0x030d0301, 0x47020208, 0x2708118b, 0x01231a36, 0x32201c1c, 0x38503812,
+    0x1a21212b, 0x131a1313, 0x110f0001, 0x16361ff5, 0x02030709, 0x190c2609, 0x5e0a140d, 0x360f9441, 0x651d2d2a, 0x3327493e, 0x7070503d, 0x0e684550,
+    0x2536257b, 0x4b003625, 0xff510683, 0x00152b07, 0x003f001d, 0x0058004a, 0xf4583700, 0x17372405, 0x4307010e, 0x63490956, 0x14654208, 0x43013e21,
+    0x172d0651, 0x3405011e, 0x06173736, 0x26222123, 0x062c4535, 0x012b2008, 0x3627012e, 0x14118533, 0x8904251b, 0x4205281e, 0x1a26130d, 0xa0011a40,
+    0x34262634, 0x48856b26, 0x31080f77, 0x2b3e06a4, 0x2027422e, 0xfe2d1c37, 0xf52c3c97, 0xe0fe0607, 0xc0011c14, 0x0d13261a, 0x1e280542, 0x0cec1a13,
+    0x0b0b1b25, 0x233a1089, 0x1a200d13, 0x46822026, 0xa9342623, 0x3bfc8f67, 0x42382a7f, 0x0c38232e, 0x4923052b, 0xbd04422c, 0xb0141c02, 0x0d201a26,
+    0x103a2313, 0x3005cf47, 0xc0ffffff, 0xc1010102, 0x5f005700, 0x00006700, 0x051f4925, 0x1f062224, 0x375a1601, 0x0e5c4c06, 0x4c06c05d, 0x35230e5e,
+    0x4c333634, 0x33211160, 0x05475132, 0x04331623, 0x05305332, 0x3607564c, 0x110ce401, 0x26160c11, 0x080f1b1d, 0x080b0c11, 0x10471b0f, 0x82471018,
+    0x0c0b220d, 0x220d8211, 0x9f16261d, 0xfefe2120, 0x200abd59, 0x233d8fdc, 0x0b11110b, 0x20905e9c, 0x831c2c21, 0x5154204f, 0x00380625, 0xf9ff0300,
+    0x8702bfff, 0x2400c701, 0x61005800, 0x36370000, 0x010e1737, 0x270b694d, 0x15300730, 0x36012e06, 0x26096d4d, 0x010e0133, 0x82260127, 0x011f2110,
+    0x2213714d, 0x4d011e17, 0x07320d72, 0x25071617, 0x34353634, 0x07222326, 0xf50d0f72, 0xca851611, 0x1809012a, 0x0f090110, 0x16261d1b, 0x022eaa83,
+    0x050d040d, 0x090cb3fd, 0x5d0d0a14, 0x30411808, 0x0816230a, 0x31410109, 0x33d28405, 0xa3031e16, 0xd2fe090c, 0x08141c01, 0x0701dc08, 0x131c06bd,
+    0x162a4184, 0x0f1b1d26, 0x01080101, 0x3d861712, 0x05eafe2d, 0xc7010402, 0x0c1a0c0a, 0x8a094909, 0x21298343, 0x65820707, 0x471a1022, 0x1c2c8d82,
+    0x0c0a7e14, 0x010201fc, 0x00031c14, 0x2c064f47, 0x00c00180, 0x0057004f, 0x00af00a7, 0x0d3742b7, 0x924e1420, 0x5f332041, 0x2724070d, 0x011f0622,
+    0x42054b60, 0xe44e0e87, 0x4e232034, 0x52610fde, 0x38bf5105, 0x131a9135, 0x65131a13, 0x0c14161d, 0x06120c06, 0x0c35140c, 0x82350c12, 0x8212200c,
+    0x1614280f, 0x0d08101d, 0x8410080d, 0x110d211e, 0x11211e8a, 0x860c820d, 0x5fd8201e, 0x60200a6f, 0x203dbc49, 0x228c8220, 0x95981a13, 0x8b9f8c80,
+    0x209f8e80, 0x20448415, 0x22898233, 0x4b000e09, 0xc03d08f3, 0x2e00c001, 0x46003a00, 0x16250000, 0x0614011d, 0x3735012b, 0x27222306, 0x1d060717,
+    0x05284501, 0x87633f20, 0x011f2a06, 0x3f323316, 0x013b3601, 0x212a8232, 0x88533607, 0x16142605, 0x36043732, 0x08845334, 0xb5012808, 0xc00d130b,
+    0x2727234a, 0x020d3923, 0x0b130da0, 0x200d1335, 0x1a190607, 0x191a2020, 0x0d200706, 0x0a05fd13, 0x8330040d, 0x2c012704, 0x04300509, 0x04820a0d,
+    0x1310d039, 0xe0130dcd, 0xaa1313dd, 0xe0050529, 0x13cd0d13, 0x0d805010, 0x82110413, 0x13042400, 0x85d3800d, 0x222c8227, 0x850e0905, 0x0530223e,
+    0x05575400, 0xc7850120, 0x52004a24, 0xc9b06800, 0xeb820520, 0x3f24c582, 0x32161701, 0x3720c883, 0x2720d985, 0x83072853, 0x32252e07, 0x35343536,
+    0x012b012e, 0x27263635, 0x05cc4d22, 0xeba23320, 0x0fc0fe2d, 0x0a07040f, 0x03101003, 0x8a04070a, 0x2213350b, 0x17221717, 0x0f0a2f01, 0x050a0f01,
+    0x010a0d01, 0x070f0a01, 0x20200541, 0x85489070, 0x82bb2054, 0x2217234c, 0x46830f61, 0x82050c21, 0x0b0e2454, 0x82000730, 0x01470800, 0xc0fffaff,
+    0xc0010602, 0x00001700, 0x33150701, 0x14151632, 0x3522012b, 0x013b3634, 0x36262735, 0x16322133, 0x38d6f601, 0xf0081711, 0x38111708, 0x171110d6,
+    0x1117bc01, 0xc0d68601, 0x08081117, 0xd6c01711, 0x822a2a10, 0x0100224a, 0x053f4c00, 0x1e00c024, 0x6c5b0000, 0x14112c05, 0x34262206, 0x17323336,
+    0x88150535, 0x3411310b, 0x05d60137, 0x38130d05, 0x28383850, 0x00ff1010, 0x16300886, 0x1302be01, 0x1ba0fe0d, 0x25362525, 0xea4bb904, 0x01220885,
+    0xac831805, 0x5f820220, 0x0002bf22, 0x1925ab82, 0x00002100, 0x07654e25, 0x013d2624, 0x66832306, 0x0720bb83, 0xef436b82, 0xf9013b07, 0x071c0707,
+    0x07640714, 0x7a564838, 0x2c7aac7a, 0xfa070a10, 0x6a4b4b6a, 0x1682054b, 0x82071c21, 0x100a2219, 0x2518822c, 0x3848567a, 0x17820707, 0x006a4b2e,
+    0xfdff0100, 0x0302e0ff, 0x1200a401, 0x44080c82, 0x010f011e, 0x012f2206, 0x36373626, 0x37011f16, 0xce01013e, 0xc12b062f, 0xc10a1a0a, 0x292f062b,
+    0x1414266b, 0x81016b26, 0xc82b7c28, 0x2bc80a0a, 0x0923287c, 0x27141427, 0x00010009, 0x02baff0f, 0x00c10131, 0x23478218, 0x021f3236, 0x42084b83,
+    0x2f061617, 0x26060701, 0x2627013f, 0x01013f36, 0x09280903, 0x0c149241, 0x03196a0e, 0x83831120, 0x19032011, 0x140c0e6a, 0x12ae0192, 0x02168412,
+    0x92670e26, 0x44091713, 0x13180a44, 0x260e6792, 0x82001602, 0x00022500, 0x01c0ff00, 0x00240182, 0x001b0007, 0x52085b5d, 0x2121070d, 0x062d5222,
+    0x37321624, 0xf1841501, 0x4f37262f, 0xa0fe141c, 0x374f1c14, 0x234c2311, 0x2dec84c0, 0x2a374f6b, 0x141c1c14, 0x104f372a, 0x00820010, 0x5c850920,
+    0x0080013e, 0x003b002f, 0x00530047, 0x006b005f, 0x00830077, 0x0100008f, 0x11151632, 0x012b0614, 0x2006aa66, 0x66078621, 0x3b2906eb, 0x3b141501,
+    0x013d3201, 0x87078621, 0x66158527, 0x0b8f05f9, 0x43860520, 0x1667178f, 0x21178f07, 0x4789013d, 0x0ae8012b, 0x080a0e0e, 0xfe0c280c, 0x200482c0,
+    0x210d8708, 0x12834001, 0x04828020, 0x0124028e, 0x0cc80c10, 0x70200288, 0x0e821d8e, 0x0e80012b, 0x0ab0fe0a, 0x0c0c140e, 0x23038314, 0x50010a0e,
+    0xfe230d89, 0x820c28cc, 0x8a6c2024, 0x60c42605, 0x0c600c0c, 0x200584b4, 0x351d908c, 0x00040000, 0x02e0ff00, 0x00a00100, 0x001f000f, 0x003f002f,
+    0x294f0100, 0x2336210d, 0x230c384f, 0x34033336, 0x20064345, 0x05ea5214, 0xf9530520, 0x011d2709, 0x01230614, 0xe883c028, 0x46200483, 0x0a230887,
+    0x870a0e18, 0x28012115, 0x01241588, 0xa00a0ea0, 0x048c0d83, 0x88f8fe21, 0x89182012, 0x0000221f, 0x2bab9009, 0x005f004f, 0x007f006f, 0x1300008f,
+    0x85086054, 0x8517209e, 0x0793549d, 0x8e371521, 0x8e2320b5, 0x0699421f, 0x22061e50, 0x8e073336, 0x8e25202f, 0x8e0720e5, 0x8e25200f, 0x0e95252f,
+    0x0e0a650a, 0xb6230484, 0x83660a0e, 0x2004820a, 0x82158920, 0x2015870a, 0x222886ce, 0x89180a0e, 0x8301211f, 0x48871588, 0xfe0a0e23, 0x224b89cd,
+    0x83508801, 0x20048321, 0x410887fa, 0x1784054d, 0x88221288, 0x10840a0e, 0xb8200482, 0xa0201493, 0x68201f89, 0x00201f88, 0x42068b4c, 0x4f250d1b,
+    0x00005f00, 0x0e694137, 0x200f2941, 0x0e2f4213, 0x6a069763, 0x14230569, 0x6a012306, 0x2d640775, 0x17352105, 0x88054941, 0x0a39411f, 0x7d200a8a,
+    0x20080d41, 0x210983b5, 0x05831b01, 0x0ecdfe23, 0x2309860a, 0x180e0ae5, 0xe8201889, 0x20081a41, 0x21d288aa, 0xe889a801, 0x8940fe21, 0xa801210b,
+    0xb8202288, 0xff821589, 0x03830120, 0x01000225, 0x8214007f, 0x562720f5, 0x1f21059c, 0x06c25001, 0x0601072f, 0x07a7ae22, 0x15072507, 0x08f07008,
+    0x2b088215, 0x07d9fe07, 0x07a60916, 0x08240716, 0x08211383, 0x220a8224, 0x8308dafe, 0xffff2947, 0x61010f00, 0x23007101, 0x17204b82, 0x24071a46,
+    0x2f220607, 0x90588301, 0x64f32e5d, 0x0a160909, 0x6464091a, 0x160a1a09, 0x8c078309, 0x96c0200f, 0x842f8217, 0x20738227, 0x088f4603, 0x35001b2a,
+    0x00003d00, 0x2b141501, 0x22230384, 0x8223013d, 0x3b342303, 0x03823501, 0x011d3225, 0x85133233, 0x0eaa468a, 0x16011f25, 0x48342614, 0x0125054a,
+    0x0c380c30, 0x86038220, 0x46c92006, 0x642910ba, 0x7050a807, 0x01705050, 0x23268a00, 0xd7fe380c, 0x230fc946, 0xce140764, 0x50212883, 0x24a38900,
+    0x0025000b, 0x85a3862d, 0x2493a59b, 0xa80c0ca8, 0x828b9d0c, 0x2c839bb5, 0xff070002, 0x01f801c7, 0x002400c0, 0x28818234, 0x1415011e, 0x35262206,
+    0x05514734, 0x07061623, 0x2111820e, 0x84533316, 0x012e2605, 0x013e013f, 0x0e3e4407, 0x90012308, 0xcd913830, 0x09303892, 0x04100515, 0x24200704,
+    0x63454662, 0x04072024, 0x15051004, 0x200a0e5f, 0x04840e0a, 0x8a012308, 0x673d6b22, 0x3d679191, 0x0506236a, 0x12081c09, 0x29461805, 0x47626345,
+    0x05184727, 0x091c0812, 0x2a83d805, 0x0483f020, 0x05000028, 0xc0ff1800, 0x9b826802, 0x23079f45, 0x3700004f, 0x440e6143, 0x25200fbb, 0x82070747,
+    0x341123c4, 0x2f823336, 0x96051747, 0x07d8250f, 0x30070909, 0x50200483, 0x01200988, 0x04840f84, 0x1488b020, 0xa0230989, 0x83c00709, 0x23048216,
+    0x60070960, 0x04820a83, 0x0709c024, 0x0b83e0fe, 0x07200123, 0x21178209, 0x0c8480fe, 0x0c830582, 0x09221382, 0x1f820107, 0x00002508, 0x10000200,
+    0xf001c1ff, 0x3c00bf01, 0x00004400, 0x06071625, 0x012f0607, 0x14150706, 0x26270607, 0x2726013d, 0x273a0783, 0x26013f26, 0x26273734, 0x36373637,
+    0x3736011f, 0x36373435, 0x011d1617, 0x07831716, 0x0f161725, 0x4d071601, 0x013b0796, 0x110309e7, 0x2b080626, 0x3709221b, 0x1b220a36, 0x2606092a,
+    0x2a090311, 0x842a0303, 0x2a092119, 0x37211983, 0x08198909, 0xde060627, 0x422f2f42, 0x0a04842f, 0x04072935, 0x310c1719, 0x0c0c020a, 0x0c310a02,
+    0x07041917, 0x05093529, 0x11241119, 0x211e8419, 0x1e901805, 0x19040a25, 0x822d2323, 0x422f2140, 0xff2bd382, 0x02e0ffff, 0x00a00141, 0x4943001d,
+    0x1e5b0551, 0x05ab5e09, 0x2005a34c, 0x20df8222, 0x05845025, 0x2f222328, 0x0f222601, 0x3a5e0601, 0x18012a15, 0xb8040804, 0x07700709, 0x06f45d09,
+    0x01290982, 0x190304dc, 0x03050504, 0x3b1c82eb, 0x060403eb, 0x04031904, 0x0d220efd, 0x3805075a, 0x2c010705, 0xa4980202, 0x060a0907, 0x25059641,
+    0x07090a06, 0x258231a4, 0x051f032a, 0x0202c203, 0x1f0503c2, 0xd02a3483, 0x494a0b0b, 0x05070705, 0xbb82008b, 0xff080029, 0x01f801c8, 0x820700b8,
+    0x089f58bd, 0x35360524, 0x055a2f34, 0x1f143e09, 0x32331601, 0x91ce9937, 0x0191ce91, 0x3a060454, 0x07200709, 0x04430f09, 0x01040806, 0x221482b8,
+    0x82a8ce91, 0x2a05220b, 0x22b08390, 0x820c139c, 0x03002377, 0x6082fbff, 0x80014524, 0x61482100, 0x16252505, 0x27012b06, 0x35051141, 0x22230715,
+    0x36133726, 0x1407013b, 0x32013b16, 0x33273536, 0x8e501732, 0x2f362706, 0x012b2601, 0x15831722, 0x143b2e87, 0x3d023316, 0xc4111207, 0x4407090b,
+    0xc40b0907, 0x8c071211, 0x03621308, 0x821e0305, 0x13622b03, 0x0104ad08, 0x06280607, 0x07820107, 0x37072828, 0x09060907, 0x03822e06, 0x07092208,
+    0x621d102d, 0x06080806, 0x01101d62, 0x04171340, 0x17040505, 0x052c3413, 0x2c050808, 0x070bb007, 0x221c8330, 0x490b0730, 0xc0340517, 0xc0010002,
+    0x2b001500, 0x3b003300, 0x33130000, 0x011d1632, 0x9c820482, 0x98822220, 0x3523b282, 0x60013634, 0x342008b1, 0x17231082, 0x833f3216, 0x45062022,
+    0x5f520633, 0xd82b0807, 0x580e0a50, 0x98090a0d, 0x98061006, 0x580d0a09, 0x0e32010e, 0x0a30fe0a, 0x930a0e0e, 0x0f2a0f31, 0x0e0a9331, 0x0c100c7c,
+    0x844c100c, 0xc0012505, 0x19a80a0e, 0x2e822f82, 0x0aa81926, 0x7088fe0e, 0x04822b83, 0x0f0f3125, 0x836a0e31, 0x832c8229, 0x02002202, 0x27008200,
+    0x80014002, 0x1b001300, 0x20073f4e, 0x05624b23, 0x013f3c08, 0x32213336, 0x33070517, 0x33373317, 0x08380227, 0x20fe141c, 0x6a081c14, 0x0c011a0e,
+    0xd4fe0e1a, 0x70207b55, 0xcc557b20, 0x14810f0c, 0x81141c1c, 0x159f0c0f, 0x40802b15, 0x82008040, 0x00012a00, 0x02c8ff07, 0x00c00101, 0x089f5835,
+    0x23082349, 0x2e173330, 0x2105f55f, 0x26713233, 0x15162305, 0xeb4c0714, 0x32333005, 0x34271716, 0x33363431, 0x0705f401, 0x83c80507, 0x65013f04,
+    0x492d4d18, 0x42496767, 0x05040432, 0x04032204, 0x91676046, 0x62386692, 0x05070423, 0x2686c001, 0x07052f2a, 0x672a2405, 0x032c6792, 0x052c2382,
+    0x91400306, 0x292e92cd, 0x07050152, 0x0020ea84, 0x2207c74d, 0x82530029, 0x22658395, 0x4332013b, 0x7482095b, 0x815d9885, 0x013e2108, 0x03238f83,
+    0x6b373632, 0x232809ef, 0x17272622, 0x06143114, 0x264acf82, 0x29438307, 0x011e2723, 0x0507b901, 0x8e860c2f, 0xb4826620, 0x0e5f3e2a, 0x05310a02,
+    0x5a891107, 0xbd22ac82, 0x0e85603d, 0x84100121, 0x8bbc820f, 0xb301212d, 0x0c20a982, 0xca85f184, 0x093b4c22, 0x0126de82, 0x292e7357, 0x0c8aaffe,
+    0x278bd183, 0x07000022, 0x660ae34a, 0x332805f1, 0x4b003f00, 0x21050000, 0x2006bc45, 0x05dc4521, 0x68220021, 0x06200509, 0x3720078e, 0x200aaf4c,
+    0x290b9615, 0x60fed001, 0x141c1c14, 0x0582a001, 0x22adfe24, 0x028d1717, 0x824cf820, 0x20088808, 0x842d8220, 0x82fe2033, 0x68012133, 0x49203084,
+    0x9f26058a, 0x200c0c20, 0x058a540c, 0xaf5b0020, 0xc0012405, 0x8300c001, 0x5b0020c9, 0x342711a5, 0x1d163236, 0x65352301, 0x0121050a, 0x208d8290,
+    0x2d5f8314, 0x5918141c, 0x2a50597e, 0x1ce02a3c, 0x1583c014, 0x483e0482, 0x3f59593f, 0x2a1e4848, 0x00481e2a, 0x08000100, 0x0002c0ff, 0x2700c101,
+    0x32010000, 0x48823637, 0x22057a42, 0x4a072223, 0x352d06a0, 0x34352611, 0x011e1736, 0x14151417, 0x086b8207, 0x305e013d, 0x0e1e0f45, 0x68243f3b,
+    0x0e343e1a, 0x0e0a100a, 0x16182218, 0x2104011f, 0x5d016847, 0x12120720, 0x290911f3, 0x0a5e1723, 0x010a0e0e, 0x181d1182, 0x1e010121, 0x0a020215,
+    0x82230c0a, 0x072b4d73, 0x00002f23, 0x24ba8312, 0x0e010f14, 0x070e4301, 0x32013b23, 0x4dca8617, 0x2f2e0c20, 0x013d2601, 0x96d49634, 0x41020e12,
+    0x5a83182d, 0x212f1827, 0x21719e71, 0x3b0c852f, 0x0e02412d, 0x96a00112, 0x0914306a, 0x0e3f2d07, 0x0e0ab00a, 0x714f0222, 0x22024f71, 0x3f270c84,
+    0x1409072d, 0x82006a30, 0x00013400, 0x01fcff00, 0x00840100, 0x13000011, 0x11151636, 0x522f0614, 0x758206e9, 0x1e0bd726, 0x66590b1e, 0x66326383,
+    0x0c0b7901, 0x10b0fe10, 0x0e590b0c, 0x0e0a900a, 0x3b820200, 0x8101fa22, 0x23203b84, 0x17313d93, 0x0614011e, 0x012e0607, 0x34363736, 0x3e012e27,
+    0x2b4f8b01, 0x191915d4, 0x09140815, 0x15150905, 0x14220482, 0x5f8d7801, 0x290c1332, 0x050c2930, 0x05131106, 0x050c2e0c, 0x00061113, 0x2c054745,
+    0x014002ce, 0x001100b2, 0x003a0025, 0x2077934c, 0x23778925, 0x2634013e, 0x16207984, 0x26248983, 0x37362627, 0x17221288, 0xa09c0716, 0x42012608,
+    0x3c44443c, 0x040b1408, 0x39393109, 0x0b040931, 0x292d2814, 0x05051309, 0x221d0904, 0x04091d22, 0x2908140a, 0x41c68f61, 0x21080e26, 0x8e7e278c,
+    0x0506277e, 0x21051410, 0x21687668, 0x05101405, 0x195360c2, 0x09080506, 0x3d130613, 0x05823d46, 0x06051124, 0xef933619, 0x00092e08, 0x01e0ff00,
+    0x00a001c0, 0x00070003, 0x000f000b, 0x00170013, 0x00270023, 0x3d00002b, 0x27153301, 0x37353315, 0x37231533, 0x01152335, 0x200f8535, 0x820f8225,
+    0x8223200e, 0x1533210e, 0x27200b82, 0xc0240382, 0xc0804080, 0xfe200482, 0x01290483, 0x20602020, 0x20406040, 0x20028220, 0x251183e0, 0x40c04040,
+    0x1c824040, 0x402d2282, 0x60208040, 0x208020c0, 0x10002020, 0x23008200, 0x80010002, 0x1b227f8c, 0x83861f00, 0x33002f2d, 0x3b003700, 0x00003f00,
+    0xbc331131, 0x09122a01, 0x24091209, 0x1b121b09, 0x23008309, 0x121b121a, 0x09220083, 0x10831b12, 0x80011224, 0x03bb80fe, 0x02000022, 0x2408e745,
+    0x00190011, 0x06a34500, 0xbd611f20, 0x6d262008, 0x1c2a070d, 0x0e14cc14, 0xcc0e0ed4, 0x0682280e, 0x1c288429, 0xc41c281c, 0x821c14cc, 0x8228200c,
+    0x20068214, 0x211182d0, 0x134d281c, 0x01802308, 0x538300c0, 0xa5532920, 0x3634250d, 0x1732013b, 0x2b074e4a, 0x22060705, 0x34363727, 0x3233012f,
+    0x01217483, 0x846187f2, 0x84c2206f, 0x32022166, 0xae247483, 0x31c51a1a, 0xde208283, 0xcc218182, 0x8270820e, 0x0e1c2291, 0x20758492, 0x241082a2,
+    0x1b4a1bae, 0x831682c4, 0x04002182, 0x26081b53, 0x00230017, 0x8238002f, 0x07142485, 0x68171406, 0x99790811, 0x05152107, 0x5206a952, 0x133f0f9b,
+    0x22213726, 0x33161406, 0x0309c001, 0x0a0e0903, 0x3828b8fe, 0x48012838, 0xc0fe0e0a, 0x8806d406, 0x03fd3302, 0x0de3fe03, 0x580d1313, 0x340b070c,
+    0x100b080b, 0x27820e0a, 0x3828402b, 0x146e0a0e, 0x06140606, 0x26058446, 0x202000ff, 0x55131a13, 0x01290523, 0x00c00180, 0x1500000a, 0x05aa4f11,
+    0x27111534, 0x2001141c, 0x40c01c14, 0x1c14d001, 0x30fe141c, 0x23490070, 0x0023240b, 0x83300027, 0x730120c7, 0x81480a71, 0x05845705, 0x35333622,
+    0x1f284a84, 0x03151601, 0x25152135, 0x21051c60, 0x825b1523, 0xc0013b07, 0x0709251b, 0xfe0d1330, 0x30130dc0, 0x1b250907, 0x13010d13, 0x092e090d,
+    0x9482ff40, 0xc02f1182, 0x0e142601, 0x010e140e, 0x701b2500, 0x83600907, 0x096028d4, 0x251b7007, 0x82130da0, 0xfe0d2527, 0xe060608d, 0x30221182,
+    0x2e5b48a0, 0x47032005, 0x1928084b, 0x29002100, 0x11010000, 0x82067250, 0x013b25d7, 0x3b013e37, 0x1f20af82, 0x560caf49, 0x32220503, 0xe4820002,
+    0xea836020, 0x060c583c, 0x0f7e0f18, 0x580c0618, 0x46881c14, 0x64464664, 0x34483426, 0x30014834, 0x2083e0fe, 0x1420012b, 0x110e211c, 0x1c210e11,
+    0x211d83d6, 0x1d839c46, 0x00003424, 0x7f830200, 0x01c00128, 0x002b00a1, 0xff46002e, 0x092e4607, 0x07232722, 0x230e6a53, 0x3613013b, 0x17269382,
+    0x27332713, 0xda60b001, 0x18142408, 0x88141898, 0x83172b0d, 0x16301608, 0x5ee88308, 0xb760202f, 0x40402109, 0x01350b89, 0xfe16166a, 0x00819096,
+    0x00030000, 0x01e0ff12, 0x00a00184, 0x055f4f1d, 0x011e2523, 0x0bb34607, 0x4e5e1120, 0x07162b09, 0x33152706, 0x26343632, 0x82641123, 0x01152905,
+    0x041c1b4d, 0xd1365205, 0x20217d83, 0x26058320, 0x064c39c7, 0x8357d303, 0x201830fa, 0xd2571820, 0x34243f15, 0x30070946, 0x82010907, 0x3606828f,
+    0x61243954, 0x1c281c60, 0x2e21e0fe, 0x00007021, 0xff000001, 0x824001e0, 0x82232083, 0x1415250c, 0x03012b06, 0x878af891, 0xcb820120, 0x2f503f22,
+    0x21065f4e, 0x0b890709, 0x82900121, 0xc0fe2183, 0xf686ea8a, 0x6f41ea82, 0x43022105, 0x2d226782, 0xad4a4900, 0x1123210e, 0x11217190, 0x0ac85223,
+    0x32013323, 0x0ad74b16, 0x3f268c82, 0x1f323601, 0xac821601, 0x0b4f1520, 0x21798205, 0x93832838, 0x0483a020, 0x30060964, 0x20020709, 0x5008080b,
+    0x50040e04, 0x300b0808, 0x210c8b30, 0x1a4fa001, 0xfe202206, 0x20b28ad0, 0x84498230, 0xb0fe2a18, 0x05500714, 0x14075005, 0x820888e0, 0x000226c8,
+    0x01ddff00, 0x20c795c0, 0x20c79015, 0x52c78d35, 0x2622055b, 0x1683013d, 0x27055c52, 0x011d1636, 0x36343533, 0x82055242, 0x1878217d, 0x21084d42,
+    0x99867818, 0x8f5b0121, 0x8314208a, 0x835020bf, 0x70102129, 0x7021be89, 0x06285010, 0x95fbfe21, 0x0b3022f5, 0x051b4408, 0x56050747, 0x37200857,
+    0x650ee753, 0x36200588, 0x2008f753, 0x0dfd6417, 0x0d653320, 0x0d33270e, 0x05080805, 0x05830601, 0x89fafe21, 0x839d200b, 0x60fe218e, 0x01210583,
+    0x230b89a0, 0x26050860, 0x04822483, 0x89000121, 0x0a25430b, 0x8900ff21, 0x040021d4, 0x8808b747, 0x8f7f8faf, 0x06d7540f, 0x17873b20, 0x230b4943,
+    0x0614011d, 0x91056d41, 0x055c2599, 0xe8050707, 0x0120048c, 0x8b0ac843, 0x40012496, 0x83280507, 0x21048229, 0x0b8900ff, 0x20245f41, 0x1e4f4115,
+    0x1020cf8f, 0x41094241, 0x01210946, 0x0f6f41a3, 0x20057b41, 0x093b41e0, 0x200b8d43, 0x09694180, 0x7541ff20, 0x4caf940a, 0x33200e0f, 0x5f410faf,
+    0x0b054217, 0x63410b8b, 0x8980200a, 0x290a95bd, 0x00000600, 0x0002f0ff, 0x17599001, 0x05fb5608, 0x560e7953, 0xc3420feb, 0x07e34506, 0xe56f3320,
+    0x10d3420e, 0x50201f8f, 0x2008e751, 0x21099240, 0x1483e001, 0x83c0fe21, 0x84012005, 0x200b9120, 0x06275250, 0x01201e82, 0x8405c07a, 0x89a02010,
+    0x45b02016, 0x0723113d, 0x82090720, 0x84058221, 0x0000231b, 0x0f430500, 0x000b2808, 0x002b001b, 0x574b003b, 0x16240803, 0x0614011d, 0x5664b98f,
+    0x06e54308, 0x860fa354, 0x0514480f, 0x3336342c, 0x05056065, 0x14140760, 0x6c424401, 0x05e6240f, 0x89050808, 0x89e32004, 0x60552c1f, 0x60040e04,
+    0xc00b0808, 0x892d080b, 0x0a7442c5, 0x20890a8b, 0x0621cf98, 0x06597326, 0xbf071421, 0x821b20cf, 0x820720cb, 0x350121d3, 0xca85cfaa, 0xd6830820,
+    0xcfad9520, 0x2209f351, 0x5c19000f, 0x232008f9, 0x20072450, 0x07194e05, 0x50013526, 0x141c1c14, 0x2706aa48, 0x232210de, 0x80016e0f, 0x20311088,
+    0x0b261c14, 0x00ff1411, 0x4b0b1114, 0x0000009e, 0x2e038203, 0x01000200, 0x000f0080, 0x00220017, 0x50012900, 0x07261577, 0x26273521, 0x0383010f,
+    0x300d4e50, 0x21212ea3, 0x0168212e, 0x08085880, 0x08083888, 0x053a4a48, 0x01217285, 0x231b8248, 0x70e72e21, 0x00201c87, 0x01280082, 0xbfff0000,
+    0xc0018001, 0x00237182, 0x67062e17, 0x2e08068b, 0x0607050e, 0x3d18ac22, 0x0d0b221a, 0x70a07003, 0x220b0d03, 0x07183d1a, 0x5823361a, 0x22163524,
+    0x70501119, 0x19115070, 0x24351622, 0x540a2358, 0x0d240dc3, 0x34360000, 0x31050578, 0x34363237, 0x91082326, 0xce9191ce, 0x6c6c4c67, 0x0983594c,
+    0x6c409124, 0x33836c98, 0xc0ff002f, 0xc1016001, 0x21001100, 0x1e130000, 0x06fb5703, 0x37023e25, 0x84033236, 0x2235083a, 0x26343526, 0x14150622,
+    0x3610cd16, 0x9267212c, 0x352d2167, 0x172d0710, 0x07090907, 0x0e092f21, 0xaa014209, 0x49365f34, 0x68684a26, 0x3848264a, 0xfe16345e, 0x21168240,
+    0x2183212f, 0x74422e21, 0x0b2f0cf3, 0x36001900, 0x17010000, 0x06020f16, 0x6f023f26, 0x2f290645, 0x013f2601, 0x03173236, 0x4c068234, 0x0f391008,
+    0x012b0601, 0x93012111, 0xdb07075a, 0x010d0a5c, 0xa907db0a, 0x07240b0b, 0x28108207, 0x0c200b24, 0x05280484, 0x053f5f0f, 0x01141c2e, 0x0606081e,
+    0xe6050328, 0x6d014001, 0xdb2c2082, 0x0a0d010a, 0x1007db5c, 0x230c200c, 0x232d3284, 0xb2fe0c0c, 0x06280305, 0x149e0806, 0x05db511c, 0x28050f25,
+    0x82c0fe04, 0x000135ab, 0x01daff40, 0x00a60180, 0x17000015, 0x013b3411, 0x37011d32, 0x2e075142, 0x012b1415, 0x300c4022, 0x250fc40c, 0x82c40f25,
+    0x14210808, 0x0c0ca801, 0x120db5b0, 0x1480fe14, 0xafb40d12, 0x0100000c, 0xfaff0000, 0x86010002, 0x00001f00, 0x8c438935, 0x2f062148, 0x25058d5a,
+    0xac0c280c, 0x0282250f, 0xac0f2522, 0x0e820282, 0x68010c26, 0x9d980c0c, 0x84205282, 0xfe210483, 0x215782c0, 0x0483839c, 0x000c9723, 0x295b8802,
+    0x0017000b, 0x34263700, 0x9d85013f, 0x0b8b2720, 0x0c0c0c23, 0x20a283c0, 0x24078640, 0x0a1e0aa7, 0x845182a0, 0x8ba0204c, 0x0000210c, 0xb82faf84,
+    0xc801c101, 0x00000b00, 0x07141625, 0x82260605, 0x173638b6, 0x1818a801, 0x3117a0fe, 0x0ee91533, 0x0ed00e36, 0xa0011c1b, 0x820e191e, 0x26878432,
+    0x01c001e1, 0x830f00a1, 0x601720e5, 0xa1530866, 0x14252105, 0x24051f5f, 0x3b363411, 0x25128201, 0x1c146090, 0x0483141c, 0x07860120, 0x1f200c83,
+    0x200b5853, 0x078b4130, 0x82141c21, 0x05374b60, 0xa001c022, 0xdb605f82, 0x08e14307, 0x210b2d53, 0xf941a001, 0x415e8208, 0xcd820f1f, 0x86010f21,
+    0x057173cd, 0xf420d986, 0x200e2041, 0x061341d9, 0x14400124, 0x20410d12, 0x410c8407, 0x012a0ecf, 0x012b1411, 0x07013d22, 0x04842606, 0xe2823520,
+    0x35011f24, 0x04833634, 0x0221eb82, 0x11d14100, 0xfe740123, 0x0bd24198, 0xd2415784, 0x42002008, 0x5f8a0c73, 0x55825a87, 0x42800121, 0x01230b74,
+    0x4258fe94, 0x01200675, 0x31087542, 0xff020000, 0x01e0fff7, 0x00a001c9, 0x001b000f, 0x9d572500, 0x2133270a, 0x22251632, 0xd74b3f26, 0x01232b06,
+    0xfe0d13c0, 0x13130d80, 0x0582010d, 0x1f70fe2e, 0x0eb01519, 0x15b00e2a, 0x40401f19, 0x04831683, 0x17393338, 0xc01010c0, 0x00003917, 0x1b000100,
+    0x2501e5ff, 0x14009b01, 0x46850000, 0x20063063, 0x0581630f, 0xc223342b, 0x16071407, 0x9b070107, 0x2004829b, 0x240c8216, 0xc2d108c2, 0x20128207,
+    0x83128314, 0x8207201b, 0x274b8f22, 0x22060725, 0x012e012f, 0x20067263, 0x056e5036, 0x4c921d20, 0x4c93af20, 0xbb590220, 0x0023210a, 0x2109bb59,
+    0x09633435, 0x6f232008, 0x4d500566, 0x32332106, 0x2406c159, 0x0c5c0c88, 0x86038238, 0x06c15906, 0x128a8320, 0x455c0c21, 0x13200d57, 0x17275f89,
+    0x013d3221, 0x83212334, 0x274f855a, 0x0c080174, 0x0cf8fe0c, 0x8f204786, 0x20052b5e, 0x249f9700, 0x2f363727, 0x06434601, 0x011f0623, 0x23038207,
+    0x17013f16, 0x36200382, 0x012b4f85, 0x08424272, 0x09082808, 0x82094141, 0x8c082006, 0x2064860d, 0x861b93a8, 0x0ed75a29, 0x0f821720, 0x2006df4f,
+    0x317a8d03, 0x91f80116, 0xce9191ce, 0x0c0cb884, 0x960b0c16, 0x06820b46, 0x0b680c24, 0x15832701, 0x85fe9127, 0x170b0bb8, 0x8317830b, 0x0c682406,
+    0x41030000, 0x2a220a73, 0x59893200, 0x84220721, 0x3e3723c7, 0x506e3301, 0x020e2305, 0x2464011d, 0x023e2406, 0x57263435, 0x728607b0, 0x2b4a603e,
+    0x09230906, 0x12171007, 0x110f1d11, 0x0c141112, 0x1f1a0c38, 0x2620481a, 0x1b261b1b, 0x523d8186, 0x1a070940, 0x11130907, 0x0d0b0e13, 0x1e0c0a0a,
+    0x0c0c0413, 0x10120901, 0x3c2a1a26, 0x212782f8, 0x938d261b, 0x27000f22, 0x2009a941, 0x06235824, 0x11421720, 0x2092820a, 0x06154215, 0x2a070d42,
+    0x19192209, 0x0c0e1922, 0x82400c0c, 0x20028203, 0x07c94158, 0x17822320, 0xe5221928, 0x0c640c18, 0x1d82180c, 0x820c1821, 0x030021f0, 0x28089f53,
+    0x004f0027, 0x25000057, 0x25ea8232, 0x010e012b, 0x20441507, 0x012e2205, 0x06676027, 0x37013e23, 0x05484635, 0x17011e23, 0x860d8207, 0x86218217,
+    0x2035822b, 0x823f8533, 0x212b8421, 0xad413415, 0xf4012e06, 0x0b1e0c0c, 0x280c4665, 0x0b65460c, 0x2a0c8b1e, 0x0a3f2cb6, 0x290c0c29, 0x822c3f0a,
+    0x250c8c1d, 0x13131a13, 0x3392e01a, 0xb5204086, 0x40853392, 0x39837920, 0xe3411320, 0x000d210c, 0x2b0af942, 0x07012e04, 0x1e043601, 0x06013701,
+    0x2806a942, 0x348860aa, 0xfe260101, 0x22078291, 0x4226fffe, 0x1527069c, 0xfe260b60, 0x821c34ff, 0x01012306, 0x00820034, 0xffff012c, 0xc001e5ff,
+    0x1d009b01, 0xf7430000, 0x34262105, 0x24054b44, 0x010f0616, 0x055f4c21, 0x1721232c, 0x0201011e, 0x07140717, 0x028207c2, 0x17071433, 0x78070107,
+    0x0e0a1f01, 0xe1fe0a0e, 0x03010778, 0x44178516, 0x7328060f, 0x0a200a0e, 0x1407730e, 0x00256384, 0x01e5ff00, 0x216385c1, 0x4e443713, 0x06a24405,
+    0x013f3622, 0x2605185c, 0x27213336, 0x8fbe012e, 0xe1fe2162, 0x01216283, 0x2162821f, 0x639c7d01, 0xe0ff0526, 0xa101bb01, 0x3720c783, 0x2108bd62,
+    0x67821416, 0x012f2623, 0x07fb4611, 0x010e0723, 0x20469623, 0x217b8a9e, 0xde820816, 0x00257b8a, 0xff050001, 0x205f82df, 0x205f83a0, 0x082f6325,
+    0x3f342628, 0x1f163601, 0x53471101, 0x37112506, 0x9d01013e, 0xe2206096, 0x3f41dc8f, 0x0727410a, 0x0102dc29, 0x1e00a501, 0x85010000, 0x3d4b08ba,
+    0x14030e01, 0x27061617, 0x3435012e, 0x3537033e, 0x01173634, 0xb00808f8, 0x44311c0c, 0x040d1732, 0x30230b15, 0x504c321e, 0x010c1c34, 0x07160702,
+    0x0f0d0a98, 0x190b0158, 0x0c2b402a, 0x5519080e, 0x29422c2c, 0x50010919, 0x830a0d0f, 0x00042363, 0x0751ff00, 0x00102905, 0x00320021, 0x11000043,
+    0x3b215382, 0x05ea4201, 0x2b141526, 0x34252201, 0x16220e82, 0x3343011d, 0x22232305, 0xcb5c1735, 0x013d2107, 0x35231a82, 0x83073334, 0x8426201a,
+    0x311a820d, 0x0e153233, 0x0c0c7c0a, 0x0c280c54, 0x7c0c2001, 0x08820e0a, 0x940c5423, 0x2015860c, 0x201288ec, 0x881c9b01, 0x5aa7962f, 0xaa840655,
+    0x76823320, 0xd0481420, 0x43858405, 0x0648059f, 0x06ca4306, 0x15163223, 0x21c28517, 0x34843634, 0x01210c82, 0x219d87b4, 0xb388e0fe, 0x9983ad84,
+    0x0982c020, 0x01211585, 0x201d8800, 0x22ce8618, 0x8558fe0c, 0x851984e2, 0x00002146, 0x20091349, 0x0a515523, 0x5408c853, 0xd9770844, 0xa0012c08,
+    0x0d13130d, 0x200d1390, 0x8990130d, 0x8ff0200a, 0x831b8510, 0x9000275f, 0xf000c001, 0x5f880f00, 0x8508b34e, 0x0533484b, 0x45844085, 0x00820020,
+    0x13000126, 0xed01c0ff, 0x3b05275f, 0x0f011e25, 0x2f010e01, 0x06161701, 0x2622012b, 0x0607013f, 0x26012f26, 0x27013f36, 0x08053e64, 0x27011f29,
+    0x013b3626, 0x010f1632, 0x1f163637, 0x0f061601, 0x09de0101, 0x05130505, 0x038b0814, 0x260b0e01, 0x03010e0b, 0x8214088b, 0x09052311, 0x1a998e8e,
+    0x13057231, 0x05092209, 0x0ba25406, 0xa20b0e0e, 0x82050654, 0x0513230e, 0x17964e4e, 0xd7440020, 0x000f220c, 0x09bb461d, 0x27460220, 0x17272206,
+    0x219b8214, 0x72613735, 0x06a84605, 0x1b265430, 0x5a1b261b, 0x0c300c08, 0x40050708, 0x9a460705, 0xd6fe2106, 0x1b291682, 0x0b88c026, 0x0706880b,
+    0x076b4f07, 0x01000237, 0x000600a0, 0x002e000d, 0x00410037, 0x33353300, 0x26222315, 0x22068205, 0x51230614, 0x59410637, 0x013b2907, 0x36343526,
+    0x17163233, 0x22063647, 0x60332107, 0x33080859, 0x23263436, 0x07010e22, 0x0da0c020, 0xc0000113, 0x0d200d13, 0xfe070913, 0x13090720, 0x340a2c0d,
+    0x1b2e1e24, 0x241e2e1b, 0xe4fe0a34, 0x12212356, 0xdf171711, 0x112a0382, 0x1920110c, 0x1313a080, 0x368280a0, 0xae794020, 0x0d503306, 0x24151313,
+    0x24242034, 0x14243420, 0x171b3514, 0x02821722, 0x2524072b, 0xff010000, 0x02bdfffd, 0x06535e40, 0x5c151621, 0x06280581, 0x2e010e07, 0x043e3701,
+    0x21051957, 0xaa830722, 0x013b4b08, 0x36373632, 0x1e220232, 0x5b387597, 0x0513351b, 0x050b1819, 0x51402009, 0x0907477d, 0x75a90709, 0x50507002,
+    0x05184f2f, 0x42b60113, 0x09b9834e, 0x2c252e06, 0x0a0b0c2e, 0x2f150c19, 0x0922303e, 0x0e54090e, 0x2f705006, 0x73590829, 0x00c42608, 0x13000021,
+    0x08824e14, 0x2005d45e, 0x23778216, 0x042e3435, 0x3c086f82, 0x3123d816, 0x9e712331, 0x1e0b3771, 0x261b1a25, 0x131d1a13, 0x0a1a1506, 0x1ca80122,
+    0x4d322c32, 0x71714f2f, 0x0c394e4f, 0x1b55110c, 0x111b2526, 0x221c1a20, 0x0f253d2a, 0x0300000a, 0x82008200, 0x00802bdb, 0x0019000f, 0x2500002b,
+    0xd8821416, 0x2726222d, 0x3e373426, 0x07163201, 0x62353632, 0x372005b4, 0x22052e7c, 0x85373435, 0x36272a7a, 0x03033d02, 0x98b6982a, 0x3b06852a,
+    0x54543cf3, 0x3c545478, 0x4f383828, 0x100c0439, 0x0c091c14, 0x071007cf, 0x50616150, 0xef220685, 0x23843c54, 0x2082f020, 0x0d273929, 0x141c090c,
+    0x82040c10, 0x06334881, 0xc0018028, 0x2f001000, 0x87824500, 0x17373224, 0x87852306, 0x17373624, 0xa777011e, 0x16322216, 0x21b18217, 0x46180706,
+    0x172007e4, 0x2731ae82, 0x16323336, 0x14153015, 0x0d400107, 0x2529340d, 0x28a2835b, 0x0469170e, 0x06730152, 0xbe491803, 0x4580220d, 0x331e844e,
+    0x0e49331f, 0x27343c54, 0x0d090249, 0x0538270d, 0x0a290330, 0x1a25b784, 0x4d38511d, 0x0fad763a, 0x84266321, 0x2b3b2a1c, 0x3c1f1d39, 0x05392154,
+    0x32c98205, 0x0f012738, 0xff03000f, 0x02c0fff8, 0x00c10148, 0x6f13000b, 0x062905f1, 0x26222123, 0x32361337, 0x154b4317, 0x0d3a022e, 0x20fe1c1b,
+    0xf00d1b1c, 0x170e380e, 0x2a0f5243, 0x30301808, 0x18a00118, 0x43b6fe18, 0x01220e54, 0x6b82feff, 0xc0014027, 0x00002800, 0x050f7701, 0x2205dd62,
+    0x8723013f, 0x05534408, 0x33011f22, 0x013a0887, 0x42421ee0, 0x0569721e, 0x09084209, 0x2b673102, 0x08280805, 0x20200109, 0x08820901, 0x2b052408,
+    0x09023167, 0x05094208, 0x27000169, 0x08b82732, 0x3aac070d, 0x6c080c06, 0x060c086c, 0x0d07ac3a, 0x8200b808, 0x5c082000, 0x092208af, 0xe7821500,
+    0x39002d2d, 0x51004500, 0x00006f00, 0x5b211115, 0x25200653, 0x2016a95c, 0x8217ae27, 0x011d24db, 0x65343521, 0x1847055d, 0x45332005, 0xc02b09cd,
+    0xa0fe141c, 0x40011c14, 0x880c280c, 0x0c496f02, 0x012d0c8c, 0xfe1c1450, 0x30141c40, 0x07200709, 0x05eb5509, 0x10011028, 0x1c14f0fe, 0x4184d81c,
+    0x2005146f, 0x200b9674, 0x283b8301, 0x301c1430, 0x07090907, 0x32058530, 0x00000300, 0x0102dbff, 0x1300a501, 0x3b001f00, 0x48250000, 0x2325073b,
+    0x37012f22, 0x25ae8317, 0x3d222517, 0xbe823401, 0x07011f24, 0xa1412127, 0x20108405, 0x5ed88537, 0x263606c5, 0x07f90135, 0x1e0b5007, 0x4604053b,
+    0x1e203535, 0x0c63fe0b, 0x0c846f0c, 0x20200129, 0x6f0504dc, 0x82540c0c, 0x1e3b2306, 0x2884500b, 0x14075922, 0x0c2e2f82, 0x4b042810, 0x1028393a,
+    0x0c670b0c, 0x0b830c38, 0x8204ec21, 0x04ec2108, 0x50201283, 0x00252386, 0xff010000, 0x06df6ffe, 0x0f4c1220, 0x05b17b06, 0x3e262608, 0x35263702,
+    0x96d49634, 0x33386a96, 0x04054c41, 0x061c1107, 0x7aa00139, 0x33137aac, 0x3115070a, 0x564a3916, 0x20eb8400, 0x29eb82d3, 0x000f00ac, 0x003e001e,
+    0x62471300, 0x05aa4a08, 0x82081448, 0x163224d7, 0x82330715, 0x17062904, 0x22010e14, 0x3435012e, 0x2308b841, 0x36321614, 0x3630ff82, 0x070598a4,
+    0x0f680f15, 0x57010715, 0x0c980507, 0x14830b84, 0x4e010126, 0x4f747b74, 0x05321382, 0x323c3207, 0x072c0107, 0x150f5005, 0x05500f15, 0x02820c07,
+    0x7c330b84, 0x092c0507, 0x3b3b7448, 0x31054774, 0x05070705, 0x82342d34, 0x07052d02, 0x05000100, 0xbb013b00, 0x14004501, 0x1722a382, 0x80471416,
+    0x05774705, 0x013f3425, 0x4ff13236, 0x0121113a, 0x12624f3d, 0x4b8d0020, 0x2205db4a, 0x471f013e, 0x142506a8, 0x2206010f, 0x204b91cf, 0x2d4a9443,
+    0x03000200, 0x7d02fcff, 0x21008401, 0xf14b4300, 0x2335240f, 0x48012f22, 0x1d200507, 0x32255e82, 0x1416011f, 0x06334805, 0x6e013d21, 0xc04b081b,
+    0x33153b0b, 0x65760232, 0x65071407, 0x070b0707, 0xbc280715, 0x0b100809, 0x0af4100c, 0x0e82280e, 0xfe070b23, 0x820e8cf0, 0x242b8b27, 0x07076468,
+    0x2c3d8264, 0x2b07070b, 0x0b1007b6, 0xde0a0e1e, 0x2149832b, 0x0c8b1614, 0x26892382, 0x25059f46, 0xc0014202, 0xc1822e00, 0x21230629, 0x16322117,
+    0x5516010f, 0x37210629, 0x20098823, 0x0a1c4203, 0x82011f21, 0x02073425, 0xfe130410, 0x0d0106db, 0x06020e0b, 0x212e2120, 0x8211d211, 0x1c200805,
+    0x0e0a4646, 0x08670a0e, 0x0109020d, 0x030e0c89, 0x12201393, 0x230f190b, 0x17212117, 0x18101018, 0x202e0783, 0x0e570111, 0x0e0a100a, 0x122d080b,
+    0x8783000b, 0x02000028, 0x00800100, 0x41180011, 0x35270b2b, 0x3b363411, 0x60011701, 0x602a059a, 0x141c1c14, 0x400140a0, 0x9f5f141c, 0x00402308,
+    0x00820002, 0x01440226, 0x000d0080, 0x2605794d, 0x26222123, 0x5236013f, 0x06210515, 0x05524c0f, 0x3233172f, 0x02011d16, 0x2512493d, 0x0e0e70fe,
+    0x29078207, 0x0e0e9001, 0x2c1a54fe, 0x5683450d, 0x1c14a027, 0x18207c9c, 0x2703820c, 0x76161a38, 0x1c141601, 0x30226882, 0x5f840500, 0x80010022,
+    0x22082f5a, 0x72000054, 0x33200f33, 0x750e3372, 0x4a430805, 0x8f232005, 0x0a115d1f, 0x3225e385, 0x01111516, 0x06d65c4d, 0x3a050822, 0xfe210988,
+    0x281492ba, 0x090907dd, 0x0d30fe07, 0x05fc4413, 0x86050822, 0x04842483, 0x20095e59, 0x84138346, 0x83c62004, 0x5d048209, 0x13230522, 0x8450010d,
+    0x00d0223f, 0x08476106, 0x1c000f2e, 0x35002d00, 0x4d003d00, 0x21130000, 0x51618e83, 0x22172209, 0x08e95006, 0x3205232d, 0x2634013d, 0x0f22012b,
+    0x82222301, 0x12332116, 0x08675718, 0x0614162b, 0x16342622, 0x34353632, 0x06534936, 0x1415062b, 0x14a00130, 0xfe141c1c, 0x08058360, 0x06090722,
+    0x01060674, 0x07090640, 0x1e0203fd, 0xa806068a, 0x64464664, 0x34485446, 0x21344834, 0x0d13090e, 0x1a219b83, 0x0df95426, 0x07092033, 0x1406060a,
+    0x4a066006, 0x2d030907, 0xfe062406, 0x223582f8, 0x828a6446, 0x29028235, 0x130d0709, 0x26090e09, 0x5b64071a, 0x00c12d08, 0x00290021, 0x06140100,
+    0x07272223, 0x08be4d18, 0x8205be4e, 0x4a3f20c2, 0x6d690799, 0x262a0805, 0x67000222, 0x18101149, 0x0e250b07, 0x0a0e280a, 0x070e0a70, 0x496709a2,
+    0x1cb06749, 0x281c1c28, 0x67491001, 0x28081b03, 0x02820e0a, 0x4e0a0e2b, 0x1ba2070a, 0x6767491c, 0x371c8305, 0x0600001c, 0xbefffaff, 0xc3018202,
+    0x43003b00, 0x8f008300, 0xd300cb00, 0xec6e7f82, 0x82272008, 0x37262587, 0x36013b36, 0x6e09f56e, 0x172409eb, 0x16173233, 0x0621a683, 0x2c078307,
+    0x012f0607, 0x3e162706, 0x0e262701, 0x23118901, 0x06141507, 0x2e215082, 0x0c466f01, 0x250c456f, 0x17363736, 0x476f011e, 0x013e2b0d, 0x0706012e,
+    0x011e010e, 0x8fc20536, 0x08000235, 0x0e120a05, 0x0a080508, 0x010b1006, 0x0b010404, 0x820a0610, 0x120e260e, 0x1008050a, 0x241d9c10, 0x0926121a,
+    0x0803820d, 0x1122672c, 0x0d210907, 0x1e181e11, 0x2626080c, 0x181f0b09, 0x200d111d, 0x2111070a, 0x12210606, 0x0c200a08, 0x1e191d12, 0x2626090b,
+    0x24820c08, 0x22281b85, 0x04117b06, 0x16302316, 0x01210584, 0xa56a9c09, 0x01220888, 0x03090e01, 0x09070c07, 0x0b0f0c0e, 0x0f0a1312, 0x06090f0c,
+    0x0904070c, 0x0f03030f, 0x0d060409, 0x12820906, 0x12130a27, 0x0e0c0f0b, 0x2819820a, 0x030e0903, 0x230c0e3e, 0x08038214, 0x0a11ae20, 0x0f281a13,
+    0x0b15110a, 0x010e0822, 0x0e010707, 0x150b2208, 0x270f0a11, 0x110a131b, 0x1f821f20, 0x0f271b29, 0x0a15100a, 0x830d0922, 0x090d291f, 0x10140b22,
+    0x1c26100b, 0x1f271f82, 0x23301635, 0x84110516, 0x8ea62005, 0x0e0d2587, 0x060c0709, 0xa1838788, 0x860f0d21, 0x20198287, 0x33878b07, 0xff020000,
+    0x02e0fffe, 0x00a00142, 0x00290011, 0x06140000, 0x2b060f48, 0x26373637, 0x32363435, 0x16171613, 0x27201387, 0x0806004c, 0x15011e49, 0x7aa00114,
+    0x2b333c56, 0x0304052e, 0x7a260f15, 0x150ff4ac, 0x2e050403, 0x403c332b, 0x0e121868, 0x39018d63, 0x84420148, 0x0a19195e, 0x29221404, 0xfe5e4233,
+    0x04142284, 0x3619190a, 0x4f71022c, 0x5112090b, 0x7a003331, 0x01250573, 0x00c00120, 0x200c820d, 0x08677a11, 0x01360223, 0x095a7a20, 0x01094131,
+    0x4448fec0, 0x91141709, 0x03260e67, 0x82128415, 0x243b82aa, 0x01bfff00, 0x233b8281, 0x2500002b, 0x06219483, 0x2099822b, 0x057c570f, 0x23013d23,
+    0x20c18322, 0x06b7503f, 0x3c085862, 0x2a01012b, 0x0a0e3026, 0x02180188, 0x0118020a, 0x300e0a88, 0x0a2a0c26, 0x010a0e0e, 0x39058310, 0x3b12ea2a,
+    0x680e0a25, 0x04300202, 0x02023004, 0x240a0e68, 0x0e76123c, 0x1d83300a, 0xbf5b0482, 0x0033240c, 0x4643003b, 0x0726077f, 0x010e0706, 0x9463010f,
+    0x21232f06, 0x34013d22, 0x35013b36, 0x2627022e, 0x0c862627, 0x8a863420, 0x16052708, 0x23272617, 0x35251415, 0x36070623, 0x28023637, 0x303e0e0a,
+    0x0a220e3e, 0x251b300a, 0x0cd8fe0c, 0x04301b25, 0x1484240e, 0x85820a20, 0xfe3f9e83, 0x0b1713a3, 0xc0014002, 0x170b0240, 0x80012313, 0x38380a0e,
+    0x1807222d, 0x48070724, 0x820c1a1e, 0x1e1a2b00, 0x260a0248, 0x2d220718, 0x77443838, 0x81282e06, 0x2d29080d, 0x10171710, 0x0d08292d, 0x0dcf701a,
+    0x37002f29, 0x00003f00, 0x82222325, 0x0de964a1, 0x37061422, 0x180ccf70, 0x200aed4b, 0x0fd37016, 0x70280121, 0xce2110d4, 0x06d3700e, 0x17218826,
+    0x88211750, 0x200dd370, 0x0dd27040, 0x70700821, 0x082506d1, 0x17212117, 0x0ed37008, 0xfcff2a08, 0x0402bcff, 0x2300c401, 0x00003500, 0x07011e00,
+    0x0e16010e, 0x07062606, 0x37022e06, 0x3e26013e, 0x37361606, 0x013e0736, 0x261a832e, 0x17160607, 0x82323332, 0xd8013318, 0x08090922, 0x0a020702,
+    0x3a464227, 0x0d2b2d3b, 0x11902b0f, 0x0706b93f, 0x34070b03, 0x07010e6a, 0x0c020206, 0x015e0a04, 0x0f2b22ba, 0x3b2d2b0d, 0x2742463a, 0x223e820a,
+    0x90090908, 0x02632e11, 0x01070d0b, 0x07346a0e, 0x2c0c020b, 0x2097825e, 0x22a78201, 0x820002c0, 0x001735a7, 0x15160100, 0x22230014, 0x3f26012f,
+    0x011f3601, 0x2737013e, 0x30080983, 0x13ed0117, 0x13c0f0fe, 0x13051804, 0x310c1070, 0x3c1b5b3b, 0x0830070e, 0x04a70113, 0xf0fec013, 0x08136813,
+    0x3c0e0730, 0x323a5c1b, 0x1270110b, 0x0a3b6805, 0x0f00a024, 0xdf5f2e00, 0x32133411, 0x2f343536, 0x22232201, 0x1506010f, 0x06011f14, 0x86262707,
+    0x1715220c, 0x0b1c5c16, 0xaa782e37, 0x0201410c, 0x011e040a, 0x4b232506, 0x0307051f, 0x0f094603, 0x0d3a4703, 0xaa80fe39, 0x0f030c78, 0x03034609,
+    0x4b1f0507, 0x01062523, 0x020a041e, 0x820c4101, 0x06ff4d7c, 0x2600c122, 0x22101353, 0x6f35013b, 0x314705c5, 0x22868208, 0x6f011d06, 0x7d300dcc,
+    0x200a0e5a, 0x1e2b0e0a, 0x1cc02a1d, 0x1c14a014, 0x662f0484, 0x3f595a40, 0x0e0e0a10, 0x2a1e100a, 0x54671e2b, 0x02240887, 0x00a00140, 0x25056b4e,
+    0x3d00002b, 0x93422101, 0x4e372006, 0x07200a4b, 0x01220b8a, 0x85822115, 0x3221332f, 0x1c400216, 0x1420fe14, 0x880cc01c, 0x2302820c, 0x0c480c80,
+    0x02220282, 0x7682fd00, 0x14e00126, 0xb0b0101c, 0x58207c82, 0x230a3b4e, 0x30301001, 0x7b831282, 0xe7820320, 0xc101df31, 0x0700a101, 0x30001b00,
+    0x14360000, 0x82262206, 0x851720de, 0x2e3523dc, 0xc1492701, 0x1e332205, 0x36139201, 0x35258002, 0xd5352626, 0x07300709, 0x54770609, 0x070a0906,
+    0x8597a474, 0x90cb210e, 0x73230e83, 0x833b74c4, 0x6f252823, 0x06090a07, 0x84067754, 0xa407221c, 0x210e8374, 0x0e85cb90, 0xc3750424, 0x90830400,
+    0x01400225, 0x820f0080, 0x0023228b, 0x11cb5c2b, 0x22212725, 0x82363707, 0x011f21f5, 0x2008545a, 0x06c15326, 0x21070741, 0xf583141c, 0x20fe3025,
+    0x73610f10, 0x612805f0, 0x131a330f, 0x73131a13, 0x935e0584, 0x063c2709, 0x91151591, 0x1a826006, 0x82840287, 0x50000021, 0x2c270677, 0x00003400,
+    0x18071424, 0x24078047, 0x1506012b, 0x05ac4c14, 0x35262724, 0xfa4b3734, 0x3f2a0809, 0x32333601, 0x07011d16, 0x23060711, 0x02173215, 0x10102040,
+    0x4255090b, 0x1a041c55, 0x4b13120b, 0x02190814, 0x25251b22, 0x1382c01b, 0x0b093008, 0x21401010, 0x546b6b54, 0x99124af5, 0x4407160a, 0x2b101035,
+    0x11231022, 0x10103a35, 0x1b601b25, 0x07443525, 0xc4990a16, 0x431a1a01, 0x53004360, 0x032c06a7, 0x3b00c301, 0x17250000, 0x010f0616, 0x2f240482,
+    0x010e0701, 0x06210482, 0x55048426, 0x2722066a, 0x09823626, 0x1f362624, 0xc34d3701, 0x36372208, 0x08318216, 0x07011e22, 0x0a2ecb01, 0x123f0d08,
+    0x3e0e1404, 0x091c0310, 0x1c092d2d, 0x0e3e1003, 0x3f120414, 0x2e0a080d, 0x0a211d8f, 0x211d8a1b, 0x0e892dc0, 0x83070e21, 0x0e07212c, 0x1b224a87,
+    0x1d8d2d0a, 0x8a2f2f21, 0x531b2068, 0x0028088f, 0x26008101, 0x3e003600, 0x1426c782, 0x16012b06, 0x02840706, 0x012a232b, 0x27262223, 0x013d012e,
+    0x27b78234, 0x32333637, 0x07060716, 0x05210582, 0x0d787a15, 0x38079445, 0x121b0002, 0x12010d64, 0x060e0c0a, 0x0e012827, 0x12472301, 0x1f1c0c08,
+    0x29048245, 0x050a1c1a, 0x1b129509, 0xd24660fe, 0x1c220809, 0x0c0c100c, 0x1a11f810, 0x120f2b0d, 0x24230825, 0x0d010324, 0x0d1fac09, 0x1d132d0d,
+    0x0d0c182b, 0xaf7f121a, 0xba0e2107, 0x0c232a83, 0x42030000, 0xb3890510, 0x26331324, 0x9b822627, 0x011e1722, 0x2005bb6e, 0x84778207, 0x2e3722ba,
+    0x47028301, 0x05200591, 0x200eb26a, 0x060a4c16, 0x09952d2b, 0x1a1c0a05, 0x45080c1c, 0x2204821f, 0x82234712, 0x27282eb7, 0x0a0c0e06, 0x640d0112,
+    0x011b1b12, 0x0782479d, 0x841a0e21, 0x24013e84, 0x2b180c0d, 0x0d2d131d, 0x09ac1f0d, 0x2403010d, 0x25082324, 0x0d2b0f12, 0x1a12111a, 0x64401814,
+    0x84d42009, 0xeb5218df, 0x41c02009, 0x13270767, 0x011d1632, 0x84171636, 0x1c152502, 0x06141501, 0x2a050f6d, 0x27012e27, 0x36343526, 0x82171617,
+    0x8f132005, 0x065843b3, 0x31418820, 0xc001212a, 0x92339341, 0x351724b3, 0x82060706, 0x3e37229b, 0x05bf7601, 0x011e1722, 0x2722ba85, 0x0283010e,
+    0x2323c482, 0x51132622, 0x0624096d, 0x2622012b, 0x20077c78, 0x2c33415c, 0x95411320, 0x0e675f31, 0x00002522, 0x07825c18, 0x33270724, 0x094e3632,
+    0x36372305, 0xea7a2f34, 0x14200805, 0x3216011f, 0x3436013f, 0x91ce6701, 0xdb91ce91, 0x0e0ab74c, 0x4cb70a0e, 0x070b0707, 0x07840714, 0x14200282,
+    0x38200a82, 0x912b1b82, 0x0e4801ce, 0x0e0a100a, 0x82150748, 0x85072112, 0x85202082, 0x15202783, 0x820d9760, 0x56122073, 0x342205b7, 0x54181737,
+    0x072108ac, 0x876b8806, 0x05af5d7b, 0xb75d7297, 0x6673a806, 0x27210763, 0x08294937, 0xdb851720, 0x7b66eb8b, 0x66549705, 0x9197058e, 0x20115b41,
+    0x07954600, 0x094f5a18, 0x22262724, 0xeb8d010f, 0x9706b559, 0x06bc5974, 0x33087598, 0xff000009, 0x01f001c8, 0x000500b8, 0x0013000d, 0x00220019,
+    0x0031002b, 0x003d0037, 0x3e230100, 0x06163201, 0x16333734, 0x25230714, 0x1e272623, 0x07062501, 0x05221582, 0x11821516, 0x27343627, 0x23171407,
+    0x29208226, 0x0e331706, 0x17262201, 0x07823736, 0x33252a08, 0x012e1716, 0x0bb05001, 0xad303a30, 0x0303ba03, 0x6c4201ba, 0x5335230f, 0x0e24eafe,
+    0x0153166c, 0x7209096b, 0x03fd0303, 0x20078372, 0x20278428, 0x21198494, 0x27849ffe, 0x44200136, 0x40c45454, 0x20402020, 0x10325ca0, 0x5c325b4b,
+    0x209e4b33, 0x21250082, 0x1e40213e, 0x21058222, 0x22827f21, 0x17834a20, 0x21837e20, 0x0000002f, 0xffffff02, 0x010502bf, 0x001c00c5, 0x35bd8224,
+    0x0e070616, 0x06072701, 0x3f342622, 0x37362601, 0x1e17013e, 0xe1530f01, 0x44002005, 0x4208069b, 0x1409fc01, 0x26501e1b, 0x253513d5, 0x120dd513,
+    0x244a1b1d, 0x4a050307, 0x054b440b, 0x143cfe0d, 0x0e140e0e, 0x49245301, 0x0d121d1c, 0x352513d5, 0x5125d613, 0x09141b1d, 0x4b050d02, 0x054a0b44,
+    0x828efe03, 0x140e2121, 0x00217e82, 0x3c7f8206, 0x010002f0, 0x001500a1, 0x0033002b, 0x00530043, 0x13000063, 0x0f141617, 0x2f220602, 0x59421801,
+    0x2014900e, 0x06d94206, 0x5c06636b, 0xe16d098f, 0x0fc36a0e, 0x03118c2b, 0x040f4903, 0x042f040a, 0x29068204, 0x03401703, 0x0311040a, 0x138e4804,
+    0x1c285c2a, 0x011d281c, 0x090907e1, 0x940abf7f, 0x109c290b, 0x48040904, 0x30030310, 0x0f274a82, 0x3f160404, 0x8211a304, 0x8252820a, 0x04092165,
+    0x12821982, 0x831cb121, 0x6c0c2051, 0x40082268, 0xfffbff01, 0x010502bc, 0x001000c0, 0x16320100, 0x1411010f, 0x26012f06, 0x2627013d, 0xe8013336,
+    0xb90b0c10, 0x0a500c1a, 0x100c0bb9, 0x0b1ec001, 0x0ffafeb9, 0x0838080d, 0x0bb9ce0c, 0x0000001e, 0x089b5203, 0x27001327, 0x00002b00, 0x05605c25,
+    0x82222121, 0x43332042, 0x37200694, 0x09906818, 0x08082245, 0x23352323, 0xc0400115, 0x60fe131d, 0x09c01d13, 0x09076007, 0xfe1d1390, 0x50131d00,
+    0x13a0131d, 0x7080401d, 0x27108230, 0x3090131d, 0xd7090907, 0x502a1682, 0x13301d13, 0x30131d1d, 0xaa822020, 0xffffff29, 0x010002bf, 0x553b00c1,
+    0x362208d5, 0x5482013b, 0x3420be84, 0x2105c469, 0x5e4d3533, 0x8233200d, 0x07f9577e, 0x23013d2d, 0x16323315, 0x074f6001, 0x824f0714, 0x65332dde,
+    0x074f0c1d, 0x1d0c4f07, 0x0d103365, 0x16930a82, 0x21881620, 0x840b0c21, 0x0d0c2238, 0x8c388c10, 0x53002016, 0x803806bb, 0x0700a001, 0x1d000f00,
+    0x39002500, 0x00004700, 0x34262236, 0x14163236, 0x4208a745, 0x2b280549, 0x27012e01, 0x012a3336, 0x49181d85, 0x272013ad, 0x0c815218, 0x26347a27,
+    0x01263426, 0x2006849a, 0x0a521820, 0x5c922809, 0x425c4242, 0x6b433023, 0x432605f6, 0x46210930, 0x5218d721, 0xe0200965, 0x02873582, 0x51184620,
+    0x328208fc, 0x625c422f, 0x141d3043, 0x1d141c1c, 0x10104330, 0x4c52180d, 0x43002007, 0x002208c7, 0xc582c101, 0x00004b27, 0x0f141601, 0x05c44301,
+    0x17163622, 0x0f230182, 0x45010e01, 0x272a067d, 0x35262726, 0x36013f26, 0x25843616, 0x27200e82, 0x3e210e82, 0x06294501, 0x15212e83, 0x823e8216,
+    0x82342018, 0x01230826, 0x442c2c47, 0x2c597e2c, 0x01130726, 0x07030901, 0x1501150d, 0x43153c15, 0x05051515, 0x160c0107, 0x9b6a1609, 0x830a201c,
+    0x0701233e, 0x45827e2d, 0x827e5921, 0x0a082a45, 0x07091a1b, 0x153b150e, 0x2b448216, 0x0405153c, 0x0c120804, 0xb0100a15, 0x09201e9d, 0xdc824284,
+    0xff00002a, 0x018002e0, 0x001b00a0, 0x2806eb50, 0x26222123, 0x37363435, 0x24048234, 0x17163233, 0x08048236, 0x02141535, 0x4b3a2c1a, 0x3c90fe35,
+    0x5e2a3654, 0x154a2c42, 0x38281d18, 0x2e4609dd, 0x3c544b35, 0x050f4a2f, 0x2c5e4203, 0x28381024, 0xff020012, 0x01c0fff4, 0x82c001cc, 0x82252053,
+    0x06162155, 0x18050357, 0x2212a857, 0x74273307, 0x07310541, 0x2816b501, 0x2acefe2a, 0x08751628, 0x0a0e0e0a, 0x2f0483d0, 0x30acb608, 0x2c064006,
+    0x23494923, 0x0a0e97bd, 0x2a05c44d, 0x69970e0a, 0xa00a084e, 0x43080aa0, 0x01210597, 0x24bf82c5, 0x002f0027, 0x276d8237, 0x06071617, 0x07012f22,
+    0x20052c58, 0x23bd8234, 0x06273717, 0x09174d18, 0x36371723, 0x78238232, 0x2f560710, 0x16013707, 0x180909a6, 0x19741846, 0x38503807, 0x06072838,
+    0x07062121, 0x0c823828, 0x7419072b, 0x09184618, 0x1a97fe09, 0x08b64c13, 0x09a6c029, 0x73191908, 0x84121119, 0x21012323, 0x37840121, 0x82111221,
+    0x08192314, 0x29844609, 0x84edfe21, 0x053f4406, 0x8201c021, 0x11002701, 0x2c002300, 0x6b4e0000, 0x05705707, 0x16141127, 0x16141333, 0x0d39783b,
+    0x1d161739, 0x33352301, 0x40011732, 0xf0fe0a0e, 0x0a0e0e0a, 0xa8172148, 0x87680a0e, 0x79a8270e, 0x0a066007, 0x1a832807, 0x0a700129, 0x17d8fe0e,
+    0x82580121, 0x87f82007, 0x07493b11, 0x0760060a, 0xffff0100, 0xc101bfff, 0x3200c101, 0x26170000, 0x36013f36, 0xb2421732, 0x270d8307, 0x0f16011f,
+    0x16170601, 0x34201882, 0x2106bc42, 0x0c823216, 0x28081785, 0x012b2b22, 0x5e22d12c, 0xb7212121, 0x15164016, 0x0c8f1601, 0x0b0b170b, 0x08090990,
+    0x0f0fb707, 0xd20f280e, 0x1948331a, 0x2f1584ac, 0x127e2dac, 0xd72d7f2d, 0x5f222222, 0x0117bb21, 0x16275582, 0x160b0b93, 0x82930b0c, 0xba08332f,
+    0x0f0f2a10, 0x4b1bd60f, 0x0cb01a35, 0x0c0b160c, 0xc7412db0, 0x01c02e06, 0x001100a0, 0x00280019, 0x15160100, 0x09f35711, 0x32213324, 0x32470217,
+    0x34132606, 0x2b26012f, 0x05696a01, 0x01353224, 0x956c0eb2, 0x140c3808, 0x2536990e, 0xa0253625, 0x04040304, 0xe80c0ce5, 0x0e3e010c, 0x6cf4fe14,
+    0x0e2207ef, 0x1d828efe, 0x01362524, 0x2182040c, 0x0c680c23, 0x3aff6c0c, 0x00000328, 0xc001fcff, 0x8b598401, 0x75002006, 0x697606a9, 0x4f052008,
+    0x212006c5, 0x2005f544, 0x750f8f23, 0xbe750a09, 0x05527411, 0x093c0126, 0x09072807, 0xa0200484, 0x00210a94, 0x09437400, 0x89820720, 0x27001726,
+    0x47003700, 0x20099569, 0x06d54716, 0xdd470787, 0x281c222f, 0x21028e1c, 0x1f74f001, 0x90012121, 0x84203484, 0xa747058a, 0x062b0823, 0xe0fffcff,
+    0xa0010002, 0x3a002a00, 0x5a004a00, 0x94007400, 0x1e370000, 0x06141501, 0x26272223, 0x1736013f, 0x35323316, 0x53012b34, 0x37200600, 0x25071766,
+    0x1530011d, 0xde8f0714, 0x8e760f8f, 0x5f27200f, 0x35240540, 0x34352223, 0x3b255c82, 0x011d3201, 0x22038233, 0x83072314, 0x013e2b19, 0x22233435,
+    0x012f0607, 0x09453726, 0x07406a05, 0x0e3e2335, 0x1518180e, 0x06060910, 0x08070b05, 0x0804100e, 0x82030105, 0x1706280c, 0x0b390808, 0x41a10105,
+    0xa02a2125, 0x08100808, 0x02080108, 0x08831805, 0x0c442b08, 0x06091a19, 0x08070904, 0x1a0e070a, 0x19171c11, 0x08082701, 0x0c13042f, 0x07091a12,
+    0x06090a09, 0x08090803, 0x07080702, 0x2f820606, 0x01040b25, 0x489d0607, 0x5a7509fd, 0x0bbb7a0a, 0x2a82e020, 0x02084023, 0x20a08202, 0x340a8258,
+    0x15040ba0, 0x08050f1d, 0x07060804, 0x14130807, 0x0e171014, 0x21178203, 0xe3480200, 0x002f2208, 0x1281534d, 0x26272622, 0x2106d648, 0x4818011f,
+    0x272d0755, 0x22012b26, 0x16141506, 0x1633021f, 0x20158217, 0x220f8206, 0x82012f26, 0x013f2c29, 0x17323336, 0x32013b16, 0x42343536, 0x22080632,
+    0x09090720, 0x02136607, 0x44344801, 0x01103d25, 0x032b0901, 0x0e040a04, 0x1a12421f, 0x16570e11, 0x9301045e, 0x0a05781a, 0x061d1b28, 0x27493306,
+    0x37830120, 0x0801162c, 0x0e121a1c, 0x601b0417, 0x17900c0c, 0x00001722, 0x7745d384, 0x002f2305, 0xa143003f, 0x05ee6107, 0xab821420, 0x3222b982,
+    0xca573d36, 0x24178b07, 0x3d262206, 0x0f2c4201, 0x9020bf84, 0x2023c483, 0x8a2f422f, 0x845e240d, 0x7570015e, 0x02620a91, 0x07092105, 0xa0242282,
+    0x212f2f21, 0x260a9a41, 0x5e5e42a0, 0x8afea042, 0x0ccb6621, 0x13000f28, 0x1b001700, 0x8d551f00, 0x23352312, 0x03823715, 0x07860520, 0x250b895e,
+    0xa0a0a0b0, 0x04838001, 0x240ca471, 0x606080fe, 0x180287a0, 0x23086765, 0x00c00100, 0x2b072b44, 0x1300002b, 0x013f012f, 0x010f011f, 0x07210785,
+    0x220b8705, 0x58071416, 0x342e05f4, 0x32360137, 0x27370717, 0x2010e007, 0x03821020, 0x351ba024, 0x03821b35, 0x86450121, 0x09622c08, 0x0994fe09,
+    0x09550a1a, 0x826c0109, 0x573b2507, 0x60015633, 0x10222b84, 0x2b846010, 0xb51b1b22, 0xf7220786, 0x2d831a0a, 0x82550921, 0x262d8207, 0x3356c209,
+    0x18040057, 0x4708ef68, 0x3c2005cb, 0x27088342, 0x0614012b, 0x23352622, 0x28760585, 0x011d2809, 0x011f3233, 0x47011d16, 0x078707cd, 0x2735372f,
+    0x70021523, 0x07090907, 0x38503830, 0x36038280, 0x1c1c1410, 0x14400114, 0x0e142c1c, 0x2cfe0e64, 0x281c1c28, 0x845c011c, 0x64802c06, 0x0709602c,
+    0x28090720, 0x83283838, 0x22298503, 0x8230141c, 0x6c14222a, 0x0aff4470, 0x640cb427, 0x00000070, 0x30038206, 0x01800200, 0x000f0080, 0x00190014,
+    0x00260021, 0x12b1412b, 0x26343328, 0x36323523, 0x8c522335, 0x35052507, 0x37150622, 0x1628ca82, 0x130d6002, 0xc0fd0d13, 0x102e0583, 0x1b1b2540,
+    0x42ef4025, 0x2f422f2f, 0x0a826001, 0x01254026, 0xfe0d1380, 0x012b1d84, 0xfe130d40, 0xa0251bb0, 0x82f01b25, 0x503822c9, 0x232e8268, 0x251b40e0,
+    0x002d7082, 0x01570007, 0x00000139, 0x1300000b, 0x095c7e21, 0x02011f2f, 0x81090a0d, 0x81061006, 0x00010a09, 0x820a8219, 0x00192109, 0x01200082,
+    0x60203382, 0x09203382, 0x25203383, 0x28059e60, 0x16011f32, 0xfe210106, 0x203489fe, 0x26338d60, 0x00270017, 0x845901c0, 0x4c112067, 0xc020097c,
+    0x01212587, 0x853c8b41, 0x82002067, 0x85a92033, 0x05607333, 0x87057148, 0x8b3f2032, 0x0b634da3, 0x74050343, 0x1324108b, 0x21112311, 0xf7420382,
+    0x8001220d, 0x0f6358a0, 0xff000123, 0x2a038300, 0x00020000, 0x01f8ff0d, 0x82880133, 0x001723b7, 0x4b183700, 0x25220a56, 0x346b0616, 0x32363305,
+    0x10ee2917, 0x07770b0c, 0x0b770714, 0x0b0f010c, 0x0f87100c, 0x821ea021, 0x23158216, 0x1e0b691e, 0xd8820a84, 0x53850120, 0x82a00021, 0x8b518c53,
+    0x28388845, 0x00010000, 0x01e0000d, 0x21838434, 0xa94d2500, 0x1701210a, 0xe020768a, 0x77225e84, 0xb3821e0b, 0x022b6482, 0x00800100, 0x0038001d,
+    0x77360100, 0x3d3208a6, 0x17363401, 0x041e1716, 0x37033e32, 0x2e220736, 0xfe5b2302, 0x06734806, 0x0706073a, 0x01020e22, 0x1c0703f6, 0x1460fe14,
+    0x2103071c, 0x0e170279, 0x15141516, 0x3b080582, 0x08d27602, 0x011b0e17, 0x1c09347a, 0x14a00114, 0x7d31091c, 0x170e1b01, 0x04030101, 0x1c14cc04,
+    0x04cc141c, 0x58190203, 0x0d091202, 0x0a0d0606, 0x65550211, 0x5915090b, 0x130c0728, 0x13281d83, 0x5b26070c, 0x000b0915, 0x00259482, 0x01c8ff00,
+    0x05235df9, 0x2b069357, 0x1d32013b, 0x33013e01, 0x010e011e, 0x260aaa47, 0x23263436, 0x54070622, 0x310806e8, 0x0705c8d4, 0x230c300c, 0x90673661,
+    0x5f679101, 0x22090a47, 0x42320908, 0x49676749, 0x62194a2b, 0xe0070705, 0x0cc80507, 0x2b274e0c, 0x91cd9101, 0x1f820940, 0x672c082b, 0x21276792,
+    0x05300507, 0x4f7b8507, 0x37210513, 0x06136700, 0x2106dc50, 0xd34a0727, 0x0beb5005, 0xdf642720, 0x37173a10, 0x01173236, 0x7c0707f9, 0x17071308,
+    0x28060707, 0x09090651, 0x091b0973, 0x2506852e, 0x05285106, 0x1a831407, 0x06827d20, 0x07071624, 0x0f837105, 0x0c82f920, 0x82077d21, 0x07142216,
+    0x20328305, 0x8233821b, 0x82068432, 0x83062032, 0x0813221a, 0x8221867c, 0x25ab8332, 0xc0fffeff, 0x737a4401, 0x32012a05, 0x06030716, 0x3f262223,
+    0x21048401, 0x9a6d013e, 0x28013405, 0xb0070e0e, 0x0e0c0e07, 0x0b772e03, 0x0120010e, 0x8290090e, 0x012a330c, 0xfe0c1820, 0x0c120cd0, 0xf00b10c2,
+    0x0b130c09, 0x77180082, 0x0f270cc7, 0x45003500, 0x18005500, 0x2710a951, 0x35231537, 0x013b3634, 0x2712724d, 0x1d163233, 0x23352301, 0x457e2182,
+    0x06a74a0f, 0x2508557e, 0x13130d80, 0x0483600d, 0x17304825, 0x8328ca0f, 0x27138409, 0x170fca28, 0x4830c030, 0x01211f88, 0x200a8850, 0x82328660,
+    0x30502537, 0x40170f3a, 0x40270f89, 0x303a0f17, 0x89503030, 0x82098911, 0xff023ed7, 0x02c0fffe, 0x00c00142, 0x0043002d, 0x06162500, 0x06012e27,
+    0x27220607, 0x23072e30, 0x84098422, 0x37262410, 0x5c37013e, 0x7608060f, 0x3605011e, 0x15173233, 0x22230614, 0x3e262726, 0x16171601, 0x35363233,
+    0x0c014002, 0x37351a08, 0x030c0419, 0x08080404, 0x120f0e0b, 0x14281f09, 0x19040c03, 0x081b3437, 0x8f15010c, 0x131a135c, 0xd5fe8f5c, 0x1010110f,
+    0x2a19212f, 0x190c0508, 0x0b040517, 0x08a70907, 0x0d1c070a, 0x07072b23, 0x0b0c0807, 0x05080a0c, 0x07072227, 0x1c0e242b, 0x63080a07, 0x83120a7a,
+    0x0a1232ee, 0x0e0e787a, 0x1d2f2182, 0x09180d18, 0x090b0c0c, 0x73471807, 0x00152a0a, 0x002f001d, 0x13000038, 0x08b07915, 0x17323622, 0x23057e41,
+    0x22360622, 0x2105e963, 0x4c183317, 0x2a080845, 0x013b3634, 0x37161415, 0x33352315, 0x16011f32, 0x0e0a6880, 0x12510a0e, 0x0a51124a, 0x2117880e,
+    0x0e0e142a, 0x68a00e14, 0x83f00a0e, 0x0e883818, 0x0a066072, 0x01074207, 0x0a0ee808, 0x0e0a5001, 0x0a0e2020, 0x82792148, 0x140e2324, 0x2383c8ea,
+    0x0a300123, 0x2245820e, 0x82600626, 0x82002027, 0x00033200, 0x01bfff00, 0x00c10160, 0x0020000d, 0x17000030, 0x22808235, 0x4b06010f, 0x0322054e,
+    0xa0823634, 0x0714152c, 0x15300706, 0x26313423, 0xd67c2627, 0x06222105, 0x323c9982, 0x36343536, 0x1105a060, 0x113e110a, 0x60051209, 0x674a4b64,
+    0xa00f252c, 0xb02c250f, 0x3d05827c, 0x2f090e09, 0x0a262606, 0x0e0e1a08, 0x2001081a, 0x49676947, 0x302b3242, 0x2b300101, 0x1d829232, 0x832e4221,
+    0x2f212128, 0x9b498b86, 0x00072405, 0x1855000f, 0x2109bd5b, 0x517d3406, 0x011e2306, 0x044e011d, 0x013d2705, 0x15373634, 0x8586010e, 0x35272626,
+    0x32161716, 0x14839b82, 0x1f272482, 0x013f1601, 0x82012f36, 0x1d1623a0, 0xe2770701, 0x82362005, 0x262d0835, 0x6a150127, 0x4b6a4b4b, 0x0e140ef8,
+    0x36ca140e, 0xfe131a4a, 0x401a139a, 0x21171130, 0x1216212e, 0x3a1c0b0c, 0x0104011d, 0x1f0e241c, 0x24078208, 0x30301308, 0x24088413, 0x1c240d20,
+    0x223982c0, 0x83fd6a4b, 0x0e40083a, 0x354e029f, 0x1a1a132d, 0x4b312d13, 0x1d055108, 0x21211713, 0x051d1317, 0x0a030252, 0x2e01010a, 0x2c1d2c05,
+    0x0104020e, 0x02081007, 0x19201b03, 0x041c1e19, 0x07100802, 0x0d020701, 0x052c1d2a, 0x2c09e75c, 0x00c20100, 0x0047003f, 0x16320100, 0x06ea5c15,
+    0x2006865b, 0x71c68236, 0xeb8206a8, 0x82323321, 0x08cb71c3, 0x22050e41, 0x84011e07, 0x37262316, 0x5548013e, 0x01490807, 0x20261bbf, 0x67474967,
+    0x0b493702, 0x100a3f08, 0x0b020302, 0x28391f09, 0x0a1f3827, 0x0204020b, 0x083f0a10, 0x0237490b, 0x422e2d41, 0x24010121, 0x09090e14, 0x5001090e,
+    0x12251b25, 0x5f634571, 0x39590b44, 0x020d099b, 0x2036820c, 0x273e8210, 0x38287b06, 0x067a273a, 0x10353882, 0x0d010b09, 0x9b090d02, 0x290c5839,
+    0x712b3d3a, 0x251a2612, 0x243d8250, 0x00000e09, 0x08334c04, 0x0d00092b, 0x21001700, 0x11170000, 0x05a36b34, 0x1503112f, 0x11173533, 0x012b0614,
+    0x16323311, 0x08064301, 0x141c8030, 0xc01c14a0, 0x141cc080, 0x1c143030, 0x048260fe, 0x20200a82, 0x3106cc5f, 0x20800170, 0x00ff5020, 0x60011c14,
+    0x1cbcfe1c, 0x0a820114, 0x00000039, 0xffffff02, 0x01c101c0, 0x000500c0, 0x16000029, 0x33352622, 0x5f163714, 0x352906b4, 0x37363734, 0x3435023e,
+    0x091a4436, 0x14153908, 0x1617011e, 0x802634fa, 0x0e120997, 0x120e80fe, 0x0f020109, 0x38481411, 0x38131a13, 0x0f111448, 0x1b254002, 0x0c0a711b,
+    0x0d13130d, 0x03010a0c, 0x2c43180f, 0x150b563a, 0x15280f83, 0x2c3a560b, 0x030f1843, 0x03237b82, 0x53fff9ff, 0x11270527, 0x27001900, 0x4f370000,
+    0xe08309db, 0x06142608, 0x15231323, 0x34363233, 0x22211326, 0x36372627, 0x07322133, 0xc0060706, 0x0a0e3828, 0x4b358801, 0x3820354b, 0x08d88228,
+    0x26261a2c, 0x2100fe16, 0x020d090c, 0x0f480203, 0x081a0504, 0xe8283840, 0x6a4b0e0a, 0x0138284b, 0x34268020, 0x2080fe26, 0x17010718, 0x7a83091d,
+    0x00070024, 0x2743ff00, 0x821b2005, 0x00333079, 0x0047003b, 0x006f0053, 0x21150500, 0x6a3b3435, 0xf7820551, 0x2805bd4c, 0x15163233, 0x03323311,
+    0x06205123, 0x34013d25, 0x18323307, 0x20082e5e, 0x23178317, 0x37343533, 0x4b181f8b, 0x352209f6, 0xbc7b3327, 0x18338408, 0x3c08da5e, 0x0114011d,
+    0x0c40fec0, 0x580a0e14, 0x0a700a0e, 0x0e0a580e, 0x288c0c14, 0x0c280c0c, 0x240584b4, 0x400c2874, 0x6f098434, 0x0a26061b, 0x0614061a, 0x0282061a,
+    0x2c330683, 0x010c1414, 0x480e0a68, 0x0a0e0e0a, 0xfe0a0e48, 0x82200198, 0x6f02823b, 0x80250664, 0x0c54540c, 0x20128560, 0x2156830c, 0x3c88f40c,
+    0xbf4c4384, 0x01802c08, 0x002700c0, 0x004b002f, 0x4c580053, 0x37203125, 0x431ab17c, 0x414c0751, 0x08c02427, 0x82300838, 0x20068603, 0x294f4c9c,
+    0x368adc20, 0xf0380823, 0x2539831c, 0x70640cb4, 0x53430500, 0x000d2c08, 0x001b0011, 0x00490025, 0x70111700, 0x3320099d, 0x20185943, 0x4c711805,
+    0x60353321, 0xa0141c20, 0xe0201c14, 0x141cc080, 0x1c141010, 0x048240fe, 0x012c0a82, 0x30070920, 0x07200709, 0x09073009, 0x20210a8a, 0x06a04301,
+    0x43a0fe21, 0x90201399, 0x3a842f8f, 0x00000023, 0x24c78401, 0x00a00180, 0x05a7492f, 0x0723022e, 0x2b143233, 0x35333501, 0x27230723, 0x33260682,
+    0x37352735, 0x01822335, 0x17333722, 0x35201582, 0x41081f84, 0x02173317, 0x80606020, 0x28751830, 0x10731515, 0x0b224330, 0x40403008, 0x220b0830,
+    0x73103043, 0x75281515, 0x15e03018, 0x10101516, 0xa40c0c94, 0x10450b50, 0x082a0803, 0x0b451003, 0x0c0ca450, 0x97441094, 0xc0012105, 0x19267b82,
+    0x2e002200, 0x8e823a00, 0x21058553, 0x3044010f, 0x34112107, 0x29063067, 0x26343517, 0x3715012b, 0x445e0636, 0x06222405, 0x8b14011d, 0x7001260b,
+    0x151a2f21, 0x07755551, 0x0a100124, 0xe582400e, 0xb7093728, 0x0e09090e, 0x05845709, 0x2f60012f, 0x27188121, 0x0a2a240a, 0x010a0e0e, 0x2d058390,
+    0x0781d128, 0x0419b809, 0xe0070945, 0x048d0907, 0x08b74d18, 0x0f00a024, 0x4e183300, 0x33250d35, 0x07163221, 0x20878323, 0x849b8423, 0x3b162291,
+    0x5a9f8301, 0x3d24076d, 0x01263401, 0x2606a772, 0x6001141c, 0x72701c14, 0x0920087b, 0x26098672, 0xfe700109, 0x851c14a0, 0x441c2521, 0x50500709,
+    0x0a888988, 0xc74e8b8c, 0x43052012, 0x42181a31, 0x40200c21, 0x500ee97f, 0xfc200c8c, 0x320df07f, 0x00180002, 0x01a8011f, 0x00140061, 0x3f000029,
+    0x5a323601, 0xc44b05b4, 0x7c07200a, 0x142208b5, 0x1786010f, 0x88e02722, 0x2405964b, 0x07076060, 0x240a8216, 0x07b90788, 0x21138e07, 0x874b88d1,
+    0x22238205, 0x84170714, 0x841b201e, 0x210c822a, 0x15870714, 0x838cf782, 0x2c4c3720, 0x0a6a7c08, 0x087e7418, 0x0a405f18, 0x83a31720, 0x83a6af20,
+    0xffffff27, 0x014101f8, 0x05074188, 0xfe883720, 0x36228c88, 0x1b412732, 0x22062307, 0x1786012f, 0xa4b13721, 0x41c0205f, 0x2d410e19, 0x02002113,
+    0xfe88838e, 0x200ad67d, 0x12435e17, 0xc98f0721, 0x00012883, 0x001f0018, 0x186101e8, 0x2009f742, 0x09f54116, 0x26012f24, 0xca902034, 0x2012e641,
+    0x41478c00, 0xbc4114d1, 0x12aa4111, 0xff010029, 0x015800ff, 0x83280141, 0x4113208f, 0x80411395, 0x91012012, 0x820020a3, 0x204b8500, 0x734b8540,
+    0x362105eb, 0xe3611832, 0x010f2308, 0x48412206, 0x90602012, 0x05cf54ee, 0x01400227, 0x001f00c0, 0x086f5223, 0x17012b30, 0x14163233, 0x22212306,
+    0x3b363426, 0x6a493701, 0x01332f06, 0x02112111, 0x1c1c1410, 0x4810c014, 0x455a0e0a, 0xc0102108, 0x01221383, 0x4982fed0, 0xfe141c22, 0x30230d82,
+    0x820e140e, 0x1c302c02, 0x14400114, 0x01a0fe1c, 0x4be0fe20, 0x022107a3, 0x246f8280, 0x00210017, 0x12155625, 0x3b161427, 0x37363201, 0x45698213,
+    0x0320054f, 0x02350982, 0x26090770, 0x1a00fe1a, 0xef070926, 0x0e3d0d14, 0xfec20112, 0x05745000, 0x80fe4037, 0x10070920, 0x1a26261a, 0x0b090710,
+    0x010f1115, 0x01b0fe70, 0x24918250, 0x0001dcfe, 0x557582ff, 0x0f220bb7, 0x57531700, 0x08b55b11, 0x35829020, 0xdf441420, 0x1aa32705, 0x131a1313,
+    0xf950c001, 0x216b8505, 0x7f5b20fe, 0x00022506, 0x01c0ff00, 0x0020ed82, 0x2b254f8b, 0x35262201, 0x88b68211, 0x8310204f, 0x83e0204f, 0x9b632004,
+    0x0a2b574e, 0x39001c22, 0x4f081541, 0x47560739, 0x06222309, 0x6618011d, 0x1c8d0ed8, 0x83d00121, 0x14802c6c, 0x08425e1c, 0x0a0e0e0a, 0x91261a08,
+    0x82d38211, 0x141c2e21, 0x0e5e42f0, 0x0e0a300a, 0x1c401a26, 0x8f118f14, 0x18012093, 0x460d434e, 0x2320053c, 0x9106b64a, 0x09055793, 0x82013321,
+    0x208e8981, 0x06466b50, 0x0121118e, 0x848f9ea0, 0x820020a1, 0x00072600, 0x02c0ff00, 0x08735600, 0x55001f21, 0x002105df, 0x06616400, 0xa15a0220,
+    0x05f54d06, 0x20342622, 0xb15a1786, 0x01811807, 0x86002007, 0x30012727, 0x1c1c281c, 0x04832828, 0x84ec1c21, 0xc0fe2105, 0x15201284, 0x01210c84,
+    0x21068442, 0x0684f6fe, 0x84a40121, 0x60fe2106, 0xec202184, 0x11840584, 0xd6559320, 0x4201210a, 0x00210c84, 0x6f451801, 0xe146180a, 0x05cb6508,
+    0x4c06b365, 0xb36405f3, 0x05435705, 0x200a1366, 0x06d54f04, 0x30071f6b, 0x012e3617, 0x27220607, 0x17010e26, 0xce913216, 0x27028291, 0x131a5501,
+    0xb3131a13, 0xa32d0584, 0x07110706, 0x07236e23, 0x2d050512, 0x2062868c, 0x08655e17, 0x971a132e, 0x07031107, 0x04082a2a, 0x00360810, 0x162b7bad,
+    0x2627013e, 0x1e060722, 0x93363701, 0x858a207b, 0x852d2074, 0x207b9282, 0x207584c7, 0x92818436, 0x5c1f207b, 0xf7860a63, 0x34321727, 0x1422012b,
+    0x78901833, 0x20f18507, 0x25ea84b5, 0xc0101090, 0xa5431010, 0x84b82006, 0x23e88519, 0x802020ad, 0x6385f184, 0x021f0038, 0x00600181, 0x002b000f,
+    0x003b0033, 0x16320100, 0x22230614, 0xc45f2327, 0x17332105, 0x4b1a8b48, 0x7f8707bd, 0x42e0012a, 0x43425e5e, 0x432f5c2f, 0x58240883, 0x180c340c,
+    0x06860382, 0x1722c726, 0x57172217, 0x01260584, 0x5e845e60, 0x04823030, 0x218aac20, 0x40340c22, 0x17222182, 0x05844922, 0x0d209f82, 0x00240382,
+    0x80014002, 0x8d4d9f82, 0x003f3005, 0x0057004b, 0x006f0063, 0x0087007b, 0x189f0093, 0x2011cb4e, 0x06444d01, 0x013b1423, 0x375f1832, 0x200ba30b,
+    0x8b3bae05, 0x9625202f, 0x1002253b, 0x1c1420fe, 0x2205b36d, 0x4d5cfe1c, 0x784d0571, 0x21069406, 0x239ab0fe, 0x01241c87, 0x0ce80c20, 0x41860282,
+    0x64845e82, 0x14e0fe24, 0x6c18011c, 0x118b1161, 0x276f5420, 0x3c179d0a, 0x08000400, 0x0002c0ff, 0x0700c101, 0x33002d00, 0x00005700, 0x17011e13,
+    0x27012e15, 0x9b5f1837, 0x07162d1d, 0x33163236, 0x06350732, 0x25361507, 0x06260583, 0x27263527, 0x11852615, 0x36153728, 0x17161517, 0x08821635,
+    0x1d823720, 0xf3363525, 0x820f3209, 0x10df2802, 0x3f3b0e1e, 0x18196924, 0x080cc95f, 0x21050129, 0x301a6847, 0x232822e4, 0x23274d01, 0x3e0c2623,
+    0x37132326, 0x21281c2e, 0x23263f0b, 0x2a202525, 0x0202011b, 0x82440311, 0x07bf2903, 0x11f31212, 0x16222909, 0x0ef05f18, 0x0c0b0d3f, 0x0348e323,
+    0x8a0d460f, 0x48061147, 0x02440906, 0x050b4414, 0x46150147, 0x03460411, 0x280e8507, 0x46180448, 0x04470614, 0x2c008200, 0xffffff02, 0x018002e0,
+    0x0014009b, 0x08116624, 0x013f3422, 0x2208b049, 0x53051416, 0x33270932, 0x15163221, 0x56c20201, 0x9a2105cd, 0x05134b9a, 0x0107c22f, 0xfe0a0e77,
+    0x0e0e0ad0, 0x0a30010a, 0xed4b180e, 0x83be2012, 0x8320201b, 0x00200804, 0xfaff0300, 0x8602bdff, 0x0b00c301, 0x2b001b00, 0x27050000, 0x36133726,
+    0x0716011f, 0x06270603, 0x26078672, 0x17010f16, 0x85050716, 0x2627210f, 0x28053b62, 0x3d170107, 0x0388040c, 0x3205830c, 0x09087d04, 0x900a0a90,
+    0x092b0809, 0x095b5b09, 0x881c0109, 0x842b200a, 0x1240271a, 0xd6010c03, 0x0682030c, 0x0c2afe33, 0x87080974, 0x08870909, 0x08092e09, 0x09085050,
+    0x8209882f, 0x41198210, 0xdc3c060f, 0xa5014002, 0x2e001a00, 0x37130000, 0x011d1636, 0x1415031e, 0x26060706, 0x27263637, 0xa0820982, 0x474c3420,
+    0x261b8205, 0x31150607, 0x82011f14, 0x88273716, 0x331c0cb0, 0x30213e4e, 0x04150b23, 0x1c54391c, 0x7808b00c, 0x15820808, 0x136d2508, 0x0c1c6d13,
+    0x0a980201, 0x04530f0d, 0x2f462915, 0x0819552c, 0x525a0c0e, 0x0d0f540a, 0x1607980a, 0x0716071d, 0x10241d83, 0x1a1a105e, 0x15820482, 0xff010034,
+    0x02bbfffb, 0x00c90109, 0x0100000e, 0x03071636, 0xf974010e, 0x37363d05, 0x2f1cbd01, 0x2d0bbf0c, 0x1b19b025, 0xbc01170a, 0xfe1c2f0c, 0x1b0a1760,
+    0x2d25b019, 0x26074f59, 0x010702c0, 0x183700c7, 0x23116f46, 0x33071135, 0x70054456, 0xee5108fc, 0x11153b06, 0x33352337, 0x011f3637, 0x15010f16,
+    0x0e0ae801, 0x0e280a0e, 0x0e0a300a, 0x0c827393, 0x0f8b2820, 0x0b3bd327, 0x0c0c160c, 0x059d6f3b, 0x01221a84, 0x0d82931b, 0x84080121, 0x25118431,
+    0x6093e5fe, 0x27820c3b, 0xf33b0b23, 0x3a008200, 0xff000004, 0x018001c0, 0x003400c0, 0x0044003c, 0x0100004c, 0x06070614, 0x82020e07, 0x07062204,
+    0xc36a181e, 0x2e352209, 0xdd7a1801, 0x36152708, 0x37023e37, 0x12863736, 0x07184c18, 0x2007c263, 0x062e4612, 0x1e800136, 0x0d150118, 0x321c202d,
+    0x17050a10, 0x2f422f1c, 0x1f19191f, 0x18290684, 0x1e181839, 0x1a010b07, 0x270e8220, 0x090ed7fe, 0x17090e09, 0xf7200584, 0x013c0584, 0x082a1a30,
+    0x13101a2a, 0x08050206, 0x29090805, 0x2f2f2119, 0x072a1b21, 0x1b2a07c8, 0x90290a86, 0x0302060b, 0x180d090b, 0x20128408, 0x2342822f, 0x89fe0e09,
+    0x01210684, 0x82068437, 0xff0332e3, 0x02bfffff, 0x00c10101, 0x002f0017, 0x2500003f, 0x08f06716, 0x83011f21, 0x1614260b, 0x36013f32, 0x05e94217,
+    0x14163222, 0x0b851e82, 0x22263422, 0x13230b82, 0x6b272206, 0x173d065c, 0x07141601, 0x09093001, 0x597e2c2d, 0x08092d2c, 0x2d080828, 0x153c2a15,
+    0x1008082d, 0x25169328, 0x071407e2, 0x984347fe, 0xb9012505, 0x082a0707, 0x59213b82, 0x203b827e, 0x213b8409, 0x3b832a3c, 0x9328dc21, 0xa1fe2316,
+    0x33820707, 0x17071423, 0x38438307, 0x02000714, 0xc0ff1800, 0xc0017a01, 0x30002800, 0x32130000, 0x0e141516, 0xb2661803, 0x023e330a, 0x35013e37,
+    0x22232634, 0x010e0706, 0x012e012f, 0xd16e3637, 0xca400807, 0x251a6e42, 0x0a0e1a25, 0x0d0e0a48, 0x1b13131f, 0x1b192c16, 0x13061622, 0x03082b08,
+    0x3a463f06, 0x283a2828, 0x405ac001, 0x141b3120, 0x0a060b15, 0x0a0a0e0e, 0x0c1b2216, 0x0f150f0b, 0x1a171c16, 0x21202582, 0x5b312d82, 0x39298bfe,
+    0x00392929, 0x00020000, 0x00c0ff00, 0x268f82c0, 0x0026001e, 0x5a333700, 0x33200d91, 0x870da34a, 0x14142988, 0x0c0c0814, 0x0c087008, 0x98200784,
+    0x362a0c82, 0x3c2a2a3c, 0x0c90182a, 0x0d823008, 0x86d40821, 0x210c8207, 0x1882a801, 0x833c2a21, 0x8210206b, 0x82b0206b, 0x0007246b, 0x75000017,
+    0x03200755, 0x20068e56, 0x05d17203, 0x2fb0352a, 0x422f2f42, 0x5e0a0e68, 0x0e25bf82, 0x0e0a420a, 0x05765f31, 0x0f0a472a, 0xf0fe0a0f, 0x0a0d0d0a,
+    0x5083b783, 0x00c00125, 0x5253001f, 0xdf4b083b, 0x64c68309, 0x1623072f, 0x8727011d, 0x170721c7, 0x2f23d289, 0x89060701, 0x18372031, 0x2c09c19b,
+    0x37011f32, 0xf0013336, 0x07090907, 0x2b048360, 0x09071010, 0x0a041002, 0x90090730, 0x21230f83, 0x83214e4e, 0x08432707, 0x05505005, 0x13924308,
+    0x63200121, 0x602509f7, 0x03040709, 0x204c8220, 0x82098290, 0x70702343, 0x06820709, 0x73730723, 0x8a088407, 0x8200200f, 0x00022800, 0x02c0ff00,
+    0x85800100, 0x0ef55bdb, 0x8e013b21, 0xf00320db, 0x21d993db, 0xca8f8001, 0x00200f8f, 0x2a051b47, 0x00a10100, 0x001a0015, 0x65072500, 0x212605c6,
+    0x26012f22, 0x5d523734, 0x25230806, 0x37331707, 0x908ef201, 0x9cfe0c0c, 0x0e600e14, 0x0e00010e, 0x0ea00e28, 0x507cc3fe, 0x8eae4472, 0x820c280c,
+    0x83282015, 0x32158216, 0x507d3128, 0x00000043, 0xff000001, 0x014002bf, 0x824500c0, 0x16322159, 0x26056f5c, 0x010e2223, 0x82011f16, 0x012e2405,
+    0x43363435, 0x152e0556, 0x15011e14, 0x26010e14, 0x3011012f, 0x14821617, 0x33201a82, 0x68083284, 0x3e161415, 0x30013f01, 0x32330607, 0x1b070236,
+    0x141a1d1e, 0x12111131, 0x03030401, 0x2e2d340c, 0x1b23241a, 0x1414241b, 0x13343525, 0x20704012, 0x231a1c27, 0x3a3a2824, 0x13111414, 0x9f320929,
+    0x231b1b26, 0x23231924, 0x04060c0d, 0x11111201, 0x1d191530, 0x1f121b1d, 0x14140917, 0x04040401, 0x0b0a4d01, 0x17320932, 0x2a58831a, 0x12171230,
+    0x08070f08, 0x181f6b45, 0x27097f58, 0x000b00c0, 0x3600003c, 0x2505064e, 0x011d1632, 0x05843714, 0x15070622, 0x260e8c43, 0x2e35013b, 0x18013d01,
+    0x23086f74, 0x36161716, 0x332c0e83, 0x383850d8, 0x07403850, 0x38415709, 0x08a76018, 0x57413833, 0x07100709, 0x39314209, 0x60070954, 0x28a02838,
+    0x27048338, 0x30070968, 0x22096342, 0x04841c84, 0x69092224, 0x37832844, 0x4e332a29, 0x384d0604, 0x82090730, 0xf9ff349f, 0x8702b9ff, 0x2300c701,
+    0x00004300, 0x010f1605, 0x48012706, 0x35200544, 0x2106f979, 0x7f841707, 0x20063f4f, 0x10df4e0f, 0x1726ae84, 0x1617011e, 0xce821737, 0x0c7a0228,
+    0x0c0a1409, 0x0684b3fd, 0xb282b320, 0x0b1a0522, 0x14218184, 0x30b68b4c, 0x293c0a34, 0x12320e07, 0x0d0a0a10, 0x01090c19, 0x210684c7, 0xbf842d8a,
+    0x14100e24, 0xa1821a18, 0x2a22c582, 0xc48d8026, 0x2829072a, 0x01010439, 0x22020627, 0x2c05e744, 0xc001c001, 0x2b000d00, 0x21130000, 0x0abe6a32,
+    0x7d142521, 0x342009b1, 0x1d22be82, 0x73183301, 0x1625080f, 0xa8010c15, 0x05c16a0c, 0x0cc00124, 0x0b8258fe, 0x280c3024, 0x0382800c, 0x1c143038,
+    0xfe0c0001, 0x1c1c14fc, 0x0c040114, 0x240c0c2c, 0x0c341c14, 0x0383340c, 0x00141c22, 0x02220082, 0x1b5afeff, 0x00363106, 0x0100003e, 0x011d1636,
+    0x012f0614, 0x15233526, 0x44052e5c, 0x37370781, 0x0e022a35, 0x010e0705, 0x3637012e, 0x33362637, 0x33071632, 0x6b063734, 0x2b080655, 0x0806b201,
+    0x0aa80608, 0x0e291f28, 0x0e0a900a, 0x1e041f29, 0x12061806, 0x05090d07, 0x08121303, 0x0b3c1e04, 0x221c1e21, 0x810a3a08, 0x08057f47, 0x0801a62d,
+    0x08057405, 0x10021c01, 0x2134081b, 0x0e0e0af8, 0x3521f70a, 0x03021b08, 0x130d0a06, 0x0708090c, 0x0f4c0913, 0x1b2d311b, 0x47120210, 0x7b44066c,
+    0x01012605, 0x002a00c0, 0x24af8232, 0x06141516, 0x26038207, 0x2306010f, 0x183d2622, 0x8209c04e, 0x3435260d, 0x013e013f, 0x2303823b, 0x16173233,
+    0x2308a888, 0x3c4407f9, 0x05620b10, 0x160e0a06, 0x33091a0b, 0x17080109, 0x030e0a68, 0x0c1a0531, 0x48642768, 0x880a2033, 0x2f05d24d, 0x483221ad,
+    0x0d682764, 0x03310519, 0x17680a0e, 0x33302982, 0x16091b0a, 0x05060a0e, 0x3d100a63, 0x9f020743, 0x1806d84d, 0x200b3b56, 0x0957761c, 0x65752520,
+    0x0a567608, 0x32064e76, 0x078896fe, 0x08100714, 0x08656508, 0x13081008, 0x76078807, 0x56210549, 0x210f8587, 0x1f856666, 0x14078722, 0x0c9b5618,
+    0x50001c21, 0x05200859, 0x20066a6d, 0x76f8821f, 0x99200842, 0x20052650, 0x4f5e906a, 0x5fa206a2, 0x21072f76, 0xad750713, 0x21c88807, 0x26762226,
+    0x20459205, 0x20789759, 0x51bf8f00, 0x032007b9, 0x88081641, 0x321624c8, 0x8391f801, 0x76609248, 0x3941060d, 0x42002012, 0x022b07cb, 0x00c10142,
+    0x004a0042, 0x43223700, 0x162705fe, 0x1e012b06, 0x6b351701, 0x664a06e6, 0x1e172405, 0x44141501, 0x15240bb3, 0x2337013e, 0x0e25318a, 0x27262201,
+    0x06674a00, 0x080d2408, 0x08440506, 0x06054408, 0x520e2308, 0x0c0c3430, 0x39241c34, 0x24372828, 0x0705341c, 0x30340507, 0x89230e52, 0x10202e23,
+    0x108eaa8e, 0x131a0001, 0x60131a13, 0x3e3a850f, 0x0631270f, 0x0c280cbe, 0x1f320a05, 0x01013928, 0x321f2738, 0x0507050a, 0xbe070528, 0x87273106,
+    0x57492425, 0x54014957, 0xc7540775, 0x00c12409, 0x4b320026, 0x597508d9, 0x17d57e07, 0x3435172b, 0x1d062226, 0x32161401, 0x18e17e36, 0x22177023,
+    0x7e028217, 0x98251ae8, 0x17171130, 0x21048311, 0x67770400, 0x05b35208, 0x180abb51, 0x83123147, 0x9114237d, 0x028291ce, 0x6c98ac31, 0x836c986c,
+    0x6a4b4b6a, 0x2634664b, 0x42263426, 0xfe210685, 0x221782e1, 0x82cc986c, 0x6a4b2217, 0x2d178275, 0x00003426, 0x08000300, 0xf8017800, 0x5f6a0801,
+    0x24002106, 0x2205cb53, 0x8416023a, 0x07ca5308, 0x2a480127, 0x3c2a2a3c, 0x22048374, 0x84cafe2a, 0x84de2006, 0x82178405, 0x8402821a, 0xff18264f,
+    0x01a800c8, 0x204f87b8, 0x05035412, 0x54023c21, 0x0221052c, 0x20078534, 0x213b8f42, 0x60910801, 0x042e4f82, 0xe0ff0000, 0xa001c001, 0x17000f00,
+    0x5f522900, 0x0aab4506, 0x48183620, 0x17320841, 0x2e353632, 0x06222701, 0x3314011d, 0x1417011e, 0x118f013b, 0x9c413320, 0x282c330b, 0x1c281c1c,
+    0x050704ce, 0x07055375, 0x04553c0b, 0x0c828a0b, 0x827eb121, 0x9266230c, 0xa4680b04, 0x822c820f, 0x05073002, 0x07057553, 0x040b2304, 0x070b3c55,
+    0x85b27d05, 0x6692220c, 0x0c73430b, 0x0a155818, 0x34360525, 0x8326012f, 0x37162195, 0x27062a44, 0xb00c0c6c, 0x0c18180c, 0x2b069a41, 0x071c077f,
+    0x0e0e076b, 0x070e0ed0, 0x0220f382, 0x1b20f38a, 0x20114b57, 0x5f5b1813, 0x26cf8c0a, 0x0c0c0801, 0x8e0cf8fe, 0x0cf823b7, 0x02820c38, 0x1f21578e,
+    0x39721800, 0x765b1810, 0x0116220e, 0x0a875c90, 0x5b18e120, 0x71180e01, 0x62290cf7, 0x160c0bb8, 0x46960c0c, 0x2206820c, 0x820b680b, 0x8c03206b,
+    0x912920c3, 0x0f032b6d, 0x3f160601, 0x012f3602, 0x8b443726, 0x05126405, 0x768c3420, 0x0688b631, 0x39050901, 0x37040488, 0x071e6705, 0x83170714,
+    0x17042209, 0x277f8c07, 0x39882e01, 0x06010905, 0x38242682, 0x071e0904, 0x05222582, 0x25820437, 0xe7471420, 0x41023205, 0x1e00c501, 0x00004000,
+    0x26060701, 0x0e22013d, 0xcb571802, 0x3533230a, 0x7b823634, 0x34071428, 0x33161736, 0x92473732, 0x21232105, 0x08056a58, 0x32013b2c, 0x07060716,
+    0x11012b06, 0x90380221, 0x3f2d1d0b, 0x040c1530, 0x2b1f0914, 0x4a462d1c, 0x900b1d2f, 0x0608c008, 0x0c0c0505, 0x16480a06, 0x1c350805, 0x05097914,
+    0x04151e08, 0x40013305, 0x0b880f01, 0x0a48100c, 0x283b2717, 0x18070d0c, 0x3e2a294f, 0x48091626, 0x880b0c10, 0x05d11407, 0x04010108, 0x59060702,
+    0x06f15d14, 0x0f051227, 0xc0fe0416, 0x06434100, 0x2309b756, 0x3e00001d, 0x14248b82, 0x02262206, 0x26055343, 0x26360534, 0x8206010f, 0x3f162802,
+    0xd8373601, 0x82131a13, 0xce472e02, 0x91ce9191, 0x14067601, 0x050b900c, 0x20068542, 0x221983cd, 0x82050113, 0xce912919, 0x06140c03, 0x900b0542,
+    0x6c180685, 0xa024098f, 0x1a000f00, 0x2111d75e, 0x5e831705, 0x012b2624, 0xbe5e0622, 0x9cfe2b0d, 0x7c08087c, 0xf6080605, 0xb45e0608, 0x84a0200c,
+    0x0f0f2117, 0x820e7342, 0x1135215b, 0x4305735a, 0x252107c0, 0x24c18327, 0x32013b16, 0xef601836, 0x6401210b, 0x10225989, 0x335a6001, 0x43588908,
+    0x57820b23, 0x0f734c18, 0x36371322, 0x20077343, 0x433f9230, 0xc78a0e22, 0x00820020, 0x00000134, 0x4201e0ff, 0x4200a001, 0x17250000, 0x23060716,
+    0x0d4e2622, 0x013b2206, 0x083d6b26, 0x33013e2c, 0x011e1732, 0x2706010f, 0x316b2326, 0x260b8205, 0x1706012b, 0x84163233, 0x821e2009, 0x36373321,
+    0x02093701, 0x4d1f1e0b, 0x051e1370, 0x01150c07, 0x06821602, 0x6f16213b, 0x051b1948, 0x030c0106, 0x2811150b, 0x068a103e, 0x02060107, 0x0202930a,
+    0x08098586, 0x410f7231, 0x0c17162a, 0x030b2c22, 0x07465608, 0x140c1c05, 0x1e050716, 0x0550400c, 0x2c050901, 0x2804020b, 0x1d060923, 0x0917130a,
+    0x27091c06, 0x8802062f, 0x824020bb, 0x823120bb, 0x1d3222bb, 0x06ca4a01, 0x47013b21, 0x3421088f, 0x83b68236, 0x2627239f, 0x3b730622, 0x012b2406,
+    0x82353315, 0x01240818, 0xfe0c0c34, 0x240c0cd8, 0x1c0c0c1c, 0x2f373d4f, 0x071d0709, 0x22371e09, 0x540c0c54, 0x6005077b, 0x0c0c680c, 0x2c05ec4a,
+    0x23473742, 0x08240a07, 0x18211306, 0x39138240, 0x0705337f, 0xff010000, 0x01c0fffc, 0x00c0012a, 0x37000041, 0x0e07011e, 0x42180701, 0x2226089a,
+    0x3f012e27, 0x63723601, 0x012f2507, 0x2627012e, 0x0bd05318, 0x72084e41, 0x220806a4, 0x2d2cd117, 0x243a0c10, 0x07200709, 0x06263009, 0x0a220602,
+    0x42130f0a, 0x6715110d, 0x04042e22, 0x91023141, 0x090c281a, 0x2d540dd7, 0x4c012721, 0x1e310506, 0x22050e05, 0x110a0709, 0x1e06160d, 0x3122340a,
+    0x23178f47, 0x00031009, 0x2405f341, 0x00a00140, 0x29c48234, 0x33171623, 0x14011d32, 0xbe82012b, 0x06161722, 0x2f228e82, 0x5b4d2601, 0x74362006,
+    0x262007c0, 0x2106aa4b, 0x2b832133, 0x34013d08, 0x3b050949, 0x05350c0c, 0x0697394c, 0x05530806, 0x0704a503, 0x271f5405, 0x0c0c9f05, 0x55291492,
+    0x010c0705, 0x60010c28, 0x280c110f, 0x0246380c, 0x030f068b, 0x35050399, 0x1b200705, 0x1b241182, 0x0c2d0507, 0x00270782, 0xff130001, 0x826e01e0,
+    0x0505638b, 0x86010f21, 0x1507218c, 0x15200886, 0x22209982, 0x09ab7f18, 0x6a492720, 0x26273e06, 0x32013b36, 0x3633021f, 0x3336013f, 0x07075f01,
+    0x0c3a5003, 0x6c14580c, 0x0c6c0c0c, 0x3f038238, 0x58146c0c, 0x503a0c0c, 0x41070703, 0x1b370308, 0x370f0c02, 0xa0010803, 0x0c96060c, 0x1b250c20,
+    0x5c230482, 0x825c0c0c, 0x251b2106, 0x962a0482, 0x71070c06, 0x71232548, 0xcb430007, 0x82802008, 0x00292697, 0x37000032, 0x228e8923, 0x8a012b06,
+    0x828e848f, 0x3435218a, 0x16238e82, 0x82270614, 0x36240828, 0x23263435, 0x0ca15cef, 0x0507a10c, 0x0c340c3b, 0x0c34340c, 0x0c340507, 0x515140a3,
+    0x28244d9c, 0x20802328, 0x3422fd82, 0x1c820705, 0x7c822820, 0x07052d2d, 0x804f0ccf, 0x2996db51, 0x82282223, 0x0006267f, 0x02e0ff00, 0x2e7f8240,
+    0x004e0045, 0x005a0052, 0x00680064, 0x50230100, 0x2b220538, 0xa8410701, 0x87232005, 0x05297607, 0x230e1d41, 0x36373301, 0x1f209682, 0x16200786,
+    0x22065d41, 0x82233705, 0x3e323712, 0x23013f01, 0x27013b17, 0x06232726, 0x23371707, 0x31021e17, 0x14833633, 0x3f34022f, 0x0c0c4607, 0x0a022a55,
+    0x2b020939, 0x2a078537, 0x0c0c5429, 0x0c3e0846, 0x8212300c, 0x2a3b087f, 0x6d11020a, 0x2c090214, 0x6e14020a, 0x2e0a020e, 0x13010706, 0x78fe0c30,
+    0x060b260c, 0x03010101, 0x0651081e, 0x03021a82, 0x03020c02, 0x0c270c81, 0x01010303, 0x51071e02, 0x83000107, 0x09b723fd, 0x0383b709, 0x0c280c22,
+    0x51250e83, 0x56090905, 0x21038556, 0x14825105, 0x36369637, 0x81180c2f, 0x0b092020, 0x7f0b0c0c, 0x180b3636, 0x208f160c, 0x05e74620, 0x0180012a,
+    0x001100c0, 0x1300001a, 0x6c119b7a, 0xe03907a5, 0x0e880a0e, 0x0ab0fe0a, 0xc80a0e0e, 0x0a0680a0, 0x01076207, 0xfe0e0a38, 0x261183b8, 0x0e0ad001,
+    0x8280067a, 0x00002513, 0xff000005, 0x28054b56, 0x001d0011, 0x00350029, 0x2059933e, 0x0ab55a13, 0x2208b668, 0x8a32013b, 0x6d352016, 0x7d8c0823,
+    0xa80c4023, 0x20028e0c, 0x27909360, 0x0c088cfe, 0x4c0c080c, 0x54200584, 0x0c200a83, 0x042aa387, 0xe0fffdff, 0xa001c001, 0x9f821500, 0x52004f2f,
+    0x32370000, 0x06010f16, 0x26012f22, 0x066b6936, 0x1516322b, 0x16322511, 0x0f14011d, 0x0d345101, 0x4e183f20, 0x37210814, 0x05a64416, 0x42012f21,
+    0x2620053e, 0x24072d54, 0x27330717, 0xbd7118b0, 0x0709250b, 0x01090720, 0x0b290382, 0x0907383d, 0x07800709, 0x2c098609, 0x0709019f, 0x05030c19,
+    0x0b040447, 0x31238219, 0x2a0b043b, 0x2034040b, 0x07146010, 0x60050560, 0x93441407, 0xd0fe2805, 0x12070940, 0x84460a0e, 0x220a8a4a, 0x82030255,
+    0x0d0d2c4c, 0x0307090b, 0x0b0ba002, 0x82003065, 0x20e39200, 0xaf661813, 0x012b2209, 0x06285511, 0xbb051121, 0x911020e3, 0x886020e3, 0x21e3a2d9,
+    0xe4872001, 0x07d0fe28, 0x01070909, 0xe4aa8030, 0xfdff0522, 0x2306477a, 0x0025000f, 0x18062571, 0x200f3b6e, 0x1ad94127, 0x2008b955, 0x0f257133,
+    0x410f1378, 0x40200583, 0x4020a383, 0x3020f391, 0xc0201783, 0x2106d741, 0xf8820709, 0x0021ca82, 0x20d08207, 0x550584ff, 0x40200ac6, 0x180fd541,
+    0x820af170, 0x832020fb, 0x20048234, 0x4f721801, 0x20e7a40b, 0x14dd4103, 0xab0ef755, 0x91e020e7, 0xa97020e7, 0x000121e7, 0x550fd941, 0xe79709f0,
+    0xfdff0434, 0xb101deff, 0x1f00a001, 0x3c003400, 0x00005200, 0x53432201, 0x1d162108, 0x240e8743, 0x35013b36, 0x05784b17, 0x2606072a, 0x3726012f,
+    0x012e3736, 0x200a306f, 0x14fa4107, 0x57300121, 0x10200887, 0x38099c57, 0x2a3e280a, 0x020d062c, 0x0c0d050a, 0x0a2b2409, 0x10221d06, 0x0c100c0c,
+    0x1105419c, 0x18088957, 0x360ac874, 0x310ba340, 0x3e330b27, 0x06060213, 0x05050f14, 0x263d0408, 0x825c1d14, 0x100c2240, 0x0ff24108, 0x85079f43,
+    0x001422eb, 0x20eb851c, 0x20cb9b25, 0x1e084127, 0x16172723, 0x0ad54306, 0x22052551, 0x964a0132, 0x411c20d6, 0xd52b1303, 0x0b080850, 0x20070930,
+    0x85300907, 0x99bd20f6, 0x58f820d5, 0x0541078f, 0x603b230b, 0xc9431407, 0x30f58307, 0x00030000, 0x02c0ff00, 0x00c00101, 0x0017000f, 0x11c57444,
+    0x2d07cd61, 0x07061401, 0x15163233, 0x16230714, 0x02830706, 0x020e0727, 0x2722012b, 0x33cb8226, 0x3734013d, 0x3637013e, 0x32333637, 0x0a68021e,
+    0x500a0e0e, 0x31080483, 0x0e0e141e, 0x58010e14, 0x19650120, 0x08011323, 0x0a060d04, 0x0a0c060c, 0x031d212a, 0x11234830, 0x14040705, 0x0b0e1035,
+    0x150b140e, 0x0ee00f19, 0x3583f00a, 0x28720482, 0x01240805, 0x073f1979, 0x131e1723, 0x14112e11, 0x121a0e29, 0x20020e0e, 0xd6050710, 0x4d150305,
+    0x3a2c0f0f, 0x00240f05, 0x1120c392, 0x20082f57, 0x23a18206, 0x14363526, 0xad83c585, 0x012e2724, 0xaf822627, 0x372ba982, 0x32013b36, 0x1617011e,
+    0x83011e07, 0x46332002, 0x1e25052e, 0x0e141501, 0x82c18602, 0x822820c6, 0x140e24c2, 0x82140201, 0x35102da7, 0x05070414, 0x30482311, 0x2a211d03,
+    0x062fcb84, 0x0108040d, 0x65192313, 0x190f2001, 0x86880115, 0x0a0e22c1, 0x28fc8432, 0x2c3ae8fe, 0x154d0f0f, 0x2ab58203, 0x02201007, 0x1a120e0e,
+    0x8214290e, 0x1e133ad1, 0x3f072317, 0x0f241919, 0x02000005, 0xc0ff0500, 0xc001fb00, 0x22000700, 0x089b5400, 0x82161321, 0x086b4bc1, 0x08053542,
+    0x16013b25, 0x17323337, 0x25253665, 0x03b72536, 0x0e380c0e, 0x0e0a200a, 0x030e0c38, 0x0b130430, 0x130b2525, 0x82c00104, 0x3625261b, 0x120cc3fe,
+    0x27908368, 0xc00c1268, 0x12111112, 0x220a0b5c, 0x89240007, 0x085f4567, 0x115d6518, 0x45371622, 0x702f6984, 0x0a0e1c14, 0x400a0e10, 0x0a100e0a,
+    0x82141c0e, 0x22658668, 0x82141c6b, 0x29f884f5, 0x880a0e88, 0x11111c14, 0xcf5d0300, 0x00072408, 0x8937002f, 0x6a052069, 0x0620054e, 0x2206416b,
+    0x61260607, 0x27250637, 0x011f3626, 0x05906937, 0x010f162a, 0x26343606, 0x16140622, 0x3405e858, 0x0a0a5601, 0x0f03215e, 0x0430640a, 0x642f0516,
+    0x2104100a, 0x2512835e, 0x640b0f04, 0x1287052f, 0x4b4b632d, 0x014b4b6a, 0x38503820, 0x88185038, 0x85299216, 0x0a102312, 0x3183bf64, 0x004b6a22,
+    0x013f0082, 0xc0ff1b00, 0xc001e801, 0x00001500, 0x34262205, 0x17323336, 0x0e07011e, 0x16141501, 0x82163637, 0x01260808, 0x96966a1b, 0x0817186a,
+    0x372f0703, 0x08085d92, 0x40682405, 0x0496d496, 0x1a051002, 0x795e365e, 0x060f0212, 0x477b322d, 0x8209200b, 0x0025264d, 0x21113300, 0x05136211,
+    0x14153724, 0x0c72013b, 0x060d4706, 0x21078b54, 0x6e182033, 0xa02307a8, 0x820c680c, 0x18012002, 0x390afe64, 0xe0fe2001, 0xe113130d, 0x080c0c08,
+    0x0d13c00c, 0x09090730, 0x130d3007, 0x6b410200, 0x00c02a06, 0x0045003f, 0x06142500, 0x29b1822b, 0x14161707, 0x012f2206, 0xb4492306, 0x27222306,
+    0xd4820607, 0x0f613f20, 0x34352606, 0x35013b36, 0x08e58227, 0x011f3235, 0x32363733, 0x010f1416, 0x16323315, 0x15163200, 0x00023423, 0x0e370d14,
+    0x1a13093d, 0x3328360a, 0x330c180c, 0x1a0a3628, 0x0e3d0913, 0x13140d37, 0x842f380d, 0x84e62019, 0x382f2f13, 0xd3fe130d, 0x9fe0425c, 0x2010120d,
+    0x27833c1d, 0xf4203727, 0x20f40c0c, 0x29268337, 0x10201d3c, 0x130e0d12, 0x19842e3b, 0x2e271384, 0x1301133b, 0x502e2e42, 0x0520114f, 0x2106a551,
+    0x88822133, 0x0614112d, 0x1f060703, 0x3d361601, 0x52263401, 0xa0270c47, 0x7c08087c, 0x520f0f05, 0x65500d36, 0x535a820a, 0x0f200cbf, 0x20098542,
+    0x055c4204, 0xbb533220, 0x2f482506, 0x422f2f42, 0x2006b953, 0x200b8388, 0x08a35d2f, 0xc201023d, 0x40002a00, 0x17250000, 0x010f0616, 0x012f2606,
+    0x27262223, 0x36343526, 0x82011e17, 0x0a6e5e13, 0x3233172a, 0x3637011f, 0x0e172716, 0x22822483, 0x82163721, 0x0544760a, 0x01376f08, 0x04030ef0,
+    0x1a0c4106, 0x0c8c3e06, 0x28200212, 0x0123191b, 0x05182001, 0x09090782, 0x84057907, 0x25390914, 0x1ab60c06, 0x49355715, 0x04323d67, 0x421f1905,
+    0x063f2a2e, 0x0d061c3e, 0x09062103, 0x0b10860c, 0x261b04e1, 0x19240101, 0x21032519, 0x07200709, 0x7b122009, 0x1c040213, 0x673a2f37, 0x13593749,
+    0x330f271b, 0x37422e1f, 0xff4e0029, 0x4e812006, 0x25330573, 0x0e151632, 0x22012b01, 0x0607013d, 0x34013d26, 0x8835013f, 0xf6731808, 0x011d2508,
+    0x15010f14, 0x0885c182, 0x82363221, 0x01332ec2, 0x04070574, 0x0c50657b, 0x09090631, 0x23048437, 0x810c380c, 0x87200c82, 0x462b0484, 0xc0050762,
+    0x70640507, 0x820bc10c, 0x0a29245c, 0x871e0c02, 0x0c452408, 0x851d330c, 0x1e1e2114, 0x9f2d0887, 0x0704484d, 0x00020000, 0x02e0ff00, 0x359f8280,
+    0x003c0033, 0x14162500, 0x21230607, 0x0e330706, 0x23352304, 0xa5822215, 0x3422ad82, 0x05853533, 0x33363434, 0x32353315, 0x2317031e, 0x32211716,
+    0x26363207, 0xa7822223, 0x2f510234, 0xfe45342f, 0xce0907e2, 0x2a2b4228, 0x14102237, 0x0082201c, 0x141c2908, 0x2a372210, 0xce28422b, 0x1e010709,
+    0x0c0f3545, 0xf0080f0c, 0x18163416, 0x2308060a, 0x80162324, 0x401b2580, 0x10182818, 0x40250382, 0x8080251b, 0x28158216, 0x700a0608, 0x40082828,
+    0x06c34308, 0xa7560120, 0x00252205, 0x11b5553d, 0x32172608, 0x3e32021e, 0x37363302, 0x23263435, 0x1d062221, 0x06051601, 0x22040e07, 0x2627032e,
+    0x16141527, 0x36322133, 0x0bd05535, 0x1101822b, 0x0f0a0f08, 0x4a011108, 0x05096e28, 0x18012829, 0x10014916, 0x820f1009, 0x27178201, 0x0a0e1649,
+    0x0e0a1001, 0x3f0dcf52, 0x07050ee6, 0x350e0507, 0x0e0a1920, 0x20190a0e, 0x01351109, 0x0409060c, 0x0c060904, 0x8e113501, 0x00201583, 0x032e0082,
+    0xe0ff1000, 0xa001f001, 0x25001700, 0x90183900, 0x9d820807, 0x20065b50, 0x05845f3f, 0x16320322, 0x26084852, 0x33373336, 0x86353315, 0x32230803,
+    0x3521011d, 0x01013b34, 0x0c1808f0, 0x180c78fe, 0x01e80508, 0x05e80104, 0x080e0a18, 0x0e0830fe, 0x8340380a, 0x0c242a00, 0x240c60fe, 0x08104001,
+    0x2f00820c, 0x02051008, 0x58010158, 0x0ecbfe02, 0x0808100a, 0xf021c182, 0x270083c0, 0x0c14140c, 0x00020000, 0x02270082, 0x00840181, 0x822e0023,
+    0x16730895, 0x06050714, 0x0706012f, 0x07141516, 0x2b061617, 0x3f262201, 0x34352601, 0x27373637, 0x25373426, 0x37011f36, 0x22061417, 0x17373526,
+    0x126e0216, 0x17e9fe12, 0x0213c417, 0x011a0e10, 0x08380809, 0x0e1a0109, 0x30110110, 0x17011212, 0x910a1717, 0x70a0700e, 0x0121910e, 0x06220627,
+    0x3c080855, 0x110a170e, 0x07730a10, 0x73070c0c, 0x0912100a, 0x850f151a, 0x2cf72919, 0x25251b71, 0x0a2c711b, 0x00219182, 0x24048205, 0x01800220,
+    0x2f098260, 0x0044000f, 0x0064004e, 0x23173700, 0x2516013f, 0x22057e44, 0x73112123, 0x06301279, 0x26272607, 0x1706020f, 0x07061716, 0x16011f06,
+    0x1633b782, 0x013f1617, 0x27262736, 0x32333736, 0x33363425, 0x83211121, 0x160627bf, 0x3f32013b, 0x23533301, 0x012f2205, 0x34ec8226, 0x260b9807,
+    0x0105080b, 0x0e0e0ad3, 0x01e8fe0a, 0x0c400c00, 0x38038210, 0x1509720c, 0x09070809, 0x070b0707, 0x0e0c0b0a, 0x0608060a, 0x1011120b, 0x39088314,
+    0x200d0d0a, 0xfd0c0b0b, 0x010a0eb0, 0x0ae8fe18, 0x07023b0e, 0x03091706, 0x03823c09, 0x022c8782, 0x20090339, 0x26d40309, 0x80152126, 0x23055d42,
+    0x10784001, 0x02825882, 0x150c102a, 0x090b0a16, 0x07040406, 0x092a4782, 0x0e0a0609, 0x0e0b070b, 0x04820c0d, 0x0a365c82, 0x0a6c2323, 0x0ec0fe0e,
+    0x0a06380a, 0x091f1f09, 0x08a9060a, 0x376e0008, 0x4d152009, 0x5e2208c3, 0x0b436e00, 0x24e18210, 0x1516011f, 0x10297503, 0x080b8f18, 0x22821620,
+    0x9e173621, 0x4f3d201f, 0x232205bb, 0x7c412715, 0x702b2005, 0x0123071c, 0x18130de0, 0x24078a43, 0x2e090df3, 0x0a974d09, 0x8914b94c, 0x07302414,
+    0x8380a009, 0x8320203d, 0x20012104, 0x4c844682, 0x0dc00123, 0x22488213, 0x4d9dfe0d, 0x092107d5, 0x20098887, 0x26139279, 0x07094077, 0x87408030,
+    0x40012586, 0x0800130d, 0x5108177a, 0x3d29074f, 0x55004900, 0x00006100, 0x07484305, 0x20081f57, 0x0af94701, 0x083e6318, 0x1720e282, 0x21091a7a,
+    0xad471733, 0x0b976c06, 0x8b0b8151, 0xb401220b, 0x050c7a0c, 0x0a500125, 0x6be0fe0e, 0x34210bb6, 0x200d830c, 0x18048274, 0x850c2369, 0x0c202f22,
+    0x010c1414, 0x0e0e0ac8, 0x0138fe0a, 0x2b832894, 0x05846c20, 0x2085a020, 0x0c54a025, 0x8aac540c, 0x211d8517, 0x93520000, 0x0007250a, 0x12000029,
+    0x2306fa5b, 0x0f141636, 0x2307b350, 0x1523013d, 0x4807bd50, 0x782f095e, 0x2a2a3c2a, 0x0913cb3c, 0x100d135f, 0x8410130d, 0x095f2a05, 0x560a1a13,
+    0x010a5666, 0x211d835a, 0x0e82502a, 0xf5fe5e28, 0x0d13130d, 0x05837070, 0x0b012508, 0x131a0a5e, 0x09575709, 0x05000000, 0xe0fffbff, 0xa5010502,
+    0x1a001200, 0x2a002200, 0x00003200, 0x011e3236, 0x23256e82, 0x22232622, 0x2c058206, 0x26363435, 0x2e010e16, 0x16013e01, 0x21058306, 0x0d83041e,
+    0x0b853620, 0xda060135, 0x263e5c4c, 0x134c1922, 0x22194d12, 0x10193e26, 0x822a2c14, 0x2f9e2403, 0x8214122d, 0x2cd82403, 0x822a1014, 0x2f452403,
+    0x822d1214, 0x43e03003, 0x1e1a265f, 0x1a1e1919, 0x346a5f26, 0x831d0a2d, 0x260c2303, 0x03823741, 0x2d0a1a24, 0x03821d34, 0x370c0c24, 0x03822641,
+    0x9418a282, 0xc13108e3, 0x19001300, 0x00001d00, 0x011f3613, 0x011d011e, 0x05af6814, 0x013d4308, 0x013f3634, 0x37171507, 0x35370335, 0x1111ef07,
+    0x1b110ed0, 0xd01615d0, 0xe10e111a, 0xa0c0c0c0, 0xba01a0a0, 0x064e0606, 0x1ee10f18, 0x0b0b680d, 0xe11e0d68, 0x1006180f, 0x4e4e0248, 0x50e4fe02,
+    0x67834286, 0x00000728, 0x0002dbff, 0x6382a301, 0x2700212d, 0x2f002b00, 0x37003300, 0x53250000, 0x06230512, 0x8207012f, 0x06e84703, 0x013f3422,
+    0x19828682, 0x07350724, 0x7c832715, 0x82032721, 0x27372409, 0x86051707, 0xe9013d07, 0x10641417, 0x10686810, 0x17146410, 0x0d641761, 0x2217640d,
+    0x66667755, 0x55551266, 0x01210582, 0x08068456, 0x1909c631, 0x320a166e, 0x34340808, 0x0a320808, 0x09196e16, 0x09196c24, 0x26050526, 0x016c1909,
+    0x8f452449, 0x01292901, 0x4bb7fe26, 0x279b4f27, 0x86462a27, 0x00003407, 0xfffcff03, 0x010402bd, 0x001c00c1, 0x00540038, 0x84163700, 0x3b1622a6,
+    0x05985701, 0x012e2227, 0x2627013f, 0x24ad8236, 0x26371716, 0x05324122, 0x2405b046, 0x0f163637, 0x052c6901, 0x17013f29, 0x2b010e16, 0x82141501,
+    0x8226203e, 0x24d8821e, 0x2f363233, 0x080b8301, 0x02b91760, 0x33280912, 0x3413120a, 0x24340c0c, 0x33120936, 0x0b030929, 0x010c066e, 0x0924097c,
+    0x220b0612, 0x1c12070a, 0x282a1c6a, 0x19031209, 0x6e060b02, 0x2809030b, 0x360912ad, 0x07146024, 0x500c0c50, 0x13601407, 0x071b0a12, 0x070a220a,
+    0x060d0aba, 0x21105119, 0x300c280c, 0x1a512241, 0x33821505, 0x07074c08, 0x1d0f0f49, 0x0616060a, 0x2d2d1d0a, 0x0d061942, 0x07076e0a, 0x15031902,
+    0x229c1a05, 0x0b303041, 0x0b500808, 0x0808500b, 0x1021300b, 0x15070a2c, 0x00000a06, 0xfeff0400, 0x02020000, 0x35008001, 0x4e003f00, 0x00005d00,
+    0x82163201, 0x012b21e4, 0x1421c182, 0x087b4d07, 0x09882120, 0x013d2625, 0x54233734, 0x881806f7, 0x252f08c4, 0x2e272107, 0x22012b01, 0x023a0706,
+    0x4a35033e, 0x212005cc, 0x37054564, 0x031e1415, 0xf401013a, 0x06010706, 0x16140903, 0x200d1310, 0x00ff130d, 0x33080684, 0x09141610, 0x07010603,
+    0x0c113c06, 0x22802239, 0xfe110c39, 0x000114dc, 0x0e190514, 0x39190e80, 0x0b060d02, 0x22030706, 0x0112121c, 0x12120e4e, 0x0703221c, 0x0d2e1182,
+    0x06091001, 0x1d130918, 0x36121830, 0x4a82130d, 0x20085282, 0x12360d13, 0x131d3018, 0x09061809, 0x2626202a, 0x32122a20, 0x11110d32, 0x030201af,
+    0x210f0406, 0x29448212, 0x0f21121c, 0x02030604, 0x00820001, 0x537d0420, 0x00312d08, 0x00420039, 0x2500004a, 0x011d011e, 0x3620f998, 0x7f057b64,
+    0x17200b56, 0x085d4a18, 0x20060241, 0x24108707, 0x1c16ce01, 0x08eb8b20, 0x161c2023, 0x1b2b0716, 0x800d130b, 0x1b0b130d, 0x9bfe072b, 0x1a13131a,
+    0x16013513, 0x040a0111, 0x01030cd6, 0x2710840d, 0x172304ce, 0x29132430, 0x2929d889, 0x17302512, 0x1b550423, 0x23e78422, 0xc31b2220, 0x13273882,
+    0x05435d1a, 0x84b20e08, 0x2acf820a, 0xfffbff01, 0x018501bf, 0x822d00c1, 0x061624c9, 0x4815012b, 0x352108c9, 0x61461823, 0x22232408, 0x493f2627,
+    0x07200574, 0x22842382, 0x7a014a08, 0x890f0c0a, 0x0909041e, 0x04090960, 0x0c0f891e, 0x0f1f500a, 0x1d4f090c, 0x0a06060f, 0x050e056e, 0x06060a6e,
+    0x094f1d0f, 0x461f0f0c, 0x31181b0b, 0x080f0f08, 0x0b1b1831, 0x5b0b1a5a, 0x750b0d0e, 0x0b750505, 0x0b5b0e0d, 0xd752181a, 0x000b2a0b, 0x001f0015,
+    0x14150100, 0x0a5c6806, 0x16220b84, 0x15861720, 0x01201626, 0x83ba83c0, 0x47230285, 0x82473201, 0x26068209, 0x1e2e7701, 0x831e2b2b, 0x67852104,
+    0x67220983, 0x07866f31, 0x0720eb82, 0x08083758, 0x0c000622, 0x24001200, 0x49004000, 0x00004d00, 0x34012e37, 0x07143233, 0x07061716, 0x37360736,
+    0x3313020e, 0x2406e84e, 0x36341135, 0x2a8b823b, 0x27261716, 0x012e2736, 0x82060706, 0x010e2824, 0x32331617, 0x82373637, 0x36220805, 0x16372627,
+    0x3523011d, 0x13173233, 0xb6362706, 0x06020202, 0x0c150e06, 0x044f0d33, 0x08110a1f, 0xd65888a2, 0x0e390808, 0x0c0e1d02, 0x16150305, 0x170e0602,
+    0x0c261d12, 0x24190e08, 0x1c24113e, 0x100a0a14, 0x0680074f, 0x0618070a, 0x07c02b25, 0x36281117, 0x14020f1a, 0x1d0b5618, 0x0105150f, 0x0905590d,
+    0x0a882508, 0x2412ac0e, 0x0b0e112f, 0x37160a08, 0x260e2036, 0x143e0a10, 0x09221303, 0x0a07db0f, 0xfe078006, 0x0110079f, 0x0021ee82, 0x24ef8803,
+    0x003b0011, 0x14235944, 0x06072228, 0x26272615, 0x0882012b, 0x08850720, 0x011f0625, 0x83013b16, 0x163322dd, 0x24098317, 0x2636013f, 0x15295923,
+    0x010a3929, 0x021c0216, 0x820a1d09, 0x13013c05, 0x06190a02, 0x02250207, 0x0309250a, 0x04010118, 0x26090315, 0x0126020a, 0x594f0607, 0xff3c133f,
+    0x1c650a00, 0x0909730f, 0x5f1b0873, 0xa806090a, 0x0c630909, 0x09095817, 0x860906a8, 0x8b05ec59, 0x003422c3, 0x21c3933d, 0xbe833617, 0x34010f22,
+    0xbd82c684, 0x86060721, 0x22be85bf, 0x95012f36, 0x043c29bc, 0x07230707, 0x03252503, 0x07220682, 0x0f863c04, 0x11032224, 0x11850413, 0x2b14865a,
+    0x060c06f2, 0x06440145, 0x5e5d060d, 0x3d230a82, 0x82242108, 0xd65e2106, 0xeb70b085, 0x0007300c, 0x00220010, 0x3700003b, 0x06141632, 0x4235012b,
+    0x07200829, 0x2010085b, 0x0d654a13, 0x3a013d32, 0xc2043e02, 0x0d0f0e0d, 0x8007d31b, 0x37070a06, 0x3a0b205b, 0x51212835, 0x05070705, 0x0107051f,
+    0x10170c14, 0xb1080c13, 0x3d111b11, 0x820a07a6, 0x5b812087, 0xfe260b36, 0x072c21d3, 0x2d83c805, 0x06023925, 0x4419110b, 0x435b07c7, 0x00082205,
+    0x23a3821a, 0x0100002d, 0x2007895b, 0x10fc4207, 0x06220628, 0x36321614, 0x85181734, 0x15220843, 0xd1418001, 0x42882005, 0x6a300add, 0x271c1c27,
+    0x0828a01d, 0x08286709, 0x46012808, 0x62228a82, 0xbb423007, 0x1c10270c, 0x281c1c28, 0x208270d4, 0x03826820, 0x5b302821, 0x08280bcf, 0x26001000,
+    0x4b002a00, 0x53438d82, 0x62022007, 0x37200654, 0x24103141, 0x33353315, 0x2b048207, 0x2f363202, 0x012b2601, 0x23353335, 0x15230387, 0x86331523,
+    0x06072403, 0x83077901, 0x1ba426ac, 0x131b1313, 0x0a464180, 0x4020682d, 0x32192080, 0x0212041f, 0x8920160a, 0x05132500, 0x0a075701, 0xfe27bd82,
+    0x101610b7, 0x41d81610, 0x26840b4f, 0x2680fe25, 0x890a5719, 0x20202431, 0x82001861, 0x43052000, 0x21260a73, 0x3d002f00, 0xb3424600, 0x35033613,
+    0x010f2634, 0x011d2223, 0x17013b14, 0x06373616, 0x3637011e, 0x05df7934, 0x26371423, 0x2114820e, 0x14850714, 0x0815bc42, 0x050f4023, 0x0c0c1c24,
+    0x0f05241c, 0x18090a21, 0x0b14140c, 0x0709071a, 0x061b0a4f, 0x0b1b1b09, 0x290b180a, 0x13734340, 0x886cfe3c, 0x24060608, 0x240c380c, 0x0b380606,
+    0x1509061a, 0x080b143b, 0x13070c18, 0x06820a6e, 0x1c4e1c29, 0x09051a0b, 0x429f752a, 0x834308cf, 0x00082409, 0x4234001a, 0x93410b29, 0x83132010,
+    0x10204dd7, 0x3520e182, 0x20073042, 0x0a7f41a0, 0x1e60c829, 0x0a0e370b, 0x840e0a70, 0x0b372204, 0x0633421e, 0xc0421820, 0x10e8250c, 0x26370b0c,
+    0x0e262486, 0x0b37260a, 0x6b41100c, 0x2497830c, 0x00470033, 0x1cc54260, 0x36370726, 0x012f3435, 0x26320585, 0x010f2223, 0x011f1406, 0x17323316,
+    0x3f323330, 0x1c833401, 0x16833020, 0x14151423, 0x05906a17, 0x15202484, 0x07212582, 0x82058306, 0x4237202b, 0x733a13f8, 0x28020114, 0x14010228,
+    0x01020301, 0x41020241, 0x35030201, 0x3e010401, 0x05841c04, 0x1285bc20, 0x26891f82, 0x27141d43, 0x020215f1, 0x24240103, 0x022d4782, 0x3d010115,
+    0x3d020402, 0xd3043101, 0x20468201, 0x20068508, 0x20138467, 0x22288d01, 0x18000600, 0x27090f9d, 0x0015000d, 0x0021001b, 0x0a518118, 0x27262524,
+    0x94181607, 0x27250829, 0x36170706, 0x22108237, 0x82272637, 0x540e8208, 0xa6320643, 0x1c3f1a14, 0x38509611, 0x20385038, 0x1140141a, 0x11846d1c,
+    0x0b84ee20, 0x20065b54, 0x200c8419, 0x222282a1, 0x8ad65038, 0x2d2a851e, 0x01000000, 0xc7ff0700, 0xb401f801, 0x0c822200, 0x6b363421, 0x23250563,
+    0x34272622, 0x05965336, 0x08058e56, 0x35363240, 0x26272634, 0x12200135, 0x9169510c, 0x01916766, 0x130b5169, 0x6c4c3a12, 0x3a4c6c98, 0x0c990112,
+    0x8515030e, 0x90916756, 0x15865667, 0x110c0e03, 0x62100512, 0x6c6c4c3f, 0x10623f4c, 0x6b831205, 0xffffff29, 0x010302bb, 0x821600c5, 0x1636266b,
+    0x010e0307, 0x051d542f, 0x36133908, 0x27050726, 0x0137012e, 0x02190ddc, 0x0a150248, 0x200a407d, 0x040803f1, 0x0e6ae1fe, 0xbd010d02, 0xfe0f1107,
+    0x050c0b50, 0x0b0d4d34, 0x25015111, 0xfd030705, 0x071e062c, 0x022c5782, 0xc7ff0800, 0xb801f901, 0x37002500, 0x14230f82, 0x82222306, 0x013f2c4b,
+    0x1617013e, 0x34363233, 0x51222326, 0x3d2807f3, 0x1f363401, 0x32333601, 0xe9497b84, 0x2ff68208, 0x91f80107, 0x08445867, 0x060b0801, 0x40320713,
+    0x2308b983, 0x07333549, 0x07910b08, 0x32071409, 0x24676348, 0x41081406, 0x0a100a0e, 0x0208290e, 0xcd270106, 0x15073792, 0x013e2e82, 0x986c2805,
+    0x0733326c, 0x91070914, 0x3207080b, 0x08bafe45, 0x88330603, 0x0a0e0e0a, 0x35822068, 0x00010022, 0x20072753, 0x18fb824b, 0x21113092, 0x8a712335,
+    0xf48f1811, 0x012b220f, 0x0e4a7515, 0x0127e982, 0x090720c0, 0x83a00709, 0x8b202004, 0x2116950b, 0x58186001, 0x80200b25, 0x200b7a5d, 0x09c25040,
+    0xae82178b, 0x61200021, 0x2120061f, 0x15220c82, 0x585c0614, 0x0638600b, 0x23013d24, 0x065b2622, 0xc0012305, 0x355c0709, 0x05e75e05, 0x5e422029,
+    0x07f0425e, 0x82900109, 0x90fe2192, 0x0121a883, 0x26078570, 0x5e845e70, 0x4b030009, 0x232608a7, 0x6b004700, 0xa5580000, 0x111d5a08, 0x8608b141,
+    0x7fc91823, 0x4a21200a, 0x33210582, 0x18238821, 0x9a08278e, 0x05917547, 0x84b0fe21, 0x835020fc, 0x8450209c, 0x8a01200a, 0xb0fe210b, 0x1885b484,
+    0xd0201784, 0xd0202384, 0x0a851683, 0x20053c41, 0x20108310, 0x851b8410, 0x8aa0200a, 0x2816a10b, 0x01000000, 0xc0ff0000, 0x24018201, 0x00002500,
+    0x054e4725, 0x37343526, 0x22230627, 0x21051f5a, 0xde822637, 0x23331783, 0x16072722, 0x36170714, 0x38286001, 0x02385038, 0x82221a66, 0x22282408,
+    0x8202661a, 0x8438200e, 0x20148208, 0x230c8480, 0x15400a0b, 0x15230882, 0x840b0a40, 0x2008822d, 0x18128216, 0x200c0348, 0x11b76935, 0x07220727,
+    0x27343627, 0x05464337, 0x1506222a, 0x26071714, 0x14062223, 0x37211082, 0x220e8217, 0x18363216, 0x2d0f9148, 0x44101690, 0x10440202, 0x21211716,
+    0x0886212e, 0x14831720, 0x21200e82, 0x270ce469, 0x07290fec, 0x0f29070e, 0x17211883, 0x82088507, 0x84072012, 0x0a0b5439, 0x18001721, 0x22073f42,
+    0x824f003f, 0x170729a5, 0x010f1416, 0x06141516, 0x08071541, 0x1f323624, 0x32013f01, 0x22012b14, 0x32263334, 0x2214011d, 0x0617013d, 0x36013f26,
+    0x27010f16, 0x011f3626, 0x03830616, 0x26012f24, 0x76180536, 0xc1820b1c, 0xb8012608, 0x07071b34, 0xac7a1211, 0x2d567a7a, 0x14071129, 0x4d341a07,
+    0x0c180c0c, 0x1818300c, 0x0912082e, 0x08110811, 0x23048355, 0x3b110911, 0xfe2e0786, 0x071a269f, 0x28070909, 0x090e0938, 0x42826801, 0x11071426,
+    0x7a562d29, 0x12294682, 0x1b070711, 0x18180c34, 0x2544833c, 0x12092b18, 0x03831108, 0x4b841120, 0x82191221, 0x23538246, 0x261ac012, 0x38213b82,
+    0x23468228, 0x03000000, 0x220a1746, 0x822a0025, 0x27df8511, 0x27071732, 0x27261737, 0x06220683, 0x06823707, 0x3717142c, 0x1607011f, 0x013f2737,
+    0x1c833617, 0x7f710720, 0x61210806, 0x22113f1a, 0x4b0e3e27, 0x273e0e4b, 0x1a3f1023, 0x25550826, 0x1e3e3e1e, 0x26085525, 0x4e4e1ef8, 0x068e711e,
+    0x16f82c08, 0x3603543a, 0x2a2a1f13, 0x0336131f, 0x42163a54, 0x4d0b2234, 0x12141412, 0x34220b4d, 0x38385c04, 0x000d005c, 0x02c0ff00, 0x18cd0105,
+    0x080a977d, 0x69005d28, 0x81007500, 0x99008d00, 0xb100a500, 0x3e130000, 0x16171601, 0x2306010f, 0x26012f22, 0x37353035, 0x30170726, 0x11881415,
+    0x83183420, 0x3b2307b8, 0xaf153201, 0x6805200b, 0x342005a4, 0x2f8b3ba7, 0x05393b97, 0x44b7b744, 0x052b080a, 0x5703030b, 0x6060060b, 0x03570b06,
+    0x2b050b03, 0x07411803, 0x18148d14, 0x3d331541, 0x31445801, 0x0d0a4431, 0x23010845, 0x3c010d04, 0x013c2323, 0x0123040d, 0x05054508, 0x7e18c708,
+    0x4118096a, 0x88201230, 0x17911d96, 0x2e066349, 0x010002e0, 0x000900a0, 0x0031001d, 0x493f003b, 0x97450563, 0x83052005, 0x55152006, 0x3d27072b,
+    0x25033e01, 0x4517031e, 0x353f091a, 0x25163233, 0x011d1632, 0x36343523, 0x33351333, 0x60a00115, 0x07400709, 0x13a0fe09, 0x8220600d, 0x130d2c03,
+    0x13171401, 0x13018101, 0x84011417, 0x6020270f, 0xf0fe130d, 0x28820907, 0x0140703d, 0x07303090, 0x0d770909, 0x0da0a013, 0x2c0d1313, 0x3929472c,
+    0x29391f1f, 0x832c2c47, 0xa0a0250f, 0x07097313, 0xff232383, 0x4ea0a000, 0x07240af3, 0x2b002300, 0x3221ab87, 0x0b1d6016, 0x23150726, 0x3d012e35,
+    0x82096367, 0x3634290f, 0x40011632, 0x131a1340, 0x07276e83, 0x40374910, 0x82104937, 0x70072179, 0xb6821483, 0x132f9582, 0x2007098d, 0x39200907,
+    0x63630b59, 0x4639590b, 0x8021058c, 0x231a8360, 0x00070000, 0x02310082, 0x00800140, 0x001a0014, 0x00320026, 0x004a003e, 0x12675856, 0x36343525,
+    0x82320233, 0x37152180, 0x200a3657, 0x200b8a21, 0x84179627, 0x2123332f, 0x14011d22, 0x0a280233, 0xfe141c0e, 0x0e211728, 0x0282280a, 0xf4101029,
+    0x0c980c0c, 0x8468010c, 0x8b382006, 0x2016820c, 0x390382fe, 0x0a0e8001, 0x1c14c8fe, 0x10011721, 0x0a080e0a, 0x08b0fe0e, 0x0c08f8f8, 0x02880c08,
+    0x0c8d6020, 0x0c0c2831, 0x00000c28, 0xffffff03, 0x018102e0, 0x821200af, 0x822c20db, 0x141631d3, 0x2706010f, 0x06072026, 0x3426012f, 0x16013e37,
+    0x2007a94d, 0x201a8625, 0x3c1a8622, 0x7b023236, 0x0b220505, 0xd6fe6e0b, 0x220b0b6e, 0xe4570505, 0x2536ffe4, 0x01253625, 0x2218840b, 0x853fa83f,
+    0x01e82417, 0x830e0425, 0x6464212a, 0x0e261083, 0x39395104, 0x2882eafe, 0x79362523, 0x26188205, 0x36360a0a, 0x82220a0a, 0x004c210a, 0x3105cb45,
+    0xc001c001, 0x1f000f00, 0x3f002f00, 0x5f004f00, 0x6f416f00, 0x13332110, 0x4f10904c, 0xd1590d6b, 0x201f8f1f, 0x082a5d11, 0x27051d5d, 0x1d139001,
+    0xa0fe131d, 0x50250583, 0x05260508, 0x20048e08, 0x840f8e80, 0x21148c0e, 0x3483dafe, 0x3a820120, 0x82c00121, 0x8360204a, 0x8201204a, 0x4dfe2150,
+    0x85204d88, 0x7b200988, 0xa6201393, 0x04834083, 0x66050122, 0x04830a83, 0x03000022, 0x230a0f7b, 0x0034002e, 0x200d117b, 0xe2541836, 0x1617300f,
+    0x31061415, 0x22231725, 0x37343526, 0x8216023e, 0x14332107, 0x220d017b, 0x183d2591, 0x3008f554, 0xfe010901, 0x0ef2d57e, 0x0c0e0912, 0x2634c116,
+    0x0cfb7a80, 0x0d317022, 0x0d005518, 0x0c0a0132, 0xa4880301, 0x0a0c0d13, 0xe5320e0f, 0x001b1b25, 0x02210082, 0x059f4800, 0x1700c125, 0x18002100,
+    0x6e0b297f, 0x373005d9, 0x32013b36, 0x0301011f, 0x010e0321, 0x2622012b, 0x0b499918, 0x07097834, 0x070f720f, 0x15fdfe09, 0x01158001, 0x13f6131c,
+    0x2249011c, 0x07093105, 0x13090720, 0xfe130d0d, 0xfe53014d, 0x1a1a13ad, 0x200d7f78, 0x094b6131, 0x3536052a, 0x2e012f34, 0x020e0701, 0x3627fa84,
+    0x16173233, 0x82013f36, 0x2e272116, 0x06271282, 0x33161415, 0x4d013e32, 0x21080627, 0x1902036d, 0x03030c03, 0x2311220c, 0x24222827, 0x030b041a,
+    0x04030216, 0x3e1d3511, 0x203f5152, 0x2b4d1138, 0xca210806, 0x03040404, 0x04010422, 0x30100a03, 0x182b2120, 0x23040204, 0x04050303, 0x52140e04,
+    0x18533e3d, 0x2aff8410, 0x01c8ff08, 0x00b801f8, 0x8446003a, 0x141529ff, 0x2e222306, 0x010e2702, 0x36298d88, 0x1632013b, 0x1606010f, 0x76411817,
+    0x27918307, 0x1f163637, 0x07061601, 0x2105ca49, 0x3a7e3213, 0x16750808, 0x8e6a0001, 0x100f4c4a, 0x0d030e17, 0x342c142a, 0x122a3951, 0x0c2d0c01,
+    0x0318020e, 0x201a0c05, 0x6c4c4e6a, 0x2d364c6c, 0x0a061208, 0x3d090407, 0x9191674a, 0x12251551, 0x14241711, 0x647cb801, 0x0601543f, 0x16110c0f,
+    0x56423139, 0x0c110c16, 0x01100d79, 0x4a1f3203, 0x6c986c56, 0x0703051d, 0x0615090c, 0x91ce9128, 0x1f29d0fe, 0x20291613, 0x02001513, 0x05876700,
+    0x0b00c133, 0x00002300, 0x0717013f, 0x07012b06, 0x34353727, 0x05316500, 0xc0821420, 0x012f2222, 0x093f6e18, 0x807e3336, 0x2d1b137e, 0x01202038,
+    0x4d1c38a8, 0x2907070d, 0xa2071407, 0x0d230685, 0x83731c4d, 0x2020281f, 0x011b2d38, 0x83503860, 0x82142020, 0x84208221, 0x20208206, 0x08008200,
+    0xffff0221, 0x0002c0ff, 0x1200c001, 0x00002b00, 0x16301737, 0x23061415, 0x1e352622, 0x37323303, 0x82320136, 0x0e07220f, 0x054d4801, 0x3e344e08,
+    0xa7363707, 0x3a460158, 0x12024040, 0x0b04100f, 0x6a011a04, 0x550e2016, 0x0c0a2e50, 0x08010940, 0x27141408, 0x121e3f25, 0x02074a8b, 0x43584038,
+    0x0a0a0d02, 0x3a01440a, 0x1b13161c, 0x3503619f, 0x0e091413, 0x12170c10, 0x1b381f23, 0x08875010, 0x7f82c020, 0x3400232f, 0x4a003f00, 0x00005500,
+    0x22262225, 0x07d05b06, 0x23062228, 0x3b363435, 0xa2603501, 0x1d16280b, 0x32352101, 0x85163236, 0x32332403, 0x82013316, 0x363427b3, 0x14163235,
+    0x0a943306, 0x0cc0012c, 0x18272f27, 0x28171827, 0x09820d0b, 0x141c0c24, 0x00834010, 0x1c141024, 0x178240fe, 0x2f2e1d84, 0x270b0d27, 0x0da0fe18,
+    0x160a2013, 0x068c7212, 0x84204021, 0x14502300, 0x0084901c, 0xd0141c23, 0x2a118460, 0x13400120, 0x161c0e0d, 0x8f152625, 0x21e38207, 0x04840002,
+    0x00800125, 0x731b000f, 0x352b09c1, 0x013b3411, 0x25111532, 0x821f1636, 0x3e373ccd, 0x01011f01, 0xfe0c0cf4, 0x280c0c18, 0x0435010c, 0xfe5a020b,
+    0x0d035780, 0x82405504, 0x010c2210, 0x2c1b8268, 0x0304e0cc, 0x9168bc05, 0x72050105, 0x2e008200, 0xfffcff03, 0x012102be, 0x000800c1, 0x83230013,
+    0x0716345d, 0x2f060706, 0x06143701, 0x3435012b, 0x011e3336, 0x82161705, 0x074c0812, 0x26272606, 0x16363736, 0x07100215, 0x3d0c010a, 0xde9f0b0b,
+    0x0ae00709, 0xfe805907, 0x01059ce6, 0x604b3c06, 0x77030390, 0xa00b075a, 0x3a53070b, 0x419e0b0a, 0x07e00a07, 0x9a800609, 0x040f059c, 0x8901012b,
+    0x0c8d5c60, 0x00080901, 0x1420d389, 0x570e537b, 0x322305f5, 0x6d111516, 0xe96706a4, 0x05a05b08, 0x011f3223, 0x20878237, 0x06e84d33, 0x130d303a,
+    0x07200709, 0x07900109, 0x200b1e09, 0x0a1a0a60, 0x0c0b2e49, 0x440c0c16, 0x49240a83, 0x100c0b20, 0x1805cc4d, 0x2609a582, 0x07092001, 0x820c1076,
+    0x0909242d, 0x820c2e4a, 0x450b212c, 0x4a240982, 0x001e0b20, 0x03200082, 0x002d0382, 0x80014002, 0x13000b00, 0x00001d00, 0x05415601, 0x34262224,
+    0x8c553336, 0x22263205, 0x34363213, 0x16012b26, 0x80010714, 0x50707050, 0x320483c0, 0x4b6a4b80, 0x35f56a4b, 0x31354b4b, 0x80013131, 0x8270a070,
+    0x838b2002, 0xff4b2214, 0x231c8200, 0x00379237, 0x5f87fb86, 0x12205d8c, 0x2005835b, 0x85538a14, 0x214b873d, 0x6284c0fe, 0xff050022, 0x022d0082,
+    0x00800181, 0x003b0037, 0x0050004a, 0x2da78466, 0x27010e07, 0x3435012e, 0x06072737, 0xc344012b, 0x4437200a, 0x3b2605cd, 0x1d163201, 0x44183301,
+    0x36270cc7, 0x26330705, 0x83363207, 0x013f2122, 0x27050e4e, 0x0723013f, 0x16011f16, 0x2005d444, 0x08ba6607, 0x17066408, 0x0102011e, 0x01014b35,
+    0x4b34354b, 0x07560f29, 0x450b340d, 0x4c4b352c, 0x1e141734, 0x0e0e0a31, 0x0907570b, 0x07330f72, 0x40070909, 0x164e070d, 0x2b18d3fe, 0x28184a04,
+    0x0e0e5109, 0x09082d08, 0xc42f2f21, 0x2418804a, 0x3222fd06, 0x0a0a212f, 0x0603032d, 0x030d060d, 0x0101142d, 0x4d00012c, 0x824a3535, 0x3834355c,
+    0x0b8b1826, 0x364b362a, 0x30084b34, 0x0e0a0a0e, 0x18100709, 0x073e0382, 0x087d0b09, 0x7616264a, 0x0c19161a, 0x422f0249, 0x2878602f, 0x02603020,
+    0x2f212230, 0x48824802, 0x50820920, 0x1f184724, 0x6b572c1f, 0x00022b08, 0x3400c001, 0x4c003c00, 0xe3465400, 0x06695008, 0x88092f4b, 0x26222109,
+    0x7d089e4a, 0x002008dc, 0x27069841, 0x36322137, 0x2634013d, 0x2205ad65, 0x86041614, 0xe8012117, 0x0a2afa82, 0x060c0e08, 0x0d200d13, 0x0584c013,
+    0x08130d22, 0x82311584, 0x83fe82bc, 0x1a13131a, 0x00013013, 0x0d13130d, 0x210583ff, 0x12841001, 0x0e400129, 0x0e0a500a, 0x820f0ba6, 0x85368237,
+    0x0d132205, 0x271684a0, 0x2e2e2230, 0xf0fe3022, 0x13253b82, 0x0d135d1a, 0x823e8380, 0x84702004, 0x00002110, 0x2805ab42, 0x00800100, 0x0027000f,
+    0x117f493f, 0x26061725, 0x64363435, 0x2e2b0559, 0x14150601, 0x36373616, 0x9726012f, 0x97651817, 0x1faa3c0b, 0x061e403d, 0x03021104, 0x3f415219,
+    0x03041a53, 0x1eb90414, 0x051f403e, 0x83011204, 0x52402713, 0x1303031b, 0x9e180104, 0xe0380c24, 0x2225171b, 0x06041815, 0x1903031e, 0x2f2e3403,
+    0x041c0536, 0x05061b04, 0xb3501796, 0x001c270a, 0x13000039, 0x90522634, 0x0e8a6d0a, 0xd7631320, 0x06ce420d, 0x35363234, 0x33363411, 0x701721f8,
+    0x07300709, 0xa80a0e09, 0x09845038, 0x0907b827, 0x0aa83850, 0x2c0c840e, 0x09211770, 0x17180107, 0x07a0fe21, 0x22098209, 0x820e0a98, 0x2a0a841c,
+    0xfe070930, 0x0e5038d8, 0x8318010a, 0x21e0270f, 0x07280117, 0x9b840009, 0x4202be2b, 0x3000c001, 0x00005400, 0xcf881825, 0x22232d0a, 0x37262726,
+    0x14151623, 0x012e2706, 0x88180a82, 0x0f2410d1, 0x23270601, 0x2808ff4a, 0x1d062223, 0x3b161401, 0xfe771801, 0x42332008, 0x0122054b, 0x8818fef9,
+    0x183109f5, 0x01012016, 0x2311d212, 0x011f1518, 0x46461e02, 0xfb88180a, 0x042f220c, 0x22aa8274, 0x82090710, 0x21d382e5, 0x0a860709, 0x12208036,
+    0x230f190b, 0x16202117, 0x18101119, 0x01012118, 0x1222151f, 0x0b148918, 0x9813d022, 0x0922d282, 0x34842807, 0x00200a8a, 0x02230082, 0x87ff0000,
+    0xb64320e7, 0x012b24e7, 0x82011d22, 0x011f26e5, 0x36013f16, 0x26d6ad26, 0x180c2b79, 0x18082b0c, 0xa407e341, 0x3c8024cf, 0x183c0c0c, 0x2107b441,
+    0x03490000, 0x01802505, 0x003b00c0, 0x1e21c383, 0x06d87501, 0x27222322, 0x2205bc4a, 0x54230627, 0x32270654, 0x26273736, 0x48013f36, 0x6442051a,
+    0x3f2f8407, 0x07011e17, 0x36371525, 0x35011f32, 0x3d0ef101, 0x0e0e0a2c, 0x0b37580a, 0x1e801e30, 0x58370b30, 0x2b080e83, 0x460d3e2c, 0x2a11080c,
+    0x0e400d13, 0x0e0a900a, 0x2a130d40, 0xfe0c0811, 0x0a057689, 0x224b7605, 0x100a0e29, 0x1a3b0e0a, 0x3b1a2121, 0x292a0a84, 0x230d4622, 0x0d8c0e05,
+    0x3f832813, 0x0d132831, 0x23050e8c, 0x2658af0d, 0x58260202, 0x4b040000, 0xc2290687, 0x36003200, 0x56003a00, 0x06db6000, 0xdb6d0620, 0x2baf8307,
+    0x3526013b, 0x37343526, 0x013e3736, 0x21056541, 0x01821716, 0x07141524, 0xbb820714, 0x37010f26, 0x3717012f, 0x34220682, 0xea823537, 0x30152726,
+    0x16151633, 0xee82d082, 0x82323621, 0x36950807, 0x80013637, 0x131a231d, 0x1a139afe, 0x04191e25, 0x123a080a, 0x1b0e4640, 0x1c0a1607, 0x0a1c0e0e,
+    0x0e1b0716, 0x3b124046, 0xe8030a08, 0x8a321820, 0x4a18322a, 0x32342c06, 0x0905012e, 0x140e0408, 0x0e020614, 0x161d0702, 0x128c0806, 0x132d233d,
+    0x2d131a1a, 0x3c123e24, 0x211f0e08, 0x0d14130d, 0x05092231, 0x07070e05, 0x0905050e, 0x140d3122, 0x1f210d13, 0x78ea080e, 0xc0c02028, 0x03b22820,
+    0x06060b03, 0x1903030b, 0x11060308, 0x15060611, 0x0706050f, 0x20008200, 0x08cf4603, 0xfb824720, 0x00006c24, 0xb9823201, 0x22270623, 0x25ee8226,
+    0x17010e27, 0xce460616, 0x25fa8206, 0x37173637, 0xb0492b26, 0x013b2305, 0xce461732, 0x3637210d, 0x20051544, 0x22318214, 0x46053617, 0x25210dd7,
+    0x063c5836, 0x06010f29, 0x06012f26, 0x82161415, 0x02360850, 0x014b3401, 0x4b34364c, 0x1d1c0d2d, 0x0a0f0101, 0x2c450b54, 0x01014b36, 0x13163248,
+    0x3820100c, 0x0a0e0e0a, 0x9a1f4538, 0x09074214, 0x0e500709, 0x07261607, 0x15832d0b, 0x15205239, 0x281895fe, 0x0e0e5109, 0x07052907, 0x012f2f21,
+    0x223002f1, 0x46310808, 0x4a0806d7, 0x22321632, 0x00012b1f, 0x4c36344b, 0x3b344b01, 0x42171527, 0x2a0f0a24, 0x33364d36, 0x06010248, 0x0a0e1914,
+    0x20280e0a, 0x07100709, 0x2a260c09, 0x200a0e08, 0x07370e0a, 0x18151bd0, 0x2f014b0c, 0x224c2f42, 0x05510232, 0x8208040d, 0x17522851, 0x02302220,
+    0x82002b02, 0x00032200, 0x067b4b00, 0x23001b34, 0x00003f00, 0x15011e25, 0x26220614, 0x37363435, 0x65181716, 0x36280c69, 0x34262226, 0x14163236,
+    0x088bbe18, 0x37321629, 0x1d163233, 0x67061401, 0x4608086e, 0x4f417001, 0x4f96d496, 0x33080841, 0x7aac7a3d, 0x4d08333d, 0x36252536, 0x130d8025,
+    0x110c141c, 0x140c1126, 0x130d131c, 0x130d400d, 0x1c2e0c76, 0x28383828, 0x090c2e1c, 0x1b071704, 0x21211710, 0x071b1017, 0x82d30417, 0x36252e30,
+    0x600d13e5, 0x08081c14, 0x0d60141c, 0x2f028213, 0x02000d13, 0xe0fffeff, 0xa1010202, 0x29000d00, 0x1729ad82, 0x22060733, 0x3733012f, 0x298b8217,
+    0x07011e13, 0x22262723, 0x0484010f, 0x36262324, 0xcc71013f, 0x17323605, 0x6d164001, 0x050f06b6, 0x391e5eb6, 0xcc041404, 0x77210424, 0x0808821c,
+    0x053a3133, 0x66240415, 0x03240421, 0x1c276e26, 0x266e271c, 0x06ba2ccc, 0x7f48ba06, 0x0d010909, 0x37286925, 0x82620909, 0x28560a09, 0x28022569,
+    0x271d1c28, 0x082f7027, 0xa0012024, 0x87832100, 0x06140123, 0x09b57c07, 0x260cb47c, 0x3435012e, 0x49163236, 0x012907f3, 0x24313f20, 0x0c240c0c,
+    0x32038228, 0x3f31240c, 0xe0547854, 0x2f2f422f, 0x33100142, 0x86340b4e, 0x27068217, 0x334e0b34, 0x1b54543c, 0x2f201b83, 0x00227282, 0x00820002,
+    0x0180012c, 0x00180080, 0x01000020, 0x76821d32, 0x76182f20, 0x26220ee1, 0x51183336, 0x0127075d, 0x050f0c74, 0x82165111, 0x3c542961, 0x1150232a,
+    0xb6080605, 0x012a4d84, 0x084f0c80, 0x50110506, 0x61822a23, 0x16547828, 0x0f051151, 0x8684c0fe, 0x02000028, 0xc0ff0000, 0x03452001, 0x22db9d08,
+    0x82272637, 0x3b362a01, 0x16173201, 0x37321617, 0x053b4336, 0x82060721, 0x3cf59901, 0x26030433, 0x06070105, 0x04020a28, 0x17461711, 0x0a020411,
+    0x01070628, 0x03042605, 0x050f4133, 0x0e41f020, 0x2b433711, 0x2f200303, 0x130a0805, 0x0f14140f, 0x05080a13, 0x0204202f, 0xd484222b, 0x8020b786,
+    0x3122b782, 0x1f413900, 0x1c9d410e, 0x17323324, 0x38412737, 0x0fa94112, 0x200e4441, 0x084441c0, 0x1c25a982, 0x1c0c280c, 0x8202820c, 0x4e0b2306,
+    0x53413c33, 0x82e02014, 0x004f229b, 0x229baa57, 0x68072737, 0x07820560, 0x013d2623, 0x05455034, 0x36371729, 0x0f16011f, 0x8f361701, 0x41d420b9,
+    0xb98e05f2, 0x1410162c, 0x091c0809, 0x11131309, 0xb5830f05, 0x1411062c, 0x1d080913, 0x10140808, 0x19425423, 0x24d49b0c, 0x1410232a, 0x84358208,
+    0x08062247, 0x206b834f, 0x22118513, 0x42161014, 0xbf5b0c44, 0x00212209, 0x42f18429, 0x21431d45, 0x4305200a, 0x26231648, 0x5d373627, 0x0c8208ba,
+    0x16323325, 0x43061415, 0x21201a4f, 0x320a6743, 0x0b151a1f, 0x2f212217, 0x1722212f, 0x3227150b, 0x433f543c, 0xdc201c6f, 0x2f0b8843, 0x1f1a1407,
+    0x2f422f18, 0x1f192018, 0x4e333c54, 0x240c3745, 0x00210019, 0x07d1414b, 0x10707a18, 0x200a5542, 0x05294525, 0x23212287, 0x2cc38222, 0x14151437,
+    0x34363216, 0x22302326, 0x42de8231, 0x01270587, 0x0a070c54, 0x43311103, 0x302707b9, 0x08060511, 0x822f4296, 0xb4012382, 0x1b860705, 0x51383c25,
+    0x821e2106, 0x212f2613, 0x21030f03, 0x2825841d, 0x4f0cc001, 0x11030705, 0x07d94330, 0x05113124, 0x5043fe0f, 0x07512205, 0x261b8905, 0x0f03374a,
+    0x83210201, 0x211e2353, 0x26831203, 0x28090f46, 0x00c00140, 0x00480026, 0x21d78f50, 0x84412223, 0x23b28510, 0x15163204, 0x841de141, 0x062224e6,
+    0x87340214, 0x323c22dc, 0x0d944127, 0x84232a21, 0x6ffe23c3, 0xc0425478, 0x856f200e, 0x23dc8bfc, 0x1820191f, 0x1824fc82, 0x161f1a1f, 0x4022bd83,
+    0x30443c54, 0x8c3c2111, 0x8209d344, 0x018126cb, 0x002a0080, 0x08bf4d32, 0x07012f27, 0x010f1617, 0x08444506, 0x36343522, 0x22050c44, 0x5036013f,
+    0x4d450623, 0x07052d09, 0x1211050f, 0x1c09090e, 0x120e0809, 0x28079c41, 0x08080f12, 0x0e09081d, 0x0b5e4511, 0x4f050725, 0x83060608, 0x1c08312c,
+    0x120e0909, 0x543c2a23, 0x543c3c54, 0x080e1216, 0x11823e82, 0x380a7045, 0xff000002, 0x012101e0, 0x002c00c4, 0x37000034, 0x22061416, 0x36373426,
+    0x23551837, 0x84098309, 0x06162392, 0x1560012b, 0x16152109, 0x2e07a278, 0x78542af6, 0x281e2a54, 0x07070514, 0x82181405, 0x0838277c, 0x06063808,
+    0x11851808, 0x2f272838, 0x2f2f422f, 0x54782ad6, 0x1d2a7854, 0x05071a09, 0x18070528, 0x2684060f, 0x84190e21, 0x091a220e, 0x3c2483d3, 0x00002f42,
+    0x00000002, 0x01e50130, 0x00280050, 0x25000030, 0x06010f16, 0x23013d26, 0x057c5b15, 0x07062322, 0x362ca383, 0x17161732, 0x3b343533, 0x011d3201,
+    0x36210782, 0x2d8f8717, 0x0909dc01, 0x180f0538, 0x1c0c280c, 0x75871d09, 0x0e821c20, 0x050f1823, 0x208b84f3, 0x24a087c8, 0x28140c0c, 0x82bf871e,
+    0x20bd830c, 0x41888690, 0x202c051b, 0x1100a001, 0x00001900, 0x07061401, 0x57478286, 0x073c4f07, 0x313f2022, 0x31255d82, 0x5478543f, 0x052d42b1,
+    0x4e33102d, 0x0c0c980b, 0x334e0b98, 0x4254543c, 0xdb870709, 0xdb822020, 0x0f000726, 0x22120000, 0x20069b47, 0x05784132, 0x8c223d85, 0x49825478,
+    0x84100121, 0x826f2087, 0x7854220a, 0x23008200, 0xff000009, 0x30054f5b, 0x0017000f, 0x002f001f, 0x003f0037, 0x0057004f, 0x609d825f, 0xea43086e,
+    0x18262005, 0xbe0f0560, 0xe001291f, 0x130d40fe, 0xc0010d13, 0x33260582, 0x140e0e14, 0x05844e0e, 0x17ae5820, 0x13200123, 0x8249840d, 0x82582004,
+    0x20028745, 0x4416acea, 0x8029092f, 0x2300c001, 0x3f002b00, 0x07a76100, 0x4d0a8361, 0x3b20062e, 0x2305274d, 0x011d1632, 0x0e058218, 0x09054f18,
+    0x37321628, 0x09077002, 0x6d530709, 0x89402005, 0xe5fe210a, 0x13b4cb18, 0x0709f025, 0x8a090720, 0x210a8526, 0x2c834b30, 0x374f6b26, 0x1c1c142a,
+    0x09cbcb18, 0x00000326, 0x8702c0ff, 0x1b20ab82, 0x3720ad82, 0xfc43ab82, 0x06624707, 0x013f2626, 0x37011f36, 0x16210382, 0x2ea39c07, 0x0c0c2d4e,
+    0x2e0b0b17, 0x170b0b2e, 0x8c2d0c0c, 0x9afe210d, 0xd020a993, 0x38862a93, 0xae923e20, 0x82000221, 0x80022b00, 0x07008001, 0x00002b00, 0x794b2236,
+    0xb9421805, 0x1521220c, 0xf1ab1814, 0x0582430c, 0x42d13321, 0x2e2706fd, 0x20070942, 0x18fe0907, 0x220a2642, 0x490709e0, 0x512505e4, 0x07c02e42,
+    0x05775d09, 0x01070923, 0x220b8360, 0x630790d0, 0xc0210577, 0x25018201, 0x27001700, 0xfd612f00, 0x16172806, 0x22212306, 0x18013f26, 0x5b0abb4c,
+    0x06200e43, 0x3606eb42, 0x344ec001, 0x0603043f, 0x0306d0fe, 0x4e343f04, 0x32c0314f, 0x180e304e, 0x340a655e, 0x21212e99, 0x6001212e, 0x392700ff,
+    0x0b0b0332, 0x27393203, 0x220b8201, 0x6870af39, 0x36200722, 0x21222082, 0x9b57002e, 0x248f830c, 0x003f0037, 0x21939d47, 0x2251012b, 0x36322207,
+    0x0e375c37, 0x5c18a387, 0xab940786, 0x0a0ef822, 0x2205ae7e, 0x89c80e0a, 0x281c220a, 0x2102821c, 0x0684e4fe, 0x0d69bb9c, 0x2e0e2108, 0x0a576418,
+    0x2b062b43, 0x80022000, 0x07006001, 0x25002100, 0x2129c782, 0x33352115, 0x32372335, 0xb8421816, 0x7d15200a, 0x3d2505a2, 0x33363401, 0x2a208205,
+    0x20fe2002, 0x2020e001, 0x541c1410, 0x1c39050a, 0x1400fe14, 0x01141c1c, 0x0160fed0, 0x4040c020, 0x10141c80, 0x0a900a0e, 0x2722820e, 0x14e0141c,
+    0x8080601c, 0x03207082, 0x6fcc0382, 0xc0fe7022, 0x23216fd0, 0x21df9935, 0x6e9be010, 0xdfb20020, 0x9a151721, 0x80b0216f, 0x02206e99, 0x210c4b41,
+    0xb9410100, 0x41d59920, 0x5e8214b1, 0x0001002f, 0x01beff00, 0x00c40144, 0x25000015, 0x082f5723, 0x06073608, 0x34113526, 0x16011736, 0x6a2e0106,
+    0x07060338, 0x030d0731, 0x16085735, 0x1d010717, 0x88770908, 0x16030e07, 0x81070502, 0x0c0a0959, 0x090cae01, 0x08dbfe08, 0x374f8417, 0x010001bf,
+    0x004500c1, 0x06140100, 0x011d2223, 0x011d3233, 0x15012b14, 0x07ed5918, 0x2e222326, 0x020e2701, 0x1808d252, 0x2009fc4b, 0x06e54f34, 0x32332008,
+    0x3e17011e, 0x16323302, 0x07000115, 0x0c245405, 0x0554240c, 0x17050707, 0x12122d1e, 0x83161e2e, 0x3615930b, 0x07058c01, 0x280c7030, 0x0131700c,
+    0x05280507, 0x11120307, 0x84021212, 0x4317940a, 0x5f470623, 0x002c2206, 0x05eb4338, 0x2223b286, 0x4721013d, 0x342406fa, 0x2311013b, 0x07820f82,
+    0x8507df78, 0x180520d6, 0x2309d540, 0x34350515, 0x26089e57, 0x0132013b, 0x180c14e0, 0x200805d1, 0x210b8414, 0x10828001, 0xfe140c26, 0x0ca80c80,
+    0x01260282, 0x0e540c40, 0x0984480a, 0x8605c878, 0x84402026, 0x2d328426, 0x880c0cb4, 0x88e80c0c, 0x0e0a480c, 0x40180c34, 0x022a0737, 0x00a00140,
+    0x005d002b, 0xa1893700, 0xa1943520, 0x8207db4c, 0x8a3720bd, 0x21d98a0b, 0xdb553335, 0x26342408, 0x4935012b, 0x142a075e, 0x0640012b, 0x1a060634,
+    0x0682061a, 0x89200121, 0x84c0200b, 0xe0fe2111, 0x88291184, 0x0a400a0e, 0x080a0e0e, 0x200e8468, 0x201b8480, 0x842c8ac0, 0xa040210a, 0x48211189,
+    0x822f8308, 0x84482034, 0x5700202b, 0x11290a4b, 0x00001a00, 0x1d062225, 0x0f411801, 0x010f220c, 0x27988306, 0x38011415, 0xf8fe0e0a, 0x01293e83,
+    0x070e0a90, 0x060a0762, 0x059f6f80, 0x0e290f83, 0x37f8fe0a, 0x06800762, 0x2753850a, 0x010002c0, 0x000f00c0, 0x18052360, 0x2507aa51, 0x36341135,
+    0xf4821133, 0x86230621, 0x013b2464, 0x58161415, 0xe0280643, 0x141c1c14, 0xfe141cd0, 0x30230884, 0x87c0012f, 0x2001210b, 0x08317618, 0xd0230a83,
+    0x82002f21, 0xff052600, 0x02c0ffff, 0x28678280, 0x00180015, 0x0031002e, 0x29c1825d, 0x26220614, 0x34353035, 0x01823736, 0x16173224, 0x62821e17,
+    0x33072723, 0x22189505, 0x18132733, 0x230de98c, 0x2611013b, 0x1809ee5a, 0x3b07bd79, 0x012b0614, 0x01110706, 0x4b6a4b00, 0x131a1e0a, 0x140d3c0d,
+    0x800a1d1a, 0xb8019048, 0xc829128d, 0x07104890, 0xfe070909, 0x23058360, 0x820826b0, 0x90240783, 0x90194e19, 0x82380883, 0x21702608, 0x01212f2f,
+    0x343c1708, 0x281a1a26, 0x09163935, 0x1090a001, 0x10221491, 0xf448fe90, 0x07092805, 0x01090720, 0x84291027, 0x64202008, 0x292305c9, 0x41d9fe10,
+    0x0127066b, 0x00c00180, 0x4c2f0029, 0x232308eb, 0x82070614, 0x3dd88df6, 0x37363433, 0x2235012e, 0x34013d26, 0x34013336, 0x15062226, 0x0e0a6801,
+    0x35440a0e, 0x07834435, 0x8bb0fe21, 0x1001310d, 0x013d563d, 0x100a0ec0, 0x6b430e0a, 0x436b1212, 0x0f8f0a84, 0x3b40fe26, 0x003b5555, 0x08db7918,
+    0x35208b87, 0x2e2a8dac, 0x07062201, 0x23353613, 0x939c1714, 0x320d0529, 0xba0d323c, 0xa20bd00b, 0x24802a99, 0x01242c2c, 0x22221e00, 0x529e821e,
+    0x2b410a33, 0x21244105, 0x16322128, 0x0e14011d, 0x98833201, 0x41680121, 0x50291627, 0xdd0e0e0a, 0x01d03d56, 0x1a264180, 0x100a0e28, 0x55900e0a,
+    0xe36b3b3b, 0x05274107, 0xa7010021, 0x9c062085, 0x857ba17f, 0x02df2677, 0x00a10100, 0x079b413d, 0x06010f22, 0x0629e082, 0x2622012b, 0x2f34013d,
+    0x051b4201, 0x1724f583, 0x33363435, 0x33200883, 0x34320891, 0x13d10136, 0x0830081c, 0x0af00a0e, 0x2070100e, 0x0e82141d, 0x013c048f, 0x85141d70,
+    0x12741214, 0x0e0a0313, 0x15070a0e, 0x2b1d640e, 0x1d1c1442, 0x88073014, 0x1f210683, 0x21058330, 0x0b84202f, 0x001c142b, 0xfffdff01, 0x01c001c0,
+    0x09b54fc1, 0x0e010f23, 0x829c8201, 0x013e2498, 0x91011f16, 0x37118b8a, 0x17109901, 0x1b031b05, 0x0f18c610, 0x1b050a7d, 0x17200921, 0x08181110,
+    0x18390489, 0x10184001, 0x71151796, 0xac141510, 0x0513210e, 0x10ec2c0d, 0xaf111818, 0x210583d8, 0x0583b1d7, 0x1157b023, 0x052b4118, 0x0002e034,
+    0x2b00a401, 0x34160000, 0x23353336, 0x36342622, 0x0788013b, 0x012e2726, 0x011f013e, 0x26055959, 0x0614011d, 0x8206010f, 0x17d825aa, 0x17112011,
+    0xd03e0482, 0x141c1c14, 0x1012b2d0, 0xbe13240f, 0x0d1d0919, 0x0e111470, 0x50050488, 0x17220911, 0x03821708, 0x1c281c38, 0x2408450e, 0x4b071025,
+    0x07050c1f, 0xf0170c40, 0x2003160e, 0x00820001, 0xff2f0482, 0x014002e0, 0x002400a0, 0x34350500, 0x4126012f, 0x838206a4, 0x013f3223, 0x080e8836,
+    0x3221333e, 0x1d161317, 0x0b800101, 0x930e0c70, 0x1b250e0a, 0x1608157c, 0xe60a0a03, 0x0a0e2117, 0x0e1a4e01, 0x3d200fa3, 0x0747070e, 0x1b080a0e,
+    0x09331425, 0x10172110, 0xfe160e0a, 0x741c17fd, 0xc0296b86, 0xc1010002, 0x00004800, 0x05b76501, 0x35206f82, 0x3222f582, 0x7a83011f, 0x162a0a84,
+    0x3316011f, 0x35343532, 0x0f8a2627, 0x18013f21, 0x2308c256, 0x33143114, 0x0f839a82, 0x15163808, 0x44ff0114, 0x7f253809, 0x0d6c2736, 0x0b101117,
+    0x022a0c3d, 0x160d1117, 0x07012603, 0x17013308, 0x04150e11, 0x08080238, 0x16032602, 0x0f06060e, 0x0722030f, 0x821d0206, 0x1121080c, 0xfe2f0117,
+    0x252d23e1, 0x11110c66, 0x29390b17, 0x06059028, 0x0d101711, 0x0108067d, 0x0505c401, 0x2f478211, 0xb80808da, 0x0502120e, 0x01a5101b, 0x0e7b0608,
+    0x05201382, 0x0021ca82, 0x06434204, 0x2d00c02d, 0x35003100, 0x00003900, 0x42141525, 0x11220e46, 0xd9423634, 0x83078c07, 0x23052416, 0x86373315,
+    0xc0012303, 0x90822001, 0x0c14d023, 0x064e4280, 0x2006b941, 0x24078517, 0x080800ff, 0x28028458, 0x040560d0, 0x10110e88, 0x055442b0, 0x11140127,
+    0xc8111717, 0x21058328, 0x05831828, 0x61210483, 0x25008360, 0xff010000, 0x774dfffc, 0x002b2305, 0x81832400, 0x362ba08a, 0x2627013f, 0x1f16013e,
+    0x8e353301, 0x013424a6, 0x84172287, 0x17f03391, 0x0507400c, 0x074b1f0c, 0x08242510, 0x281c0e45, 0x9383081c, 0x1117e823, 0x2c888450, 0x1d0d7014,
+    0x13be1909, 0x12100f24, 0x058942b2, 0x23059542, 0x00000011, 0x2405df4a, 0x00600181, 0x06c36618, 0x14150723, 0x10c54f06, 0x16013329, 0x2f22012b,
+    0x42233501, 0x2f2306da, 0x42162302, 0x262305e4, 0x18361337, 0x82092556, 0x17270809, 0x07050501, 0x55050701, 0x05360507, 0x07055507, 0x0174020c,
+    0x010b360d, 0x070b0109, 0x3209031e, 0x121f0209, 0x82020201, 0x3621080e, 0x18010706, 0x09410b01, 0x01102b03, 0x032b0809, 0x010b4109, 0x05076001,
+    0xf107052b, 0x05070705, 0x3e0a82f1, 0x0dcdfe0c, 0x2236850b, 0x07075514, 0x181e3655, 0x05080b85, 0x080b2801, 0x1520357f, 0x6f0b087f, 0x0f2e0d2b,
+    0x00002a00, 0x012b1425, 0x16323335, 0xac521436, 0x26132505, 0x34353627, 0x200b214e, 0x1145183d, 0x01250807, 0x171e1c1d, 0x91db0e15, 0xce9191ce,
+    0x26012b04, 0x0f09476a, 0x0a17090f, 0x072c1a0e, 0x0e0e180e, 0x0c381df1, 0x341c8327, 0x4fa0fe91, 0x59321802, 0x0ae80a0e, 0x480a0e0e, 0x00180d53,
+    0x05474600, 0x07510220, 0x61272005, 0xab530841, 0x09e35009, 0x75183520, 0x50260c93, 0x141c1c14, 0x1c48b0f0, 0x83f0200a, 0x10022b11, 0xc00100fe,
+    0xc0fe141c, 0x52181c14, 0x20220a19, 0x7518141c, 0x03210a95, 0x05776900, 0x1d00c026, 0x47002b00, 0xa2187582, 0x6418080f, 0x1d23105d, 0x18051401,
+    0x210c8b64, 0xb9183405, 0x352718ac, 0x58feb401, 0x18141c0c, 0x210a7e64, 0x64184cfe, 0x4824099c, 0x280c3c0c, 0x06860382, 0x18200121, 0x220d8d64,
+    0x18200c24, 0x2009aa64, 0x8227898c, 0x080f4809, 0x8501c021, 0xae3720b3, 0x0a546db3, 0x3c25a39d, 0x0cb80c0c, 0x209a9c0c, 0x82c482c0, 0x41939002,
+    0x37202f47, 0x1854ba18, 0xa39d2720, 0x09300d2c, 0x09081c09, 0x08093030, 0x0683091c, 0xb99c0d8a, 0x3193a020, 0x3f834682, 0x0020ce82, 0x200d1742,
+    0x2e63413b, 0x0f262723, 0x26038301, 0x16011f06, 0x9d36013f, 0x825920c3, 0x2e6a23c0, 0xc0820908, 0x08095224, 0xb79c098f, 0x091c6026, 0x082f6a08,
+    0x0825ed82, 0x8e080854, 0x20ab8309, 0x084f5501, 0x00001924, 0x91183601, 0x3b270cec, 0x1d163201, 0x82363701, 0xdb013804, 0x0a0e190c, 0x0e0a30fe,
+    0x0a700a0e, 0x190c8b0e, 0x0e081c01, 0x4cf0fe0e, 0x0e27077b, 0x0858c40a, 0x89440e0e, 0x012034ff, 0x000900c0, 0x001d0011, 0x32163700, 0x06071537,
+    0x7c012f22, 0x2a08088c, 0x22233432, 0x32141506, 0x70363435, 0x16111e11, 0x16040c04, 0x5454781c, 0x0c905478, 0x1836260c, 0x03038328, 0x0505219d,
+    0x82da0121, 0x78542913, 0x26361808, 0x281c0c0c, 0xff255f84, 0x02c0fff9, 0x245f8207, 0x0024001a, 0x22b78239, 0x61010f16, 0x3b200863, 0x2609e754,
+    0x03173233, 0x53153335, 0x524c05a5, 0x05836809, 0x332b2782, 0x0cfb0115, 0x0e092b0c, 0x820a7ffe, 0x09a829d8, 0x09072007, 0xf0090e99, 0x2005fe54,
+    0x241483e8, 0x090e7ffe, 0x2d24842b, 0x6b014099, 0x092c0b0b, 0x0a500a0e, 0x5576100e, 0x39fe2305, 0x09827070, 0x84170121, 0x2c092114, 0x20211f83,
+    0x08a48220, 0x00000345, 0x4002deff, 0x0800a201, 0x15000c00, 0x34110000, 0x0711013f, 0x37352606, 0x13111711, 0x11151636, 0x11010f14, 0x088a8c14,
+    0xaac0c00e, 0x8c140e08, 0x08164a01, 0x3f80fe38, 0x30080a03, 0xfe408001, 0x82bf0180, 0xa6fe210a, 0x01221582, 0x13480080, 0x02bd2406, 0x83c00100,
+    0x6501204f, 0x53820744, 0x44013d21, 0xc02908d3, 0x1a26261a, 0x0d067d90, 0x32088360, 0x1a26c001, 0x261ae0fe, 0x0707045e, 0x011a2654, 0x84261a20,
+    0x072f6d9b, 0x17000722, 0x6f0be57a, 0xbf530fa7, 0x05bd6d0f, 0x0709e822, 0x2105b864, 0xa9650907, 0x6d0f8405, 0xb72306b0, 0x780907a0, 0x098806f9,
+    0x00217282, 0x0a477502, 0xbe181720, 0x26200cb3, 0x850b0f46, 0x58012161, 0x57904289, 0x24096763, 0x001100c0, 0x06ff5f19, 0x53113321, 0x352105b5,
+    0x05a24711, 0x15231522, 0x26220882, 0xf65a0622, 0x58062007, 0x603707a7, 0xfe212f60, 0x602f21e0, 0xc04b6a4b, 0x26342680, 0x0e0e1496, 0x84b20e14,
+    0x20013405, 0x2f21f0fe, 0x1001212f, 0x4b4b3520, 0x1a202035, 0x57922626, 0x21080aa0, 0x00000400, 0x4002e0ff, 0x2900a201, 0x41003500, 0x00004d00,
+    0x06141525, 0x0e07012b, 0x22212301, 0x90182f26, 0x372709c2, 0x011e013e, 0x4833010f, 0x3222073a, 0x66180516, 0x37200a4e, 0x27200b8a, 0x28080b8a,
+    0x0a0e4002, 0x1b031a08, 0x1294fe12, 0x081a031b, 0x0a0e0e0a, 0x1a086b43, 0x50080416, 0x040850ec, 0x6b081a16, 0xfe0e0a43, 0x209585f8, 0x20068570,
+    0x2b0685e0, 0x0e0a10e8, 0x171712b7, 0x0a0eb712, 0x932f0a82, 0x1a10040b, 0x0b6d6d0b, 0x0b04101a, 0x55ba0e93, 0x235508df, 0x31098909, 0xff020000,
+    0x01e0ffff, 0x00a001c1, 0x00470043, 0xd5830100, 0x48323321, 0x0720055e, 0x22210c82, 0x7bb41826, 0x8323200a, 0x3b36210d, 0x07ec6718, 0x0c820882,
+    0x33202c83, 0x82057f60, 0x310d83f8, 0x01072337, 0x4f0a02b9, 0x08054b17, 0x0a010801, 0x67600f50, 0x620e2a05, 0x290a0110, 0x0f010706, 0x2004824b,
+    0x3021a007, 0x176317ba, 0x800a0a01, 0x0a280509, 0x05090a56, 0x83048452, 0x3012900d, 0x008080b2, 0xfcff0500, 0xc401c0ff, 0x0700c001, 0x05295a00,
+    0xc5572d20, 0x07175a09, 0x95181620, 0x36210891, 0x20138334, 0x20ed8213, 0x31f68307, 0x01372622, 0x425c9e36, 0x5c425c42, 0x281c1c28, 0x0b8a821c,
+    0x0e206830, 0x91fe080e, 0x0e220c07, 0x7001090e, 0x2582e007, 0x5e5c4222, 0x1c222582, 0x0b8ac428, 0x1aa4012d, 0x0a30fe0c, 0xd0010c1a, 0x4205000a,
+    0x8f850aff, 0x00004722, 0x07166918, 0x7b182420, 0x36200e77, 0x3106cb57, 0x2e013e17, 0x22060701, 0x010e2627, 0x17161716, 0x0d820e14, 0x011e5308,
+    0x37363736, 0x1e171633, 0x27013e01, 0x3635022e, 0x7aac5601, 0xfe7aac7a, 0x9191cec9, 0xa0a891ce, 0x70a07070, 0x15151ecf, 0x0652151e, 0x070b0307,
+    0x07484c48, 0x0607030b, 0x06091d35, 0x0e06020a, 0x0412030d, 0x0312040a, 0x02060e0d, 0x1d09060a, 0x3d829001, 0xa2ac7a22, 0x91223c82, 0x3c8259ce,
+    0x44a07022, 0x40083c82, 0x014d1e15, 0x02070d0c, 0x07021111, 0x0c020b0d, 0x13412f04, 0x050e0718, 0x212e0606, 0x06062e21, 0x18070e05, 0x042f4113,
+    0x00000400, 0x8001bdff, 0x0b00c001, 0x1b001300, 0x00004200, 0x22230605, 0x2da8822f, 0x14151617, 0x0e161727, 0x012f2601, 0x43592212, 0x16172405,
+    0x82060706, 0x2326290f, 0x1f141522, 0x0e071501, 0x3f25e582, 0x15073501, 0x05da6714, 0x36374408, 0x1732013b, 0x02027c01, 0x087d0205, 0xf1017e05,
+    0x180b053f, 0x04240519, 0x241a1a24, 0x02066f1a, 0x07140708, 0x04020166, 0x04421f01, 0x050c1918, 0x0a0e1036, 0x073d0e0a, 0x070c200c, 0xce04013f,
+    0x82d00703, 0x9ac3293c, 0x0b0a190c, 0x3c01580c, 0x1a253582, 0x1408c324, 0x3b3a8206, 0x02040281, 0xb56c2701, 0x18090c0c, 0x148c950d, 0x0e0e0a50,
+    0x094f5f0b, 0x00050009, 0x02380082, 0x00800100, 0x000e0006, 0x0034001e, 0x37000043, 0x36372317, 0x32371637, 0x2b23c982, 0x18373501, 0x290d0c99,
+    0x26270516, 0x0f22012b, 0x4f180601, 0x37200cdf, 0x2c0d1f75, 0x091a09a3, 0xa8020202, 0x0e2f1916, 0x167f18c5, 0xf52c080c, 0x24090239, 0x02390308,
+    0x091d0607, 0x08340803, 0x061d0903, 0x2e35b707, 0x07070539, 0x352e3905, 0x061e1ed1, 0x191a0a0a, 0x5f623118, 0x3a058353, 0x1c142001, 0x08a8f41c,
+    0x0a06a808, 0x091e1e09, 0x332d560a, 0x05a80507, 0x82003407, 0xff042c00, 0x01c0fff4, 0x00c60181, 0x82330021, 0x00532abf, 0x012e1700, 0x1f363736,
+    0x82c08201, 0x222329a7, 0x17062723, 0x32333237, 0x13321189, 0x0e071416, 0x26012f01, 0x27343637, 0x36013f26, 0x11823716, 0x108a0620, 0x0f8e0720,
+    0x40612608, 0x0a3f2e2d, 0x0209400c, 0x010c0420, 0x20203801, 0x0c010138, 0x08012004, 0x08040540, 0x03090991, 0x0606050b, 0x08008204, 0x05060642,
+    0x2d2d5f0b, 0x09050a08, 0x08252508, 0x260a0509, 0x0a081b1b, 0x14070806, 0x06080714, 0xab403b0a, 0x080a40ab, 0x030a0528, 0x060b5103, 0x0b065a5a,
+    0x0a030351, 0x01032805, 0x102210a1, 0x06040105, 0x10202b82, 0x06362a82, 0x36560104, 0x090a368c, 0x2d080806, 0x08082d74, 0x23370906, 0x0f822358,
+    0x1a08072c, 0x07081a42, 0x00000906, 0x0082000c, 0x01800223, 0x08f743a0, 0x5e002721, 0x47270523, 0x57004f00, 0x18005f00, 0x20088f74, 0x06754306,
+    0x07861220, 0x5e090d44, 0x17870587, 0x1f8e0420, 0x802c2f9f, 0x25253625, 0x131a2836, 0x05131a13, 0x25210a83, 0x820b84d3, 0x2011880e, 0x8b0c8501,
+    0x85248b12, 0x84db2017, 0x84c0203c, 0x7301210c, 0x9b205584, 0x8d200c84, 0x532012ab, 0x00202c84, 0x06210082, 0x056b6800, 0x1300c323, 0x05c95b00,
+    0x60005c2e, 0x14370000, 0x35262206, 0x16323634, 0x23067868, 0x26062226, 0x0e210c83, 0x05914302, 0x3336342a, 0x34353632, 0x3435023e, 0x24861a82,
+    0x41072d41, 0x25200745, 0x3d384585, 0x27012e01, 0x013e012e, 0x17011e17, 0x27070514, 0x1810d837, 0x2f422f10, 0x0e360582, 0x92310e14, 0x171b1667,
+    0x100c2d3f, 0x1e160c10, 0x46161b17, 0x19824664, 0x131a5322, 0x6d20a582, 0x02210584, 0x30108200, 0x0b405101, 0x0b15070a, 0xfe016651, 0x22502299,
+    0x233083bc, 0x212f2f21, 0x0a2c0783, 0x67a60e0e, 0x19322149, 0x3f2d0b19, 0x1e2a2c82, 0x13251916, 0x46321926, 0x1e833246, 0x84854921, 0x846d20f1,
+    0x83cf2005, 0x01022f11, 0x166f4401, 0x0a161504, 0x568c1b04, 0x5082b503, 0x3f052b43, 0x02c6fffa, 0x00ba0186, 0x003f0031, 0x007f0071, 0x07260100,
+    0x06161732, 0x07163223, 0x2723010e, 0x2a05a744, 0x3736023f, 0x06011e36, 0x82070607, 0x82162008, 0x8209831f, 0x252382e0, 0x22232607, 0x4a761506,
+    0x26332505, 0x020f1625, 0x2e212682, 0x20278201, 0x22088237, 0x84262726, 0x2e272909, 0x013e3701, 0x22371617, 0x33221082, 0x0c822622, 0x3717332a,
+    0x07171636, 0x23060722, 0x46085182, 0x35363233, 0x23012634, 0x183d2120, 0x0e0e1007, 0x2b0b0710, 0x07435e1a, 0x082c030e, 0x0a293a0f, 0x0e160846,
+    0x0d140802, 0x120b2822, 0x0b0e0201, 0x2b2d1517, 0x0505070a, 0x160a2515, 0x0e15140f, 0x11070a16, 0x8e700111, 0x1409212b, 0x09202b8c, 0x1c215d8b,
+    0x205d835c, 0x203884b9, 0x3f448407, 0x0c100301, 0x19190d33, 0x091c170d, 0x06050421, 0x21090f59, 0x07395a4a, 0x07161102, 0x05171311, 0x0b377682,
+    0x0d020211, 0x1505150a, 0x41070a0a, 0x0f0f1515, 0x010f1414, 0x8d081034, 0x0c0d2127, 0x0520278b, 0x4720558d, 0xb1823182, 0x00313a82, 0xfffbff04,
+    0x010502c0, 0x001300c5, 0x00430037, 0x378b4250, 0x0f162523, 0x05426001, 0x01173623, 0x200c8317, 0x05e34b22, 0x35237b42, 0x0909bc01, 0x1c090857,
+    0x09570808, 0x1cc9fe08, 0x04940909, 0x0683030a, 0x75420820, 0x089b212c, 0x08224682, 0x4682091c, 0x46830920, 0x0494083b, 0x09081c04, 0x03000994,
+    0xbfffffff, 0xc201c101, 0x3f003200, 0x00006b00, 0x07b45417, 0x7305b96e, 0x352007d5, 0x37200882, 0x27201a83, 0x2005c654, 0x09c15416, 0x2737262a,
+    0x36373626, 0x06011f16, 0x37270382, 0x0f141530, 0x82343501, 0x870720e4, 0x88208817, 0x26273008, 0x1516013e, 0x3e0d115b, 0x11110c7e, 0x829a7f0b,
+    0x0c2d0805, 0x120c7d9a, 0xa90c1001, 0x0e040a1f, 0x0e7c0918, 0x10500c0f, 0x100c6b10, 0x03072549, 0x08180909, 0x0e020d0d, 0x3d0df70b, 0x15157b12,
+    0x2e128234, 0x4e07170a, 0x03085e04, 0x0717090a, 0x844d055f, 0x67082e08, 0x17110101, 0x110c2412, 0x0c0c1106, 0x20048210, 0x3309830b, 0x0716110b,
+    0x06031318, 0x8d120a5a, 0x1302130c, 0x2eee1004, 0x32823e82, 0x230b1130, 0x0102080a, 0x11300a11, 0x0f5a0c16, 0x6882430e, 0x0a03072e, 0x0a790363,
+    0x03070718, 0x62047a09, 0x85230885, 0x82110c26, 0x0000379d, 0xf8ff0200, 0x4002beff, 0x2d00c201, 0x00004200, 0x07141625, 0x915d0706, 0x03272906,
+    0x06130706, 0x022f2223, 0x26231282, 0x70372627, 0x36280607, 0x36011f16, 0x07163233, 0x2107f074, 0x48491736, 0x35220805, 0x02070616, 0x31070739,
+    0x03052b57, 0x14080d08, 0x1214fc06, 0x161112be, 0x10772916, 0x3c717d0d, 0x1a890f0f, 0x28352008, 0x8895592a, 0x1a385022, 0x262a1318, 0x24191912,
+    0x12050e19, 0x0b1a0bd8, 0x083a2b54, 0x820a0514, 0x65013042, 0xf1fe0d09, 0xab3a0302, 0x28b21311, 0x89181866, 0x0a482b1a, 0x3327bb57, 0x1c095038,
+    0x3a82140d, 0x1a121924, 0x7b45193d, 0xfd230806, 0x80018002, 0x20001900, 0x2f002800, 0x57003700, 0x32010000, 0x2615011f, 0x3637012f, 0x0f222627,
+    0x82061501, 0x37342ece, 0x33363735, 0x23113317, 0x3a352622, 0x059a4a01, 0xa15b0520, 0x07b94a05, 0x011e0529, 0x010e010f, 0x8307012f, 0x20038304,
+    0x20348223, 0x080e833b, 0x011e172b, 0xb301013f, 0x0437090d, 0x0c1a9204, 0x050d050a, 0x0a220d50, 0x09620d0a, 0x4060c30d, 0x0e29130d, 0x090e0909,
+    0x1360c0fd, 0x8207820d, 0xa4013d02, 0x0909030a, 0x050a1b08, 0x0c1f0920, 0x14351112, 0x0937125b, 0x1652540d, 0x3b141402, 0x80374f82, 0x05c23709,
+    0x0b187603, 0x4904050c, 0x0b020a01, 0x010b210c, 0x1940085a, 0x2608e209, 0xe0000129, 0x8440130d, 0x080a244e, 0x820c0b1a, 0x26043450, 0x100a040c,
+    0x52110615, 0x4b0937e0, 0x15163c14, 0x531b1403, 0x002906a7, 0x1a00c101, 0x00004500, 0x07b54d05, 0x37342508, 0x3e303736, 0x1e323302, 0x17163102,
+    0x26071516, 0x30070607, 0x2223020e, 0x2631022e, 0x010f2627, 0x17141506, 0x08729918, 0x35363726, 0x00022734, 0x32054b49, 0x1c7c2912, 0x0808170e,
+    0x7c1c0e17, 0x04421229, 0x87472307, 0x4731080f, 0x09040723, 0x46240302, 0x170e1602, 0x17151415, 0x4602160e, 0x10020324, 0x141c1c14, 0x0e180701,
+    0x09155a20, 0x15090b0b, 0x180e205a, 0x1b040642, 0x3c0e8533, 0x06041b33, 0x0402020e, 0x02321a03, 0x060d0a11, 0x110a0d06, 0x031a3202, 0x00020204,
+    0x09df5100, 0x2f002729, 0x00004300, 0x5f152301, 0x07880624, 0x3624d788, 0x16322133, 0x4106f75f, 0x674f07bd, 0x22062205, 0x084e7427, 0x01363227,
+    0x0c1414b4, 0x5403840c, 0x9f820576, 0x1c14403f, 0x34d60c14, 0x26342626, 0x051c2730, 0x05132a13, 0x090d271c, 0x010d09b4, 0x280c4020, 0x2003830c,
+    0x20c98430, 0x200583a0, 0x20128230, 0x312b8220, 0x13c73426, 0x08082218, 0x08131822, 0x00000b0b, 0xb34e0006, 0x00a02805, 0x0017000f, 0x8237002b,
+    0x764f20b3, 0x16201165, 0x20052c43, 0x209d9334, 0xf4691837, 0x8958180a, 0x05544117, 0x8320fe21, 0x939a208a, 0x08e023b4, 0x028e0890, 0x18a00121,
+    0x24075a71, 0x1c146001, 0x26bc9060, 0x0808103d, 0x8a480810, 0x3f711805, 0x501f2010, 0x8018094d, 0x373009de, 0x2223012e, 0x27220607, 0x06222326,
+    0x91ce9107, 0x01360282, 0x3434481c, 0xb2b13448, 0x20340e39, 0x28150403, 0x20030415, 0x60500e34, 0x82312006, 0x48343b1a, 0x1b44dcfe, 0x07070121,
+    0x001b2101, 0x00000400, 0x8001c0ff, 0x0f00c001, 0xb1661b00, 0x51012005, 0x23200575, 0x2c06295f, 0x06221733, 0x013b1614, 0x26343632, 0xe44f1823,
+    0x26342309, 0xdd41012b, 0x1450220e, 0x07385f1c, 0x66186020, 0x162008d1, 0x18132541, 0x230d388b, 0x090e0920, 0x80200282, 0x23101941, 0x07000000,
+    0x2f08d741, 0x00130009, 0x002b001f, 0x003f0037, 0x01000051, 0x07ffaa18, 0x11033323, 0x06b04c21, 0x5a182520, 0x1d211677, 0x09b36101, 0x21079f42,
+    0xd3840607, 0x012e2722, 0x022ac787, 0xfd1c1410, 0x30141cc0, 0xc6824002, 0x1c142024, 0xc9416001, 0x200e820e, 0x36ce8496, 0x080a02ad, 0x020a08ba,
+    0x08152206, 0x08132a13, 0xa0012215, 0x8210141c, 0x70fe2940, 0xd0fe3001, 0xfc1c1c14, 0x8510d541, 0xa63508df, 0x080c0d07, 0x08081913, 0xff030019,
+    0x01c0ffff, 0x00c00100, 0x00320012, 0x13000042, 0x14151615, 0x23302306, 0x34352622, 0x36343537, 0x32031632, 0x2e343536, 0x073d5106, 0x15070e25,
+    0x4a331614, 0x218506cd, 0x16011d3d, 0x354b20e0, 0x204a3501, 0x60385038, 0x02022f21, 0x03070306, 0x281c0108, 0x8208011c, 0x062a0809, 0x202f0202,
+    0x25362541, 0x131a1320, 0xcb600120, 0x4b353025, 0x2430354c, 0x383828cb, 0x212f68fe, 0x0b090c06, 0x09040906, 0xb782dd01, 0x01dd143b, 0x0609030a,
+    0x070b090b, 0x1b503020, 0x251b2525, 0x130de912, 0x12e90d13, 0x20008200, 0x22b38803, 0x8322000f, 0x208b8fb3, 0x21c29037, 0xc08f0315, 0x32013b24,
+    0x9087c036, 0xbc892020, 0xba941020, 0x2f210123, 0x20878540, 0x228783a9, 0x8b3012a9, 0xfe2822c0, 0x20bf99e0, 0x0a63412f, 0x6920aff2, 0x6920af83,
+    0x20a9af40, 0x20af8329, 0x25afb629, 0x001a0007, 0x794e003a, 0x2b074208, 0x45362522, 0x26220442, 0x2525365b, 0x41152536, 0x002b2afc, 0x00100000,
+    0x02e0ff00, 0x4fa10100, 0x6728182b, 0x77006f00, 0x0000a600, 0x210fa152, 0xcb512216, 0x05d75b05, 0x26141622, 0x6b06234f, 0x06220727, 0x11853634,
+    0x860e3b4f, 0x4e342015, 0x07970735, 0x37382787, 0x010f1416, 0x012f2206, 0x013f3426, 0x37343526, 0x22232627, 0x15010e23, 0x081b6f18, 0x1f2a6882,
+    0x32333601, 0x32363717, 0xdb480117, 0x25058505, 0x09090e37, 0x0b8b090e, 0x11849720, 0x2005a648, 0x200b8420, 0x20239069, 0x85118417, 0x200b853b,
+    0x08118449, 0x04042621, 0x040e04aa, 0x0604040c, 0x110a0e20, 0x16040418, 0x2007091d, 0x65490907, 0x1b1a0a23, 0x8206202e, 0x8280201d, 0x0e092270,
+    0x20058469, 0x20058437, 0x850b9029, 0x20848578, 0x85239017, 0x853b8511, 0x8449200b, 0x82e32023, 0x04aa215d, 0x0e207e82, 0x2e347f82, 0x110a1a1b,
+    0xfe172403, 0x090907ce, 0x342f0107, 0x0e0a244d, 0x04208082, 0x2d067b64, 0xc1010002, 0x49001900, 0x35370000, 0x5b181521, 0x4f18155a, 0x222808cf,
+    0x34013d26, 0x35013b36, 0x24054941, 0x1f323617, 0x09754101, 0x3726372b, 0x06222627, 0x0120011d, 0x05085dc0, 0xcf6cff20, 0x01202205, 0x217c83d0,
+    0x058320fe, 0x3929102d, 0x232d1314, 0x0b050d05, 0x85690505, 0x141c2b06, 0x0c120614, 0x2b303040, 0x2384291c, 0x05831020, 0xab1c2924, 0x09840709,
+    0xbb270482, 0x1414291c, 0x82051c14, 0x820d2035, 0x27068436, 0x06142c23, 0x00bb090c, 0x04200082, 0x086f9b18, 0x2b000b2d, 0x56004e00, 0x06050000,
+    0x822e2722, 0x15322baa, 0x16270614, 0x06070607, 0x67182627, 0x0b830784, 0x3726272e, 0x26343536, 0x07010e07, 0x16321206, 0x07212582, 0x18128206,
+    0x25086a87, 0x17161415, 0x03821516, 0x46840620, 0x0807c450, 0x060b0137, 0x0e07064a, 0x05750e80, 0x04070e06, 0x3d572e05, 0x02015239, 0x07040530,
+    0x1d05060e, 0x3525293b, 0xba050202, 0x03384683, 0x01040106, 0x48682c25, 0x242a6749, 0x080b8203, 0x39030655, 0x2536c545, 0x29253625, 0x55191717,
+    0x172c2c17, 0x0405af55, 0x06080f0a, 0x553d3e2b, 0x39510202, 0x08062c41, 0x05040a0f, 0x3929281d, 0x25350202, 0x8303012b, 0x1b6c425d, 0x1b040402,
+    0x2e4e1814, 0x48676749, 0x02184e2d, 0x04191303, 0x6c1b0204, 0x821d5d42, 0x3625224e, 0x08df6800, 0x49010021, 0x002005bb, 0x270f7f48, 0x23343505,
+    0x011d2221, 0x2906ad67, 0x1c1c1460, 0x0c900114, 0x7c1898fe, 0xa0240e2d, 0x540c0c54, 0x002a4e82, 0xff000001, 0x000002e0, 0xd0180060, 0xd02013ef,
+    0xfe203f83, 0x60234584, 0x8320141c, 0x2004820d, 0x07476600, 0x01000225, 0x591100c0, 0x11270671, 0x012b0614, 0x83263435, 0x33362504, 0x07163221,
+    0x230e1a55, 0x012b3407, 0x33289a82, 0x141c0002, 0xd0212f30, 0x4c829982, 0x0c664018, 0xe40c442e, 0x9001fc0c, 0x1c14e0fe, 0x302f21d0, 0x94206f82,
+    0x29850b83, 0x0c301c24, 0x7a82340c, 0x82090021, 0x84c020b3, 0x000f227b, 0xa74a181f, 0x007f250a, 0x0100008f, 0x280a0944, 0x1632013b, 0x2b141517,
+    0x22038301, 0x6b323335, 0xa5820a6e, 0x25240fa5, 0x22231533, 0x200a856b, 0x230fae37, 0x141ca001, 0x0484ce82, 0x12066025, 0x822a2a06, 0x21079704,
+    0x1e9c1efe, 0x01120623, 0x058d4190, 0x14a0012d, 0x0c4e1c1c, 0x30060606, 0x96660606, 0x820c2007, 0x8306201b, 0x9960201b, 0x82002008, 0xff013400,
+    0x01c0fffa, 0x00c001c6, 0x250000a5, 0x010f011e, 0x4f012f06, 0x2f23065b, 0x43171502, 0x152007fd, 0x2105385d, 0x9818013d, 0x352908ff, 0x010e010f,
+    0x012e012f, 0x2513823f, 0x3f26012f, 0x0b832701, 0x1f013e24, 0x2c533701, 0x82362006, 0x24178213, 0x27011f36, 0x290b8226, 0x021f1636, 0x34262735,
+    0x1182013f, 0x36343522, 0x4407535e, 0x15220664, 0x3c83013f, 0x37208383, 0x16232082, 0x8317010f, 0x2264830b, 0x82371707, 0x0125083c, 0x010f0616,
+    0x0306b801, 0x0e071003, 0x06020621, 0x0c060f06, 0x353f1301, 0x050b0505, 0x0a14040d, 0x09072006, 0x27098214, 0x3605050c, 0x0b02133f, 0x20081f82,
+    0x21070106, 0x0810070e, 0x071a220e, 0x01040206, 0x4046070b, 0x0b074640, 0x06020401, 0x0e221a07, 0x284a8d08, 0x0c040436, 0x09140b0b, 0x45498307,
+    0x498205e2, 0x830c0121, 0x06022149, 0x07214983, 0x3349940d, 0x050d0367, 0x14070d1b, 0x020b061a, 0x06070204, 0x354e2447, 0x2705fb44, 0x09072813,
+    0x13280709, 0x3625a485, 0x0647244e, 0x2a888207, 0x141a060c, 0x0d1b0d07, 0x84071308, 0x020725a8, 0x13252513, 0x0f203982, 0x07224182, 0x1a820813,
+    0x0c214d91, 0x214d8c0c, 0x4d863505, 0x4d9b4182, 0x0000002d, 0xffffff01, 0x010902bf, 0x821400c9, 0x0616250c, 0x27010e07, 0x0808ca41, 0x3736262d,
+    0xe001013e, 0x24301428, 0x08c02558, 0x08330917, 0x0d15d709, 0x01893124, 0x31892aa0, 0xd7150d24, 0x09330809, 0x25c00817, 0x82302458, 0x4f002040,
+    0x013005bb, 0x00c101a0, 0x003b0029, 0x15161300, 0x17070614, 0x07b76918, 0x35012e2e, 0x32363734, 0x32161517, 0x35023e37, 0x16210982, 0x820a8217,
+    0x2e132208, 0x05bf6e01, 0x3906aa43, 0x2510d037, 0x0f010d20, 0x0f0a400a, 0x25200d01, 0x022c0210, 0x01010e01, 0x08830304, 0x0a820720, 0x792c022e,
+    0x2a13222c, 0x0e0a1939, 0x0b380a0e, 0x28081b82, 0x26225fb1, 0x0aee0c37, 0xee0a0f0f, 0x2226370c, 0x8e100f5f, 0x470b0202, 0x1010013b, 0x02028608,
+    0xd3fe108e, 0x424c5623, 0x05a56026, 0x000a1022, 0x0029f282, 0x01c8ff08, 0x00b901f9, 0x210c8224, 0xb0181632, 0x36240cb8, 0x07263637, 0x2f08be88,
+    0x3634013d, 0x0136011f, 0x91926600, 0x0a475f67, 0x08082809, 0x61463f30, 0x45650101, 0x0b2a3042, 0x0a86100c, 0x240b1e0e, 0x91b80147, 0x084091ce,
+    0x27081f82, 0x45622a07, 0x01016347, 0x1e0b2a2c, 0x10860a0e, 0x45240b0c, 0x00050000, 0x01c0ff00, 0x00c101c0, 0x00150009, 0x002d0021, 0x17201482,
+    0x2508854d, 0x16141501, 0x6d823632, 0x06222623, 0x470b9607, 0x37281099, 0x32013b36, 0x0120011f, 0x24063b45, 0x0e091001, 0x20028209, 0x21068c60,
+    0xc4644001, 0x09783209, 0x0f720f07, 0x01100907, 0x14b0fe50, 0x14011c1c, 0x971c83e0, 0x18a92004, 0x24096558, 0x130d0d13, 0x5f008200, 0x1c2709af,
+    0x00003900, 0x82232601, 0x2b062fb0, 0x37262201, 0x3233013e, 0x16363717, 0x1f44011d, 0x05372a05, 0x0f163233, 0x32331601, 0x25a98436, 0x010e0716,
+    0x2f7d2223, 0x01363306, 0x3a423173, 0x0a020e5b, 0x01070639, 0x635a8911, 0x2f412448, 0xd7fe2607, 0x0b0c1086, 0x2b1f932a, 0x472d3b01, 0x05090938,
+    0x24457357, 0x23077c41, 0x2a0b1e79, 0x002f158f, 0xff100002, 0x01b601c0, 0x002200c0, 0x58000030, 0x36210685, 0x0afd6f37, 0x012b1424, 0xb17d1615,
+    0x16022106, 0x0944bd18, 0x3b142e08, 0xb0013201, 0x657aac7a, 0x0c0c1c4b, 0x1c0c0c78, 0x091b2c38, 0x09091c08, 0xb022011d, 0x05280507, 0x0c280c07,
+    0x7a7a5690, 0x0c754d56, 0x820b8222, 0x09222702, 0x09091b24, 0x2382081c, 0x98623328, 0x04080804, 0x2f410c98, 0xff002a05, 0x01f801fc, 0x00150084,
+    0x61878231, 0x5b490795, 0x011f2408, 0x18051416, 0x2007d6d9, 0xed661836, 0x1d062408, 0x82161401, 0x152f080d, 0x0ba8f101, 0x0e0a881e, 0x1e880a0e,
+    0xfe07a80b, 0x28540cc8, 0x54283838, 0x0d540c0c, 0x540d1313, 0x0ba8af0c, 0x0e60100c, 0x0e0a600a, 0x820c1060, 0xaa142722, 0xc028380c, 0x95823828,
+    0xc00d1324, 0x8788130d, 0x0002f426, 0x1b008001, 0x21208783, 0x20070471, 0x23888236, 0x22012b26, 0x82450682, 0x06142705, 0x0f141627, 0x49180601,
+    0x17220e27, 0x7289a001, 0x57228284, 0x998a0707, 0x28206c88, 0xc9227c85, 0x1e821407, 0x0028988b, 0x07000100, 0xf801c8ff, 0x42077743, 0x3f3a0b2b,
+    0x26272601, 0x011e1706, 0x36373233, 0x0716011f, 0x26222306, 0x00013634, 0x16424764, 0x302a3608, 0x01654542, 0x3f466101, 0x28080830, 0x5f470a09,
+    0x01929167, 0x090842b8, 0x012c2a29, 0x45476301, 0x82072a62, 0x4008251e, 0x0091ce91, 0x2f05ab51, 0xc0010002, 0x38003000, 0x4c004400, 0x1e250000,
+    0x0861a218, 0x37363428, 0x36343526, 0x0585013b, 0x3536322b, 0x33362734, 0x14151632, 0x52058a07, 0x1725073e, 0x012b2636, 0x22a58322, 0x62263632,
+    0x35080736, 0x2a231ac3, 0x1e90fe1e, 0x1d1a232a, 0x160e1e2a, 0x21101a26, 0x06090f2f, 0x06063828, 0x0e16261a, 0xedfe2a1e, 0x1a13131a, 0x05018013,
+    0x0504b004, 0x383c0801, 0x1184253c, 0x044f2308, 0x2a1e1b28, 0x281b1e2a, 0x1e231604, 0x1a1d132a, 0x19212f26, 0x28380215, 0x1a26110f, 0x1e2a131d,
+    0x38825b23, 0x781a132a, 0x04070704, 0x60202015, 0x6b620d84, 0x49a02008, 0x34200673, 0x9c76d382, 0x11352106, 0x1524cd83, 0x25331614, 0x220d6954,
+    0x51340415, 0x072105c5, 0xb0e71815, 0x01072f07, 0xfe141ce0, 0x1c1c1480, 0x212f1014, 0x0c87b001, 0x12820120, 0x1cc0fe31, 0x281c1c28, 0x58600144,
+    0x28880808, 0x55200808, 0x00260519, 0x21d01c14, 0x3383502f, 0x0b820120, 0x44141c22, 0x1c232683, 0x86703060, 0x82002027, 0xff043400, 0x02befffe,
+    0x00c00101, 0x0019000d, 0x00280021, 0x59070100, 0x32260687, 0x1416011f, 0x05823627, 0x13820720, 0x013f2624, 0x03821636, 0x020f2637, 0x17072335,
+    0xf2013537, 0x6f08092e, 0x0e2e0909, 0x0e3c0e28, 0x2b0b84e4, 0x0c7afafe, 0x5c160212, 0x0a9a0a14, 0x242b0382, 0x40200c24, 0x092e3201, 0x82086f09,
+    0x21268227, 0x0b841c28, 0x16fafe27, 0x7a0c1202, 0x83238220, 0x30682527, 0x240c2040, 0x00218e82, 0x228f8802, 0x82110007, 0x8517208b, 0x37888279,
+    0x3727010f, 0x01173236, 0xeafe8023, 0x01100c72, 0x0ee5010d, 0x3980390e, 0x01217d82, 0x26138263, 0x0c10010d, 0x82290172, 0x2014830e, 0x874c820e,
+    0x00c1244b, 0x821f0009, 0x1416214b, 0x07214386, 0x2655821f, 0x37260607, 0x18013f36, 0x23071b42, 0xf2013236, 0xbb244f87, 0x51c55355, 0x512d6384,
+    0x0b661798, 0x0c0c160c, 0x01210b77, 0x215b8776, 0x1f825428, 0x512a6f84, 0x0b661698, 0x0c0b170b, 0x60820c76, 0xff0d002d, 0x01f300df, 0x001300a0,
+    0x18333700, 0x360d157b, 0x1532013b, 0x0c102ea8, 0x1407560b, 0x0c0b5607, 0x380c2e10, 0x821e660c, 0x2e0d820e, 0x0c2e011e, 0xff01000c, 0x014d00ff,
+    0x843301c0, 0x1815203f, 0x280917b2, 0x3221011d, 0x2314011d, 0x202e8b86, 0x214c8f98, 0xf3820100, 0xc1014d22, 0x25233f85, 0x4e363435, 0x262a0604,
+    0x2221013d, 0x3334013d, 0x40873a01, 0x0cd2fe24, 0x4090e80c, 0x01203f82, 0xe020c382, 0xa120c382, 0x13278383, 0x3f262223, 0x82323601, 0x2b062947,
+    0x2b141101, 0x58352201, 0x0121358f, 0x82548b1a, 0x21c78342, 0x8782dfff, 0x3b00a122, 0x8205ed42, 0x20478237, 0x2b601827, 0x4637200d, 0x4318075d,
+    0x2721078e, 0x30481826, 0x012f3908, 0x36371707, 0x0ec00116, 0x0c10700a, 0x6b6b240b, 0x100c0b24, 0x1e0e0a70, 0x1e200b85, 0x68201797, 0x3b8b23a2,
+    0x74060758, 0x1d2005eb, 0x116ff418, 0x32363427, 0x32331516, 0x0af55716, 0x6f55cc82, 0x07ca4705, 0x50141c32, 0x50263426, 0x14b61c14, 0x0e140e0e,
+    0x06b40648, 0x01310282, 0x14a0fe50, 0x01141c1c, 0x1a1c1460, 0x1c1a2626, 0x281b8234, 0x1464140e, 0x06140606, 0x05eb4100, 0x01010225, 0x821b0033,
+    0x0baa410c, 0x0e02f218, 0x417a0121, 0xf420075e, 0x01210888, 0x0b474216, 0x200c9041, 0x06c34100, 0xf300bf24, 0x5b83c101, 0x0c718118, 0xd0413520,
+    0xd615210c, 0x46204698, 0x56187491, 0x1a200d37, 0x116e6782, 0x15072306, 0xe86a2223, 0x6d262006, 0x0137060f, 0x91ce91f8, 0x4793ce91, 0x73060608,
+    0x06730808, 0x0c470806, 0x6d010c40, 0x842305fc, 0x83050f74, 0x0f052315, 0x46820c74, 0x820c5768, 0x07357e57, 0x35232726, 0x010f2634, 0x36295a83,
+    0x3233013d, 0x0134013d, 0x20568367, 0x20408b91, 0x8f699438, 0x32122153, 0x33050f62, 0x14153317, 0x36013f16, 0x0626012f, 0x2223011d, 0x9914011d,
+    0x01215290, 0x2053a4b8, 0x061f5336, 0x33353723, 0x05bf6c32, 0x3b160629, 0x3b141501, 0x94083201, 0x90592040, 0x09eb5169, 0x1e00c025, 0x7f003400,
+    0xc57707f9, 0x49322009, 0x112506a2, 0x36343521, 0x06ff6a33, 0x08b5a618, 0x27013f29, 0x01333626, 0x590907b0, 0xa03f0782, 0x07090907, 0x09400190,
+    0x0e0a5807, 0xf3240b1e, 0x17071407, 0x24f40707, 0x80100c0b, 0x42800709, 0x09340792, 0x09072007, 0x0770c0fe, 0x0e400109, 0x0c10800a, 0x07f4240b,
+    0x14252982, 0x0b24f307, 0x778a181e, 0x0023230d, 0x17500100, 0x2223250f, 0x07011f06, 0x2405f641, 0x3d361617, 0xad601801, 0x7058210f, 0x202b5382,
+    0x1f0909c3, 0x20c30908, 0x180e1e0b, 0x220ca060, 0x820b1e24, 0x1f08221b, 0x251b8309, 0x0a70100c, 0x7385000e, 0x0002f32b, 0x15008d01, 0x00002b00,
+    0x83f18311, 0x0bc644f6, 0x41052621, 0x23210511, 0x0c1f4521, 0x010a0e30, 0x500b1e68, 0x0b500707, 0x0a98fe1e, 0xf76b010e, 0x87982005, 0x18012513,
+    0x300e0a10, 0x50229182, 0x23821407, 0x30100c26, 0x0a0e8e0e, 0xab51138f, 0x01802608, 0x001b00a0, 0x0f7f4830, 0x0dc5c118, 0x19360721, 0x820e6c1d,
+    0x023727a7, 0x4b3a2c1a, 0xc118fe35, 0x8b320dda, 0x410b0807, 0x07300709, 0x080b4109, 0x0b0b6a07, 0xc11809dd, 0x692912eb, 0x07701407, 0x70070909,
+    0xae228314, 0x0c81428b, 0x013b1626, 0x013d3632, 0x97208b94, 0x6a208185, 0x8b949288, 0x83844e20, 0x91876a20, 0x00005408, 0xff000006, 0x014002c0,
+    0x000300c0, 0x000b0007, 0x00170011, 0x0100001d, 0x23272317, 0x23372117, 0x15230733, 0x06161733, 0x03210327, 0x3f272206, 0x06073301, 0x5ae60126,
+    0x45304565, 0x8045eafe, 0x65654550, 0x0105017b, 0x89180147, 0x43010401, 0x82db657b, 0xa0c0210d, 0x202f0083, 0x020302fc, 0xc2feff00, 0xfc420202,
+    0x820302ff, 0x010027fa, 0xbffffdff, 0x6f824501, 0x00001923, 0x05f14e25, 0x013b3623, 0x7ddb1811, 0x152d0809, 0x16323311, 0x08683a01, 0x0a680814,
+    0x5440100c, 0x06380305, 0x0ac40806, 0x0c10400e, 0x08087038, 0x011d0b70, 0x05380410, 0xfe0a0e0f, 0x84ab82b8, 0x82c02053, 0x00c12153, 0x01225382,
+    0x52180616, 0x3f2108dd, 0x205a8501, 0x23088226, 0x3a011732, 0x0e294e83, 0x0608c40a, 0x05033806, 0x204e8254, 0x2f65830a, 0x1d0b4801, 0x0e0ab8fe,
+    0x0438050f, 0x0b1d1001, 0x00236282, 0x41000100, 0xc1220517, 0xb6822600, 0x20059b42, 0x05f5772b, 0x22232623, 0x92401806, 0x0abb7208, 0x69013422,
+    0x0a5bd118, 0x1c143022, 0x3207bb43, 0x59c001e0, 0x0e0a503f, 0x1e500a0e, 0x471e2b2a, 0x83c0141c, 0x2104821c, 0x5c824046, 0x82020021, 0x01bf296b,
+    0x00c00180, 0x001f0017, 0x0f75f118, 0x2a07e54a, 0x1a3d18ac, 0x030d0b22, 0x1870a070, 0x2d087df1, 0x2f2f4214, 0x23362f42, 0x16352458, 0xf1181922,
+    0xf0200d83, 0x2f211982, 0x225f8742, 0x826001c0, 0x0030235f, 0x815c0052, 0x06142405, 0x8c331507, 0x3b3621d6, 0x17cb9818, 0x86560620, 0x16322905,
+    0x1d222315, 0x013b1401, 0x1422078f, 0x98185001, 0x68291be8, 0x50383850, 0x0b0b5538, 0x22038755, 0x18090001, 0x2b22f198, 0xa02838a0, 0x28383828,
+    0x20081008, 0x28200386, 0x0326cf83, 0xc0ff0000, 0xcf824001, 0x17000f24, 0x2d5f2300, 0x012b2708, 0x11352622, 0x92183634, 0x3722089d, 0x13823411,
+    0x82111521, 0x013221b2, 0x0fb5a818, 0xc80c9023, 0x5d02820c, 0xfe310dd2, 0x131a1320, 0x01591a13, 0xfe0c0c38, 0x00000cc8, 0x38708307, 0x80018002,
+    0x2d001d00, 0x37003200, 0x44003f00, 0x00004900, 0x011d3225, 0x07b44d14, 0x2306352d, 0x26012f22, 0x013f3435, 0x82013b36, 0x9b7a1819, 0x2a918608,
+    0x26343313, 0x36323523, 0x4c122335, 0xbc1806b4, 0x013509e3, 0x40080860, 0x02100808, 0x08030403, 0x060f0402, 0x01080e07, 0xf7bc1810, 0x50e82f10,
+    0x38503838, 0x251b7001, 0xa0254040, 0x31821008, 0x01370831, 0x02020e03, 0x040a0304, 0x13e05808, 0x83c0fe0d, 0x40013235, 0xb0fe130d, 0x25a0251b,
+    0x4200ff1b, 0x5c42425c, 0x0abd1862, 0x02002d08, 0xb9fff9ff, 0xc7018102, 0x28000d00, 0x3622c582, 0xbb851737, 0x1729b982, 0x0f011e05, 0x01270601,
+    0x230c8326, 0x27373601, 0x08052c54, 0x14151633, 0x0f0c0107, 0x95795013, 0x05180413, 0x0c107013, 0x02059f01, 0x0c0a1404, 0x090cb3fd, 0x010d0a14,
+    0x3c111d61, 0x0830070e, 0x65136813, 0x3e0b0743, 0x08088257, 0x07300820, 0x0d04890e, 0x0a0c1a05, 0x0d0ac601, 0xfe090c19, 0x322524ee, 0x1270110b,
+    0x13041805, 0xbb5680a0, 0x5f012008, 0x172205c7, 0xf9602b00, 0x5f01202d, 0xaa200ab9, 0x5f21af5f, 0x200813a8, 0xffffff01, 0x010002dc, 0x001e00a5,
+    0x36371300, 0x1e011d16, 0x06141504, 0x37260607, 0x022e3436, 0x068e4627, 0xb0089508, 0x50341c0c, 0x301e324c, 0x04150b23, 0x4432170d, 0xb00c1c31,
+    0x98020108, 0x500f0d0a, 0x29190901, 0x552c2c42, 0x0c0e0819, 0x192a402b, 0x0f58010b, 0x07980a0d, 0x00020016, 0x01bcff10, 0x00c001f0, 0x001b0016,
+    0x011e0100, 0x020e1415, 0x2e270607, 0x36343503, 0x3236013f, 0x013e0317, 0xd2012737, 0x462c100e, 0x12122448, 0x27404d2a, 0x08c00e10, 0x4b120814,
+    0x01b00263, 0x0f18056c, 0x3c5b894e, 0x1108080e, 0x47825f43, 0x5005180f, 0x46fe0404, 0x4a6ca225, 0x430bef62, 0x05610d0b, 0x076f4208, 0x34113722,
+    0x15261382, 0x21331411, 0xac180132, 0xd0281011, 0x0cb8fe0c, 0x0c48010c, 0x601e0e43, 0x0d200ad7, 0x2331cf82, 0x3c002b00, 0x4e004600, 0x32120000,
+    0x07141516, 0x31638206, 0x34352627, 0x14062225, 0x3f323316, 0x31363401, 0x4c18012e, 0xa8180726, 0x252e0771, 0x06012e36, 0x010e010f, 0x33171415,
+    0x69183536, 0x2323082f, 0x43160722, 0xa93d061e, 0x0927a9ee, 0x1244fe12, 0x20012709, 0x0d13130d, 0x03090909, 0x1ad81003, 0x131a1313, 0x30058443,
+    0x09031701, 0x3d031213, 0x6e092319, 0x0a4c1709, 0x22268311, 0x852e0605, 0xa9a02a1c, 0x0f434e77, 0x774e430f, 0x27318269, 0x05011c06, 0xe0fe0d0b,
+    0x310aa26b, 0x06120a35, 0x02b80909, 0x0f111925, 0x131d110f, 0x1c820f7f, 0x84de0221, 0x00002321, 0x00820003, 0x01400223, 0x29098280, 0x002f001f,
+    0x15211300, 0xd3822421, 0x2006e44f, 0x0557623d, 0x3634352a, 0x16322133, 0x2722011d, 0x09b35a18, 0x362e1182, 0x40018035, 0x9001c0fe, 0x141c141c,
+    0x048220fe, 0x09831c20, 0x82e00121, 0x0e4c3209, 0x0ab0fe0a, 0x010a0e0e, 0x010e0a50, 0x2874c020, 0x06d5591c, 0x38200887, 0xd0201d83, 0x00210483,
+    0x085f5902, 0x1b00072d, 0x22240000, 0x32363426, 0x18071416, 0x2e0daa40, 0x3216013b, 0x783c0137, 0x54785454, 0x654b3510, 0x4b26057a, 0x4c233735,
+    0x1282a023, 0x74785426, 0x1410354b, 0x1c828282, 0x5a101021, 0x75430fbb, 0x27012212, 0x18ba7737, 0x290ccf5a, 0x0943434c, 0x09092809, 0x06844242,
+    0x40640d8c, 0xdefe210d, 0x09202393, 0x00313185, 0xfff9ff02, 0x01c701d9, 0x001300a7, 0x3f000027, 0x0d354e01, 0x012f0624, 0x674e0126, 0x1f36280e,
+    0x63051601, 0x4e0c0b21, 0x1f270540, 0x190b0c63, 0x8fc2010c, 0x63152411, 0x4e1e0b1f, 0x2127051b, 0x190c0c63, 0x8f62010b, 0xb3541811, 0x01c02208,
+    0x207f85a0, 0x936b9237, 0x5dd52193, 0x5d257f89, 0x0b1a0b0b, 0x21108f0b, 0x7e895d85, 0x6b202184, 0x3a08108f, 0x00000300, 0xf001c8ff, 0x2000b801,
+    0x2c002600, 0x16250000, 0x22230617, 0x27373627, 0x34260706, 0x37171637, 0x32362726, 0x17070617, 0x14163736, 0x25272607, 0x16072736, 0x82063707,
+    0x373f0818, 0x21137001, 0x48646448, 0x111d1420, 0x1c36361c, 0x20131d10, 0x2048c848, 0x1c101d13, 0x111b3736, 0x1919fffe, 0xf615161f, 0x151e1919,
+    0x1f275416, 0x271f4646, 0x441c210e, 0x211b44ae, 0x821e260f, 0x0e26230e, 0x0e831b21, 0x4d122227, 0x43430a4d, 0x25058290, 0x00004442, 0x97880800,
+    0x0a000428, 0x15000f00, 0xa1841b00, 0x00002b28, 0x27070613, 0xa1821736, 0x05171622, 0x36229782, 0xa5822705, 0xaf829f82, 0x82252721, 0x25062216,
+    0x20a68217, 0x08af8236, 0xd4061721, 0x354e2a02, 0x01392e69, 0xa2fe3f53, 0x0a4d374e, 0x9e2e3c01, 0x96620434, 0x5302382e, 0x835e013f, 0xc4fe2112,
+    0xba201284, 0x01372a83, 0x4e374db6, 0x462eca2c, 0x22340462, 0x45022a4e, 0x3f9e2e97, 0x8e2c0253, 0xeb012110, 0xa6822683, 0x18040021, 0x4419b79b,
+    0x8a18074e, 0x0f870761, 0x91ce9122, 0x6b250282, 0x1a13131a, 0x05d15313, 0x0b841020, 0x2006224e, 0x22168227, 0x845a1a13, 0x6fb02012, 0x052008a3,
+    0x2c088b43, 0x0053003b, 0x007b0073, 0x37000093, 0x05b75427, 0x2307d456, 0x013b3435, 0x250adc5c, 0x15163233, 0x5b180f14, 0x2b250728, 0x23171401,
+    0x262a8236, 0x34013d26, 0x57173336, 0x0e8208a7, 0x5b013f21, 0x27200982, 0x47851f83, 0x07864f87, 0x17224b82, 0x3f773723, 0x2b3f9706, 0x0901224a,
+    0x08183907, 0x10081808, 0x08270382, 0x09073918, 0x5f0a2201, 0x802205e9, 0x08831010, 0x0909b724, 0x0882e007, 0x0709172e, 0x740907a0, 0x1a060b19,
+    0x36061906, 0x1a2b0382, 0x03190b06, 0x09202f7e, 0x8277090e, 0x85c02024, 0x07802924, 0x035af009, 0x20090703, 0x06825386, 0x07092027, 0x095a0303,
+    0x23508207, 0x413f3f41, 0xfc230884, 0x82160a04, 0x16072431, 0x840c040a, 0x92102968, 0x3b0e0a15, 0x1a1a0606, 0x3b270385, 0x52150a0e, 0x82202050,
+    0x90a32024, 0x05ef442b, 0x0140012e, 0x002300c0, 0x37000033, 0x2e373634, 0x35071841, 0x07061415, 0x06071716, 0x16011f14, 0x16013f32, 0x15071415,
+    0x394e3523, 0x05a64a09, 0x4708333c, 0x130e0b2a, 0x130d400d, 0x21260b0e, 0x0c02026c, 0x64020702, 0x38c0381b, 0xd3182801, 0xa0300955, 0x03228a35,
+    0x130d0b11, 0x110b0d13, 0x6c3d1f03, 0x0c2d2482, 0x3c650202, 0x2c11432b, 0x095d112c, 0x83a18307, 0x20002104, 0x4d08f741, 0x0f280523, 0x17001300,
+    0x1f001b00, 0x2724a382, 0x2f002b00, 0x2708a982, 0x003b0037, 0x0043003f, 0x004b0047, 0x0053004f, 0x005b0057, 0x0063005f, 0x006b0067, 0x0073006f,
+    0x007b0077, 0x0100007f, 0x0724b082, 0x37231533, 0x13200782, 0x27200782, 0x13830382, 0x35200682, 0x05240783, 0x35333523, 0x03240382, 0x13153335,
+    0x01200782, 0x06820782, 0x82331521, 0x82252007, 0x82012024, 0x8207200c, 0x8243840b, 0x86272007, 0x831b830b, 0x8213202f, 0x8227200f, 0x82372023,
+    0x2023832b, 0x24678227, 0x15333505, 0x20078225, 0x26138217, 0xc0400001, 0x82804040, 0x21078301, 0x05828001, 0x40c0fe23, 0x83138201, 0x40402315,
+    0x1283fe40, 0x8240c021, 0x01402114, 0x15840e82, 0x08848020, 0x00ff4022, 0xc0200d84, 0x42834185, 0x82404021, 0x822a834f, 0x82428708, 0x83802025,
+    0x82338216, 0x842b830a, 0x204c8238, 0x824786fe, 0x8285896f, 0x83398313, 0x8207821e, 0x84318202, 0x42a2854a, 0xc029060f, 0x0f00c001, 0x00003500,
+    0x0df74621, 0x43013321, 0x2120055e, 0x271d8443, 0x09079001, 0xa0fe0709, 0x01320583, 0x01130d70, 0x4ad6fe4a, 0xa00d1301, 0x28080828, 0x03823008,
+    0x41280821, 0x012c09ef, 0x050d1320, 0x05d6d605, 0x30130d05, 0x06821d86, 0x03003039, 0xc0ffffff, 0xa0018001, 0x2d002500, 0x00003d00, 0x013d2637,
+    0x83013f34, 0x05b8597c, 0x1535212d, 0x013f3634, 0x07013d36, 0x83010f06, 0x22232302, 0xbb6b3427, 0x13931806, 0x13133f0f, 0x020e0907, 0x714f940c,
+    0x1418c0fe, 0x0a161b39, 0x0f040903, 0x0706060c, 0x0c0c1006, 0xad420c10, 0x08b58406, 0x1508b020, 0x09070a89, 0x0c04041c, 0x0fc05070, 0x0a261801,
+    0x321e0d1d, 0x1e0b050b, 0x0205060f, 0x2f82a302, 0xfe100c23, 0x21c589cc, 0x4b430000, 0x00a02108, 0x23054b43, 0x3435012e, 0x20054974, 0x08fa4d07,
+    0x17141523, 0x20ae8223, 0x063b4323, 0x5f411720, 0x1669310e, 0x3d563d1b, 0x0719161b, 0x10070909, 0x1018b018, 0x2008ab5c, 0x05b15cfe, 0x1b2f0e29,
+    0x2b3d3d2b, 0x840e2f1b, 0x5005257b, 0x05502b2b, 0xe0200a84, 0x03328c8b, 0xc0ffffff, 0xc0010002, 0x17000700, 0x00004700, 0xc9482200, 0x06fa5205,
+    0x08618d18, 0x21050a77, 0x4c4d2721, 0x16172505, 0x3e333233, 0x22060044, 0x5c011e17, 0x152207c6, 0x1a831614, 0x1736372a, 0x212e1701, 0x78212e21,
+    0x080ae141, 0x0207a92a, 0x66d0fe66, 0x0c1d0702, 0x02180e0a, 0x081a1301, 0x020b2705, 0x1b221b03, 0x270b0203, 0x11160805, 0x0e180405, 0x50010c0a,
+    0x21233982, 0x898ffe2e, 0x012308a9, 0x04080508, 0x04d3d304, 0x10050903, 0x01130d08, 0x0805141e, 0x1616100a, 0x05080a10, 0x01031d12, 0x4c080d13,
+    0xa0270bb7, 0x2b002300, 0x4f003b00, 0x07260555, 0x36211714, 0xc8452735, 0x8c332008, 0x03332809, 0x22263435, 0x41011d06, 0x01320f65, 0x40090770,
+    0x0de6fe0d, 0x38070940, 0x09300907, 0x05845007, 0x1a135823, 0x05c96513, 0xde83a020, 0x09a0012b, 0x5620b007, 0x20564a4a, 0xa05218b0, 0x30302c09,
+    0xe0fe0907, 0x13130d40, 0x4180400d, 0x03310cff, 0xe0ff0000, 0xa0018002, 0x2f001700, 0x00005300, 0x05216d13, 0x5c05c750, 0xa182067d, 0x4e053321,
+    0x531805cb, 0x27201032, 0x1e902f8c, 0x3330dd83, 0x0e0e0a68, 0x0e0a300a, 0x18080818, 0x40020a0e, 0x0f820684, 0x98201484, 0x80201c86, 0x04840d84,
+    0x01250a82, 0xfe0a0e60, 0x231a83f0, 0x08300868, 0x80204082, 0x0e230685, 0x8410010a, 0x82c02015, 0x8370201f, 0xa8a82109, 0x01210583, 0x200b8790,
+    0x0aeb4700, 0x00062108, 0x0015000d, 0x01000051, 0x16271716, 0x26011617, 0x27261727, 0x013e2726, 0x010e1737, 0x27071307, 0x90056456, 0x07dc5407,
+    0x36013f23, 0x562b822f, 0x37210536, 0x82078617, 0x01262a13, 0x9d010de2, 0xfe1e3336, 0x24078534, 0x67981112, 0x330382d8, 0x061c1d66, 0x05050c05,
+    0x061c171d, 0x06060b06, 0x051d161c, 0x0e840784, 0x1d9c0520, 0x34840129, 0x0e019d35, 0x855bfe08, 0x6fc62407, 0x82d90f91, 0x54012203, 0x253d841c,
+    0x1d171c06, 0x54830505, 0x0c230783, 0x8d1c0605, 0x8a16205b, 0x601d8825, 0xa03607d3, 0x1500c001, 0x2b002100, 0x3f003500, 0x33370000, 0x012b0614,
+    0xa1500622, 0x82262008, 0x2526250d, 0x23070614, 0x2a060344, 0x35363207, 0x06162734, 0x85171627, 0x32332306, 0x09883736, 0x13e06029, 0x130d100d,
+    0x840c280c, 0x40013207, 0x2ddc2d35, 0x7aac7a35, 0x16130eb4, 0x08141d07, 0x23058448, 0x40130e17, 0x20280887, 0x0d13130d, 0x140c0c14, 0xdd330782,
+    0x1c1c5d37, 0x7a56375d, 0x0e13827a, 0x1d140817, 0x852f1607, 0x4d142106, 0x00220786, 0x00820002, 0x01000237, 0x00070080, 0x3c000012, 0x16323601,
+    0x27220614, 0x3736011e, 0x24088215, 0xd4963526, 0x23028296, 0x37c9c937, 0x31080682, 0x383850f8, 0x280e3850, 0x6e281e1e, 0x28383828, 0x00000300,
+    0x8702bdff, 0x1700c701, 0x31001f00, 0x17250000, 0x07030e14, 0x012f010e, 0x36013f36, 0x47820f26, 0x33013e22, 0x22074468, 0x650f1613, 0x6a080545,
+    0x013e3727, 0x3637011f, 0x57000117, 0x1d0f0d03, 0x36851b10, 0x5f070435, 0x3c040603, 0x511b1d19, 0x2e43e81c, 0xdd2e432e, 0x22e80c0a, 0x3b060403,
+    0x0c031956, 0x0de82204, 0x046de70a, 0x2a24280f, 0x0211150d, 0x70201702, 0x16010704, 0x1416174a, 0x2f422f88, 0x7001422f, 0x2bb10a0d, 0x0c010c05,
+    0x0105376d, 0x09b22b04, 0x5400000c, 0x00220643, 0xad83c001, 0x1121052f, 0xfe000221, 0x40000200, 0x00000002, 0x06ff6303, 0x0a00c022, 0x2720bf82,
+    0x262fbf82, 0x37270706, 0x1e173236, 0x15060701, 0x58261714, 0x33080b0c, 0x0437012e, 0x06141632, 0x01342622, 0x227130f0, 0xb23f38d4, 0xf2182f3f,
+    0x1d290b06, 0x11065924, 0x07063506, 0x091d2367, 0x503e0115, 0x38503838, 0x2f142098, 0x3f2c2382, 0x1689812f, 0x051a1d12, 0x0767241c, 0x11272382,
+    0x1d235906, 0x82a42251, 0x38250821, 0x06000050, 0xc8fffdff, 0xbd01f801, 0x11000900, 0x25001a00, 0x3a002d00, 0x0e370000, 0x27260701, 0x1637013e,
+    0x28098327, 0x17163736, 0x27262726, 0x26998336, 0x37361716, 0x82060706, 0x16072e0d, 0x22230637, 0x1e133627, 0x011c1501, 0x080b8215, 0x26363171,
+    0x124b35e7, 0x60111524, 0x3e241544, 0x470f195f, 0x37d22345, 0x305a0330, 0x84343433, 0x2829534c, 0x92461e0c, 0x7633213e, 0x465b458b, 0x49ca0a3b,
+    0x012d2c5c, 0x21cd2706, 0x2e233d63, 0x32207247, 0x3f631e4f, 0x1f269051, 0x821b06cd, 0x32060e5d, 0x0128558b, 0x29310a01, 0x2c2b1a15, 0x3b145247,
+    0x8e012f24, 0x01507f1a, 0x450e0104, 0x82080083, 0x01bf24bf, 0x82c001c0, 0x00422cb5, 0x0052004a, 0x0062005a, 0x5572006a, 0x4a1807b1, 0x35260ec6,
+    0x16323634, 0x5371011d, 0x500b9706, 0x424c0fac, 0x06995008, 0x178f0f87, 0x1a930123, 0x4d4d1813, 0x1918200d, 0x260e9143, 0xd7081008, 0x8709090e,
+    0x05bb6c02, 0x0b850e85, 0x270b216d, 0x0d135001, 0x711416b0, 0x08794d18, 0x19f12121, 0x21187f43, 0x4584e3fe, 0x05845720, 0x0b8a8920, 0x6c05e16c,
+    0x772005a5, 0x00201784, 0x07200082, 0x202a0382, 0x60018002, 0x13000900, 0x7a181700, 0x002a082b, 0x3b363411, 0x22231101, 0xab483526, 0x012b2606,
+    0x21110111, 0x07255d11, 0x5b180620, 0x0f880eb3, 0x60601a33, 0x4002261a, 0x1a26261a, 0x01e0fe60, 0x0e144600, 0x2002870e, 0x320b8a6e, 0x261a2001,
+    0x1a26c0fe, 0x1a260001, 0x01261ac0, 0x83c0fe40, 0x84e82003, 0x8452202c, 0x8a6e2005, 0x0cdb6a0b, 0x1100083b, 0x00001b00, 0x23173001, 0x16323335,
+    0x23152717, 0x3e373136, 0x21073301, 0x06676115, 0x01fe0130, 0x19108def, 0x01efdb05, 0x10190533, 0x84760263, 0x07013406, 0x0f12c007, 0x9807c021,
+    0xf0e0120f, 0x141c1c14, 0x57000300, 0xc02605df, 0x29001400, 0xa15b3e00, 0x051b4708, 0x3b363428, 0x17371501, 0x16492535, 0x490c8505, 0x23200633,
+    0x8d067b51, 0x30022129, 0x24081849, 0xfe202050, 0x820d83d0, 0x18502008, 0x20087145, 0x231186e0, 0xc00709a0, 0x04820a83, 0x15156024, 0x0e844060,
+    0x08840983, 0x13880e85, 0xa7860020, 0xa0010029, 0x1d001900, 0x6c003900, 0x3b200f65, 0x2509354e, 0x35331527, 0x4a183517, 0xb75119ba, 0x1c502c0b,
+    0x1c14a014, 0x082080c0, 0x82300838, 0x21068603, 0x54184001, 0x30290b41, 0x141c1c14, 0x20202030, 0x21228af8, 0x93523808, 0x80012c05, 0x0a00c001,
+    0x00001300, 0x45011e13, 0x2a0805b1, 0x32123634, 0x27343536, 0xc0141506, 0xaa6b6b55, 0x542c6a6b, 0x01606036, 0x3aa54dc0, 0x5e76765e, 0x8dfea53a,
+    0x69382a35, 0x842a3869, 0x02e022d7, 0x2ad78247, 0x0025001d, 0x2500002f, 0x56070616, 0x27200589, 0x3d294d84, 0x33363401, 0x36171632, 0x20068237,
+    0x9d451817, 0x37053f07, 0x22232627, 0x17010e07, 0x101b2b02, 0x3c241d27, 0x06078322, 0x42425c42, 0x02402d2e, 0x10831d0d, 0x1cf8fe3a, 0x23011c28,
+    0x1b0f4152, 0x07120c10, 0x5d27940c, 0xbb31151b, 0x2e950f0a, 0xe02a2682, 0x2c3e422e, 0x31151421, 0xde83708f, 0x3a2d7028, 0x0c09165d, 0x6b421129,
+    0x24d78407, 0x001d0015, 0x126b412d, 0x32363424, 0x0d431516, 0x53172007, 0x16210c21, 0x0b8d5637, 0x3426502c, 0x0e143626, 0x610e140e, 0x4a180909,
+    0x01210c07, 0x0b557780, 0x26261a24, 0x2582181a, 0xda140e26, 0x081d0809, 0x0a024a18, 0x08248f82, 0xc0ff0000, 0x25208f88, 0x35269182, 0x4d004100,
+    0x99975900, 0x550fba44, 0x3620076f, 0x2006b743, 0x22297813, 0xaa20c58f, 0x840abe43, 0x820e21a8, 0x68201184, 0x91116376, 0x98fe21da, 0x430acd43,
+    0xb22005df, 0xfe271184, 0x0808109e, 0x8a680810, 0x00002205, 0x23ef8307, 0xc0018002, 0x0f2a0982, 0x3b003300, 0x4b004300, 0xf5545b00, 0x63691809,
+    0x27052f07, 0x36373626, 0x35361637, 0x17323336, 0x0a821606, 0x011e1730, 0x010e010f, 0x15272627, 0x07063523, 0x30662606, 0x67601807, 0x056f4c09,
+    0x4308675e, 0x310805da, 0x0ef70133, 0x090e0909, 0x3434489c, 0xa4fe3448, 0x0c050712, 0x3718120b, 0x453c4a56, 0x0e2f2005, 0x040d171c, 0x1a071207,
+    0xe037320a, 0x1a0a3138, 0xfd843701, 0x2005d444, 0x273a84b1, 0x0907f001, 0xa0fd0709, 0xc0200583, 0x09224a82, 0x4a82470e, 0x48342308, 0x1c091bf0,
+    0x140a0608, 0x16201f19, 0x16032319, 0x1c080e0d, 0x050b1b09, 0x5b131e06, 0x061e135b, 0xf0441f05, 0x8406200a, 0x4bc92038, 0x04200cbf, 0x30069b7e,
+    0x003c00c1, 0x00470041, 0x1500004d, 0x2e37033e, 0x051b5503, 0x17161723, 0x08d56921, 0x06070436, 0x27263307, 0x021e3736, 0x2b061617, 0x26272201,
+    0x07062127, 0x25080983, 0x37361326, 0x21371623, 0x36331716, 0x27262103, 0x0e030623, 0x2d2d4220, 0x030e2042, 0x20070a01, 0x0202020e, 0x04823801,
+    0x07200e34, 0x0a02010a, 0x314d2a1e, 0x0d7f222c, 0x2a1b2004, 0x22841139, 0x01010f25, 0x86c8fe03, 0xe1370822, 0x1c801c24, 0x09fafea7, 0xfd0cdc0c,
+    0x0d080501, 0x152e0cdb, 0x1d49442f, 0x2f44491d, 0x0e0b0715, 0x080a0a08, 0x12070b0e, 0x40393f28, 0x0c1d1619, 0x24131102, 0x821a385a, 0x0c063019,
+    0x0b0e0909, 0x18141901, 0x10106818, 0x82d0fe10, 0x00003304, 0xff000003, 0x014202b9, 0x001200c0, 0x003a0032, 0xe0822500, 0x17013f25, 0x6e372737,
+    0x26200765, 0x0f23d482, 0x18010e01, 0x23100870, 0x17161317, 0x8e182582, 0x012e0876, 0x06023526, 0x3d213e06, 0x0c063d21, 0x0b823c02, 0xfe17a122,
+    0xd5350582, 0x1d2d4401, 0x2c08052b, 0x0907595c, 0x17700709, 0x1c2d6407, 0x282282d6, 0x1c28b7fe, 0xaa1c281c, 0x240b82a0, 0x63146314, 0x3f2c8215,
+    0x020c07b5, 0x07291135, 0x2c47030b, 0x2c050838, 0x0123371e, 0x20070915, 0xfe160907, 0x472401d6, 0xa8202282, 0x1c213382, 0xdb501828, 0x0014270b,
+    0x37000042, 0xfe672622, 0x17372306, 0x3e4d3335, 0x4d232005, 0x2b2006ee, 0x13a5f918, 0x30832320, 0x21067d4f, 0x3083013b, 0x9f83d020, 0x30309023,
+    0x82078390, 0x07092372, 0x6c820353, 0x84c60321, 0x07532305, 0x18833009, 0x09076027, 0x01070980, 0x21068200, 0x09822020, 0x0982ff20, 0xa2844020,
+    0x14070927, 0x08141c1c, 0x21078908, 0x18867001, 0x0090fe23, 0x08534403, 0x1a00082b, 0x00003600, 0x011d1601, 0x21aa8223, 0x88180717, 0x511812ef,
+    0x79211a06, 0xb78b1807, 0x46402010, 0x57200e4c, 0x12af8b18, 0x6c46d820, 0x41098209, 0x0127063f, 0x00c001c0, 0x8238002f, 0x33848a8d, 0x1733013d,
+    0x013f3216, 0x36323317, 0x012b2634, 0x0f222627, 0x735d0482, 0x36342408, 0x8717013b, 0x200122bd, 0x62a7180e, 0x23462b07, 0x39020a02, 0x09075a16,
+    0x0b850709, 0x0502142a, 0x3808088d, 0x99c80a0e, 0x0132b584, 0xfe0e0a38, 0x0e0e0ab8, 0x0446a80a, 0x092c7204, 0x0783090e, 0x08042828, 0x0ae80810,
+    0xb784690e, 0xe3690020, 0x0009270a, 0x0029000d, 0x21490033, 0x1117280a, 0x15251121, 0x83013b14, 0x64322003, 0x2f4106c7, 0x06015e0a, 0x11012b2d,
+    0x3030141c, 0x01801c14, 0x4100ff40, 0x50220e20, 0x1c821c14, 0x14700125, 0x8340fe1c, 0xfec02208, 0x0d6a4740, 0x2b46c020, 0xc0012305, 0xaf480800,
+    0x00192e08, 0x00310025, 0x0049003d, 0x00710065, 0x120b467d, 0x20087450, 0x16ef4501, 0x17961720, 0x3d483720, 0x173b461a, 0x0d200235, 0xfd070913,
+    0x130907e0, 0x0d13800d, 0xff130dc0, 0x18280c00, 0x20098681, 0x240c8ba0, 0x061a0610, 0x86038214, 0x8b902006, 0x60012d1b, 0x90fe0d13, 0x07090907,
+    0x130d7001, 0x2105cf50, 0x4984acfe, 0x11170019, 0x458ab620, 0xfe1a0623, 0x42268adc, 0x02260653, 0x00c00100, 0x0d190007, 0x22230f83, 0x8c23011d,
+    0x153325fd, 0x32013b14, 0x25056c4e, 0x30087001, 0x03826008, 0x01210686, 0x271784c0, 0x0808f0e2, 0x08085858, 0x17420685, 0x05336305, 0x1b001326,
+    0x37002d00, 0x22128341, 0x7e353315, 0x32220873, 0xad7d2736, 0x06072509, 0x15133316, 0x36208382, 0x16207682, 0x280b977f, 0x3446c090, 0x26342626,
+    0x0ca07d1d, 0x0a02062a, 0x13809d08, 0x130d400d, 0x220d5f47, 0x82a06060, 0x3426342c, 0x13070dba, 0x19080819, 0x010d0713, 0x0d6060a0, 0x82001313,
+    0x48042000, 0x39220c3b, 0xa3924500, 0x200ccd48, 0x1afb4113, 0x34013d22, 0x5f091d69, 0xe5480a73, 0x42482009, 0x08220dd9, 0x028208b0, 0xea48af8d,
+    0xdefe2109, 0x250c4f4a, 0x080810c8, 0xb3870810, 0x0180022e, 0x001400c0, 0x003c0038, 0x37000040, 0x2113804b, 0xba622317, 0x07355407, 0x09c4d918,
+    0x26058d5d, 0x35050614, 0x82211523, 0x07902803, 0x70070909, 0x83704040, 0x30802207, 0x09aa4730, 0x02210b85, 0x2f118260, 0x01a0a9fe, 0x09c0a080,
+    0x0907e007, 0x80202080, 0x4e450885, 0x07202207, 0x200a8b09, 0x3b008240, 0x00040000, 0x02dcff00, 0x00a00144, 0x0013000b, 0x0027001d, 0x16321200,
+    0x0614011d, 0x1720b184, 0x2a06e953, 0x07161737, 0x37022e06, 0x6d1e013e, 0x3724057e, 0x425c4236, 0xa03c0282, 0xec1c281c, 0x2f0707d2, 0x22085476,
+    0x0953c306, 0xd3070523, 0x012f0706, 0xe02e42a0, 0x2005a74a, 0x05a04a9e, 0x07d31e2b, 0x53092305, 0x37072f76, 0x24048254, 0x0607d207, 0x06e34222,
+    0x0180012c, 0x002100c0, 0x13000031, 0xc9672135, 0x09894406, 0x3d323327, 0x012b3401, 0x21078435, 0xd9553723, 0x01202c0e, 0xff0d1340, 0x78130d00,
+    0x86780808, 0x0ad02203, 0x089b5e0e, 0xfe40002b, 0x13130da0, 0x1008400d, 0x22038708, 0x530a0ec0, 0x002007d9, 0x250c2f4b, 0x0019000f, 0x03550035,
+    0x058b4d05, 0x36227a82, 0x5b731333, 0x45372008, 0x01211a29, 0x20768968, 0x46958708, 0x7a8a0f4b, 0x0120fe23, 0x209b8460, 0x0c4642c5, 0xdb460020,
+    0x80022905, 0x2300c101, 0x47003f00, 0x200ed34d, 0x15bf5421, 0x71222721, 0x1f2c0576, 0x32363701, 0x3233011f, 0x2b061416, 0x21068b75, 0x334a2202,
+    0x10022105, 0x122f6818, 0x0709c035, 0x8d080888, 0x32140205, 0x1c041404, 0x09090766, 0x84167a07, 0x344c290b, 0x26342626, 0xa02e42e0, 0x2109a655,
+    0x0b836001, 0x0790f031, 0x10088009, 0x63280408, 0x09370909, 0x832c090e, 0x00ff2107, 0x26222e82, 0x03430034, 0x0049260c, 0x00590051, 0x25c58a5e,
+    0x26220614, 0x61422335, 0x41332005, 0xbc8605dc, 0x1647c282, 0x21178307, 0x17852123, 0x20089d60, 0x2ad98233, 0x04011d16, 0x26343632, 0x87140622,
+    0x35372607, 0x02152327, 0x23a48470, 0x80385038, 0x98260382, 0x08d00808, 0x0587f008, 0x0982fe20, 0x141c3825, 0x18140001, 0x832412e2, 0x059964da,
+    0x30280588, 0x141c1c14, 0x0e640e30, 0x1422e218, 0x2e067f68, 0x00c00180, 0x0023000b, 0x00370033, 0x655a004e, 0x33240c5d, 0x1d011e03, 0x20076a65,
+    0x09195d26, 0x42031421, 0x05240ed1, 0x01152335, 0x2a8a2b8a, 0xac651720, 0x02332a09, 0x30080878, 0x291f0808, 0x2206822e, 0x821d1f24, 0x07702405,
+    0x71070909, 0x01260585, 0x0801b060, 0x14821e1a, 0x823c2421, 0x84582004, 0x4c60202b, 0x260805eb, 0x571b0901, 0x08081e31, 0x1442261e, 0x083e2513,
+    0xfe0b3e08, 0x800709f1, 0x141c0907, 0x701c1440, 0x42014040, 0x83213912, 0x192c2421, 0x8242412a, 0xee2c2120, 0x00353a85, 0xfffcff02, 0x010402bc,
+    0x001f00c4, 0x1300003e, 0x06071737, 0x0512442f, 0x27013f25, 0x56013f26, 0x0784077f, 0x16372724, 0x1f83010f, 0x07841720, 0x1f820320, 0x021f3623,
+    0x3b278337, 0x40ca1736, 0x261bb688, 0x05064240, 0x4305050c, 0x1a1b0407, 0x0b060538, 0x2d370606, 0xfd210785, 0x2b188205, 0x492d1c06, 0x06220606,
+    0x11881105, 0x39230785, 0x82061c2d, 0x01052926, 0xb5884111, 0x4307051c, 0x42252684, 0x1b1b2640, 0x22188338, 0x842e3706, 0x95052107, 0x1c234d84,
+    0x82054a2d, 0x8306203f, 0x2205253f, 0x38110606, 0x58823f82, 0x00000529, 0xffffff04, 0x828402c0, 0x0b2108cb, 0x21001700, 0x00002b00, 0x17163212,
+    0x21230616, 0x36352622, 0x15163205, 0x2622010e, 0x33363427, 0x08f64400, 0x09450720, 0x64362e06, 0x01095b78, 0xd0fe0306, 0x01090503, 0x2004822f,
+    0x2d10825b, 0x1f020305, 0x05230954, 0x0707d307, 0x0483462f, 0x0e837620, 0x4d000129, 0x0606033a, 0x82633a03, 0x834d2003, 0x6b01250b, 0x072f7654,
+    0x05212682, 0x22268223, 0x83092305, 0x0000230e, 0x93840100, 0xc3010124, 0x0c822800, 0x0f14162d, 0x06072301, 0x3f342622, 0x41373501, 0xf2570c5a,
+    0x013e350a, 0x1c23dd01, 0x075964fe, 0x59070e14, 0x0606322d, 0x3206060b, 0xee83078a, 0x1b2e3333, 0x21ac014d, 0x59fd1c52, 0x07140e07, 0x332e6559,
+    0x21178205, 0x07903206, 0x82061c21, 0xff023087, 0x01cffffd, 0x00b401e4, 0x00190015, 0x41160100, 0x062405c7, 0x26272223, 0x27097e7b, 0x01072737,
+    0x220505de, 0xf6297182, 0x1f2f2b1e, 0xf21e061b, 0x260f840b, 0x944f4608, 0x86060601, 0x2024241a, 0x82f11e52, 0x05222694, 0x4f45ee05, 0x205f8294,
+    0x08234f05, 0x1700132b, 0x3b002700, 0x00003f00, 0x05ee4313, 0x5105e442, 0x3322063d, 0xc5533315, 0x095b5b07, 0x482d2796, 0x08d00808, 0x422f1808,
+    0x0140302f, 0x092247a0, 0x8b580121, 0x08802318, 0x02820830, 0x2f21f028, 0x60f0212f, 0x6c5afe60, 0x8e01200a, 0x0000221b, 0x20a78804, 0x22a7820b,
+    0x18410023, 0x22095783, 0x5a34013d, 0xa6440571, 0x25332105, 0x0b82b783, 0x34373527, 0x15162533, 0x06556911, 0x12822620, 0x3106c158, 0x37341135,
+    0x17323625, 0x0808f801, 0x080890fe, 0x078c7001, 0x0108012d, 0x50081ed9, 0xfe0e1308, 0x82130e82, 0x011e2408, 0x49140810, 0xb6820bc8, 0xbd85c020,
+    0x200c8b2b, 0x0808a9fe, 0x13130df8, 0x254d820d, 0x0c205701, 0xac820471, 0xaf840320, 0xc0010028, 0x21001900, 0x2d493200, 0x15062812, 0x36321614,
+    0x46273435, 0x27210715, 0x2d128822, 0x012e3637, 0xc0010706, 0x1a26261a, 0x058380fe, 0x711a1a3a, 0x641a719e, 0x845e5e84, 0x1711a05e, 0x0b172217,
+    0x0c050222, 0x8001030c, 0x28842282, 0x1a40012d, 0x4f332d26, 0x334f7171, 0x8200ff2d, 0x845e2427, 0x8210183a, 0x0f11282b, 0x0c064f0c, 0x41060505,
+    0x072a0cef, 0x1f000f00, 0x7d003300, 0x2b590000, 0x34262105, 0x07e94318, 0x4510435d, 0x3b260d19, 0x11211101, 0x0b483527, 0x10d54d08, 0x2011d66b,
+    0x22eb8306, 0x8433013d, 0x263421f3, 0x84074548, 0x0ee92607, 0x090e0909, 0x200584b7, 0x092c42d0, 0x89600221, 0x02302b0b, 0x88086000, 0x68080868,
+    0x03821008, 0x88680823, 0x260e8508, 0x1c1c1440, 0x82401c28, 0x141c2203, 0x211f8340, 0x43180888, 0x01210b6d, 0x09005197, 0x7449fe20, 0x6001270a,
+    0x10c8a0fe, 0x4d822008, 0x8306d562, 0x8403840a, 0x1010214a, 0x10845784, 0x00002508, 0xfffeff03, 0x018202de, 0x001700a2, 0x002d0022, 0x3f322500,
+    0x06141501, 0x2f06010f, 0x3d012e01, 0x33161701, 0x17231182, 0x85163716, 0x36372713, 0x1f362117, 0x1e840701, 0x01375a08, 0x890607aa, 0x0fd90a0e,
+    0x0e0ad810, 0x1c070689, 0x0e40400e, 0x080604f0, 0x5c060cc6, 0xfd050cfa, 0xfa0c05ea, 0xc60c065c, 0xc0040608, 0x0bb22702, 0x04360311, 0x11033604,
+    0x0227b20b, 0x176b6b17, 0x020e0770, 0x980b0438, 0x0a0a0120, 0x0b982001, 0x0e023804, 0x00000007, 0x28978204, 0x010002e0, 0x001200a0, 0x2499821a,
+    0x1200002a, 0x05f97c32, 0x22230629, 0x37023e26, 0x58343526, 0x0f870f5e, 0x96d49636, 0x33386a96, 0x04054c41, 0x061c1107, 0x131a7339, 0x93131a13,
+    0x0120058a, 0x0d2f0c19, 0x1e827620, 0x8282028d, 0x6b020021, 0x0f2808ff, 0x00002400, 0x05373437, 0x27207b82, 0x26250382, 0x26373637, 0x0a016c05,
+    0x79011f21, 0x40250686, 0x26450109, 0x257b8528, 0x390b2c03, 0xfc6b3a02, 0x4969320c, 0x39966a60, 0xfc1c1ad0, 0x0a33130a, 0x392b3404, 0x0cf56b90,
+    0x7a355225, 0x823a4856, 0x8402207c, 0x01802680, 0x00110080, 0x227b8339, 0x69012b26, 0x1529053f, 0x1d062223, 0x32252101, 0x11451816, 0x08d24e16,
+    0x09822120, 0x26a0333b, 0x2838201a, 0x38284001, 0xfe261a20, 0x1aa001c0, 0x07092026, 0xfe090740, 0x20068480, 0x271f8220, 0x8001130d, 0x1ae00d13,
+    0x382ab882, 0x401a2628, 0x241a2660, 0x44187913, 0x792b09ec, 0x261a2413, 0x60600d13, 0x5800130d, 0x07240c67, 0x67004500, 0x27097354, 0x15010e27,
+    0x011f1614, 0x062b9982, 0x2622012b, 0x1406010f, 0x82171617, 0x058c7113, 0x35013e25, 0x7a2f2634, 0x162707bc, 0x2636013f, 0x82272627, 0x212c8213,
+    0x99431506, 0x013b2a0e, 0x22231716, 0x3314011d, 0x05bf4921, 0x0137363f, 0x7a7aac56, 0x19e67aac, 0x3f131822, 0x26070a0c, 0x1006100a, 0x18130504,
+    0x070b0709, 0x2515820a, 0x0a0c3e14, 0x15842706, 0x1304012f, 0x0c060a18, 0x0df60a06, 0xfe0d1313, 0x2d058340, 0x3f2b1e20, 0x6c010a0a, 0x2c400a0a,
+    0x4982201e, 0xc5ac7a2e, 0x151a2401, 0x03130621, 0x0a0a080e, 0x0a294c82, 0x11010e03, 0x070a0a07, 0x24189710, 0x0d13f1fe, 0x824d8360, 0x19272104,
+    0x2205bb49, 0x82002719, 0x03250800, 0xbffffeff, 0xc3010002, 0x29000900, 0x00003100, 0x36272601, 0x17163637, 0x33371716, 0x06141507, 0x0607012b,
+    0x21f28223, 0x19823f36, 0x34352622, 0x2305c25c, 0x36343517, 0x0807b942, 0x4e200151, 0x07201135, 0x2c0a0213, 0x5e207070, 0x0a414d42, 0x052e6b0c,
+    0x16900806, 0x041a5511, 0x7d1e0415, 0x0e1a2f4e, 0x090e0909, 0x3b101901, 0x06082531, 0x4b38450a, 0x5e42a040, 0x48040838, 0x24021007, 0x68511110,
+    0x0a09373d, 0x3c055845, 0x82602f21, 0x0e092129, 0x002e8a82, 0x02c0ff00, 0x00800041, 0x25000025, 0x60180616, 0xee7e0c68, 0x2b260808, 0x14062201,
+    0x32013b16, 0x3236013f, 0x010c3502, 0x1612970c, 0x09079bfe, 0x2f370709, 0x0fa02a20, 0x14020213, 0x0f834e0c, 0x11177636, 0x7818095d, 0x79091e0a,
+    0x6007090e, 0x1a260907, 0x0f0c0e17, 0x0e256e82, 0x0000084a, 0x256f8502, 0x1200c301, 0x71823800, 0x3626272d, 0x1f163637, 0x013e3701, 0x82011e17,
+    0x0522217d, 0x013584a4, 0x03176d13, 0x153d171a, 0x3c160b0b, 0x18031b17, 0x010e066d, 0x3298a11c, 0x481872c6, 0x16051416, 0x05160c0c, 0x18481614,
+    0x97480672, 0x29ab88aa, 0x004300c0, 0x0100006c, 0xad83012e, 0x26084643, 0x15161716, 0x82140714, 0x26272db3, 0x1522012b, 0x1e011f14, 0x06161701,
+    0x2205d141, 0x413d2622, 0x342b06cc, 0x1736013f, 0x32013b16, 0x83273435, 0x12624132, 0x15141524, 0x6441010e, 0x0f013a0c, 0x03031a12, 0x070a1920,
+    0x130a0712, 0x02020510, 0x05090613, 0x07092406, 0x21189736, 0x95410bf0, 0x130d210e, 0x3d0d9441, 0x19053001, 0x02251811, 0x09090712, 0x09021207,
+    0x03030604, 0x06110201, 0x07080204, 0x1b9a0f01, 0x0e0aa924, 0xce410a0f, 0x0d132308, 0xd0410203, 0x07cf4108, 0x0b00c028, 0x00003100, 0xbe422224,
+    0x15162306, 0xc8411714, 0x50482825, 0x10055338, 0x41b55305, 0xc02a21bc, 0x702c2737, 0x2c700606, 0xb4417f27, 0x2e8f8517, 0x00800180, 0x00450022,
+    0x16173700, 0x5714011d, 0x2f2705cb, 0x013d2601, 0x82323634, 0x16172511, 0x36013f32, 0x3e231082, 0x83241601, 0x0f142210, 0x06e85701, 0x3f252282,
+    0x1e013e01, 0x055d7901, 0x2f082782, 0x39cd3435, 0x8407091a, 0x0703030c, 0x1a130a69, 0x0e045a13, 0x080a0d05, 0x16030826, 0x1a8e011a, 0x07690a13,
+    0x840c0303, 0x391a0907, 0x03161a08, 0x2a081882, 0x0e050d0a, 0x4dda5a04, 0x07702b22, 0x090c0c09, 0xda110d87, 0x0d13130d, 0x05066c94, 0x330b090d,
+    0x04101a0b, 0xda0d139c, 0x83870d11, 0x7007281e, 0x0a4d222b, 0x821a1004, 0x0d092719, 0x946c0605, 0x0082000d, 0xfdff022d, 0x8302bdff, 0x2500c301,
+    0x50004000, 0x2b220719, 0xd0831501, 0x20053544, 0x25c38226, 0x35013f36, 0x15823f34, 0x36321628, 0x1625013d, 0x0f820f06, 0x26842620, 0x5c672220,
+    0x3b362605, 0x16363701, 0x05f87717, 0x0d130836, 0x891a2610, 0x071a0b67, 0x0b070650, 0x2a411f50, 0x2c012a3c, 0x212a0a83, 0x2217b817, 0x10210f17,
+    0x1e836712, 0x0e00012c, 0x0e0a300a, 0x1a130d40, 0x1f823c26, 0x1a0b8b2f, 0x24302e06, 0x1e7a2713, 0x381e2a2a, 0x2c0e8325, 0x5821171c, 0x11171711,
+    0x1509127e, 0x8224830a, 0x07474cb7, 0x3300c022, 0x1624b582, 0x07012b06, 0x83078541, 0x27372c8f, 0x37262223, 0x0637013e, 0x82172315, 0x3541089a,
+    0x32363423, 0x15231516, 0x37173233, 0x1e273423, 0x01000201, 0x8909070a, 0x800d1302, 0x8902130d, 0x010a0709, 0x3e3f5807, 0x0107741c, 0x5e517030,
+    0x01307051, 0x3e1c7407, 0x1101583f, 0x06980a07, 0x82258202, 0x0602392a, 0x36070a98, 0x6c441554, 0x52800282, 0x80526e6e, 0x446c8202, 0x05005415,
+    0x2e064741, 0x000700c0, 0x001a000f, 0x006d0064, 0x18221200, 0x210d31fc, 0x3b5d1613, 0x023f3b06, 0x0e020f16, 0x23222301, 0x013f012e, 0x27013f36,
+    0x010f0607, 0x26230706, 0x0282012f, 0x16170724, 0x2b82011f, 0xc4822220, 0x26022f22, 0x37212182, 0x20128236, 0x08164402, 0x17311186, 0x07011f05,
+    0x012e010e, 0x1c289437, 0x011c281c, 0x08068464, 0x0b054e5c, 0x1606060c, 0x29021b08, 0x4316070a, 0x0c12020a, 0x100d0301, 0x0d030a01, 0x0607112b,
+    0x0b063313, 0x33060ba0, 0x11070712, 0x0a030d2b, 0x030d1001, 0x02120c01, 0x0716430a, 0x1d1e0713, 0x0b0d241b, 0xa0070910, 0x0b100907, 0x1e1b230d,
+    0xe5fd071e, 0x051b0229, 0x050b1918, 0x78186001, 0x57080a0f, 0x190c70fe, 0x45140205, 0x20642e13, 0x0c5d4c19, 0x0e140210, 0x310f145c, 0x0d131547,
+    0x01010421, 0x130d2104, 0x0f314715, 0x140e5c14, 0x5d0c1002, 0x5020194c, 0x0f0c0d20, 0x0a222715, 0x09090760, 0x220a6007, 0x0c0f1527, 0x2eb4200d,
+    0x0b0c4513, 0x000c190a, 0xfffdff03, 0x2405b355, 0x00480040, 0x0a555157, 0x180af344, 0x2007a885, 0x20fa823d, 0x05e84135, 0x50323321, 0x0632057b,
+    0x3b160607, 0x3b013e01, 0x36173201, 0x1607013b, 0x4c510617, 0x22273006, 0x35263407, 0x16323634, 0x26311415, 0x83300223, 0x0d312781, 0x40070912,
+    0x8f480907, 0x1e360805, 0x22192822, 0x16210303, 0x09010606, 0x0f02020e, 0x580b2b0b, 0x1007803a, 0x13202c1d, 0x0e690d18, 0x090e0909, 0x011817a0,
+    0x0b385038, 0x0709e005, 0x12090780, 0x4883510d, 0x3505a554, 0x26431651, 0x1c151926, 0x0b061406, 0x37110c08, 0x4c220249, 0x394b1e16, 0x06b73f05,
+    0x28010401, 0x01283838, 0x00000001, 0xfffeff02, 0x01c201b8, 0x000800c1, 0x3f000029, 0xd54a1701, 0x16253205, 0x06010f06, 0x012e0327, 0x3f013e34,
+    0x36373601, 0x050c4232, 0x010f5a08, 0x26373627, 0x75060722, 0x120e5b4f, 0x01030944, 0x090207bb, 0xf90d1245, 0x05070c0d, 0x0a062c02, 0x0a1f6b22,
+    0x07112c06, 0x344f2215, 0x215a2104, 0x66588204, 0x061c0c10, 0x16080816, 0x100c1c06, 0x230f1301, 0x03091b1b, 0x16060c49, 0x490c0616, 0x2617401c,
+    0x12063b57, 0x4e8e8212, 0x00350607, 0x2600c001, 0x3b002e00, 0x00004300, 0x14163225, 0x36212306, 0x06d75937, 0x34262225, 0x41013b36, 0xa6820742,
+    0x06222326, 0x12331614, 0x32270583, 0x32043436, 0x82141516, 0x022e2115, 0x21091c4b, 0xf083a001, 0x1beafe29, 0x130de615, 0x83600d13, 0x2d2d280d,
+    0x30385038, 0x83601818, 0x1a6d2711, 0x131a1313, 0x118478fe, 0x35200b23, 0x200f8453, 0x21218280, 0x18821f21, 0x40210782, 0x23348320, 0x1c1c5018,
+    0x01210f82, 0x24048200, 0x38ad1a13, 0x25108328, 0x1856260c, 0xf66f4828, 0x00022305, 0xb34bff00, 0x000f2405, 0x49000018, 0xfb6106cf, 0x22320805,
+    0x33253526, 0x26070614, 0x40013e27, 0x0709835d, 0x5d090720, 0x40c00183, 0x2b105574, 0x6001681e, 0x07905d83, 0x90070909, 0x56405d83, 0x2f3d0980,
+    0x97473f34, 0x01002606, 0x002300c0, 0x08174527, 0x11212324, 0xbe780614, 0x080b5c05, 0x25089443, 0x15213513, 0x4883f001, 0x8490fe21, 0x83302063,
+    0x8430200b, 0x0120240a, 0x84800140, 0x073a5909, 0xfe23218a, 0x41e0e0c0, 0xc8250783, 0xb801f001, 0x05434e00, 0x6f672c20, 0x34122109, 0x08051f5f,
+    0x16173744, 0x012e2736, 0x06070622, 0x36013f16, 0x0e260732, 0x32161701, 0x07263637, 0xce912206, 0x37ce9191, 0x13131a13, 0x060ab11a, 0x2503010f,
+    0x01032528, 0x0b0a060f, 0x1207bd26, 0x8c2d0505, 0x0a190a2d, 0x077f6e23, 0x1b012105, 0x133b2883, 0x08060910, 0x18181209, 0x06080912, 0x086f0909,
+    0x36081004, 0x0c140c36, 0x6a00002a, 0x07250997, 0x21001900, 0x05054d00, 0x34262222, 0x430a9b5f, 0x0721054f, 0x06644326, 0x2634c627, 0x01263426,
+    0x2ef983d0, 0x835d70fe, 0x4383ba83, 0x383850c5, 0x55013850, 0xba20053b, 0x1682f784, 0x5e5d8324, 0xe0664042, 0xff033105, 0x02befffe, 0x00c00180,
+    0x00260013, 0x3700002e, 0x3510575e, 0x21012606, 0x23061411, 0x05272622, 0x26012f06, 0x34112537, 0x74861236, 0x31323608, 0x4d060702, 0x4d193e19,
+    0x32020b07, 0xd8070601, 0x4c010b07, 0x2e420001, 0xfe02412d, 0x0d020877, 0x5a010802, 0x1c288913, 0x481c281c, 0x020c06ba, 0x5d105c14, 0x20288215,
+    0x373082b9, 0x0107023a, 0x2e70fe7e, 0x6c2d3f42, 0x082e0802, 0x44015e02, 0x40fe130d, 0x1c262b82, 0x00050028, 0x9b6bff00, 0x00292405, 0x56390031,
+    0x6a4606af, 0xec611806, 0x23372107, 0x23220983, 0xa0832722, 0x99823520, 0x2105dd58, 0xee5e3233, 0x07634b08, 0x33152525, 0x44232627, 0x023f0792,
+    0x0709136d, 0x422f0212, 0x02a4022f, 0x1828212f, 0x2f212818, 0xa0010d13, 0x1a26130d, 0x4e10fe13, 0x30250b34, 0x06052b5c, 0x2c118403, 0x561a13d3,
+    0x08080907, 0x212f2f21, 0x2f008208, 0x20202f21, 0x5001212f, 0x0d13130d, 0x13fd1360, 0x09296318, 0x2b30cd23, 0x054b7705, 0x00820020, 0x534e0220,
+    0x001e3608, 0x05000026, 0x010f011e, 0x01012f06, 0x013f2627, 0x33011f36, 0x3fd68232, 0x36373517, 0x14111516, 0x35250706, 0x21230601, 0x7a022622,
+    0x14040205, 0xfeb20d0a, 0x090c258b, 0x38080882, 0x1c14f44e, 0x22106e20, 0xddfd0c11, 0x110d6e01, 0x1c14e0fe, 0x050d040a, 0x8a090c1a, 0x0a1c2101,
+    0x090c190d, 0xb2141c3d, 0x0b4b8918, 0x00ff1411, 0x1001120d, 0x0ae5fef5, 0x3782821c, 0xfbff0100, 0x2501c0ff, 0x1d00c001, 0x32170000, 0x2b141516,
+    0x34352201, 0x2105d47c, 0x0883013f, 0x30081482, 0x07061617, 0x1711d815, 0x1708d008, 0x40342811, 0x06091005, 0x100906e0, 0x10344005, 0x08081117,
+    0x0c751711, 0x07b23757, 0xb2070808, 0x750c5737, 0x0a2f4f00, 0x20001622, 0x217bdb87, 0x011f2205, 0x26db833e, 0x0f061415, 0x82173301, 0x823d20d1,
+    0x7bd58666, 0x872f0718, 0x3c324d0c, 0xc0212954, 0x82fef830, 0x854f1c14, 0x070f7bcf, 0x3d2f692e, 0x42283c54, 0x1cc03313, 0x4f370a14, 0x0625c783,
+    0xc0ff0000, 0x2c018201, 0x2b001b00, 0x4f003300, 0x5f005700, 0x09075b00, 0x32013e24, 0xbd6f1716, 0x010e2508, 0x37272622, 0x21088b4e, 0xf4822634,
+    0x2f17062b, 0x1f013f01, 0x1e170701, 0x053f4a01, 0x20068c4e, 0xfe6a181d, 0x16372307, 0x4d6a0632, 0x32262206, 0x2d168216, 0x07403435, 0x0e070909,
+    0x50605012, 0x0a890e12, 0x28381a2f, 0x1c382830, 0x1c149014, 0x24240c48, 0x0803820c, 0x45338c25, 0x1350141c, 0x130d800d, 0x451c1450, 0x0f703033,
+    0x0e09090e, 0x090e5709, 0x0709e020, 0x2b090760, 0x882b3535, 0x18582a08, 0x28383828, 0x17171118, 0x2e3e8459, 0x06950c0c, 0x140a334c, 0x130d401c,
+    0x82400d13, 0x4c3323f6, 0xd04d1f06, 0x22818205, 0x4f073030, 0x8528088b, 0x0700c001, 0x2b001b00, 0x67098b4f, 0x83180679, 0x25200c13, 0x095f6218,
+    0x2005d76b, 0x62821815, 0x54013113, 0x088d0908, 0x09095109, 0x2d09081c, 0xc0080969, 0x11578218, 0x08088022, 0x52292282, 0x091b0908, 0x08682d09,
+    0x06bb4609, 0x87848020, 0x87821720, 0x89823320, 0x20063741, 0xbd291917, 0x2732230d, 0x01421614, 0x013b2807, 0x33373216, 0x64061732, 0x210807ad,
+    0x5478b401, 0xd0547854, 0x0c0a260a, 0x0a3c0a0a, 0xfe2328f0, 0x4f1c14a5, 0x4c231137, 0x0d0b1123, 0xb1842b12, 0x2382e020, 0x42785437, 0x0a360a0c,
+    0x100a4c0a, 0x1c184c2c, 0x4f372a14, 0x26021010, 0x86ac8448, 0x8282208f, 0x003b3d8f, 0x004b0043, 0x25000076, 0x06071617, 0x012f0607, 0x14150706,
+    0x26270607, 0x2726013d, 0x27240783, 0x26013f26, 0x0c651819, 0x47193720, 0x2d440fab, 0x24a78707, 0x17141513, 0x0c5b4106, 0x16323331, 0x15061433,
+    0x011f1606, 0x0e071706, 0x53161701, 0x163d0539, 0x051a6202, 0x04180a01, 0x14111905, 0x06212106, 0x051a1114, 0x020a1704, 0x04041906, 0x23198219,
+    0x1a050417, 0x192f1987, 0x0a180405, 0x041a0501, 0x1c1c288a, 0x84ab1c28, 0x024925ec, 0xa0fe0f0c, 0x08080441, 0x01080234, 0x0c0a0403, 0x08010108,
+    0x0c040a0c, 0x0a110c1c, 0x4b050809, 0x2006030f, 0x0f020419, 0x061e070e, 0x01070701, 0x0e071e06, 0x1904020f, 0x0f030620, 0x1d9c1515, 0x6a823020,
+    0x74281c23, 0x256d834b, 0x050ad3fe, 0x4d410807, 0x01013c06, 0x1a0d0206, 0x04040407, 0x0d190705, 0x050c1f27, 0x00000304, 0x00000400, 0x4102bfff,
+    0x1c2405eb, 0x2f002400, 0x200b7542, 0x416a8217, 0x17330cde, 0x010f1737, 0x25372606, 0x010f1416, 0x36013f27, 0x42011732, 0x3b290677, 0x01084e29,
+    0xfe040107, 0x32dd87ed, 0x89478a3e, 0x010b083d, 0x07071901, 0x2505482a, 0x42071407, 0x2e26067d, 0x3d0b084d, 0x99860b0a, 0x47899128, 0x0b01078a,
+    0x2082e108, 0x04482a25, 0x86070726, 0x05274697, 0x1b000726, 0x37002300, 0x09296d18, 0x7c130d43, 0x15390a1f, 0x012b0614, 0x013d3634, 0x3b362734,
+    0x37321601, 0x42425cee, 0x3023425c, 0x05e36943, 0x0930433b, 0x01214621, 0x38385004, 0x2e303850, 0xb1141c42, 0x1d1b2801, 0x172a1704, 0x2f2782c0,
+    0x43625c42, 0x1c141d30, 0x301d141c, 0x20101043, 0x38302482, 0x2e425850, 0x04011c14, 0x2b392701, 0x0008080f, 0x29086374, 0x00c301c0, 0x00390010,
+    0x73442500, 0x07454205, 0x03173729, 0x013f3426, 0x18011f36, 0x28097fa6, 0x27373435, 0x14151615, 0x05a76607, 0x013f2623, 0x24128226, 0x363f0135,
+    0x05ed624b, 0x364b2408, 0x0e0ed25f, 0xbe1414be, 0x0e600e0e, 0x0e4b6a4b, 0x0f0b0c42, 0x2a040502, 0x0f020504, 0x027f0c0b, 0x830a364d, 0x0a2b0898,
+    0x5f024d36, 0x1a035001, 0x04042e03, 0x0319042e, 0x351d1c17, 0x1d354b4b, 0x0735101c, 0x3e080c0d, 0x05090905, 0x0d0c083e, 0x59003b07, 0x07280937,
+    0x34001c00, 0x44003c00, 0x210ae141, 0xde411415, 0x3233280a, 0x17303337, 0x4d322506, 0x36230bf8, 0x4f35013b, 0x3643057f, 0x5f372007, 0xf84106e2,
+    0x09202306, 0xf141e7fe, 0x26262505, 0x080e1123, 0x2f05b57e, 0x13130de0, 0x422f200d, 0x131a5d2f, 0x40131a13, 0xfb410382, 0xa08b2305, 0xf7410f11,
+    0x0e022506, 0xa00d1310, 0x04822883, 0x2f215026, 0x9050212f, 0x13232782, 0x83507d1a, 0x00502214, 0x084b5903, 0x17000f26, 0x00002b00, 0x33219a8e,
+    0x1a157e06, 0x07700224, 0x726c0909, 0x459b2005, 0x7f181319, 0x30200a31, 0x85111345, 0xc001277b, 0x1000c001, 0x7b842300, 0x2b0fe141, 0x26373427,
+    0x3e173235, 0x16323301, 0x2c054949, 0x06223706, 0x26343315, 0x34450123, 0x05d34147, 0x34472e08, 0x2b2bc065, 0x3e0f1d31, 0x4b4b3525, 0x0c432c35,
+    0x130d671c, 0x9f0d13a0, 0x2a344c05, 0x141c1c14, 0x054c342a, 0x1d33c766, 0x2128331d, 0x27888227, 0x601e2935, 0x130d0d13, 0x22060343, 0x828002bd,
+    0x00112883, 0x001e0016, 0x19000036, 0x2d07ab63, 0x35012e27, 0x36013f34, 0x013e0717, 0xc9442737, 0x14072207, 0x12c94416, 0x02063038, 0x2b1a126e,
+    0x0b0b152b, 0x73125035, 0x210b0b0b, 0xdb60043b, 0x6d824b6a, 0x2c372024, 0x90440a09, 0x05013b0a, 0x07b10101, 0x334d2c12, 0x04040822, 0x124e7315,
+    0x04042d07, 0x3a4e0fec, 0x2e821126, 0x736a4b26, 0x04236d44, 0x2106c041, 0x27480601, 0x481f200d, 0x07291727, 0x37363405, 0x26222105, 0x0e264835,
+    0x49049330, 0x304b3532, 0x40f6fe26, 0xfe1f012f, 0xf84814a2, 0x07284806, 0x4431722e, 0x4229354b, 0x4a31ae0d, 0x141cde09, 0x20061341, 0x061341c0,
+    0x21001922, 0x24051341, 0x06010f14, 0x062a5222, 0x32013b22, 0x4108a24e, 0x15220717, 0x75181f14, 0x163d0b8b, 0x32333732, 0x09770217, 0x1b095c0a,
+    0x12125b09, 0x121b4f0e, 0x0e0e1466, 0x6a930e14, 0x23e6824b, 0x170f3a1c, 0x220a1441, 0x82531511, 0x095d2127, 0x1b252a82, 0x13130d4f, 0x22288245,
+    0x824a140e, 0x6a4b2628, 0x3a1c28ba, 0x060f4113, 0x17440620, 0x00c0240a, 0x431d0007, 0x3d420a69, 0x2737230f, 0x3b450733, 0x35202107, 0x26070144,
+    0x20203035, 0x43202060, 0x6c23052a, 0x42354e02, 0x35270522, 0x88bf024e, 0x82883838, 0x2663825f, 0x8202e0ff, 0x4700a001, 0x6224050b, 0x93008500,
+    0x45450f47, 0x17200743, 0x08796d18, 0x06220729, 0x23262707, 0x82060722, 0x15172309, 0xa44d1714, 0x33162d08, 0x3336013a, 0x06011f16, 0x06233017,
+    0x25051f47, 0x0e271637, 0x22880701, 0x2c473220, 0xfe2a083a, 0x262634ba, 0x2ea02634, 0x425d4142, 0x0101010b, 0x110a0908, 0x010d170c, 0xff066804,
+    0x2f441c14, 0x02232109, 0x04010403, 0x1c820806, 0x0c0a2334, 0x0b110c1c, 0x1efa0510, 0x0d420528, 0x401a2613, 0x25476b1a, 0x2443471c, 0x26368082,
+    0x2e424634, 0x2e42422e, 0x01011719, 0x190c0505, 0x0ac20122, 0x1b460a0a, 0x05012205, 0x08008204, 0x27201228, 0x03090c1f, 0x233a10af, 0x1a200d13,
+    0x00000026, 0xffffff05, 0x018002c0, 0x002a00c2, 0x00430040, 0x005c0059, 0x56452100, 0x11352509, 0x06072726, 0x27060654, 0x36343526, 0x37173233,
+    0x2907f16b, 0x25110706, 0x26220614, 0x18823035, 0x84183720, 0x33290b9a, 0x17160527, 0x1415011e, 0x231f8d31, 0x02273307, 0x30079e7a, 0x068e0607,
+    0x030a020c, 0x01800706, 0x172e212f, 0x250d8676, 0x01200b84, 0x84184b20, 0xc8280c92, 0xabfe4890, 0x0a1d1a14, 0x66231688, 0x7d094890, 0x012805fd,
+    0x30040357, 0x1f060602, 0x2b263e82, 0x2f210208, 0x0d822728, 0x0b071e2d, 0x0e212c03, 0x2190d9fe, 0x18212f2f, 0x280d9884, 0x286a9010, 0x09163935,
+    0x211a8a01, 0x0b4190c0, 0x41812007, 0x172f0d0b, 0x013b3634, 0x012f2611, 0x013f012e, 0x5b1f013e, 0xdd820770, 0x0e010f27, 0x06012f01, 0x07175007,
+    0x06412720, 0x23fc840f, 0x01273337, 0x60341897, 0x20b00709, 0x0607840b, 0x0c020a03, 0x2e177606, 0x80012f21, 0x8e320d86, 0x07090706, 0x600907e0,
+    0x141b1c0a, 0x130d3c0d, 0xfe831e1a, 0x48903827, 0x1d0a0001, 0x35128d1a, 0x01090710, 0x2c210e27, 0x1e070b03, 0x27020606, 0x02212f28, 0x53822b08,
+    0x0d821f20, 0x03043036, 0x0907a9fe, 0x01c00709, 0x36391509, 0x261a1a28, 0x08173c34, 0x3128fe83, 0x01e0fe90, 0x35391609, 0x0020148d, 0x270a1352,
+    0x0017000f, 0x003f003b, 0x4807d146, 0x33200737, 0x2807d74e, 0x011d2213, 0x07013b14, 0x20078e23, 0x71861821, 0x21333207, 0x27330507, 0x1ba00123,
+    0xfe0d1325, 0x25130dc0, 0x05195d1b, 0x08483108, 0x8c129e08, 0x12840808, 0x69080872, 0x0900ff11, 0x1c1c1467, 0x11d00114, 0x0b5151fe, 0x1b254046,
+    0x13130d20, 0x251b200d, 0x131a1360, 0x8d011a13, 0x2a0ae866, 0x141c6040, 0x401c14a0, 0x82008080, 0x00022d00, 0x02ddff00, 0x00a10140, 0x00210010,
+    0x08897b18, 0x06070631, 0x34113526, 0x16073637, 0x06141115, 0x6d272627, 0x3d0805fc, 0x1e021617, 0x0d11140e, 0x0f084f8c, 0x077b4d07, 0x8c4f080f,
+    0x0e14110d, 0x01a0019a, 0xaefe0e12, 0x2708120c, 0x01080904, 0x2f04096c, 0xfe09042f, 0x04090894, 0x0c120827, 0x120e5201, 0xdb440901, 0x05b75006,
+    0x24001130, 0x49003700, 0x68006500, 0x22130000, 0x6d822627, 0x32013b2e, 0x14060716, 0x23061617, 0x16010e27, 0x88054549, 0x16252219, 0x05f46f14,
+    0x013e3726, 0x36262726, 0x07222d82, 0x14881732, 0x82343621, 0x07333413, 0x0f061613, 0x2f260601, 0x0e072301, 0x2e012f01, 0x53133701, 0x2308077f,
+    0x97273307, 0x0808030c, 0x08220c03, 0x08080209, 0x5f080902, 0x17040f0c, 0x23090904, 0x1a1b040a, 0x09230b04, 0x1a201782, 0x04240885, 0x0c0f0516,
+    0x0b211a83, 0x2d348e79, 0x05038252, 0x0c061e06, 0x31963103, 0x09820c03, 0x03052508, 0x34260b82, 0x30607026, 0x1a0b0001, 0x0d0b1a36, 0x152c1508,
+    0x16a90d08, 0x082b5d34, 0x7c39090f, 0x060f0939, 0x09270584, 0x17365b29, 0x8b400f08, 0xfe642d26, 0x020c06c6, 0x0605020d, 0x05067676, 0x0c2e0882,
+    0x103a0106, 0x25251b14, 0x74ac141b, 0x0f7a0200, 0x0029210a, 0x20160d7a, 0x28057a25, 0x09980123, 0x11007a0c, 0x7a290e21, 0x082a0a00, 0x174a1602,
+    0x0db91416, 0xf979b209, 0x06362705, 0xb22b0502, 0x80180c09, 0x0d270aef, 0x00002100, 0x51231113, 0x152006ba, 0x115e0982, 0x21332f0e, 0x60153335,
+    0x01111740, 0x401711f0, 0x49720750, 0x10012f08, 0xfe8001c0, 0x117801a0, 0xfe111717, 0x6f630188, 0x4040220c, 0x20008200, 0x065f4503, 0x1300c02c,
+    0x34001b00, 0x32370000, 0x47541516, 0x36342306, 0xc0533233, 0x061b4a05, 0x8c700120, 0x012b2405, 0x82332726, 0x11332672, 0x23261521, 0x2f268235,
+    0x1c412fd0, 0x1c14e014, 0x03042f41, 0x03152815, 0x7405104c, 0xf5380506, 0x804c1e09, 0x1fa0fe40, 0x60141c21, 0x1c132f42, 0x422f131c, 0x01070701,
+    0x32050e4c, 0x151d0801, 0x1d15c4fe, 0x40401a26, 0x12322001, 0x841d152e, 0x08af4a97, 0x36002d27, 0x00003f00, 0x05645025, 0x06222624, 0x7382011d,
+    0x35013f22, 0x5011e554, 0x152508d3, 0x013f3405, 0x20208215, 0x83368335, 0x01352ace, 0x256010d0, 0x10602536, 0x0afa5470, 0xfe3b0a85, 0x706d13a0,
+    0x6d020907, 0x70070913, 0xee1209c9, 0x25251b60, 0x12ee601b, 0x55334409, 0x33300f2c, 0x2f0815d9, 0x810709c0, 0x07641508, 0x0600c009, 0x0033a784,
+    0x0900c001, 0x1d001100, 0x2c002400, 0x00003400, 0x7c201635, 0x00200682, 0x24063b41, 0x32011e05, 0x21138636, 0x09843525, 0x08502420, 0x26052206,
+    0x2a0f8427, 0x3d06013d, 0x01719e71, 0x82719e8f, 0x00fe2606, 0x6874681e, 0x3309821e, 0x213fa001, 0xa0a4fe34, 0x70a07070, 0x300c9b01, 0x2b37336e,
+    0x1a300082, 0x011a2626, 0x26342640, 0x19d23426, 0x34191b1b, 0x29351083, 0x2b180b3f, 0x2f8f1e11, 0x422f2f42, 0x05172209, 0x1e122b25, 0x0bf37e00,
+    0x1097e218, 0x36341727, 0x06223533, 0x072f4515, 0x22071964, 0x8291ce91, 0x5e582a02, 0x98714f42, 0x50383850, 0x05005738, 0x84b80121, 0x42672618,
+    0x4f71205e, 0x21168260, 0xe7565038, 0x02bc340a, 0x00c00180, 0x00300028, 0x16320100, 0x14150715, 0x51170706, 0x2a23055e, 0x86012b01, 0x0723270a,
+    0x34352606, 0xaf470137, 0x08725405, 0x38282031, 0x293d4d60, 0x0c160b04, 0x04012c04, 0x85262701, 0x6121080a, 0x0c1d0f79, 0x212f7401, 0x144a1927,
+    0x0e140e0e, 0x1b25a001, 0x65415010, 0x040b7012, 0x780b0408, 0x2c068568, 0x1111073d, 0x2501090f, 0x202f2115, 0x23268248, 0x0200140e, 0x22084742,
+    0x183b000f, 0x2011fb43, 0x056f4c00, 0x21072725, 0x41230627, 0x152105a9, 0x21b08214, 0x4c583f36, 0x17072308, 0x0d84011e, 0x3f051848, 0x090760fe,
+    0xcc010709, 0x141c1c28, 0xfe480503, 0x03054880, 0x281c1c14, 0x0b48041c, 0x1252061b, 0x12260982, 0x0c1a0652, 0x86640448, 0x40012109, 0x01231582,
+    0x8201c1c1, 0x141c2a06, 0x072b0a0a, 0x0f8f0b07, 0x2d368216, 0x8f0f1614, 0x2b07070b, 0x00140a0a, 0xab880800, 0x1800102f, 0x30002800, 0x40003800,
+    0x50004800, 0x09fb5c00, 0x3d262227, 0x013e3701, 0x08395a27, 0xac181620, 0xae4b0c33, 0x09cc4108, 0x7705ae6b, 0x178707c6, 0x83500221, 0x14e0347d,
+    0x0912881c, 0x0e14030a, 0x160e140e, 0x0faf0e0e, 0x85af0f28, 0x84ad2006, 0x778e2013, 0x118510b9, 0x1c000123, 0x273c8214, 0x892e141c, 0xb8163112,
+    0x0e223d82, 0x3c89ad14, 0xea204382, 0x8e201384, 0x72200584, 0x1185058a, 0x82060021, 0x01e027eb, 0x00a001c0, 0x3d7c000f, 0xff66180a, 0x0746570f,
+    0xde8fbe8f, 0x1b800127, 0xfe1b2525, 0x200583c0, 0x09635633, 0xc7471320, 0x20058505, 0x21178413, 0x2787a001, 0x1b400125, 0x84a0fe25, 0x84ad2015,
+    0x8a732005, 0x22118505, 0x92050000, 0x0f3f7ba7, 0x082b5218, 0x0f87a58f, 0x7a189d97, 0x979a0b12, 0xa38ad320, 0x00820020, 0x938c0220, 0x758b8d98,
+    0xfb929320, 0xb05aff20, 0x00002205, 0x184f8c07, 0x9809f5b7, 0x97d78759, 0x84f79fef, 0x8b1320cf, 0x1a9b41fd, 0x1b844d20, 0x09410585, 0x20118b05,
+    0x06db4400, 0x900d4b42, 0x171167b9, 0x42119941, 0x93410b31, 0x052a420d, 0x820b2442, 0x4103207b, 0x79a00e3b, 0x07417191, 0x856b9305, 0x890020ee,
+    0x057b5b63, 0x1808bb69, 0x20078d6d, 0x0dab6917, 0x36c53327, 0x25362525, 0x2505845b, 0x13130d80, 0x0584fe0d, 0x14826020, 0xe5362522, 0x55220584,
+    0xbb4a0d13, 0x130d2105, 0x220a2345, 0x45210019, 0x3b211023, 0x08794801, 0x5207495b, 0xad7a050f, 0x1c702605, 0x14200114, 0x052c5d1c, 0x260af244,
+    0x1e1e158d, 0x4173fe15, 0x57710534, 0x00c32209, 0x05b56810, 0x2908c34d, 0x33352311, 0x11151632, 0x04823603, 0x84060159, 0x44372073, 0x702e08ab,
+    0x07090907, 0x14706090, 0x190fe81c, 0x0d83b0fe, 0x0a0e5028, 0x0e0e1486, 0x72840e14, 0x4080012d, 0xb1fe141d, 0x1404bf01, 0x8521fe10, 0x0b6d2412,
+    0x5ded0312, 0x002f0580, 0x00020000, 0x01300000, 0x005001c0, 0x4c1f000f, 0x0d53112b, 0x083b4c06, 0x41a00121, 0x01200936, 0x200a4241, 0x09364190,
+    0x0a89c020, 0x08a74318, 0xc7010522, 0x0027dd82, 0x0f011e01, 0x82063301, 0x020e3303, 0x06072726, 0x37342622, 0x0f263601, 0x37362601, 0x0282013e,
+    0x01164608, 0x210a27d3, 0x27086283, 0x471b6293, 0x42163a45, 0x070e1407, 0x170b0401, 0x1d06b30b, 0x2e210729, 0x01515f2c, 0x39672793, 0x3127082c,
+    0x04081f1a, 0x0e074206, 0x03010714, 0xb20b160c, 0x062a7435, 0x212c2d22, 0x30778213, 0xffffff02, 0x014002e0, 0x003500a0, 0x0100003d, 0x05616516,
+    0x49331721, 0x272e06c6, 0x27012e36, 0x010f2226, 0x013f1606, 0x98841736, 0xea831a84, 0x83343521, 0x1632218f, 0x083b8518, 0x293abf36, 0x629a1e1e,
+    0x09130d36, 0x02775a07, 0x1b091111, 0x0c231c46, 0x2326e982, 0x13142026, 0x18834f23, 0xd0fe2f08, 0x7aa7261a, 0x2c3a2c06, 0x0e0e1453, 0x5f010e14,
+    0x23101614, 0x69561122, 0x09070d13, 0x132c187e, 0x1a151506, 0x1909190a, 0x420e0f1a, 0x1583301b, 0x7d1a2528, 0x251d0bb7, 0x2f824325, 0x59140e21,
+    0x0028089f, 0x0f00c001, 0x44004000, 0x32107542, 0x1d160133, 0x27061401, 0x013d012e, 0x012b2634, 0x5b112115, 0x5918057f, 0x16240735, 0x013d3632,
+    0x27221d83, 0xd9823426, 0x0717322d, 0x01152335, 0x09090750, 0x83c0fe07, 0xdd013305, 0x1b212f13, 0x08111725, 0x1a26e0fe, 0x08261aa0, 0x7d823424,
+    0x261c142a, 0x040c0404, 0xa09c040e, 0x080aad42, 0x1b135521, 0x032b20df, 0x1c1d2c03, 0x01701711, 0x26261a60, 0x2434c01a, 0x0e0e0a20, 0x1f03a10a,
+    0x82263e15, 0x040c2531, 0x8080a604, 0x2c05cb42, 0x014002e0, 0x004300a8, 0x005d0050, 0x07644a00, 0x0d4d2220, 0x05da5f06, 0x3e259682, 0x1e011f01,
+    0x05874f01, 0x06072629, 0x3336010f, 0x83331732, 0x26272304, 0x3e4d2627, 0x36262105, 0x1627be82, 0x26370117, 0x5b072223, 0x25210686, 0x080c8335,
+    0x011e173c, 0x3632013b, 0x43023e02, 0x422e2530, 0x03240303, 0x252e4203, 0x2d024330, 0x1024430a, 0x05020606, 0x0e060c02, 0x04100f12, 0x3b292927,
+    0x3b374a37, 0x04272929, 0x0e120f10, 0x1b820c06, 0x06063308, 0x0a432410, 0x2304bafe, 0x1e242523, 0x1e142515, 0x25243601, 0x01042323, 0x1525141e,
+    0x0808a81e, 0x3d432f46, 0x2c27272c, 0x462f433d, 0x26b50808, 0x51830d25, 0x59820f20, 0x07060433, 0x0c9a1109, 0x9a0c1a1a, 0x06070911, 0x06060204,
+    0x3454830f, 0xfe26250d, 0x0d0d29f1, 0x1b1d1525, 0x0d0d2517, 0x1d1b1329, 0x2a008200, 0xfffdff01, 0x018101fd, 0x41160083, 0x0721060f, 0x07965105,
+    0x9a502720, 0x01173d05, 0xfe12126e, 0x05190ccd, 0x0c09060e, 0x090ddadb, 0x19050e06, 0x1508ee0c, 0x8f091422, 0x1d251282, 0x6606190c, 0x20128266,
+    0x821a821d, 0x00022853, 0x01d0ff00, 0x82b301c0, 0x00262353, 0x46861300, 0x1d160524, 0x5d891401, 0x2f0ffc44, 0x050d0d37, 0x0d1b050c, 0x17172e01,
+    0x1b0ed3fe, 0x0d290c82, 0x0ac1b00d, 0xfe0a0e0e, 0x39058370, 0x18055401, 0x0c0c1e0c, 0x17077805, 0x78071710, 0x1e0c0c05, 0x4404180d, 0x99760ee0,
+    0xff032e0a, 0x02c0fffe, 0x00c00181, 0x002b0026, 0x2ad3823d, 0x26032f22, 0x32013b36, 0x4c33011f, 0x3320077a, 0x2008c444, 0x05534315, 0x33152728,
+    0x1617012e, 0x035b0714, 0x37228208, 0x30011736, 0xa0560a10, 0x08090120, 0x2b050828, 0x0907b0d0, 0xa0010709, 0xb02f0583, 0x0d13835d, 0x440a7da0,
+    0x210605ac, 0x84bafe23, 0x0d462c19, 0x0d400b17, 0x086c4073, 0x6e3a060c, 0x40380ac1, 0x130d5d83, 0x442f7cbc, 0x040e05fe, 0x2007091e, 0x0b160907,
+    0x03000000, 0x202a0382, 0x60018002, 0x1a001100, 0x6b182300, 0xd24a090b, 0x32333005, 0x32073617, 0x22232637, 0x21161406, 0x82343632, 0x16072909,
+    0x6346d701, 0x46514663, 0x07850282, 0x822fdd21, 0x2b1e2400, 0x824c012b, 0x821e2004, 0x6001260b, 0x4f5e845e, 0x2104844f, 0x684c40e0, 0x40262205,
+    0x446f8240, 0xae250673, 0x3c003400, 0x28108200, 0x07141525, 0x2f222322, 0x20708201, 0x0a0b6507, 0x27210e82, 0x054c4e15, 0x2e013d2d, 0x3e343501,
+    0x17363703, 0x44013b16, 0x173a0972, 0x02070635, 0x02020c40, 0x0c4a040a, 0x114c4c0c, 0x10070917, 0x020e0907, 0x08841818, 0x342c2908, 0x1a30241c,
+    0x43465409, 0x452e0a50, 0x0e0e1477, 0x11680e14, 0x0cf6e617, 0x01890804, 0x3b090b31, 0x07090907, 0x36060131, 0x4a2e0783, 0x29345919, 0x0a1c2644,
+    0x2e301302, 0x2b824b3d, 0xa7140e2e, 0x00091163, 0x00000100, 0x8301fdff, 0x43069f42, 0x27270593, 0x013d2625, 0x18253734, 0x2008866e, 0x0692426d,
+    0x12cdfe25, 0x42330112, 0x5a2007a8, 0x20069142, 0x0da8428f, 0x42000021, 0x37200e9f, 0x17204d8d, 0x9f426486, 0x17172410, 0x420d2e01, 0xb0200696,
+    0x2105ac42, 0x9e42440e, 0x42ea2009, 0x0c2c0995, 0x44440518, 0x1e0d1804, 0x42050c0c, 0x230b9d42, 0x00050000, 0x022d0082, 0x00800180, 0x00190015,
+    0x0021001d, 0x2ce48245, 0x1614010e, 0x35211517, 0x2634013e, 0x06b97727, 0x35051525, 0x86331523, 0x35052403, 0x5a231521, 0x07970674, 0x0e800226,
+    0xfd0e1212, 0x13290584, 0x0d40020d, 0x4060fe13, 0x280182c0, 0x800260fe, 0x090e0940, 0x28038a80, 0x19053d01, 0x6305191e, 0x26068463, 0x13130d23,
+    0x8480a00d, 0x60c02800, 0x0a061b60, 0x911b060a, 0x08ef6105, 0xc7018726, 0x55003500, 0x0e75bb18, 0x5e18b882, 0x17261327, 0x17071433, 0x87613d36,
+    0x011d2306, 0x48180f14, 0x74180861, 0x2e2608e3, 0x17013d01, 0xf618011e, 0x5e181899, 0x552c073c, 0x1a052c29, 0x1007090b, 0x4c140907, 0x085f4718,
+    0x5741382e, 0x293c0a34, 0x10320e07, 0x0d0a0a12, 0x0fa4f618, 0x08100823, 0x25038320, 0x14100e20, 0x3b501a18, 0x262a2205, 0xef741880, 0x09222309,
+    0xf6184469, 0x63580bac, 0x01812c08, 0x001d00a1, 0x00290023, 0x47370031, 0x152905a7, 0x23061411, 0x23262722, 0x21068422, 0x6d511135, 0x32333005,
+    0x05323336, 0x37363215, 0x17160326, 0x4b23012e, 0x0539074b, 0x07010e35, 0x26353716, 0x02011e27, 0x0d13136d, 0x312b0605, 0x3f3ef63e, 0x080b8a35,
+    0x17f8fd2c, 0x1b240523, 0x2501221e, 0x2f42ef1a, 0x012f422f, 0x041e1460, 0x1e1a171f, 0x8a012001, 0xc3fe1608, 0x0d02120e, 0x1608163e, 0x09843d01,
+    0x1e3d643c, 0xeafe0216, 0x241a030b, 0x38503811, 0x3a545038, 0x03131b03, 0x030a31e6, 0xbf822318, 0x00000225, 0x8502e0ff, 0x002524bf, 0x9b160100,
+    0x320021b7, 0x98056c4e, 0xe7fe219f, 0x89939485, 0x84c0fe21, 0x0833417f, 0xa001803b, 0x19000900, 0x31002500, 0x47003d00, 0x11310000, 0x06141121,
+    0x26222123, 0x0ead6225, 0x088f4b18, 0x22012b22, 0x33251b82, 0x013d3221, 0x8b288234, 0x18012017, 0x2e08337d, 0x0d138002, 0x130dc0fd, 0x0709c001,
+    0x84090760, 0x70082204, 0x2b028208, 0x010880fe, 0xfe080830, 0xb00808d0, 0x022a0283, 0xfd090730, 0x01070980, 0x2f82fe40, 0x18dd1321, 0x26082fd8,
+    0x0808107f, 0x84580810, 0x84682005, 0x40012405, 0x82300709, 0x65be822e, 0x0f280a97, 0x55004900, 0x6d006100, 0x21100b76, 0xf4711333, 0x1617290d,
+    0x2736013f, 0x34352726, 0x1d21c382, 0x0d307201, 0x0f26272e, 0x16170601, 0x3b141517, 0x37353201, 0x0a7b4018, 0x0eb77f18, 0xff82f385, 0x0d600223,
+    0x34e58513, 0x12900d13, 0x2d0e1219, 0x1c050709, 0x04060607, 0x0e08070c, 0x94bc8211, 0x41f02014, 0xa0230507, 0x83085008, 0xf0fe2802, 0x10010808,
+    0x4ca00108, 0x01370741, 0xfe130d80, 0x121a01d8, 0x0d05180f, 0x08050a03, 0x0b040304, 0x820b0507, 0x10082124, 0x20221695, 0x6d820810, 0x2a410285,
+    0x01003005, 0xb9ff0000, 0xc701c601, 0x00003300, 0x53072325, 0x072508b6, 0x26012f06, 0x0762643f, 0x37013b23, 0x05d84323, 0x37213328, 0x16011f36,
+    0x2986010f, 0x62a00124, 0xe083ad4b, 0x0953f728, 0x0a0d190d, 0x0c833733, 0xcd4b8222, 0x01230683, 0x830a5217, 0x18342114, 0xf02d0d82, 0x200d1360,
+    0x0c6a130d, 0x0d091409, 0x910b8443, 0x82002011, 0xff053700, 0x02bafff7, 0x00cb0100, 0x001d0015, 0x002d0025, 0x13000035, 0x6c6e1e36, 0x06222a05,
+    0x07061617, 0x37022e06, 0x885e183e, 0x0f044f10, 0x8f50cc39, 0x501b2655, 0x0f112826, 0x682f1f1a, 0x0f0d2950, 0x131a2f6e, 0x50131a13, 0x6e750598,
+    0x10bb340c, 0x1b4e7f3d, 0x1c224026, 0x2a07053b, 0x4a437d50, 0x82d4fe6d, 0x1a13222a, 0x2005846d, 0x2005842d, 0x4e058453, 0x0f200a07, 0x5105434d,
+    0x13220f2d, 0xbe653632, 0x011d3005, 0x013b1614, 0x013d3632, 0x14163237, 0x18012b06, 0x340c9fde, 0x383828c0, 0x09076028, 0x07200709, 0x130d3009,
+    0x01300d13, 0x514a18a0, 0xe0fe270b, 0x09385038, 0x2283e007, 0x82803021, 0x00402a7c, 0x00ffff03, 0x01800100, 0x06ff6981, 0x60120021, 0x1e220530,
+    0x08841402, 0x14163723, 0x05385e07, 0x01373429, 0x80173236, 0x82253625, 0x83db2002, 0x46252d04, 0xeefe0a0a, 0x160a1a0a, 0x12010a0a, 0x01210782,
+    0x20168425, 0x202385db, 0x821182d5, 0x201d821e, 0x201e831a, 0x0cab600a, 0x34002422, 0x2811ab60, 0x15331503, 0x22171523, 0x07c15907, 0x1620eb82,
+    0x4d0fd060, 0x802005b6, 0x4027de83, 0x2440e0e0, 0x83604913, 0x4d10820b, 0x198405dc, 0x18138021, 0x2608adb9, 0x40202001, 0x86207030, 0x89132011,
+    0xff8e1818, 0x44c32008, 0x4920068b, 0x2408bf59, 0x0607012f, 0x23048822, 0x34113526, 0x09dfe418, 0x011f3223, 0x0aa94311, 0x42183d20, 0x0b8b0aff,
+    0x0866012b, 0x26081212, 0x050a0536, 0x20048436, 0x220f8e26, 0x8e08f008, 0xbd012d02, 0xfe0a0906, 0x06090a20, 0x03032d2d, 0x11820385, 0x8be00121,
+    0xc8fe2111, 0x430a9d44, 0x00250678, 0xff080000, 0x06d74aff, 0x2100092a, 0x2d002900, 0x39003100, 0x22055f45, 0x43153337, 0x2520066f, 0x83066745,
+    0x08b362cf, 0x16323324, 0xe96b3404, 0x23172405, 0x82373315, 0x05ed4503, 0x84321621, 0x1415250f, 0x35012b06, 0x20272582, 0x130d2020, 0x7a0d0213,
+    0x2f3605a3, 0x1a137021, 0x2f217013, 0x2217e8fe, 0x0f221717, 0x40604040, 0x0b876840, 0x0d13c022, 0xe0202e83, 0x802e0782, 0xfe30130d, 0x26261af0,
+    0x2110011a, 0x4382402f, 0x2f400d23, 0x21338382, 0x53825817, 0x09868f20, 0x2782a020, 0x0013c022, 0x01310082, 0xcdfffdff, 0xb3018302, 0x00003700,
+    0x07061601, 0x07714c01, 0x8f17ad7d, 0x36210817, 0x7c021716, 0xfe0b0706, 0x061a0b0f, 0x0c060650, 0x07043c45, 0x3c04070d, 0x06041c38, 0x1c04070e,
+    0x820f8237, 0x373c2407, 0x8707041c, 0x211f820f, 0x2f82453b, 0x82190121, 0xe6fe2104, 0x872d3582, 0x2707190b, 0x08040765, 0x1f660604, 0x2707842f,
+    0x06661f30, 0x07040803, 0x27200f90, 0xbb822f82, 0x37580220, 0x00232808, 0x37000047, 0x41260715, 0x3223056d, 0x7b011d16, 0x1d23114b, 0x6c331401,
+    0x272109d9, 0x3c181937, 0x14152608, 0x3d32013b, 0x2b0f8701, 0x13029ea0, 0x130d600d, 0x38080838, 0x012b0386, 0x13130d78, 0x0240fe0d, 0x5c299f06,
+    0xa0260a9e, 0x02069f29, 0x1b83c001, 0x168a2020, 0x3e844020, 0x8a9e0221, 0x00382140, 0x01200082, 0x40270382, 0x40014002, 0x18003700, 0x180fa343,
+    0x8e09bf48, 0x21a58f8d, 0x8a842002, 0x05830020, 0x748b3020, 0x01200b86, 0x91847d82, 0x58230482, 0x8f580808, 0x2a878503, 0x0001c0ff, 0x2f00c001,
+    0x18370000, 0x4107fb97, 0x68181e3a, 0xa823076d, 0x950d1358, 0x4020215f, 0x0e419383, 0xa9441805, 0x65078707, 0x09220af7, 0x77821900, 0x41003727,
+    0x34350000, 0xe7521836, 0x05de7108, 0x34013d2b, 0x1d32013b, 0x15163701, 0x51bc1811, 0x5011200a, 0x6351059e, 0x5b252007, 0x113e0743, 0x50400d13,
+    0x68010907, 0x08300808, 0xa2081008, 0x0709800e, 0x80090760, 0x1408a00e, 0x28493308, 0x0d702d05, 0x50070913, 0xfe130de0, 0x010709c0, 0x08299183,
+    0x28080840, 0xfe110a40, 0x0517708b, 0x11750128, 0x05056b0a, 0x30832ffb, 0xfe215382, 0x215382f0, 0x5f420040, 0x00093109, 0x01000017, 0x07230717,
+    0x3727012e, 0x32360735, 0x36093258, 0x40c00137, 0x07533e60, 0xc0530b10, 0x162b3e16, 0x0b1e0b75, 0x820b0b35, 0x53802a15, 0x5307100b, 0x2b16b73e,
+    0x8215823e, 0x0b1e2114, 0x36050745, 0xc3018002, 0x0f000700, 0x33002100, 0x22130000, 0x3b363426, 0x84021501, 0x22232105, 0x2508dd83, 0x06070614,
+    0x012f2627, 0x013e3235, 0x1e133637, 0x06141501, 0x2e272223, 0x37352302, 0xc0363736, 0x1b25251b, 0x0382e020, 0x1b202808, 0x66492c01, 0x342d4d48,
+    0x1c3a2d23, 0x30130f2b, 0x66484dd2, 0x13303849, 0x3a1c2b0f, 0x0133232d, 0x25362520, 0x82e5fe80, 0xc0200804, 0x42262e32, 0x02040a11, 0x0b80100d,
+    0x01200c09, 0x26421119, 0x0c20322e, 0x10800b09, 0x0004020d, 0x290c5352, 0x002f0027, 0x12000037, 0x7b821632, 0x1f060725, 0x7e061601, 0x944509b0,
+    0x22232806, 0x36013f26, 0x72012e27, 0x70540912, 0xd4962b07, 0x112c3296, 0x09010903, 0x9a424e07, 0x074e2106, 0x032a0d82, 0x86322c11, 0x34262634,
+    0x0584e626, 0x83c0012b, 0x205a345d, 0x0742130b, 0x0730430b, 0x42070b29, 0x5a200b13, 0x82bd5d34, 0x21028726, 0x275c0000, 0x0019220d, 0x29a1821d,
+    0x37000047, 0x3b363435, 0x8b821701, 0x1439ab82, 0x34262206, 0x01373201, 0x16141506, 0x35331737, 0x34353617, 0x07222326, 0x08214917, 0x16322724,
+    0xcb821417, 0xb7822220, 0x27203482, 0x322e3d83, 0x60011e17, 0x60160709, 0x36090776, 0xbc8296d4, 0x00012a08, 0xf5fe323d, 0x207c7124, 0x71241c33,
+    0x7c323d4f, 0x09090783, 0x182c2307, 0x04040423, 0x02010710, 0x24180b12, 0x11030504, 0x270a8206, 0x09074090, 0x37010960, 0x962e3882, 0x24d6fed4,
+    0x3d320b01, 0x20c0714f, 0x07836f20, 0x097c2423, 0x27208207, 0x03181fc0, 0x0f0b0606, 0x00300686, 0xfff4ff02, 0x017402c0, 0x001a00c0, 0x01000032,
+    0x22053d76, 0x84220627, 0x83232002, 0x013f2c9f, 0x32213336, 0x37320317, 0x4b153736, 0x3d3705b8, 0x16171601, 0x15373233, 0x02163521, 0x2f261a5a,
+    0x1d2c0707, 0x821e581e, 0x2d1d2d02, 0x262f0706, 0x1209411a, 0x09129401, 0x0926ae83, 0x40fe0d13, 0x0b83130d, 0x01110d2b, 0x49011080, 0x01065a28,
+    0x37008421, 0x285a0601, 0xfe0f0f68, 0x030101ef, 0x13130dc5, 0x0103c50d, 0x64640401, 0x21050742, 0x9b82faff, 0x9b828620, 0x1b000d29, 0x00002500,
+    0x46333525, 0x332808d1, 0x06162515, 0x26222123, 0x11209e87, 0x2b3f1b83, 0x01262201, 0x0d134040, 0x130d00ff, 0x0afb0140, 0xc0fd1312, 0x550b1213,
+    0x96011109, 0x51250911, 0x40210585, 0x321e83a0, 0x00010d13, 0x2210f2a0, 0x0e801022, 0x011efe0e, 0x82f0fe10, 0x067f42ae, 0x0002e02d, 0x0f00a001,
+    0x2f001f00, 0x4a130000, 0x322507be, 0x14011d16, 0xc44f1806, 0x08655607, 0x0f475218, 0x18521020, 0xec7b1809, 0x6001210a, 0x775c1683, 0x84888206,
+    0x2204821a, 0x87070950, 0x89b0200a, 0x4287820a, 0x0331096b, 0x0b000700, 0xb0001300, 0x0000b400, 0x27071737, 0x82028337, 0x18022008, 0x2a0889fc,
+    0x37012f34, 0x26012f36, 0x1827010f, 0x1808e444, 0x820c9454, 0x250f9d31, 0x16011f06, 0x5c82013f, 0x0b824382, 0x0f960720, 0x47822382, 0x1f867b82,
+    0x8b890f96, 0x90823720, 0x2dbc0725, 0x829e2d2d, 0x20028303, 0x05dc426a, 0x0202bb33, 0x05051d1d, 0x1c06050c, 0x0611222e, 0x06060b06, 0x20068711,
+    0x220d8405, 0x841c2d22, 0x861c2016, 0x852d2006, 0x88052026, 0x211d8426, 0x26822111, 0x05204682, 0x98204dca, 0xed20a782, 0x44200382, 0xb5200382,
+    0x01220382, 0xb4839671, 0x06039223, 0x218cf103, 0xdaa4050c, 0xa7823320, 0x00030022, 0x2407a376, 0x002f002b, 0x096f614d, 0x61012b21, 0x26200671,
+    0x3f210988, 0x05c96c01, 0x32013b2d, 0x33011d16, 0x35271732, 0x19171523, 0x2312a737, 0x1533013d, 0x2205884c, 0x7609f701, 0x05870562, 0x0d092e2f,
+    0xa0141c33, 0x0d331c14, 0xc0808909, 0x05eb4380, 0xe924238b, 0x10530d09, 0x096b4118, 0x0d531037, 0x50092e09, 0x141c1c14, 0x40090950, 0x6010d040,
+    0x0d13130d, 0x2c228960, 0xfeff0100, 0x8202c0ff, 0x2500c001, 0x05835900, 0x2f010e27, 0x1d062601, 0x077d4401, 0x73573420, 0x011e300a, 0x02373632,
+    0x03040677, 0x050d0339, 0x430f0839, 0x0f2405fc, 0x0c063908, 0x04351282, 0x3f0fc306, 0x010f3f4c, 0x060d0360, 0x03050672, 0x0909041c, 0x267283fe,
+    0x040909fe, 0x8205031c, 0x030d2614, 0x1a1a1560, 0x077b4615, 0x4301bd22, 0x07257b82, 0x49003a00, 0x085f7b00, 0x011e1722, 0x2f2a8584, 0x16170701,
+    0x0e16011f, 0x93822601, 0x3f240282, 0x0f060701, 0x2e291b82, 0x36013f01, 0x33063e37, 0x231e8232, 0x17163707, 0x06231683, 0x82342622, 0xe4470816,
+    0x281c1c28, 0x090c2e1c, 0x170c190c, 0x11050917, 0x16040b2d, 0x171a0d03, 0x0b041203, 0x0f08173c, 0x07050c1a, 0x08181806, 0x22100606, 0x11071504,
+    0x070e0e09, 0x090c3823, 0x280814cd, 0x3b09050e, 0x09131a0a, 0x7b010a32, 0xb1220519, 0x29821906, 0x190c0b3a, 0x0b324511, 0x170d5910, 0x4a0d0d06,
+    0x19420c0f, 0x040b3c22, 0x090b0e0b, 0x0e3c6582, 0x09010e20, 0x03020603, 0x1d222a01, 0x2c0a3499, 0x3c090c22, 0x0a1a1309, 0x02000932, 0x22082342,
+    0x5024001c, 0x212211d1, 0xe6451632, 0x14062405, 0x52043316, 0x0121060a, 0x05075ccd, 0x25251b3e, 0x1470011b, 0xfe07091c, 0x09090780, 0x1a430107,
+    0x131a1313, 0x141c4001, 0x1c1400ff, 0x40241c82, 0x141c251b, 0x0e221a82, 0xee4ed009, 0x93691805, 0x001f240c, 0x7744002d, 0x350809e5, 0x32161417,
+    0x27343536, 0x3231013a, 0x2f263637, 0x010e2601, 0x06011f16, 0x013e1617, 0x07222627, 0x37011e06, 0x3e373236, 0x0f012e01, 0x17010e01, 0x33323316,
+    0x34861506, 0x91ce9122, 0x88200282, 0x22086582, 0x0c010102, 0x06060203, 0x040b0750, 0x0a1e0706, 0x061206a8, 0x20621f06, 0x07110706, 0x06624615,
+    0x820c0306, 0x0206261b, 0x01010c03, 0x202f8202, 0x06fc620a, 0x0d572308, 0x020d1313, 0x0b070b06, 0x06021802, 0x0a020b0d, 0x0408a809, 0x26260810,
+    0x07031107, 0x0b02a219, 0x1982060d, 0x05211f82, 0x222a8303, 0x8200090e, 0x00022d00, 0x02c0ff00, 0x00c00140, 0x00320022, 0x290bc56a, 0x2634023d,
+    0x011d0622, 0x5c180614, 0x11220911, 0xe7651121, 0x3002210f, 0x2506aa54, 0x09385038, 0x0c83a007, 0x00021023, 0x21078310, 0x0583e0fd, 0x726a0920,
+    0xa0102605, 0x28383828, 0x06e14fb0, 0xfe600125, 0x5ac001a0, 0x002009ec, 0xff228c82, 0x018201c0, 0x82040021, 0x0010260b, 0x001a0015, 0x066b6221,
+    0x25002808, 0x3f360706, 0x27262301, 0x011e2716, 0x013e2317, 0x23070607, 0x27261736, 0x0e371633, 0x012e0701, 0x07141727, 0x46171406, 0x212005d1,
+    0x2405ae68, 0x15322133, 0x066b7b06, 0x21351322, 0x33330983, 0x2d083e01, 0x2727020c, 0x562d0c02, 0x2e010f07, 0x82220f01, 0x2d08290e, 0x0227082d,
+    0x070f014c, 0x37081382, 0x02020af7, 0xfe0b0f0a, 0x373729ba, 0x1a460129, 0x4b4b6aab, 0xfe204b6a, 0x12130de0, 0x1531f00e, 0x2920291d, 0x071e151d,
+    0x2a1e1e2a, 0x31291d02, 0x29311597, 0x072a1e29, 0x962a1082, 0x3409050f, 0x10090a0c, 0x3a820e0c, 0x37294024, 0x3a82261a, 0xfe6a4b32, 0x1c1240cb,
+    0x04000012, 0xbefffdff, 0xc5018301, 0x2837dd82, 0x79007100, 0x16370000, 0x07373233, 0x012f010e, 0x3f262207, 0x84171601, 0x16052901, 0x07272306,
+    0x012f2606, 0x3e231e83, 0x83363701, 0x26272223, 0x2c138222, 0x27072e27, 0x012e2726, 0x36372627, 0x84048234, 0x2704831d, 0x37321617, 0x011e1736,
+    0x04834282, 0x14060724, 0x59821617, 0x07060726, 0x1426060e, 0x0805464a, 0x1e166143, 0x03341112, 0x34250611, 0x2e030a09, 0x06030d0c, 0x01020409,
+    0x090a031f, 0x11062534, 0x12113403, 0x0306161e, 0x4a0c0d10, 0x090c1c0a, 0x1c0c0918, 0x0404030a, 0x03070204, 0x06160309, 0x110f0506, 0x32008206,
+    0x06050f11, 0x09151606, 0x1516110f, 0x1116150a, 0x8f15090f, 0x032f081c, 0x0307030a, 0x37a80505, 0x4e37374e, 0x800a1555, 0x26060308, 0x70080e02,
+    0x0101040a, 0x57020502, 0x26020e08, 0x80080306, 0x0107150a, 0x830a0404, 0x0606222f, 0x24068207, 0x01030304, 0x2a018202, 0x09151706, 0x16161110,
+    0x8217150a, 0x16162560, 0x10050507, 0x10257d85, 0x16070505, 0x2a7d8216, 0x160a1517, 0x09101116, 0x82061715, 0x01032f30, 0x50c90504, 0x38503838,
+    0x02000000, 0x0482ffff, 0x80018025, 0x18001100, 0x280cf15c, 0x3426012f, 0x3336013f, 0x09701805, 0x40023b1a, 0x1b25251b, 0x131a8dfe, 0x97090997,
+    0x1e011a13, 0x0c0c3e3e, 0x3e0b0c16, 0x06820b3e, 0x0d8c0c20, 0x2580012f, 0x1b00ff1b, 0x0a961325, 0x13960a1a, 0x862393fe, 0x00002131, 0x270c8755,
+    0x00350025, 0x005b004b, 0x320d4965, 0x07333634, 0x06171415, 0x013e2307, 0x010e2337, 0x82262223, 0x16322212, 0x0e59581f, 0x0f823320, 0x82061421,
+    0x23272d1d, 0x2317011e, 0x3d362726, 0x013e3301, 0x820cc97d, 0x70012638, 0x0d13130d, 0x2a048360, 0x11360640, 0x2a390b32, 0x6a200750, 0x2022055f,
+    0x1c882507, 0xc2820220, 0x141b252d, 0x2a500720, 0x11320b39, 0x82550636, 0x211d8825, 0x4386a001, 0x38304882, 0x270c0e48, 0x194f303f, 0x36251612,
+    0xe8121625, 0x01211a89, 0x2b118410, 0x3f304f19, 0x480e0c27, 0xf0fe1612, 0x00381c89, 0xff000002, 0x01c701c0, 0x003100c1, 0x0500003b, 0x26272223,
+    0x37363435, 0x4a093569, 0x2b260593, 0x17161501, 0x657b2737, 0x05a76705, 0x1516073a, 0x27060714, 0x26210706, 0x2335012f, 0xdc2e0115, 0x341a1226,
+    0x0907102c, 0x2a061354, 0x27121510, 0x0b0c0c09, 0x84340c0b, 0x2b093a05, 0xdc121a1b, 0x00011325, 0x60182513, 0x332c2140, 0x9a195934, 0x06200709,
+    0x2204840a, 0x82110c9a, 0x822e822f, 0x2e05832f, 0x352e2b09, 0xfd212c33, 0x16272716, 0x4db6b60d, 0x012a08bb, 0x00c00180, 0x001b0009, 0xa7410023,
+    0x82212005, 0x033326b2, 0x14152135, 0x28a88206, 0x26220614, 0x2223013d, 0xc9961826, 0x60013f07, 0x80fe130d, 0x01200d13, 0x401b2580, 0x40253625,
+    0x14ca251b, 0x0e140e0e, 0x0d13c001, 0x1d82e0e0, 0x2020c023, 0x8316831b, 0x824d201f, 0x140e2118, 0x2a0b8b4d, 0x00400034, 0x00520048, 0x4264005c,
+    0x6d870a19, 0x18058b45, 0x8609d041, 0x05815a7d, 0x32249982, 0x25011d16, 0x2406f250, 0x22012b34, 0x06f34602, 0x23353729, 0x011d0622, 0x823b1614,
+    0x222d8211, 0x66012b26, 0x012107c7, 0x82ce18e8, 0x58c0201e, 0x3d2c0579, 0x1a13131a, 0x0d70a013, 0x900d1313, 0x70200584, 0x2a059864, 0x0a0e4001,
+    0xa60e0a50, 0x83200f0b, 0x8520201b, 0x18132005, 0x270c89ce, 0x08081038, 0xb0fe0810, 0x13224182, 0x4d425d1a, 0xf0fe210a, 0x37080f63, 0xffffff01,
+    0x010202c0, 0x005900c0, 0x14162500, 0x22230607, 0x16171623, 0x27240783, 0x14152726, 0x3d22cf82, 0x0e850601, 0x37363724, 0x396e2322, 0x2e372405,
+    0x69342702, 0x1e2305b6, 0x82301702, 0x013e300a, 0x17323637, 0x1415021e, 0x37023e15, 0x82323336, 0x020e3544, 0xf7011607, 0x493c0909, 0x050c0909,
+    0x07040703, 0x28250302, 0x28239482, 0x82020325, 0x0324080d, 0x09090c05, 0x09093c49, 0x2b1c2c20, 0x0709030b, 0x220b0102, 0x16212153, 0x04120408,
+    0x21211608, 0x010b2253, 0x023f2883, 0x1c2b0b03, 0x1305582d, 0x11161f05, 0x01050709, 0x08401b0c, 0x0b1c4008, 0x09070501, 0x821f1611, 0x11280818,
+    0x23562109, 0x0602020b, 0x0a02010a, 0x01031a29, 0x0d287035, 0x280d0707, 0x01033570, 0x020a291a, 0x09060501, 0x2156230b, 0x82058347, 0x02bf2bf7,
+    0x00c10100, 0x00270014, 0xb6560100, 0x013f2109, 0x07cac818, 0x26270522, 0x1f330c88, 0x010f1601, 0xf9012206, 0xd8fe0707, 0xa8071407, 0x82280707,
+    0xf06f3a06, 0xfe071406, 0x0c0c70e4, 0x050d052d, 0x0d049837, 0x0c0c2d05, 0x010e04d0, 0x821d8211, 0x20288229, 0x33298214, 0x07f07007, 0x0c709207,
+    0x05052d0b, 0x05059737, 0xd00c0b2d, 0x2e05ba5d, 0xc0fffbff, 0xc0014002, 0x2d001700, 0x7e050000, 0x27250c6d, 0x21333626, 0x21788232, 0x9f6a1315,
+    0x37560806, 0x36323316, 0x22232634, 0x3e230706, 0x11280101, 0x08f00817, 0xa9381117, 0x01110c0b, 0x0b0c116e, 0x543cc0a9, 0x23283c54, 0x28141324,
+    0x1a283838, 0x0f340d2c, 0x1117104a, 0x17110808, 0x1e0ca97d, 0x7da90c1e, 0x7854d001, 0x09241554, 0x1a385038, 0x00352b16, 0x00820002, 0x0100022e,
+    0x00190080, 0x01000029, 0x2115011e, 0x48142244, 0x01290f87, 0xfe6e5220, 0x10526e40, 0x58171907, 0x83d02008, 0x20fe210a, 0x012a0583, 0x547e0b3d,
+    0x130b7e54, 0x20840709, 0xfe200482, 0x2a0a2178, 0x00040000, 0x02baff00, 0x18c60106, 0x20093566, 0x23ec8225, 0x06010f06, 0x82051a4b, 0x34352405,
+    0x8236013f, 0x011f2202, 0x18028216, 0x5908ab40, 0x01320f6c, 0x241307fe, 0x27452613, 0x1e2a4d2a, 0x0c061f37, 0x0e8b0e02, 0x59b1fe21, 0xb3200a78,
+    0xc1240b84, 0x2645272a, 0x072b3382, 0x371f060c, 0x0a4c2b1e, 0x8b1c200b, 0x13bd2110, 0x8d202683, 0x93200584, 0xaf860584, 0xc5010528, 0x26001e00,
+    0x27772e00, 0x93ac8205, 0x1e1725af, 0x16143301, 0x9007fd4a, 0x06ff24ae, 0x90142313, 0x2a2627ae, 0x4a354a01, 0xac90d9fe, 0x262ac022, 0x3420ac96,
+    0x71203082, 0xf753aa91, 0x0018220a, 0x0a395931, 0x44181520, 0x3529081b, 0x15163233, 0x33110111, 0x37601815, 0x3435260d, 0x32013b36, 0x05a14416,
+    0x0a0e282b, 0xa00e0a30, 0xfe130de0, 0x240583e0, 0x0e0e0a28, 0x2014850a, 0x841a8460, 0x48012a10, 0xff0d1360, 0xfe480100, 0x210882b8, 0x19880001,
+    0x08000022, 0x2e089362, 0x001b000f, 0x00330027, 0x004b003f, 0x4c67005b, 0x5e181137, 0x27200b61, 0x2505ce56, 0x22012b34, 0x0ba21715, 0x0fc1ac18,
+    0x71590520, 0x0b035d0a, 0x08100124, 0x028208e0, 0x1008e823, 0x06d15308, 0x28250690, 0x07d00709, 0x87048409, 0x8401202e, 0x130d2adf, 0x00010d13,
+    0x00ff130d, 0x20008308, 0x09d05c48, 0x05864d85, 0x83303021, 0x2004833d, 0x4c278479, 0x27220ebf, 0xbf4c3f00, 0x011f3609, 0x2f013e16, 0x2e363701,
+    0x27010f01, 0x1f010e26, 0x1e060701, 0x08f26801, 0x8f273721, 0x013f221a, 0x22328217, 0x8291ce91, 0x1d982c02, 0x07051107, 0x06071c1c, 0x871d080f,
+    0x1005290b, 0x26346308, 0xd3263426, 0x24841891, 0x2006bb4c, 0x86368d3e, 0x06042242, 0x223a82ad, 0x889d3426, 0x8418884f, 0x07a3474e, 0x0002be3e,
+    0x0800c001, 0x45003d00, 0x17250000, 0x2f010e07, 0x0e373602, 0x27222301, 0x2606010f, 0x262ad282, 0x3f362627, 0x16173601, 0x0f743717, 0x06173408,
+    0x22302707, 0x07312230, 0x36323316, 0x011f3637, 0x4c26011e, 0x0131062f, 0x010737c9, 0x3736070e, 0x8228522c, 0x4732344a, 0x08548236, 0x2147075d,
+    0x06030317, 0x0e090c1c, 0x380c4414, 0x340c3850, 0x02333023, 0x22234302, 0x081f6439, 0x04061c0d, 0x13131aea, 0x6068131a, 0x0308083a, 0x7e115f17,
+    0x7b13483e, 0x08080317, 0x221c7c3a, 0x10030d06, 0x12150d08, 0x28181676, 0x18283838, 0x0d245916, 0x370c7458, 0x0f070d2f, 0x82b40d04, 0x1a132337,
+    0xcf4e0000, 0x01012f05, 0x003300a1, 0x0100004a, 0x14011d16, 0x894d3507, 0x87062005, 0x27262108, 0x26351186, 0x3e34013d, 0x17323303, 0x32333637,
+    0x1516011f, 0x32040714, 0x221c8236, 0x18060727, 0x2108b97f, 0xd5822326, 0x51af0128, 0x0e140e48, 0x04823c34, 0x82343c21, 0x48320804, 0x2d523e30,
+    0x6e373913, 0x04090504, 0xfe070309, 0x2e7aacb1, 0x04057628, 0x02090509, 0x181a4907, 0x46017a56, 0x2ea0391d, 0x0e0a6620, 0x0f770a0e, 0x07836802,
+    0x0f026823, 0x2d078377, 0xa02e2066, 0x0d162d1e, 0x03470a02, 0x43820d07, 0x25c50529, 0x091b101b, 0x8208034d, 0x0508260d, 0x3526022f, 0x08ef4a00,
+    0xa001402a, 0x16000b00, 0x28001e00, 0x5e18d782, 0x36360d51, 0x010e012f, 0x17161415, 0x37321636, 0x0622012e, 0x26353707, 0x11820722, 0x17363224,
+    0xcc85013e, 0xa9161724, 0x0282a9ee, 0x08cd2708, 0x44381a0f, 0x3c153b46, 0x22061f3c, 0x7d06222a, 0x26204020, 0x3a2f2634, 0x1a384447, 0x0106080f,
+    0xc0354ba0, 0x04834b35, 0x1d532308, 0x260a2c1b, 0x0a261716, 0x14031910, 0x8d141919, 0x0d03030d, 0x6d26261a, 0x1617260a, 0x1b2c0a26, 0x6e18191d,
+    0x20250acb, 0x06010000, 0x05226b0f, 0x06070623, 0x0a226b23, 0x3e373633, 0x09000206, 0x0e516a2d, 0x3a659310, 0x39403e4b, 0x081b6b07, 0x05040234,
+    0x4f5b4432, 0xc0012c56, 0x19356e7d, 0x08313116, 0x186b3907, 0x2eb32a08, 0x38573322, 0x0512182e, 0x05b35900, 0x01800130, 0x001100c0, 0x0029001d,
+    0x005d0054, 0x64181300, 0xfa82109e, 0x32013b22, 0x25119b5d, 0x2e272213, 0x386b0701, 0x182b2005, 0x2e07fc51, 0x17013f36, 0x31321716, 0x36013f32,
+    0x82161732, 0x34362d38, 0x16132326, 0x3523011d, 0xe0173233, 0x083d6418, 0xc80a0e23, 0x064261a0, 0x82085021, 0xc1230808, 0x2b090307, 0x22060e0e,
+    0x08031206, 0x0909070c, 0x170e0c07, 0x03110b04, 0x040a010b, 0x030e0308, 0x832f1b0c, 0x18492015, 0x290e5964, 0x0e0ad001, 0x08081048, 0x05850810,
+    0x0600ff38, 0x290c0912, 0x08361111, 0x10090e09, 0x0a321f0e, 0x060f0901, 0x0d821806, 0x07170126, 0x0780060a, 0x240d4b4b, 0x00270011, 0x24f79330,
+    0x2b263613, 0xd3451801, 0x1f06250a, 0x37321601, 0x4c32ca95, 0x410b0808, 0x07200709, 0x080b4109, 0x0e056008, 0xa792ad05, 0x07a5fe24, 0xc4835014,
+    0x07145027, 0x01050560, 0x368e8552, 0xff000003, 0x014702c0, 0x000800c0, 0x00330017, 0x23150100, 0x82323335, 0x1617276e, 0x2606010f, 0x0e82013d,
+    0x3634352e, 0x16140517, 0x1415013b, 0x22212306, 0x2006095d, 0x08118415, 0x0622232b, 0x80800115, 0x62070a06, 0x0c0cbb07, 0x40140760, 0xfe071440,
+    0xb00709e5, 0xb0fe0a0e, 0x0a0e0e0a, 0x880a0ec8, 0x010907b0, 0x22ff8246, 0x82c40762, 0x20b18324, 0x23ad8340, 0x8809077c, 0x01232283, 0x820e0ad0,
+    0x09802508, 0x00000007, 0x00209385, 0x09229382, 0x93831200, 0x180af95e, 0x2113c966, 0x8a18013d, 0x11270d19, 0x013b3634, 0x82707010, 0xf00122ed,
+    0xc2661807, 0x8280200d, 0x20a584fd, 0x20978280, 0x053658a0, 0x6618b720, 0x88200dc3, 0x60209883, 0x0123a586, 0x820e0a08, 0x82002092, 0xc0ff2397,
+    0x93828001, 0x0c000333, 0x2a001e00, 0x42003600, 0x00005200, 0x35231525, 0x5c959325, 0xc04205f3, 0x0b544717, 0x5508e741, 0x3525058b, 0x01c02001,
+    0x42b78e19, 0x01210fb2, 0x05c04200, 0x2606f14d, 0xc00907e0, 0x8d974040, 0x0f9e42c8, 0x20067260, 0x08154ad0, 0x0522d882, 0xd7860000, 0x1a00082b,
+    0x32002600, 0x00006c00, 0x4dcfa501, 0x15200a5a, 0x21392e65, 0xea9e7901, 0x202a1f65, 0x8e681801, 0x059a4312, 0x08085827, 0xfe080810, 0x120465e8,
+    0x08081823, 0x21169518, 0xc77c0000, 0x44012005, 0x3b2405a7, 0x4c004300, 0x2414ad43, 0x27010f26, 0x0ec64136, 0x33013d23, 0x076b5917, 0x2a064b59,
+    0x23012f36, 0x16323335, 0x43370614, 0x94440765, 0x0c45350c, 0x21211e0b, 0x07501b25, 0x10070909, 0x3b130907, 0x0b0b0b1e, 0x1e201482, 0x0b220482,
+    0x0d821e0b, 0x30308022, 0xc9201c82, 0x25056f43, 0x0e0a3801, 0x3f43b8fe, 0xc5fe2107, 0x21242282, 0x251b2612, 0x23067b54, 0x0c1e3b30, 0x0c233e82,
+    0x830c1e1e, 0x2a3e8307, 0x0e092037, 0x80069609, 0x86076207, 0x410231db, 0x3600c001, 0x44003f00, 0x00004e00, 0x33171637, 0x2212e443, 0x45261507,
+    0x1e26166f, 0x36013f01, 0xce871332, 0x17370732, 0x16252307, 0x27010f14, 0x17323637, 0x801a0cda, 0x210b0544, 0x68450680, 0x04162516, 0xa90e0308,
+    0x6031d585, 0x45a244a3, 0x07071901, 0x071c441c, 0x17180815, 0x05cc4a01, 0x24052244, 0x01527f2f, 0x0f654505, 0x0f0a0225, 0x84280106, 0xa2eb26d6,
+    0x08f9a344, 0x823c8415, 0x420320e3, 0x6b4508df, 0x36322a19, 0x2226012f, 0x1606010f, 0x57dc183b, 0xe9f61809, 0x0ca14108, 0x61454120, 0x45602006,
+    0x6a180873, 0x01200f6d, 0xfe27a682, 0x600714a0, 0x45600505, 0xf7200771, 0x2005fa45, 0x2b8b8202, 0x010002bf, 0x001700c7, 0x25000026, 0x2009e75f,
+    0x474d183f, 0x36372e07, 0x37131732, 0x16170727, 0x2f220614, 0x08938201, 0xf7010726, 0x1cde0909, 0x1c751c50, 0x0c565f1c, 0x0b0c160c, 0x1b095256,
+    0xa3315b09, 0x12093b3b, 0x513b091b, 0xe702050e, 0xde211182, 0x2023821c, 0x20248250, 0x2024820b, 0x2324820c, 0x30e9fe09, 0x1b262483, 0x523b0912,
+    0x7b46050d, 0x40022109, 0x0a248382, 0x31002200, 0x15208583, 0x26256a82, 0x3f363435, 0x2890a501, 0x25400002, 0x10202536, 0x2a97a207, 0x1b235d80,
+    0x101b2525, 0xa57f1840, 0x062708a1, 0xc0fffeff, 0xc2010102, 0x2d000d00, 0x5c004100, 0x88006b00, 0x32360000, 0x07161516, 0x26222306, 0x34273637,
+    0x82011e37, 0x020e240d, 0x83012e27, 0x2726230e, 0x0f830622, 0x0e840120, 0x2636262c, 0x0607011e, 0x14071617, 0x2185010e, 0x32823482, 0x15141724,
+    0x12870714, 0x27012e2e, 0x2e060722, 0x36373601, 0x14151605, 0x352a5983, 0x3e262734, 0x16271601, 0x5456010e, 0x18448205, 0x2107f2a6, 0x4382013d,
+    0x1e173408, 0x0e14f601, 0x12051f02, 0x1e020b0f, 0x3e2b1702, 0x04010c01, 0x0c09090e, 0x22010b02, 0x011e1917, 0x1311020f, 0x010e020b, 0x0f493b01,
+    0x011d0602, 0x84050b01, 0x0a73081e, 0x06280101, 0x016d4c89, 0x0b0e0106, 0x06020d0a, 0x39510101, 0x11091012, 0x18090b05, 0x0e061201, 0x050e0a0a,
+    0x11130b02, 0x10040626, 0x5d1e0514, 0x393c5834, 0x010a0e01, 0x47010d0a, 0x713f6c4b, 0x720a0eca, 0x0915126e, 0x600a6b69, 0x4d2a3c01, 0x0809044b,
+    0x0a100201, 0x20174847, 0x4d152001, 0x040b094c, 0x49460a10, 0x0d1a3c29, 0x2e230813, 0x85033c3e, 0x37410820, 0x08313f39, 0x4a6b013a, 0x3536030a,
+    0x01010e08, 0x39380a10, 0x04014f37, 0x11140a02, 0x1c7a0502, 0x0f0e0a2c, 0x0a172709, 0x510b0411, 0x030b1408, 0x01312a09, 0x52393c01, 0x0f0e0918,
+    0x4866150a, 0x080d824a, 0x00000028, 0x00feff02, 0x01400220, 0x00180060, 0x01000020, 0x14021e32, 0x2223020e, 0x06072726, 0x27013f26, 0x011f3626,
+    0x5c18013e, 0x3508080e, 0x40613047, 0x61402828, 0x26703e30, 0x02140958, 0x14021919, 0x7026570a, 0x0f0f138c, 0x60010e13, 0x1a333729, 0x3c293733,
+    0x0b07422a, 0x0a6e6e0a, 0x2a42070b, 0xff53b83c, 0xcb52180a, 0x50172009, 0x00200685, 0x20078e7d, 0x061b5f26, 0x08216118, 0x2706d057, 0x2b343217,
+    0x33142201, 0x2207d44f, 0x18144e01, 0x320958ba, 0x9191ce11, 0x2a5091ce, 0x3c2a2a3c, 0x801010be, 0x83821010, 0xf82a210a, 0x27837384, 0xce140e22,
+    0x91212182, 0x829482ce, 0x20f82325, 0x2c846820, 0x8418fb82, 0x1d220d7b, 0x274e2500, 0x87162009, 0x5a53187b, 0x82372009, 0x0668547f, 0x91354f84,
+    0x131a1388, 0x09a81a13, 0x3d05010d, 0x01053d3c, 0x3431090d, 0x20128329, 0x06f14d13, 0x0c842a20, 0x0c03d72b, 0x21221b09, 0x030c091c, 0x8232850f,
+    0x0200337a, 0xc0fffaff, 0xc0010602, 0x1b001700, 0x07010000, 0x8a523315, 0x21072713, 0xf6012117, 0x775238d6, 0x10d63107, 0xbc011711, 0xfe4a1117,
+    0x18013088, 0xc0d68601, 0x2c056a52, 0x2a10d6c0, 0x0030062a, 0x00000200, 0x076341ff, 0xcf896a20, 0x36340527, 0x012e013b, 0x058e5027, 0x28054351,
+    0x1614011d, 0x1f32013b, 0x22058301, 0x82141516, 0x012f2515, 0x22012b26, 0x1b860882, 0x07821620, 0x33161728, 0x36013f32, 0x18523637, 0x013d2205,
+    0x82238334, 0x20108329, 0x843e8333, 0x4135201f, 0x01360514, 0x12070998, 0x093b590e, 0x05081906, 0x0e060308, 0x5a07090c, 0x01820506, 0x09070a25,
+    0x82062f0b, 0x0d2e0810, 0x1b0f1201, 0x19172016, 0x08080907, 0x0d080f11, 0x01040e0b, 0x13020104, 0x08070903, 0x040d0508, 0x02030705, 0x13040403,
+    0x03040503, 0x4c41090f, 0x07473206, 0x09523a09, 0x07090715, 0x0401050c, 0x07040c03, 0x38558209, 0x030c0609, 0x07030210, 0x10150b06, 0x20170e1b,
+    0x131d0709, 0x140c0f11, 0x26458210, 0x19030416, 0x820b0504, 0x06142f31, 0x0101020f, 0x02030c03, 0x000a0408, 0x23410300, 0x005f220a, 0x0a25416e,
+    0x34353622, 0x2b23d882, 0x4e012e01, 0x744e0859, 0x013b2305, 0x1d533632, 0x210b8207, 0x0d83013f, 0x82023f21, 0x07062c05, 0x2f061415, 0x16070601,
+    0x5a1f1617, 0x1d2705dc, 0x1e171401, 0x41150701, 0x37230536, 0x82173736, 0x07272657, 0x06010f06, 0x41228214, 0x21080628, 0x0e090e4a, 0x04430d09,
+    0x0e100616, 0x1f08070b, 0x05060203, 0x06030209, 0x0f020405, 0x020a0201, 0xae820904, 0x06063208, 0x0a060604, 0x1d0b0b05, 0x080f0c0c, 0x19204718,
+    0x010a0809, 0x1f12110f, 0x0d0b0910, 0x11161501, 0x05010401, 0x021d5f03, 0x04060d15, 0x12040413, 0x062f4105, 0x130ed523, 0x2b60820d, 0x06071e02,
+    0x03090703, 0x0804010a, 0x1f23fd82, 0x82040201, 0x0802215b, 0x30085889, 0x090b0201, 0x1f0c0409, 0x0c0d2647, 0x090d0109, 0x13091109, 0x0b090d20,
+    0x051b0a1f, 0x070e022f, 0x08640304, 0x2a2f0b0f, 0x1e050306, 0x1b060e06, 0x0c3f4108, 0x6d003822, 0x21093f41, 0x9f4d3717, 0x013d2206, 0x05835a34,
+    0x2223262c, 0x17141506, 0x013f3233, 0x69421636, 0x85362005, 0x2310821c, 0x35173233, 0x064e2783, 0x010f2505, 0x22012b06, 0x42088142, 0x32850584,
+    0xfa4f3320, 0x05794106, 0x08053f41, 0x0111ed53, 0x05020106, 0x0b090803, 0x1f330304, 0x0375531f, 0x1305073e, 0x17020803, 0x07060a04, 0x06050509,
+    0x07050506, 0x0c05b009, 0x03060402, 0x03010401, 0x06010204, 0x030c0502, 0x03021802, 0x0c030627, 0x020a0704, 0x03031602, 0x050d080b, 0x05070f06,
+    0x073b4109, 0x021d5f32, 0x4e080403, 0x0206040a, 0x0a260309, 0x110f5375, 0x01275982, 0x09092d04, 0x85070907, 0x18663c59, 0x030c0407, 0x03040d03,
+    0x0d02030e, 0x02110105, 0x06021001, 0x0c02030a, 0x82010605, 0x204d8250, 0x20008200, 0x0a6b420d, 0x15000e28, 0x21001d00, 0xff6b2500, 0x00352606,
+    0x0044003d, 0x0a3f414b, 0x15233525, 0x58331614, 0x362006c7, 0x82078344, 0x21128215, 0x078e1715, 0x83070f45, 0x32332217, 0x05984336, 0x1d411520,
+    0x28903205, 0x08080d13, 0x1320130d, 0x1a13131a, 0x30303035, 0x20038670, 0x2210831b, 0x82286013, 0x4222821c, 0xf720062c, 0x38200e83, 0x95203383,
+    0xe0231e84, 0x8d382828, 0x13682102, 0x93241883, 0x25132808, 0x28213982, 0x0d3b4500, 0x3b451720, 0x5204200b, 0x68520660, 0x32142d07, 0x26363736,
+    0x27220607, 0x16170626, 0x01209f85, 0x0b233819, 0x0759602c, 0x2f090d01, 0x0d092f98, 0x91860701, 0x6f841720, 0x0282bb82, 0x2736ed2c, 0x0f030c09,
+    0x090c030f, 0xb7450027, 0x0015240e, 0x41310023, 0x252e0941, 0x17160706, 0x36373216, 0x26272637, 0x0d8c0722, 0x87931220, 0x010f3827, 0x15060f01,
+    0x20068505, 0x200d8ca5, 0x2698932b, 0x22211610, 0x90090915, 0xd0fe2105, 0x1f41a58c, 0x0017240b, 0x89350027, 0x22242ba3, 0x16140706, 0x3236013f,
+    0x5e46011f, 0x210f8a07, 0xa7930626, 0x23265b2f, 0x0a030c02, 0x090d260c, 0x02010d03, 0x200e8dc3, 0x2ea99316, 0x071e2901, 0x16110503, 0x03051116,
+    0x8c291e07, 0x8bef200d, 0x052308ac, 0xc8ff0000, 0xc101f801, 0x1d000b00, 0x3d002d00, 0x00004b00, 0x35262200, 0x32363734, 0x14151617, 0x82373207,
+    0x22062c05, 0x33363426, 0x15061732, 0xac261614, 0xdc0136c3, 0x022a1c28, 0x302a0208, 0x91140b09, 0x679191ce, 0x2f083e4a, 0x9dc38d4c, 0x1c402fd2,
+    0x03371713, 0x13173703, 0x3330033c, 0x45829167, 0x0e122925, 0x88082e21, 0x040621d6, 0x0d83e48b, 0x3742e48c, 0x0019240e, 0x41390027, 0x172e0993,
+    0x011f1606, 0x36013f16, 0x06262726, 0x0482010f, 0x250d2d42, 0x27013e25, 0x1882012e, 0x07012e24, 0x2a82010e, 0xc7423720, 0x055a3205, 0x0846100e,
+    0x11041402, 0x04180e10, 0x1a0e0702, 0x0d8a4169, 0x0e100e31, 0x0e1a0505, 0x18040207, 0x0411100e, 0x42080214, 0x1f3306e0, 0x12041c0f, 0x0f460802,
+    0x1103021b, 0x0402080d, 0x41fbfe0d, 0x932e0a94, 0x0e0f1c04, 0x0802040c, 0x0302110d, 0x63820f1b, 0x0d4b4618, 0x21001424, 0xbf892f00, 0x14060522,
+    0x362a9482, 0x3637012f, 0x17010f26, 0xcb830607, 0x012f3424, 0xc78d0626, 0x012db585, 0x5006061a, 0x21070e08, 0x080e0721, 0x200584f3, 0x20118450,
+    0x20bc8d58, 0x2d2e84b8, 0x030e032d, 0x080f0530, 0x0f082828, 0x05841205, 0x12853020, 0x42f0fe21, 0x062c0cf3, 0xbfffffff, 0xc1010102, 0x17000b00,
+    0x3c379d82, 0x59004900, 0x22010000, 0x37363726, 0x14163236, 0x32010607, 0x54060716, 0x36270575, 0x16373601, 0x4427020e, 0x0724051c, 0x17023e26,
+    0x16211982, 0x29bb8527, 0x2e022f26, 0x011e0701, 0xd083013f, 0x1f16062b, 0x27013e02, 0x0e070626, 0x31028201, 0x36321617, 0x06059a01, 0x0e100b01,
+    0x110e1d2a, 0x0b8585fe, 0x0e1e2931, 0x217f0111, 0x79142918, 0x050747a8, 0x8a171902, 0x1787330b, 0x5a070901, 0x340a020a, 0x5d140105, 0x17021401,
+    0x0f850a02, 0x1922dc38, 0x04120517, 0x082c6b17, 0x3c150802, 0x05500140, 0x0e104805, 0x5982291e, 0x0a88d620, 0x050a012d, 0x79a84707, 0x20192914,
+    0x8a021f11, 0x5b28230b, 0x4c820a06, 0x05011426, 0xf0020a34, 0x5a216082, 0x2f0f8607, 0x24612260, 0x2c080107, 0x1204176b, 0x001c0f05, 0x240e8342,
+    0x002e0020, 0x09c34147, 0x8d581720, 0x3f163005, 0x36161701, 0x3637012f, 0x26022f26, 0x41010f22, 0x25200dc1, 0x02201686, 0x91222d8d, 0x028291ce,
+    0x03055f39, 0x01061a03, 0x1f1f0507, 0x06010804, 0x0503031a, 0x0a020f23, 0x41460f02, 0x27200dd8, 0x23201888, 0x05233189, 0x42060107, 0x1039069c,
+    0x19030901, 0x02060423, 0x06021111, 0x03192304, 0x20050109, 0xfe200404, 0x0af041f4, 0x1587c420, 0x2d8d0520, 0xff060038, 0x02c8ffff, 0x00b80181,
+    0x0017000b, 0x00450035, 0x00630055, 0xfb413700, 0x1605390a, 0x27220614, 0x36262726, 0x16071617, 0x31011e17, 0x2622010e, 0x37363027, 0x24060e42,
+    0x1632013e, 0x201f8217, 0x2d694406, 0x08426620, 0x02280809, 0x291e0e53, 0x010a110e, 0x72480506, 0x0201180c, 0x73887320, 0x18010220, 0x1719020c,
+    0x8d0a0d0b, 0x0d0a8dbe, 0x4b1c140b, 0x202a8644, 0x080d42c0, 0x290e1126, 0x47110e1e, 0x03216e83, 0x235c8252, 0x39444439, 0x52295b82, 0x02021f11,
+    0x7f7f5d02, 0x2106825d, 0x9c44621c, 0x00042829, 0x01bfff00, 0x77b801f0, 0x73670605, 0x14152605, 0x3d360706, 0x05134101, 0x23053f47, 0x17141517,
+    0x21133b6f, 0x19821607, 0x22230623, 0x322e8226, 0x1f163633, 0x3f321601, 0x91013e01, 0x485991ce, 0x47062a09, 0x062a0860, 0x5948092a, 0x13131a9b,
+    0x985d131a, 0x03033e05, 0x1a1b2610, 0x0b011225, 0x02010315, 0x0301020e, 0x91b80115, 0x1b7e4f67, 0x1b2e1414, 0x07794724, 0x2e1b2429, 0x7e1b1414,
+    0x4757674f, 0x9a320a99, 0x1b400801, 0x3f1a2725, 0x0b0b0509, 0x08070708, 0xe3420b0b, 0x29cb8506, 0x00340016, 0x004e0041, 0x9d952500, 0x16320222,
+    0x1731e29a, 0x012f3436, 0x011f0626, 0x3f160607, 0x36372701, 0x06414b26, 0x25013622, 0x8920b491, 0xd620e994, 0x210ee944, 0xe944090d, 0x91492005,
+    0x6a0121b9, 0x4120f59a, 0x22180445, 0x41050000, 0x073308bb, 0x35002500, 0x54003d00, 0x32000000, 0x22061416, 0x9d263426, 0x095f4ee2, 0x4e05dc58,
+    0x17200661, 0x4e152f41, 0xaf2006fa, 0xc020ea94, 0x0dde6118, 0x34880b23, 0x207e8226, 0x1129410d, 0x0e080127, 0x140e0e14, 0x20ee9abe, 0x00621850,
+    0x3009210b, 0x26224782, 0x32418d34, 0x0d934611, 0x1f000f25, 0x18002d00, 0x21080f8a, 0x014a3412, 0x8e372005, 0x260725e3, 0x011e1706, 0x1807e448,
+    0x200aa062, 0x25c08ebb, 0x010d09e9, 0xb9445907, 0xa1621807, 0x0607330c, 0x18120809, 0x08091218, 0x09090906, 0x090c0361, 0x9a443627, 0x05876f05,
+    0x01200026, 0x006001c0, 0x2f299183, 0x4f003f00, 0x00005f00, 0x145a1837, 0x200f9d0f, 0x0ed87833, 0x6a05756d, 0x3f8d0b29, 0x0d603326, 0x400d1313,
+    0xe0200483, 0xc1700992, 0x201e9805, 0x843a86a0, 0x20049120, 0x2a1e9dc0, 0x00060000, 0x01e0ff00, 0x8da00140, 0x0f2967f3, 0x08ce8018, 0x3d262226,
+    0x33363401, 0x01200f8f, 0x1f8fd38e, 0xf3890f8f, 0xbc5fb391, 0x20b89a05, 0x95f48a01, 0x4001210a, 0x21953e89, 0xff710020, 0x413b2010, 0x332420e9,
+    0x17163202, 0x081f4318, 0x2b0d016c, 0x130da036, 0x1b100d13, 0xe01b2525, 0x10200483, 0xc92b0e83, 0x090394d2, 0x09071007, 0x847aac7a, 0x82032007,
+    0x0d80278c, 0x401a2613, 0x0484261a, 0x820d1321, 0x00012d0e, 0x07706997, 0x70070909, 0x567a7a56, 0x69200985, 0xc02a9f86, 0xc0010002, 0x1f000f00,
+    0x9f824600, 0x36227c89, 0x8c82013b, 0x8e412320, 0x07624205, 0x34209f8a, 0x15252084, 0x35363233, 0x06105f34, 0x21078242, 0xa886c036, 0xb020a382,
+    0xb683a784, 0xab82f420, 0xb625352c, 0x141c1c14, 0x661c1420, 0xb3881911, 0x0d70f02c, 0x301b2513, 0x9d13251b, 0x0b870d13, 0x97600128, 0x3525a669,
+    0x2f82281c, 0xa4111923, 0x82b98302, 0x2ae582e8, 0x00030069, 0x02c0ff00, 0x82c10121, 0x00112909, 0x1500001b, 0x13071737, 0x39080382, 0x07012f06,
+    0x26273727, 0x1e253435, 0x27010f01, 0x17163637, 0x19234344, 0x1023ad29, 0x60332b16, 0x01020d33, 0x0f020fa0, 0x10c7a9aa, 0x4620102b, 0x10012343,
+    0x112aad23, 0x1b820d07, 0x06052b24, 0x1682ac10, 0xaaa9c722, 0x00202282, 0x08200082, 0x00356784, 0x1300c001, 0x3b002700, 0x53004700, 0x6b005f00,
+    0x00007300, 0x84ed1801, 0x1817200c, 0x82071d85, 0x3b362515, 0x16173201, 0x06230183, 0x4222012b, 0x61180697, 0x32230901, 0x7f07011f, 0xbb7f16af,
+    0x330b8b0b, 0x34262200, 0x14163236, 0x1b059e01, 0x0a01072b, 0x020e1007, 0x6e200988, 0xac2f1392, 0x1b25130d, 0x251b80fe, 0x152b1b25, 0x62806f11,
+    0x602005e3, 0xfe2e0693, 0x252536bb, 0x0e012536, 0x3e241628, 0x06940b07, 0x0d134023, 0x067742a0, 0xb8530d25, 0x93080870, 0x40012102, 0x25224682,
+    0x33410036, 0x01403705, 0x002d00c0, 0x004d003d, 0x006d005d, 0x00830073, 0x01000093, 0xb7761123, 0x3e641808, 0x013b220f, 0x066b4211, 0x07434718,
+    0x41180520, 0x162211d3, 0x4e50013b, 0x06222207, 0x201f8e27, 0x2b1a8917, 0x1614011d, 0x34331733, 0x25062226, 0x2110245b, 0xb7722634, 0x84142005,
+    0x3002274d, 0x09071010, 0x8f660709, 0x72f02005, 0x0221095e, 0x210b8220, 0x0019c9fe, 0x33221e87, 0x21860805, 0x38c03326, 0x00013850, 0x01252f93,
+    0x0980fe80, 0x204f8207, 0x21528250, 0x0a845007, 0x78180120, 0x2d210ae8, 0x20458726, 0x20098865, 0x2009885b, 0x23528998, 0x38382880, 0x09892289,
+    0x77180020, 0x162d0cd3, 0x36001e00, 0x4b003f00, 0x26010000, 0x06837a3d, 0x1e171422, 0x09f07c18, 0x1f360527, 0x27222301, 0xd87c1836, 0x2726210b,
+    0x03212b89, 0x221f8332, 0x1832012f, 0x2b08ce48, 0x01012f22, 0x30083cbc, 0x1e1a2808, 0xfe2a0582, 0x711824e3, 0x5a809759, 0x7c18cf01, 0xb73c0af1,
+    0x5976141d, 0x0175141d, 0x0e0a5601, 0x1e110a0e, 0x0b017613, 0x0842412a, 0x1c2c3e08, 0x07c37c18, 0x1b069927, 0x01385084, 0xf57c1821, 0x8a162a12,
+    0x0a0e8a16, 0x160e0a70, 0x0fbf478a, 0x34002c22, 0x57098f4c, 0x172507f4, 0x35362734, 0x21b88234, 0x495a1f06, 0x86142005, 0x37162307, 0x1157023e,
+    0x05564a0c, 0x2323a82d, 0x03061f29, 0x15151106, 0x83050511, 0x220c8205, 0x570b291f, 0x444a0b1a, 0x16af3e05, 0x10160e0e, 0x0d01011b, 0x19090703,
+    0x0b020709, 0x1a090702, 0x0e020808, 0xab1b0201, 0x4d308313, 0x17200f33, 0x8f72a182, 0x3616240b, 0x50012e35, 0xab9a0a8c, 0x8d370121, 0x9117232c,
+    0x028291ce, 0x0c03d12e, 0x23262302, 0x09030c02, 0x680d260d, 0x4120bc95, 0x254d248c, 0x504b2006, 0xb9200c72, 0xb720cc9b, 0x47422a8c, 0x01c83206,
+    0x00b801fc, 0x00250011, 0x004a002d, 0x2500005a, 0x068b6916, 0x36373625, 0x82011f16, 0x16072304, 0x55180615, 0x2625091f, 0x07012e23, 0x0d501806,
+    0x0f974107, 0x41010e21, 0x01200997, 0x080d5e52, 0x0116062f, 0x121107f5, 0x17030a53, 0x11131405, 0x0803041c, 0x17ab1f10, 0x9167342f, 0x1191ce91,
+    0x5415080b, 0x1aa01117, 0x131a1313, 0x29232398, 0x25ad821f, 0x11151511, 0xbe410104, 0x10250809, 0x0b270b0a, 0x010e0709, 0x25282503, 0x2e0f0103,
+    0x16052112, 0x12530902, 0x13020320, 0x05020910, 0x01540b0f, 0x294d8215, 0x2c2e6791, 0x23022503, 0x4d827f1c, 0x411a1321, 0xc2211ce3, 0x4a008209,
+    0xeb41086a, 0x000f210f, 0x2d1c5754, 0x37363217, 0x21232636, 0x1e170622, 0x57543301, 0x37382e12, 0x0a010751, 0x07f2fe07, 0x5107010a, 0x06b54137,
+    0xbf4c0720, 0x48fd280a, 0x0b0b0736, 0x54483607, 0xaf530ccf, 0x0605210e, 0x8e0eac53, 0x8805200f, 0x013b2384, 0x87863632, 0x0d011022, 0x2309ad53,
+    0xa2232623, 0x01210f8e, 0x22998a1d, 0x86513710, 0x5336209c, 0x292218b1, 0xaa858129, 0x0752ab8d, 0x52a59428, 0x01211707, 0x209d941f, 0x18044d11,
+    0x9b93ae20, 0x0f4c1720, 0x07617d05, 0x180f4741, 0x41098b8f, 0x3f4107c4, 0x010c360a, 0x0b0a060f, 0x06090c26, 0x2503010f, 0x1a5a2528, 0x131a1313,
+    0x249694c7, 0x06090835, 0x4c008209, 0x1c200513, 0x13222782, 0x90877f1a, 0x280cb345, 0x00130009, 0x004c0041, 0x956b1850, 0x25152a0a, 0x012b0614,
+    0x16323335, 0x082d4b15, 0x2305ed54, 0x23373435, 0x8b180989, 0x012310ec, 0x49112315, 0x072b069e, 0xe0152335, 0x0d13130d, 0x82400120, 0x0d202704,
+    0x09073013, 0x8b180709, 0x013016fc, 0x141cc060, 0x301c1460, 0x0d138060, 0xe0130da0, 0xe0302f82, 0x00ff0d13, 0x07200709, 0x14080809, 0x08141c1c,
+    0x07850082, 0x01070923, 0x038c1870, 0x20012408, 0x831001e0, 0x30303517, 0x00040030, 0x02beff00, 0x00c00140, 0x0016000b, 0x00290020, 0x0805797f,
+    0x22060762, 0x34352627, 0x17163707, 0x26060715, 0x0434013d, 0x37363732, 0x16352715, 0x16362517, 0x0f14011d, 0x68ec1101, 0x0e05724a, 0x778e7205,
+    0x088a0e07, 0x2c0a010e, 0xc01a210f, 0x2f01211a, 0x8c140e08, 0x344ac001, 0x0606863e, 0x8e343e86, 0xe9191630, 0x080a033f, 0x118816fa, 0x40f62528,
+    0xb62825b6, 0x08240e84, 0x00200138, 0x87065f41, 0x00132487, 0x5728001e, 0x15210691, 0x46898614, 0x91a50749, 0x19226d26, 0xe2192219, 0x5e20979f,
+    0x19222482, 0x9d9e4922, 0x0b6fb418, 0x00001e2d, 0x0717013f, 0x26060706, 0x62003637, 0x272405cc, 0x012f0607, 0x3f087670, 0x4b804b5e, 0x100c7251,
+    0xbe010d01, 0x80a51b35, 0x0c571362, 0x0b0b170b, 0x0c210b69, 0x9e1b1525, 0x0d281e83, 0x720c1001, 0x4b357301, 0x14221f83, 0x1f830b57, 0x0c0c6826,
+    0x001b1524, 0x27080082, 0xfffdff04, 0x010302c0, 0x000900c0, 0x001b0013, 0x13000034, 0x26270706, 0x32013b36, 0x16322517, 0x2726010f, 0x06333637,
+    0x20061d50, 0x15cd5305, 0x3fe04508, 0x09066f2f, 0x0a126f0a, 0x090a5501, 0x3f2f6f06, 0xca120a45, 0x92676792, 0x050d0167, 0x18340705, 0x18030e03,
+    0x05050734, 0x0c010926, 0x062f2f06, 0x0109010c, 0x9f2b0a3d, 0x10101108, 0x2b9f0811, 0xa010730a, 0x672b2d82, 0x0d053692, 0x072f0801, 0x82082f07,
+    0x34252939, 0x19030907, 0x07090319, 0xc75b9782, 0x000f220c, 0x11f94717, 0x4407b741, 0x345205d3, 0x06ae440b, 0x480b0b52, 0x19220d4b, 0x056b2100,
+    0x06142506, 0x17342622, 0x4306027a, 0x0620084e, 0x220ad55f, 0x89273435, 0x14152117, 0x58316d85, 0x22263426, 0x131a1302, 0x10e02202, 0x10108010,
+    0x860f8886, 0x1a47287c, 0x261a2626, 0x7a020612, 0x12240514, 0x702020d6, 0x2621108c, 0x0673681a, 0x0180012b, 0x000f00c7, 0x002a001a, 0x066b4900,
+    0x2507294c, 0x21130133, 0xf0703613, 0x4a072005, 0x01220ec4, 0xa0180770, 0x1131097a, 0x1f00ff1f, 0x0b4d0801, 0x30084d0b, 0x05460508, 0x79048408,
+    0x012d09de, 0x01c5fe5b, 0x4c080c3b, 0x084c0c0c, 0x08574ada, 0x00000025, 0x42000002, 0x2b2d0813, 0x07010000, 0x33363723, 0x011e1732, 0x076d4f07,
+    0x07061423, 0x05dc4c16, 0x36372626, 0x35012e37, 0x2b07a44b, 0x9764f601, 0x090c09cc, 0x12051107, 0x10308c83, 0x05143643, 0xe0070a01, 0x05010a07,
+    0x10433614, 0x01281483, 0x07996383, 0x90240804, 0x3c2d8c84, 0x201b1561, 0x070c0c07, 0x61151b20, 0x8812843c, 0x01002683, 0x000f00c0, 0x20838230,
+    0x29531814, 0x1516210b, 0x22063f4d, 0x5015012b, 0x9d700e00, 0x35363405, 0x0d13a001, 0x130da0fe, 0x60010d13, 0x1b20130d, 0x84283825, 0x8340200d,
+    0x1b252112, 0x01200b82, 0x1c820a84, 0x200d132b, 0x28401b25, 0x0d132038, 0x821d8380, 0x222f8204, 0x7a000d13, 0x2d080fff, 0x001c0017, 0x0038002c,
+    0x00450040, 0x37361300, 0x33010f06, 0x17261716, 0x3327012e, 0x3e27010e, 0x011e3701, 0x3736011f, 0x32130633, 0x42181516, 0x34250849, 0x32013336,
+    0x055f4c36, 0x62161421, 0x37250816, 0x26231716, 0x0ffb7a82, 0xf17a1e20, 0x0c122505, 0x6a082702, 0xfe298d83, 0x25251ba0, 0x0710011b, 0x06626909,
+    0x4b6a3b2c, 0xa94b6a4b, 0x0227082d, 0xfb7a1001, 0x7a68200d, 0x662505f3, 0x0131291d, 0x05297f01, 0x80273a82, 0x60fe251b, 0x82090e09, 0x82602002,
+    0x6a4b2639, 0x2931158b, 0x08634100, 0xcc010725, 0x44001700, 0x0f22076b, 0x43742701, 0x06222a06, 0x07171415, 0x01363727, 0x2c948236, 0x544f2701,
+    0x0f052163, 0x065d05b1, 0x33978202, 0x5d02131a, 0x01053b05, 0x165d2331, 0xa562c724, 0x0f546321, 0x5d340f82, 0x131a1302, 0x06020d13, 0x0fb1055d,
+    0x1e270401, 0x62b72854, 0x01226b89, 0x6b82c101, 0x00002129, 0x07173713, 0x8e050706, 0x3613216b, 0x0809b267, 0x8097892a, 0xfe20092b, 0x0a960fe8,
+    0x1c1c140b, 0x96051c28, 0x010b5d0f, 0x390e0e8a, 0x280e3980, 0x2b35010e, 0x0b219780, 0x05960f5d, 0x1c291c82, 0x960a0b14, 0x2018010f, 0x831a824a,
+    0x820e2020, 0xff042574, 0x02befffe, 0x122c7383, 0x24001c00, 0x00003600, 0x34262737, 0x21056a4a, 0x72560607, 0x011f2205, 0x20e38207, 0x280c8232,
+    0x01172714, 0x3f260607, 0x08106701, 0x1882a483, 0x6d013f37, 0x5a090964, 0x22091b09, 0x0b06063e, 0x3e020702, 0x712efe2c, 0x2c6a822e, 0x71c40e2d,
+    0x0b6bd7fe, 0x01130210, 0x222385e4, 0x832c8764, 0x05062425, 0x8264cc3e, 0x095a2132, 0x05203582, 0x34823582, 0x34831220, 0x0e2d0e24, 0x34821e28,
+    0x10021325, 0x850c6b0b, 0x86652321, 0x23823e2c, 0x3e060622, 0x26092b41, 0x00c20180, 0x442e000f, 0x37251101, 0x34013d26, 0x22978236, 0x8627021f,
+    0x17163107, 0x06070616, 0x27262527, 0x09077002, 0xa0fd0709, 0x1d3b0583, 0x27080d0d, 0x661c0308, 0x41080d30, 0x62640309, 0x0d1d1c2b, 0xfe2b2628,
+    0x440b0ee0, 0xf23e0907, 0x09650d0b, 0x020b0209, 0xa41c4308, 0x11030b08, 0x1bc00903, 0x311e1d0b, 0x4e0c0b0b, 0x90820a04, 0xfeff0228, 0x8902c0ff,
+    0x8f82a001, 0x8f923120, 0x36262722, 0x20055341, 0x30098537, 0x011f3233, 0x1e173637, 0x07060701, 0x012b0605, 0x08948b22, 0x054d4122, 0x04280803,
+    0x68480408, 0x0804069d, 0x06040441, 0x2b63db04, 0x19182e2b, 0xddfe2c17, 0x0f82100e, 0x24089b89, 0x1206536b, 0x02021404, 0x07623424, 0x02210412,
+    0x16325203, 0x27310303, 0x07941624, 0x00020000, 0x01d9ff00, 0x26978287, 0x0032002a, 0x7a172500, 0x21470697, 0x79272005, 0x35200790, 0x2b07f548,
+    0x17070614, 0x011f3637, 0x15250716, 0x2a052677, 0x0c4e2d01, 0x0b0c160c, 0x820b4e4e, 0x4e0c2306, 0x7b861380, 0x38289025, 0x85542430, 0xc5fe2715,
+    0x13130d60, 0x0d85600d, 0x31864e20, 0x0750802f, 0x01070909, 0x38090700, 0x05362428, 0x24168554, 0x1a1340b2, 0x0d174c13, 0x2b001b25, 0x59003300,
+    0x1553091f, 0x22062106, 0x23073072, 0x3435012e, 0x4b09595f, 0xc94605ac, 0x36372107, 0x0b297918, 0x27058c63, 0x0e093741, 0x2e642e09, 0x37230582,
+    0x560ab641, 0x39270d84, 0x281c1c28, 0x1807c61c, 0x2a0b3879, 0x0106090c, 0x426791b8, 0x83b42171, 0x13c523b3, 0x0783c513, 0x7121b426, 0x09476742,
+    0x2a08ce4c, 0xc9090906, 0x26263426, 0x18039034, 0x23094c79, 0x00060909, 0x2c056f5f, 0x00b801f0, 0x000f0007, 0x0023001b, 0x097b472e, 0x2b073d61,
+    0x35363206, 0x22262734, 0x14150607, 0x2908e961, 0x27013e16, 0x14222326, 0xee4c3233, 0x5fe4200c, 0x332e065e, 0x1a13131a, 0x1306ca13, 0x462d0505,
+    0xf14c1010, 0x054b6107, 0x415fdd20, 0x82942008, 0x13290824, 0x0408ad1a, 0x20360810, 0x06000000, 0xe0ff0000, 0xa0018002, 0x21001d00, 0x2d002900,
+    0x39003500, 0x16250000, 0x0614011d, 0x2503822b, 0x23352622, 0x05830614, 0x112a0382, 0x21333634, 0x33051732, 0x5d7b2335, 0x35372307, 0x61411523,
+    0x33272d07, 0x75022327, 0x200d130b, 0x80385038, 0x20350382, 0x0d13130d, 0x0e16aa01, 0x606052fe, 0x1c1c284c, 0x60d01c28, 0x2d0784ec, 0x42509230,
+    0x6f110ded, 0x3828130d, 0x03832838, 0x2f822982, 0x608f1124, 0x2782b0fe, 0xd4281c25, 0x86f06060, 0x00002c08, 0x00f9ff01, 0x01800200, 0x823a0083,
+    0x05a8460c, 0x020e232a, 0x22230607, 0x06372627, 0x26210783, 0x052f5e3f, 0xd4492620, 0x1e4b0805, 0x3e010f02, 0x1e363701, 0x06071401, 0x37323316,
+    0x6f02023e, 0x06090a07, 0x0b3a3412, 0x172b2343, 0x864d0519, 0x10130d0a, 0x19076205, 0x0d063a0e, 0x0d081203, 0x263a1c37, 0x4b2a0d13, 0x1513154a,
+    0x09040104, 0x0a361610, 0x4b013d45, 0x2c08059d, 0x05221902, 0x381c191e, 0x1e09873d, 0x150ef60e, 0x03042708, 0x090d1b06, 0x23051125, 0x47681d33,
+    0x13010136, 0x1c081121, 0x27051818, 0x0eef5d1a, 0x23001722, 0x4e0c1349, 0x17200e47, 0x20092463, 0x08335932, 0x82161421, 0x503220d1, 0x702006aa,
+    0x260e444e, 0x0a190af9, 0x82236e23, 0x8c2d2505, 0x010d0333, 0x490ac750, 0x46200623, 0x250c4f4e, 0x0c140c99, 0x04822a2a, 0x62ac3621, 0xa7820c12,
+    0x75180820, 0x13200843, 0x220a9f64, 0x443d0039, 0x957d089f, 0x36342805, 0x3335013b, 0x6e121315, 0x3438074d, 0x33013e13, 0x05163221, 0x03273307,
+    0x3f072337, 0x17072301, 0x37232733, 0x03200482, 0x01210782, 0x086947b0, 0x80302a08, 0x0e1337c9, 0x130ec2fd, 0x0c120237, 0x120cd201, 0x8c0abdfe,
+    0x6a0bc30a, 0x600a8213, 0x0bac8811, 0x670ab896, 0x13724611, 0x09c37e6a, 0x0120203d, 0x02bdfea5, 0x0d13130d, 0x0c420103, 0x60310f0f, 0x7000ff60,
+    0x6060a070, 0x849070a0, 0x08be820b, 0xff020030, 0x02e0ffff, 0x00a40141, 0x002c001e, 0x15320100, 0x07020e14, 0x2e272206, 0x33343503, 0x17021e32,
+    0x37361716, 0x2605033e, 0x36272627, 0x0e823637, 0x07067208, 0x08380206, 0x1d270f06, 0x1d53e853, 0x08060f27, 0x443f2710, 0x17172b1c, 0x3f441c2b,
+    0x13f8fe27, 0x1a211a1a, 0x47080846, 0x191a2219, 0x0f080001, 0x193f3b25, 0x3f195151, 0x080f253b, 0x1b240f05, 0x27383827, 0x050f241b, 0x19171d6f,
+    0x073d6f13, 0x136f3d07, 0x0100161a, 0xd7fff4ff, 0xa7010302, 0x00002200, 0x0f011e25, 0x010f0601, 0x012f010e, 0x20098226, 0x053b6826, 0x011f3623,
+    0x20098216, 0x08068216, 0xd8011747, 0x3e220625, 0x0305021c, 0x19361e48, 0x33264620, 0x120d1c10, 0x27291526, 0x2e152148, 0x10094c19, 0x0cfc1f07,
+    0x0f1f1243, 0x1a223e1c, 0x07132817, 0x1f34090f, 0x34181a39, 0x0603391d, 0x1a2f1602, 0x1b3d210f, 0x055f490b, 0x01000223, 0x330982c0, 0x00210011,
+    0x00310029, 0x00410039, 0x00510049, 0x23151300, 0x2105cb49, 0x7b4c011e, 0x067d4a06, 0x2908094b, 0x34363212, 0x14062226, 0x07572200, 0x07a34c05,
+    0x976b2620, 0x3f0f860f, 0x0d1380e0, 0xf3130d40, 0x1a13131a, 0x3828e013, 0x00ff0d13, 0x2838130d, 0x2f2f421f, 0x9d012f42, 0x8d201784, 0x4d200584,
+    0x63180584, 0x60250de2, 0x13130d60, 0x253a826d, 0x380d1a13, 0x0c82e028, 0x44820d20, 0x8200ff21, 0x422f233b, 0x18841101, 0x05843320, 0xb1517320,
+    0x78ad200a, 0xc0200a43, 0xc72aeb82, 0x2a000300, 0x35170000, 0x92181521, 0x3b200e53, 0x2105c456, 0xf6822627, 0x011e172f, 0x06071617, 0x1614011d,
+    0xc0012033, 0x20ac8340, 0x38bb82fe, 0x0c432838, 0x44091711, 0x062b1d2d, 0x11150f05, 0x4040400c, 0x28380001, 0x088d8320, 0x3828202b, 0x28010c11,
+    0x2c151332, 0x2b05083a, 0x2a1c201d, 0x110c0a24, 0xff020000, 0x02c0fffb, 0x00c0011d, 0x0027001c, 0x011e0100, 0x245e820f, 0x2f222306, 0x06834401,
+    0x26275d08, 0x36023f36, 0x37021f32, 0x1f11032f, 0x01012f01, 0x0f0d13fd, 0x1403196a, 0x8307080e, 0x0e080783, 0x6a190314, 0x93130d0f, 0x09280941,
+    0x72521941, 0x16330b19, 0x01041366, 0x0e260214, 0x160f9267, 0x04444404, 0x67920f16, 0x1503260e, 0x84121284, 0x04105191, 0xc3fe6717, 0x1972360c,
+    0x089b8118, 0x82800121, 0x00232883, 0x003b002f, 0x5b000049, 0x5d5a08bb, 0x07b14708, 0x4c013d21, 0x0520074f, 0x690a1359, 0x1d260576, 0x013b1401,
+    0x1d422732, 0x1d163007, 0x01352301, 0x1c1c1450, 0x07091014, 0x57090720, 0x10200540, 0x01221083, 0x55180810, 0xb0340a13, 0x60141c30, 0x01301c14,
+    0xe0141c20, 0x07101c14, 0x10070909, 0x10840585, 0x0810d822, 0x0825a018, 0x8450f021, 0x50502151, 0x240c6753, 0x0017000f, 0x09f9461f, 0x46141621,
+    0x05850543, 0xf5460620, 0x05ea4608, 0x26053a6d, 0x26263443, 0x6d832634, 0xf0201165, 0x26221682, 0x1d428a34, 0x6b421806, 0x820a200b, 0x00253265,
+    0x0031002d, 0x01000035, 0x010f1416, 0x36333711, 0x6a441832, 0x21232907, 0x013f013e, 0x06141103, 0x2305db46, 0x1632013b, 0x0a504218, 0x37153808,
+    0x01152335, 0xd30909b3, 0x1a09014b, 0x130d8809, 0xd4fe0d13, 0xba010501, 0x385038b5, 0x0d800d13, 0x0e146a13, 0x380e140e, 0x01404040, 0x091b0918,
+    0x4c0f01d3, 0x84f30909, 0x03012c1a, 0x2001bb01, 0x382880fe, 0x82012838, 0xfe13222a, 0x282a825b, 0x40aa140e, 0x40408040, 0x43601800, 0x0068330a,
+    0x0054001f, 0x3700005c, 0x36372726, 0x1f36013f, 0x33441e01, 0x06172907, 0x27220607, 0x22012b26, 0x05200782, 0x2008a04d, 0x83148227, 0x09984502,
+    0x36373222, 0x1721be82, 0x20078f16, 0x16751833, 0xbe2a0807, 0x0b440907, 0x31285010, 0x08161364, 0x07641322, 0x1b711206, 0x0a300a17, 0x1d101d19,
+    0x01300a19, 0x090907a8, 0x263a1007, 0x02847426, 0xcf413a20, 0x13252805, 0x1110110f, 0x8e4a130f, 0x25290807, 0x2f4231fe, 0x892f422f, 0x10620507,
+    0x0a1d390b, 0x26220416, 0x01160416, 0x02500d04, 0x17090915, 0x09200917, 0x09072007, 0x84008420, 0x0e12230a, 0x0387120e, 0x3b826020, 0x00422f24,
+    0x7f480002, 0x00342407, 0x5f00006a, 0xe1aa0977, 0x27222527, 0x34352726, 0x0cbe4e36, 0x06222625, 0x9433011d, 0x07062515, 0x23352306, 0xaa05484b,
+    0x188027ef, 0x38100e0a, 0xca843850, 0x131a1323, 0x240b8ac0, 0x180a0e10, 0x28ef9cc0, 0x060d0920, 0x383828e4, 0x05564128, 0x13130d25, 0x8d60600d,
+    0x05e5240f, 0x1860090d, 0x230ca75f, 0x00200018, 0x0f1d1b19, 0x17323638, 0x1415031e, 0x37342507, 0x22230605, 0x0c7a0226, 0x0c0a1409, 0x0684b3fd,
+    0x1328bb34, 0x10062d07, 0x01212c36, 0x0113a1fe, 0x49423211, 0x5f180a67, 0x91310b56, 0x1616403e, 0x49365f34, 0x110b0626, 0x2dd32628, 0x0c974368,
+    0x26285356, 0x07062216, 0x82371606, 0x3616238d, 0x5b682627, 0x52b12d1e, 0x0b01054d, 0x29822907, 0x05010b07, 0x68069f48, 0x8039195b, 0x0d0a2d3e,
+    0x03111103, 0x002d0a0d, 0xff010000, 0x01c0fff5, 0x00c901cb, 0x210c8231, 0x78820716, 0x0e010f2b, 0x2f262201, 0x22012e01, 0x210b8706, 0x01822726,
+    0x013e372c, 0x011f3637, 0x36373616, 0x0482012f, 0x011e173c, 0x250fbc01, 0x0d08061e, 0x15110208, 0x04220310, 0x04161c16, 0x15100322, 0x13820211,
+    0x1e065608, 0x32080f25, 0x64232022, 0x09030d06, 0x010a1d0d, 0x32222930, 0x313e6001, 0x39534328, 0x0d0d0b22, 0x120d8b0a, 0x0a8b0d12, 0x220b0d0d,
+    0x28435339, 0x33223d32, 0x40130908, 0x0e050304, 0x01041308, 0x33080b23, 0x00040000, 0x02c0ff00, 0x00c40182, 0x00120009, 0x22a9831d, 0x82012e13,
+    0x0e17268d, 0x3e170701, 0x05f35101, 0x011e3725, 0x82061407, 0x26272198, 0x0edf4318, 0x013b2808, 0x73071737, 0x2d050507, 0x49274784, 0x60211f1b,
+    0x2e0a0d2b, 0x3a231b18, 0x080e023f, 0x04081b66, 0x0909071d, 0x83e0fd07, 0xed250805, 0x01413c49, 0x06100337, 0x17033b38, 0x4c0b3d5a, 0x9211045f,
+    0x822cd45b, 0x03090848, 0x1e4a5d25, 0x070996fe, 0x82298320, 0x16c82204, 0x9f5218b2, 0x002f300c, 0x00370033, 0x003f003b, 0x01000057, 0x51230614,
+    0x35210af6, 0x07606023, 0x33363423, 0x09986035, 0x56331521, 0x152307ec, 0x82213533, 0x35112403, 0x82211523, 0x065d4603, 0x23056c46, 0x16323315,
+    0x2c057343, 0x13000233, 0x13130d0d, 0x130d600d, 0x8e0584c0, 0x2060260e, 0x202080fe, 0x84038201, 0x20202120, 0x01210684, 0x852e9640, 0x8320203d,
+    0x22378300, 0x82602020, 0x83348655, 0x07974706, 0xc0010535, 0x21001900, 0x16250000, 0x22212306, 0x3e133726, 0x18013b01, 0x82081241, 0x5b17209f,
+    0x31080741, 0x1d07fe01, 0x1860fe18, 0x0349071d, 0x063c0b11, 0x06385038, 0x03110b3c, 0x13131ac2, 0x1902131a, 0x01192929, 0x100e0c24, 0x38382810,
+    0x0e110f28, 0x5f461a0c, 0x18022008, 0x820ab384, 0xb584186b, 0x0703251d, 0x11d82733, 0x13b98418, 0xb2077224, 0xc2731007, 0xbd841805, 0xa001240d,
+    0x82005050, 0x61072000, 0x0f22081b, 0xd5821700, 0x49003528, 0x71005d00, 0x3b420000, 0x0b6f180e, 0x08e74908, 0x0f171629, 0x2f220601, 0x48342602,
+    0x1623058a, 0x89271714, 0x020f280b, 0x1f272206, 0x83141601, 0x21248708, 0x328f2717, 0x2010d649, 0x05f44990, 0x0c1e9e29, 0x0c020402, 0x8702021e,
+    0x8a402008, 0x2014850b, 0x20119014, 0x21359016, 0xfa492001, 0x60512611, 0x13130d60, 0x845c8b21, 0x8f0e2050, 0x82022172, 0x2e201190, 0x002d3590,
+    0xff020000, 0x01bffffc, 0x00c001c4, 0x05034822, 0x17161725, 0x4e060716, 0x22200537, 0x27230685, 0x83363726, 0x821a8201, 0x83272007, 0x3c12871c,
+    0x14011f33, 0x5f010607, 0x08161927, 0x240c0807, 0x1310412b, 0x130d200d, 0x242b4110, 0x3311820c, 0x18271916, 0x1919242a, 0x0e1f2a24, 0x0f131017,
+    0x13040202, 0x2a080884, 0x01060501, 0x1f23073f, 0x472b2b2f, 0x080a3a30, 0x303a0a08, 0x2f2b2b47, 0x0407231f, 0x0e0e0a0b, 0x0d250b0a, 0x0e010506,
+    0x83132412, 0x130f2b07, 0x09001710, 0xc0ffecff, 0xab82d401, 0x1d000731, 0x30002500, 0x3e003700, 0x4e004600, 0x18005900, 0x2a087f6e, 0x16071637,
+    0x06270607, 0x82062722, 0x2cb982a4, 0x17323617, 0x37160136, 0x27262726, 0x22c68206, 0x82232622, 0x3e172ad7, 0x16072201, 0x02373617, 0x21198232,
+    0x46500706, 0x83362008, 0x160724df, 0x82273627, 0x23063627, 0xd3161716, 0x1a13131a, 0x371ef613, 0x571d1e37, 0x57247c24, 0x370a891d, 0x2507a6fe,
+    0x0b0b0205, 0x04032c16, 0x1f010401, 0x0b160707, 0x11122097, 0x32200082, 0x01260685, 0x422f2f42, 0x1782f12f, 0x05020b28, 0x07160825, 0x28821f07,
+    0x0b030423, 0x2c5482e0, 0x35731a13, 0x34354b4b, 0x0a56560a, 0x38098834, 0x010cecfe, 0x0a091216, 0x14149623, 0x230d0c01, 0x0625860a, 0xfe060707,
+    0x200684a5, 0x224e824b, 0x823f422f, 0x13092c16, 0x239c0115, 0x14010c0d, 0x82000914, 0x82012000, 0x02202a03, 0x00600180, 0x2500004d, 0x066f6106,
+    0x2223062e, 0x2e342726, 0x22212304, 0x0e15050e, 0x082c8718, 0x27343637, 0x013d012e, 0x32333634, 0x1e141716, 0x32213304, 0x3e35053e, 0x080e8201,
+    0x14011d24, 0x07570206, 0x2c161307, 0x0827181e, 0x07060206, 0xeefe070a, 0x05070905, 0x08060105, 0x2c1e1827, 0x1e8e1316, 0x8c120121, 0xcb20081e,
+    0x0a031003, 0x1e081524, 0x01171c2c, 0x040d0511, 0x04060205, 0x0110040c, 0x1e2c1c17, 0x0a241508, 0xca821f9e, 0x0003002f, 0x02beff00, 0x00c00101,
+    0x00180007, 0x28128229, 0x26220614, 0x07323634, 0x21a18316, 0xc0862627, 0x5b161721, 0x062105b9, 0x20018207, 0x08d28226, 0x01363721, 0x38503860,
+    0x063e5038, 0x7c46070d, 0x0c120f0b, 0x0c3c0188, 0x7c0b0f12, 0x060d0845, 0x83880144, 0x3821081c, 0xf60804f1, 0x23040807, 0x0b0f0106, 0x01100cdf,
+    0x10010808, 0x0f0bdf0c, 0x04220701, 0x08f60708, 0x20728204, 0x22838202, 0x824002c0, 0x00252483, 0x5700004b, 0x222b076c, 0x23062726, 0x34352622,
+    0x82012e37, 0x21088204, 0x04833736, 0x32303329, 0x01013e31, 0x7b070614, 0x27220560, 0x2683010e, 0x65411120, 0x201c8205, 0x08178232, 0x011e0742,
+    0x16071415, 0x2a261ad0, 0x0726171e, 0x2a1e0507, 0x281b1601, 0x02171b08, 0x06021a26, 0x1b860122, 0x1e2a0116, 0x26070705, 0x262a1e17, 0x0622161a,
+    0x02261a02, 0x28081b17, 0x1a26c001, 0x2a1e88fe, 0x07332084, 0x19280907, 0x1211172e, 0x07092819, 0x15261a07, 0x84d0fe1b, 0x2b4f840a, 0x78011e2a,
+    0x151b251b, 0x08061a26, 0x12232782, 0x82001711, 0x82042000, 0x01003503, 0x008001e0, 0x00330029, 0x00510042, 0x011e2500, 0x0714011d, 0x2008194d,
+    0x39098821, 0x34013d26, 0x3e023f36, 0x32013b01, 0x25011f16, 0x2e272107, 0x22012b01, 0x39190706, 0xb72218fe, 0x39191712, 0x17320df8, 0x0c140c12,
+    0x22802239, 0xfe140c39, 0x000114d9, 0x39190514, 0xec241df2, 0x30142107, 0x10ee3919, 0x0721142a, 0x2620321c, 0x1a322026, 0x1cec3919, 0x82000321,
+    0x00022900, 0x23008001, 0x4b002f00, 0x10d94918, 0x4f013b21, 0x884705e9, 0x21d88306, 0xf94d011d, 0x3525210b, 0x1a69b018, 0x130de022, 0x2805ea58,
+    0x09200d13, 0x09076007, 0x21058480, 0x8f6600ff, 0x00012505, 0x10082808, 0x06860382, 0x4f400121, 0xed6905f7, 0x18302005, 0x2309f790, 0x08108830,
+    0x2b8b2882, 0x0028083d, 0xfffeff05, 0x018402bb, 0x002a00c2, 0x00750066, 0x00910082, 0x06073700, 0x51060717, 0x2e210519, 0x0b205101, 0x51013e21,
+    0x0f2b0627, 0x020f0601, 0x0705010e, 0x82060706, 0x0607230b, 0x2983012f, 0x0e072727, 0x26012f01, 0x843b8227, 0x37362404, 0x82023f36, 0x05cc4504,
+    0x17253b82, 0x1f161716, 0x29048202, 0x010e2624, 0x031e1716, 0x1b82023e, 0x2c822720, 0x31083682, 0x010f2223, 0x06261617, 0x1e061607, 0x3e161704,
+    0x050c8f01, 0x0b052302, 0x0a020f02, 0x0503064e, 0x32070941, 0x4d060704, 0x0107010a, 0x062b040c, 0x1b823d07, 0x050b7408, 0x180b2003, 0x0de80125,
+    0x05040d04, 0x0d04020e, 0x0d0d1f14, 0x08f80903, 0x1f0d1703, 0x01010215, 0x0502020e, 0x1d080c05, 0x20120a09, 0x0f0c0605, 0x110f0807, 0x117b1011,
+    0x0d0e150e, 0x10030703, 0x8afe0707, 0x0c07161b, 0x070c020e, 0x0507070a, 0x06fd0301, 0x16090301, 0x1807067b, 0x6cac200e, 0x0104291c, 0x0c030802,
+    0x0e020d05, 0x2ee30716, 0x901d1310, 0x37a18d85, 0x2b030738, 0x9d24070e, 0x040c112f, 0x05073403, 0x04080510, 0x431e0d17, 0x2f089883, 0x06150608,
+    0x05053407, 0x1e2e1112, 0x1801040c, 0x0c06072b, 0x05030407, 0x21050101, 0x150e0904, 0x1e351a15, 0x6013120c, 0x151c0c07, 0x02030104, 0x0535c082,
+    0x36100e04, 0x05150707, 0x2b130221, 0x18084f2e, 0x0606040e, 0x241c8203, 0x1c0d0401, 0xdf531800, 0x0023280a, 0x002f002b, 0x503b0033, 0x14210a7d,
+    0x0b2e5606, 0x34013d2b, 0x3e013f36, 0x32013b01, 0xc3a4181f, 0x35372608, 0x013b0723, 0x083f5627, 0x2820022a, 0x30070938, 0x80385038, 0x303b0382,
+    0x151b0907, 0x13210730, 0x6d131fd6, 0x1c287cfe, 0x781c281c, 0xa6a3264d, 0x84b4594d, 0x0001270c, 0x07502838, 0x33562809, 0x07092a06, 0x06221670,
+    0x1816127a, 0x072b5688, 0x3f566020, 0x03002107, 0x2508db44, 0x0051000f, 0xff5d0068, 0x060b4611, 0x14150722, 0x1bf57218, 0x013e3724, 0x4b46013d,
+    0x183b2005, 0x4e074d88, 0x15260559, 0x2b263605, 0x04833701, 0x010f2226, 0x013b1606, 0x20056a56, 0x08a28201, 0xfe07092c, 0x090907c0, 0x10100207,
+    0x191f0907, 0x271d2232, 0xfe081117, 0xa01b25e0, 0x2408251b, 0x0a0d1434, 0x091f190d, 0x0e091007, 0x03822009, 0x04e4fe26, 0x0c3a0707, 0x44284182,
+    0x0110010b, 0x173b0508, 0x07210b82, 0x09c94b03, 0x82400121, 0x1a24080b, 0x2178082a, 0x2e03032e, 0x1711191e, 0x1b600170, 0xc01b2525, 0x0d1c2434,
+    0x11020211, 0x2a08760b, 0x0907201a, 0x3c0a8a43, 0x330b0560, 0x6b090805, 0x05530705, 0x02000508, 0xbfff0000, 0xc0010002, 0x27000f00, 0xaf421800,
+    0x32362c0d, 0x2f36011f, 0x1d062601, 0x82222301, 0x3b143304, 0x013d3201, 0x16141533, 0x09f70137, 0x1a0ae009, 0x0685e00a, 0x06067b2f, 0x700a0355,
+    0x2008130d, 0x030a6008, 0x821989d7, 0x06ed3320, 0x04034e06, 0x0d133605, 0x40080850, 0x03040536, 0x78180000, 0x27200aef, 0x22089754, 0x82610059,
+    0x16322781, 0x22230614, 0x6f462327, 0x26352806, 0x33363435, 0x82331732, 0x30198304, 0x16072330, 0x32170714, 0x33171605, 0x22312227, 0x241d8226,
+    0x23373330, 0x52168206, 0xb954052d, 0x32162505, 0x14062224, 0x02201183, 0x26220584, 0xd3540422, 0x80012906, 0x1b25251b, 0x12d21225, 0x20210582,
+    0x2e0a8820, 0x27011b25, 0x01270808, 0x080fe0fe, 0x830126d0, 0x26012b24, 0xb00f08d0, 0x09090e09, 0x0584770e, 0x83c0fe21, 0x2009210b, 0x01210c84,
+    0x230c8440, 0x25362560, 0x0a82468a, 0x4125362a, 0x410f200f, 0x400f0809, 0x40231b82, 0x8462080f, 0x8a892028, 0x64488c3b, 0x0f2b0c97, 0x37001f00,
+    0x45004100, 0x18250000, 0x26091356, 0x010f1617, 0x18263706, 0x83084444, 0x1827200e, 0x200ebb60, 0x05c47f3b, 0x13373624, 0x99592111, 0x03162105,
+    0x002c0982, 0x0c0c3aff, 0x0b0c0b3a, 0x24240b0b, 0x0c210482, 0x20088755, 0x2518850b, 0x09070601, 0x76191a26, 0xba2318c0, 0x820b0b3b, 0x833f8202,
+    0x0b0c223e, 0x823e8517, 0x3c18850f, 0x1007099a, 0x1a26261a, 0x0b090710, 0x010f1115, 0x01b0fe70, 0x1c1c1450, 0x0001dcfe, 0x2bda82ff, 0xffff0300,
+    0x0102bdff, 0x0e00c001, 0x3023db82, 0x5e130000, 0x16210728, 0x21d58214, 0x06842527, 0x2505247e, 0x3f321617, 0x108f1701, 0x0c0c0c27, 0x050c05e9,
+    0x230682e9, 0xff000b0b, 0x0c820684, 0x0ca13b25, 0x82a20c18, 0x0be922c4, 0x210e820b, 0x0e83a23a, 0x062c0128, 0x026a061c, 0x06836a02, 0x12050527,
+    0x6a051d06, 0x27028205, 0x491a061d, 0x9a490505, 0x1d831685, 0x474a0f84, 0xb6ff2305, 0x9f828002, 0x0000582c, 0x14151625, 0x2e012f06, 0x86823d01,
+    0x8c823320, 0x3435362b, 0x0607012f, 0x011f1415, 0x820f8316, 0x2fb4821e, 0x37343526, 0x083e3736, 0x1d163233, 0x3d363701, 0x09117118, 0x35011f3f,
+    0x32333634, 0x1617071e, 0x4e047c02, 0x281f3c2f, 0x05020256, 0x03010902, 0x0103a8a8, 0x3a0a8209, 0x1f285602, 0x044e2f3c, 0x0c014521, 0x0b040b02,
+    0x070d0b08, 0x0721291d, 0x82100709, 0x29212403, 0x820d071d, 0x0b043413, 0x45010c02, 0x2e0f0f3a, 0x08100d37, 0x3a581f31, 0x830d0401, 0x70702149,
+    0x2e084383, 0x3a01040d, 0x08311f58, 0x2e370d10, 0x6d7a0f0f, 0x0f041202, 0x05030a04, 0x3c1c2602, 0xab080516, 0x07090907, 0x160508ab, 0x02261c3c,
+    0x820a0305, 0x0212221c, 0x0603456d, 0xeb820020, 0x3b002124, 0xfb664700, 0x48332008, 0x35530826, 0x08154907, 0x16320522, 0x2808e059, 0x32213336,
+    0x23263436, 0x22138335, 0x82222507, 0x013b30f7, 0x14011d32, 0x130da023, 0x07090d13, 0x83090740, 0x0c270808, 0x07280709, 0x14240109, 0xfe07091c,
+    0x1c090720, 0x35100114, 0x4f354b4b, 0x99fe3171, 0x08d00808, 0x0d138008, 0x82130de0, 0x8af482ef, 0x1c80230a, 0xb8820714, 0x4b1c142a, 0x71404b6a,
+    0x2037494f, 0x55053748, 0x60290b1f, 0x35003100, 0x00004000, 0x06c06601, 0xb7580620, 0x08df4b05, 0x0a1e7618, 0x2d09a973, 0x1f323315, 0x27350501,
+    0x36340515, 0xd283013f, 0x02262237, 0x02060476, 0xfe0d09d5, 0x46130ded, 0x0d130f0b, 0x388a0303, 0x8b721838, 0x39260809, 0xfe320e0f, 0xf50130c0,
+    0x2b0b0a16, 0x01192419, 0x04050120, 0xd6030312, 0x2f0d130a, 0x0c12020c, 0x01130d5f, 0x55183019, 0x30300964, 0x3f411907, 0x0a5d3e08, 0x3e10102b,
+    0x19191217, 0x012eb783, 0xc0ff0000, 0xc0010002, 0x00003000, 0x4d181e25, 0x34200861, 0x5005434b, 0xa8820590, 0x18353621, 0x081331dd, 0x1ac30123,
+    0xfe1e2a23, 0x232a1e90, 0x1e2a1d1a, 0x1b25160e, 0x0f2f2110, 0x3828050a, 0x251b0606, 0x2a1e0e16, 0xfcdc184f, 0x251b310f, 0x1519212f, 0x0f283802,
+    0x1d1b2511, 0x231e2a13, 0x82063f41, 0x01062787, 0x000700c1, 0x12820013, 0xbd593620, 0x16252b06, 0x22012b06, 0x36013f26, 0xf7681732, 0x05ed5108,
+    0x6a4b3323, 0x3202824b, 0x160bfb01, 0x1615d615, 0x2a0b6b0b, 0x130d500b, 0x83a00d13, 0x84c02004, 0x1282291d, 0xb7122525, 0xf2fe1212, 0x1b821686,
+    0x01266f83, 0xc0fffeff, 0xf782e201, 0xf7843520, 0x4205f85a, 0x07300857, 0x012f2606, 0x013f3626, 0x3f012e27, 0x1f013e01, 0x2009aa4a, 0x0e761837,
+    0x06d83008, 0x03200303, 0x0988060d, 0x09074007, 0x820d0688, 0x0603230d, 0x16958888, 0x0d047231, 0x04053805, 0x079d4f03, 0x9d070909, 0x8204034f,
+    0x040d230e, 0x17964e4e, 0x09000028, 0xc0ff0000, 0xa3828002, 0x1d000f30, 0x39002b00, 0x55004700, 0x71006300, 0x4b4b7f00, 0x13332110, 0x700a1466,
+    0x222205fa, 0x74451d06, 0xd2172006, 0x2002271b, 0x28383828, 0x058340fe, 0x07094028, 0x1c090740, 0x02821c28, 0x90280a84, 0x07500709, 0x212e2109,
+    0x0a840282, 0x80201090, 0x0121328f, 0x204d82c0, 0x204d83c0, 0x21538201, 0x508290fe, 0x14242282, 0x40941c1c, 0x14200482, 0x712b0e83, 0x09090738,
+    0x21173807, 0x82588f21, 0x58172104, 0x13930e82, 0x3b927920, 0x00820020, 0x4f410a20, 0x00572912, 0x00730065, 0x008f0081, 0x5c07975a, 0x17200867,
+    0x2606b161, 0x013b1614, 0xa8373632, 0x4415200d, 0x478c05a5, 0x41012b21, 0x4785058d, 0x022c0da5, 0x25382820, 0x1b00fe1b, 0x40283825, 0x41085941,
+    0x08870851, 0x1a878020, 0xfe212783, 0x20338340, 0x075c4160, 0x88087641, 0x08774108, 0x82c00121, 0x251b2355, 0x31821b25, 0x1420b026, 0x20141c1c,
+    0x20075d41, 0x08674117, 0x1d880985, 0x1b258922, 0x38259382, 0x251b2028, 0x832d8450, 0x181c2119, 0x18243783, 0x17212117, 0x0f200988, 0x00201d88,
+    0x31080082, 0xfffdff07, 0x018302bb, 0x000500c0, 0x00320026, 0x004f0043, 0x00630057, 0x06073700, 0x07362607, 0x1617011e, 0x22230617, 0x012f012e,
+    0x36373626, 0x0f833233, 0x27081b82, 0x2223012a, 0x17151407, 0x26010e16, 0x16352627, 0x25163736, 0x010f011e, 0x022e020e, 0x013e013f, 0x06073637,
+    0x17163615, 0x2e2b3382, 0x011e0601, 0x26063736, 0x85370627, 0x0747080e, 0x16361706, 0x122008cf, 0x04542001, 0x1a0d2646, 0x59230307, 0x0420064a,
+    0x75671212, 0x101a2424, 0x161e1920, 0x64010301, 0x13038159, 0x01021c20, 0x030d2c12, 0x12129f01, 0x53072004, 0x364f4161, 0x1d042007, 0x85889b15,
+    0x2a228317, 0x0a46531b, 0x0322832e, 0x850103de, 0x013f0831, 0x2bcb2c11, 0x2a18140b, 0x0b32182a, 0x24012023, 0x15b32644, 0x06390a27, 0x04011704,
+    0x01311505, 0x1b102b01, 0x05111306, 0x0f070907, 0x260a1f06, 0x4829b415, 0x60410b21, 0x1e15b329, 0x85ad1903, 0x11052117, 0xd0292382, 0x1c272c0f,
+    0x4f282a17, 0x220e8206, 0x82101305, 0x5008201a, 0xff250623, 0x018001c0, 0x08255fc0, 0x14010026, 0x33150706, 0x0e290482, 0x27262201, 0x3335012e,
+    0x21048935, 0x55463634, 0x211f8305, 0x554a0615, 0x8f831806, 0x8001300f, 0x25401c24, 0x5c46091e, 0x251e0946, 0x83241c40, 0x0d132a02, 0x40130dc0,
+    0x28941c24, 0x27a1181c, 0x330b830a, 0x311f0001, 0x3220260a, 0x39392c09, 0x2032092c, 0x1f310a26, 0x20250383, 0x0d13130d, 0x201b8320, 0x203184e0,
+    0x83058a64, 0x430620bb, 0x2e2b086f, 0x82003200, 0xda008a00, 0x5b00e200, 0x2e250937, 0x07062201, 0x18058523, 0x8308a179, 0x05ef47c0, 0xfe521f20,
+    0x33252305, 0x325e2327, 0x07062208, 0x05ec6517, 0x23510620, 0x6d262009, 0x2621071b, 0x089f7827, 0x4a373621, 0x3621069e, 0x083c4837, 0x04661620,
+    0x010f2305, 0x87181716, 0xaa43081d, 0x012b2105, 0xaf5b57ce, 0x16112605, 0x16434c43, 0x38058442, 0x09090711, 0x07091007, 0x710d13b0, 0x4a53131f,
+    0xc0fe130d, 0x01513384, 0x32178330, 0x04060305, 0x0b170b0b, 0x0b0a040b, 0x07200709, 0x860a0b09, 0x0405220f, 0x26209f05, 0x1c1c287f, 0x9fa01c28,
+    0x2047a626, 0x237f84e0, 0x1e22221e, 0x0c840383, 0x0907502d, 0x18130d60, 0x400d1368, 0x85fe4060, 0x90a0ab20, 0x82502079, 0x281c22af, 0x21e99534,
+    0x0a410504, 0x21488529, 0x975d0400, 0x00362608, 0x0042003a, 0x0a63424a, 0x71054b49, 0x124b0f21, 0x42352005, 0x1522116b, 0x545f2733, 0x07924d07,
+    0x2605cb41, 0x5c420232, 0x84440242, 0x07323805, 0x10070909, 0x13a00d13, 0x131f710d, 0x130d306d, 0x4d9ec0fe, 0x821c28d5, 0x3c0121d7, 0xa0200684,
+    0x0527dc85, 0x2e42422e, 0x860b0b05, 0x2f148407, 0x80130d40, 0x8818130d, 0xc0400d13, 0xc0fe6060, 0x02873482, 0x00000023, 0x33038205, 0x01000200,
+    0x00020080, 0x001a000a, 0x00480030, 0x17013f00, 0x20070e49, 0x0e616c37, 0x36321322, 0x088a4a18, 0x013b1629, 0x33013f32, 0x18331617, 0x2809f65c,
+    0x06222326, 0x32331614, 0x301c8337, 0x12129e36, 0x0e0e1494, 0x14880e14, 0xfe141c1c, 0x36058360, 0x020908cb, 0x1a110636, 0x02360611, 0x0c110809,
+    0x08460803, 0x82be0c03, 0x090732e1, 0x2a1e0c0c, 0x0d0f1e2a, 0x07100705, 0x3535b009, 0x223a8210, 0x82ce140e, 0x83e0203a, 0x012b083a, 0xfe1c1420,
+    0x9b080de0, 0x089b1010, 0x15150b0d, 0x07a0100b, 0x24070909, 0x2a3c2a04, 0x00090606, 0x00020000, 0x01c0ff00, 0x68c00140, 0x335f053d, 0x08694908,
+    0x2208b243, 0x82343526, 0x14153ae4, 0x06222607, 0x17161415, 0x3435013e, 0x0e0a2801, 0x0e600a0e, 0x0e0a200a, 0x2d0a8360, 0x6c4a252d, 0x2c45254a,
+    0x12121e1a, 0x1784c01e, 0x17839820, 0x0a849820, 0x41353b31, 0x35414f4f, 0x1e22b03b, 0x14143918, 0x4c1e1839, 0x01210553, 0x277f82c0, 0x003a0016,
+    0x25000042, 0x159d6818, 0x72820520, 0x0a7d5318, 0x08a74a18, 0x2f083949, 0x13062223, 0x06222135, 0x01331614, 0x02020ac0, 0x0b976818, 0x09d0fe26,
+    0x07093007, 0x8708cc50, 0xfeed270a, 0x12130de3, 0x68185a0e, 0x7620108b, 0x70252a82, 0x07090907, 0x28358b70, 0x1240c9fe, 0x0000121c, 0x08374505,
+    0x17000726, 0x33002f00, 0x2420b783, 0x20060f4b, 0x0a135517, 0x013b1427, 0x07222732, 0x0ac84221, 0x451d1621, 0x262c0535, 0x15233527, 0x14150617,
+    0x26222117, 0x20051851, 0x249e1833, 0x402c080f, 0x75fe2e37, 0x1d50131d, 0x1d13a013, 0x091d1350, 0x078780b7, 0x13ddfe13, 0x0709c01d, 0x547854e0,
+    0x0c427854, 0x0a0a360a, 0x20c00a4c, 0x30381f82, 0x131d1d13, 0x31131d30, 0x20206001, 0x2a1818e0, 0x90131d26, 0x00090730, 0x0c200082, 0x2d36b388,
+    0x45003900, 0x5d005100, 0x75006900, 0x8d008100, 0xa5009900, 0xb14ab100, 0x14fd5510, 0x6409ea4d, 0x0d641701, 0x63be180b, 0x2123af17, 0xdb193513,
+    0x6d640f6f, 0x68023205, 0x0d130e0a, 0x130dc0fd, 0x09280a0e, 0x09071007, 0x29058540, 0x0a900a0e, 0x0ca0fe0e, 0x028e0c28, 0x0f8e8020, 0x25920e82,
+    0x012a128c, 0xfe0a0e00, 0x13130df8, 0x6e82010d, 0x09075025, 0x85500709, 0x0a482605, 0xa80a0e0e, 0x206484d4, 0x20058a6c, 0x201190b4, 0x21119054,
+    0x128aecfe, 0x87430020, 0x02e02b05, 0x00a00100, 0x00530014, 0xc9521200, 0x23063306, 0x37343522, 0x2637023e, 0x3e053435, 0x012e2701, 0x0a82012f,
+    0x32023b23, 0x66b01817, 0x011d340e, 0x1e17010e, 0x16011f01, 0x012b1415, 0x0f262722, 0x18160601, 0x0809a4b0, 0xd496352c, 0x386a9696, 0x084c4133,
+    0x1d0f0502, 0x18013906, 0x02031d17, 0x06321118, 0x05012009, 0x11060805, 0x0e040104, 0x10070912, 0x19890907, 0x188d0620, 0x7aa0013d, 0x33137aac,
+    0x04030308, 0x39163213, 0x02b4564a, 0x19111825, 0x07010f05, 0x82040208, 0x030c2942, 0x07120209, 0x12070909, 0x00291897, 0x00030000, 0x02e0ff00,
+    0x24eb8242, 0x004c0012, 0x20118264, 0x20e78214, 0x4eeb8527, 0x322105d7, 0x05305403, 0x32647f18, 0xf5820520, 0x262c4e86, 0x32331627, 0x27343536,
+    0x1415011e, 0x562cbb82, 0x2e2b333c, 0x0e160208, 0x66ac7a26, 0x17437f18, 0x18191221, 0x080f6d7f, 0x0e5a0128, 0x05040316, 0x3c332b2e, 0x12186840,
+    0x018d630e, 0x42014839, 0x19195e84, 0x17030308, 0x4233291f, 0x0800ff5e, 0x5a181008, 0x10201225, 0x8c371695, 0x0a04171f, 0x2c361919, 0x0a4f7102,
+    0x3250120a, 0x00000033, 0x4a000001, 0x2320064b, 0x49148567, 0x322f0c83, 0x01011d16, 0x13130d60, 0x0d13600d, 0x8a130d40, 0x4001210a, 0xe0201184,
+    0xe0201c83, 0x62821c8a, 0x830a0021, 0x01023763, 0x5700c001, 0x63005d00, 0x6f006900, 0x7d007500, 0x89008300, 0x97478f00, 0x27232c08, 0x1e170706,
+    0x06010f01, 0x82012f22, 0x05c9610a, 0x26373524, 0x11830727, 0x3f342623, 0x850a8201, 0x1733228f, 0x09bd7136, 0xe14a0a82, 0x07152f05, 0x36371716,
+    0x16011f32, 0x16010f14, 0x0e832717, 0x55832620, 0x23373622, 0x36215082, 0x20108537, 0x20528317, 0x09505e16, 0x22823720, 0x44823320, 0x84070621,
+    0x16280861, 0x0a07ef01, 0x0811070a, 0x01050d24, 0x0e041605, 0x3b2f0b05, 0x1e070901, 0x3b010907, 0x0e050b2f, 0x05041604, 0x1108240d, 0x10822588,
+    0xc4382497, 0x2b0d0f04, 0x1e25591e, 0x6c0f0d2b, 0x03400615, 0x15064c09, 0x43030931, 0x32261784, 0x1a13131a, 0x1d8a3a13, 0x83400c21, 0xb6df201e,
+    0x2092916d, 0x2271827f, 0x84061531, 0x251e2173, 0x4c207482, 0x87206c84, 0x77201684, 0x13227c82, 0x1c89901a, 0x83044821, 0x0400311d, 0xc0ff0000,
+    0xc1010002, 0x1f000f00, 0x54002d00, 0x4c087553, 0x14230547, 0x4b072306, 0xa6410841, 0x32162205, 0x0726523f, 0x17013d2e, 0x011d1625, 0x15213507,
+    0x37343527, 0x28066c4b, 0x3233053e, 0x3317041e, 0x211a8232, 0xb152b016, 0x09b02308, 0x0c86a007, 0x15344623, 0x057f48d1, 0x1d01d138, 0xc0fe6012,
+    0x0e101260, 0x014e141c, 0x0e1c0107, 0x17080817, 0x0a821c0e, 0x1c144e27, 0x0709e80e, 0x82348310, 0x87502004, 0x09230808, 0xd5970f72, 0x141c1c14,
+    0x0eef97d5, 0xb9460a18, 0x180a46b9, 0x2c0a0d0e, 0x05011c14, 0x0b091501, 0x8215090b, 0x141c2408, 0x18000b2c, 0x2209c368, 0x4f210011, 0x35260ce3,
+    0x3b363411, 0x60181f01, 0xe74f09e5, 0xd0012105, 0x23091a49, 0x096040a0, 0x0849cd18, 0x1c400123, 0x08f54814, 0x88a84021, 0x8c00208c, 0x99352063,
+    0x0b4a4863, 0x18059951, 0x2208b242, 0x8d363233, 0x0a582577, 0x060a4006, 0xca506382, 0x07092705, 0x400a0610, 0x83910a06, 0x07211f88, 0x300a8609,
+    0xff030000, 0x02bcfffa, 0x00c00180, 0x001c0014, 0x34918256, 0x1415010e, 0x2f010e17, 0x013d2601, 0x33362627, 0x07163221, 0x07504806, 0x3f320345,
+    0x013b1415, 0xb1013532, 0x083b523f, 0x10501023, 0x15110fb7, 0x1115e001, 0x5e84790f, 0xb05e845e, 0x4511e344, 0x0133170d, 0x4367101a, 0x09103951,
+    0x140c3c0b, 0x270fca9c, 0x828a0f27, 0x845e2241, 0x29ec4492, 0x08081022, 0x240a3b56, 0x006f0065, 0x08694479, 0x35012b23, 0x21018323, 0x01823315,
+    0x82412320, 0x33352109, 0x23210182, 0x44018415, 0x35220cf7, 0x385b3634, 0x099a690e, 0x4905485b, 0x33260661, 0x011d1632, 0x13821527, 0x012b2624,
+    0x63530622, 0xf0012709, 0x07090907, 0x00832050, 0x07095025, 0x86090740, 0x2216830b, 0x84070910, 0x090e2302, 0x03890940, 0x09071022, 0xf8210282,
+    0x331c8230, 0x09380907, 0x09072007, 0x80070960, 0x80a00907, 0xa0806060, 0x85050e48, 0x2016840b, 0x21538270, 0x05820907, 0x4208ca6c, 0x0584058e,
+    0x7c827020, 0x70070925, 0x823030b0, 0x42b72070, 0x1f410515, 0x00312a0a, 0x0047003f, 0x15162500, 0x057f4514, 0x34352623, 0x47f38937, 0xa06a0517,
+    0x013b2406, 0x85013d32, 0x32332e0b, 0x3f363204, 0x22022e01, 0x1e010f06, 0x078f4c01, 0x03fd0133, 0xb2386609, 0x03096638, 0x18401508, 0x140a1820,
+    0x2a05880a, 0xf3fe1540, 0x0c0c3030, 0x85321105, 0x1a3d3c06, 0x131a1313, 0x0d07068d, 0x3c3c6e09, 0x070d096e, 0x10d01306, 0x86101818, 0x83ae0a0a,
+    0x0aae2307, 0x0783860a, 0x2080d027, 0x15071010, 0x20058424, 0x2533823c, 0x00001a13, 0xb37cff02, 0x00322207, 0x6ec18244, 0x2f2306cf, 0x6e141701,
+    0x352a09d4, 0x23220737, 0x013f2622, 0xae822627, 0x1f240482, 0x32363701, 0x95080483, 0x27020f16, 0x07372737, 0x17270727, 0x37071707, 0x27173707,
+    0x050df001, 0x094b620c, 0x046c0d0e, 0x0608080b, 0x08064444, 0x6c040b08, 0x0a0c0202, 0x0c624b08, 0x2a6e0d05, 0x5e0c1405, 0x041a0422, 0x140c5e22,
+    0x242f2a05, 0x2d14352f, 0x142d1010, 0x34242f35, 0x02212102, 0x061b01f5, 0x180a5335, 0x08711803, 0x5959070b, 0x71080b07, 0x530a1518, 0x011b0635,
+    0x110d6810, 0x0d6b3c07, 0x073c6b0d, 0x7d680d11, 0x32081928, 0x1d33331d, 0x28190832, 0x2a2a360c, 0x00820036, 0x1000012a, 0x3002c0ff, 0x8200c001,
+    0x0e32d582, 0x23222301, 0x3327012e, 0x34272627, 0x33373435, 0x12533627, 0x14152705, 0x14150607, 0x07851617, 0x37171622, 0x21051166, 0xeb833435,
+    0x35220484, 0xe9823334, 0x33341326, 0x13153231, 0x0f243487, 0x14161701, 0x37830483, 0x2f22232c, 0x013e1701, 0x34353637, 0x5c822627, 0x33280788,
+    0x17161732, 0x31163307, 0x37082a82, 0x86211802, 0x4d070651, 0x3b281f7f, 0x2f010104, 0x04561629, 0x03050805, 0x073a0a01, 0x2b392906, 0x02021b02,
+    0x01020204, 0x07072a14, 0x0801142a, 0x0c1e0202, 0x1f0b0808, 0x0c84158c, 0x021b3d08, 0x02083525, 0x3a070629, 0x0403010a, 0x56040509, 0x012f2916,
+    0x48603b05, 0x45570458, 0x0514133b, 0x290a0906, 0x07033c66, 0x03030504, 0x2b471a19, 0x05070805, 0x442d3725, 0x01124109, 0x21324284, 0x010e0109,
+    0x02022109, 0x01150108, 0xfe080820, 0x188e15e0, 0x123f8a83, 0x25350741, 0x25370d0c, 0x05080705, 0x181b472b, 0x04050303, 0x663d0207, 0x1a1a1129,
+    0x4e00003b, 0x1e250c07, 0x00009800, 0xa3761825, 0x14112213, 0x05e24d07, 0x30032130, 0x16171514, 0x22231415, 0x011e012f, 0x6c413632, 0x013c2e0a,
+    0x07273431, 0x35222306, 0x26013f34, 0x20248227, 0x08038207, 0x27070627, 0x31331617, 0x35343532, 0x34363727, 0x3437012f, 0x22233435, 0x34270723,
+    0x27071522, 0x15222322, 0x07011f14, 0x2d048406, 0x33161415, 0x07013f32, 0x3435012e, 0x03822637, 0x87070621, 0x0106226c, 0x0d5c4eb6, 0x444e4320,
+    0x1d013005, 0x080325fd, 0x09180203, 0x093d4e3d, 0x82030218, 0x032208f6, 0x03150525, 0x1b020803, 0x180a1f10, 0x02131910, 0x0401010d, 0x03031209,
+    0x01040912, 0x08050e01, 0x10820c05, 0x83080121, 0x01083611, 0x01010103, 0x1913020b, 0x1f0a1810, 0x08021b10, 0x05150303, 0x24771846, 0xb4fe370e,
+    0x1c120b0f, 0x01100112, 0x04022001, 0x26150208, 0x15263131, 0x6e830302, 0x52822020, 0x02161222, 0x1a2e3782, 0x120f1120, 0x1611131e, 0x23041f14,
+    0x6b820109, 0x01030f26, 0x0e040106, 0x0a246d82, 0x6f040470, 0x04207e84, 0x03211282, 0x2f74820f, 0x21070103, 0x16141f04, 0x121e1311, 0x1a20110f,
+    0x162bb283, 0x06000012, 0xbfff0000, 0x5d014102, 0x2d3e057b, 0x49003b00, 0x00005700, 0x011d1601, 0x05072625, 0x013f3435, 0x07173236, 0x15051736,
+    0xab440614, 0x012e2705, 0x3517013d, 0x0d822634, 0x14011d23, 0x20208216, 0x2e0d8c37, 0x1f141517, 0x3d361601, 0x012f3401, 0x8c270626, 0x0220080d,
+    0xf7fe162a, 0xf7fe1717, 0x200eec16, 0x0e0e2c0e, 0x0b0e1201, 0x0a160af2, 0x800e0bf2, 0x06500406, 0x90230383, 0x82600406, 0x06602608, 0x045006b0,
+    0x22038306, 0x82600690, 0x08038208, 0x076c0127, 0x07503117, 0x17315007, 0x05054f07, 0x5204046d, 0x03110be5, 0x36020236, 0xe50b1103, 0x05041022,
+    0x06011601, 0x21068311, 0x06822d02, 0x851a0221, 0x021a2b0d, 0x02061011, 0x04050116, 0x21820611, 0x11240523, 0x841a8206, 0x021a390d, 0x03000005,
+    0xbffff3ff, 0xc0010b02, 0x72006a00, 0x00007a00, 0x07011e01, 0x2f25f083, 0x36170701, 0x05aa4d31, 0x012f2623, 0x08cc5215, 0x0e073524, 0x5e602301,
+    0x37172405, 0x82060727, 0x262736ec, 0x17363736, 0x15060716, 0x011f1614, 0x3f262735, 0x35012e01, 0x05085534, 0x0f161722, 0x15215382, 0x05e65414,
+    0x3e371522, 0xff431982, 0x34072105, 0x29083e82, 0x2736011f, 0x36371714, 0x0106012f, 0x103238a0, 0x08351f0a, 0x2f1d500b, 0x0e0e0a05, 0x010d090a,
+    0x1a131029, 0x01291013, 0x1083090d, 0x2f056108, 0x080b501d, 0x190a1538, 0x090b3c2f, 0x26190709, 0x072c4d21, 0x1f1a0804, 0x0406191e, 0x073b3b08,
+    0x1e190504, 0x03081a1f, 0x224c2c06, 0x04031926, 0x081b5509, 0x1d060d0d, 0x0e051d80, 0x011b070e, 0x3f731e7e, 0x0a3d2427, 0x21142a06, 0x0e140e01,
+    0x1e1c090c, 0x130d1209, 0x09120d13, 0x0c091c1e, 0x36081282, 0x2a142101, 0x18410a06, 0x20804519, 0x0a0a0907, 0x46282f28, 0x24143616, 0x0f110907,
+    0x331e1f33, 0x07090b0f, 0x09073535, 0x1e330f0b, 0x110f331f, 0x14240709, 0x82461636, 0x05043426, 0x74090506, 0x26111420, 0x22130c26, 0x260c1322,
+    0x46141126, 0x112a0aff, 0x37002700, 0x16010000, 0x4018011d, 0x6842085c, 0x15332305, 0x03863533, 0x1d823220, 0x60055651, 0x33230ec7, 0x5e0af601,
+    0x0a270536, 0x050c05eb, 0x826040cb, 0x07102701, 0x0940fe09, 0x43781007, 0x82fe2005, 0x070932b0, 0x0b046401, 0x09090725, 0x040b2507, 0xbe02025a,
+    0x270083a0, 0x30300709, 0x09600907, 0x2008f06e, 0x05eb5100, 0x62014021, 0x392805e3, 0x4c003d00, 0x013a0000, 0x0d128318, 0x8e833720, 0x07020e2f,
+    0x22230622, 0x2e27012e, 0x34352702, 0xf7511836, 0x2e352409, 0x83012b01, 0x35052611, 0x15251523, 0x200a8323, 0x27328321, 0x8b062223, 0x40202b2a,
+    0x0805f966, 0xc0204027, 0x1707130d, 0x2202292c, 0x14110709, 0x172c2901, 0x020d1307, 0x13130d00, 0x2403c00d, 0x0d136019, 0xfe402001, 0x290783e0,
+    0xe0130d40, 0x1620261a, 0x1d838630, 0x16308635, 0x130d13a0, 0x1e211206, 0x01100916, 0x0512221d, 0x82130d10, 0x29508227, 0x20211986, 0x4080130d,
+    0x5e836040, 0x600d1326, 0x000c0026, 0x2807b75c, 0x00130009, 0x0027001d, 0x2bd78232, 0x00530048, 0x0069005e, 0x00b20074, 0x7705156e, 0x162206e8,
+    0x0997011d, 0x22363323, 0x5fcd8226, 0x0abe0712, 0xc84c0520, 0x3315210c, 0x5b05fc57, 0x3b2007a7, 0x08cd4218, 0x6e583b20, 0x52162005, 0x32280ba1,
+    0x09079036, 0x80070940, 0xe0200584, 0x7d270b8a, 0x0810131a, 0xa8732008, 0x7b022006, 0x382905a1, 0x07b0c028, 0xfe070909, 0x2b058360, 0x3828c0b0,
+    0x07200709, 0xc00d1309, 0xc0230784, 0x8201130d, 0x8290206f, 0x07092176, 0x202a058f, 0x20080d13, 0x122e0c0c, 0x09ba130d, 0x5b85d320, 0x82382821,
+    0x84798267, 0x38402276, 0x21158528, 0x9d84130d, 0x0013b022, 0x2d06234e, 0x00c00180, 0x00180009, 0x00500043, 0x85181500, 0x252e0815, 0x34352621,
+    0x013f3637, 0x16171617, 0xa0711415, 0x062e5d08, 0x07822320, 0x0e012f25, 0x18011d02, 0x4b084e94, 0x3323056e, 0x84041e03, 0x37362114, 0x2c05aa6f,
+    0x9afe4302, 0x2b45581d, 0x452b0808, 0x2bd78358, 0x131a1320, 0x0c0c1840, 0x401b1005, 0x20200a82, 0x802d1383, 0x11160803, 0x1020800e, 0xfe400120,
+    0x311182c0, 0x431f1ccd, 0x0a352b38, 0x382b350a, 0x133c1f43, 0xd118800d, 0x482a07d7, 0x08072415, 0x15260a03, 0x27824048, 0x84400d21, 0x40012d1a,
+    0x15120501, 0x20201221, 0x000a301c, 0x03370082, 0xc0ffffff, 0xc5010002, 0x67000e00, 0x00008000, 0x34262701, 0x5036013f, 0x06220558, 0x24421622,
+    0x2e222a06, 0x35273502, 0x16173634, 0x065d5f33, 0x06010f24, 0xf182012b, 0x83230621, 0x2219831b, 0x82031e17, 0x2634321c, 0x2f26012b, 0x3b362601,
+    0x34363201, 0x07222326, 0x340d8206, 0x17363734, 0x1617011e, 0x3f323307, 0x1d163602, 0x0e071401, 0x22398202, 0x82262703, 0x36032918, 0x03166901,
+    0x07071603, 0x65080583, 0x52070803, 0x1b253b3b, 0x010a1327, 0x2f23030b, 0x1e15150b, 0x291d190a, 0x354b1216, 0x1124412a, 0x0301040b, 0x3121100b,
+    0x26261a20, 0x0409211a, 0x09090410, 0x1c1c1420, 0x0a0d1114, 0x05061a0a, 0x31213828, 0x2f110908, 0x71180a0f, 0x02021208, 0x1624310e, 0x07161929,
+    0x0b130602, 0x27260e04, 0x16830135, 0x6d850803, 0x03350682, 0x64293b80, 0x130d3424, 0x26070613, 0x2b040306, 0x0f64090f, 0x08708215, 0x35211f69,
+    0x31301f4b, 0x06050617, 0x15140402, 0x34260e1f, 0x20080126, 0x281c0f08, 0x07070b1c, 0x060f0414, 0x2e050a26, 0x0a242720, 0x09069a19, 0x0303240a,
+    0x0f120d07, 0x030b1813, 0x0408110c, 0x0d050f08, 0xfeff0300, 0x8202c0ff, 0xa100c001, 0xb100a900, 0x1e240000, 0x26010e01, 0x22230607, 0x27022e27,
+    0x07062726, 0x4633011e, 0x0f8205e2, 0x27220624, 0xd946030e, 0x36322205, 0x7f1d8337, 0x062a0737, 0x023e012e, 0x1617021e, 0x18843736, 0x2e222325,
+    0x86262701, 0x011e2a2a, 0x32331617, 0x2737013e, 0x05f4682e, 0x07141528, 0x17323617, 0x54582637, 0x0f062806, 0x33021e01, 0x823e3732, 0x14162104,
+    0x07227c82, 0x8182020e, 0x16070629, 0x37011e17, 0x6702033e, 0x2420068f, 0x27080786, 0x08136702, 0x16131207, 0x0b0c151f, 0x0406150f, 0x211c0303,
+    0x0a132009, 0x170a0e0e, 0x050e1928, 0x050d100d, 0x1728190e, 0x28081083, 0x21092013, 0x0403031c, 0x0b0f1506, 0x161f150c, 0x08071213, 0x110e1313,
+    0x13160808, 0x040a0806, 0x10171302, 0x0e080c1a, 0x852c8308, 0x17073009, 0x1911192a, 0x25362523, 0x3a1b130b, 0x820b131b, 0x82232009, 0x172a2211,
+    0x22278207, 0x83101a0c, 0x3409852a, 0x04021218, 0x1306080a, 0x11080816, 0x090e8d0e, 0xfe090e09, 0x200684f7, 0x3ba08268, 0x150f0708, 0x11190505,
+    0x17060d0f, 0x0e38230b, 0x2d1c0e14, 0x01011325, 0x1c2d2513, 0x382c0c82, 0x06170b23, 0x19110f0d, 0x0f150505, 0x12329582, 0x08030107, 0x070f0505,
+    0x050e1d1a, 0x0e101103, 0x2582150d, 0x0c0f1036, 0x11342115, 0x19250222, 0x1b25251b, 0x08251013, 0x13102508, 0x192a0b83, 0x11220225, 0x0d152134,
+    0x2882100e, 0x112d0683, 0x1d0e0503, 0x050f071a, 0x01030805, 0x878d8227, 0x00002102, 0x0b2f4218, 0x12000e26, 0x1d001600, 0x3509357b, 0x27263405,
+    0x07361715, 0x37160735, 0x03373615, 0x1415010e, 0x8b773717, 0x57b02f06, 0xd8178141, 0x33732659, 0x57419926, 0x75778117, 0x43673606, 0x67a60b67,
+    0x47728629, 0x09726922, 0x0b3f0122, 0x292f4367, 0x092f6467, 0xc7018028, 0x11000800, 0x42182c00, 0x35250905, 0x013f3405, 0xdaa71815, 0x08744407,
+    0x15823520, 0x48080383, 0x16011f36, 0x6d02011d, 0x70070913, 0x6d1300fe, 0x01090770, 0x256010d0, 0x10602536, 0x0b4c0930, 0x51094c0b, 0x07641508,
+    0x154cc009, 0x09c02f08, 0x1209f907, 0x251b60ee, 0xee601b25, 0x731d0912, 0x0c4b090e, 0x0e094b0c, 0x30848273, 0xff000004, 0x01c001e0, 0x000f00a0,
+    0x002f001f, 0x10e3583f, 0x200c9563, 0x0645623b, 0x0b622b20, 0x270f9306, 0x1c149001, 0xa0fe141c, 0x70200583, 0x48092648, 0x0a8a0a31, 0x18a00121,
+    0x250c9493, 0x090780b0, 0x04840709, 0x8207e021, 0x4f048409, 0x0e8205fe, 0x2520af95, 0x09507318, 0x32213325, 0x44051516, 0xa38706dd, 0x0f9e1720,
+    0xaac00121, 0x059c7d82, 0xdba46020, 0x3b5cae82, 0x01822606, 0x000700c0, 0x2c108228, 0x36342622, 0x07141632, 0x16170727, 0x82a18206, 0x3b3d080e,
+    0x012e2701, 0x3736013f, 0x37011f36, 0x06011e36, 0x2606010f, 0x25361b01, 0x5f253625, 0x136e2318, 0x11d01a15, 0x5c111717, 0x1214202d, 0x28261231,
+    0x0c3a2718, 0x0d031521, 0x01210c58, 0x08248240, 0xcf362528, 0x136e411d, 0x17221731, 0x21471423, 0x0404215c, 0x0a2f2e1e, 0x0b211903, 0x00030a48,
+    0xffff0200, 0x8002c0ff, 0x8182c201, 0x83825120, 0x82050e46, 0x05b75c65, 0x35013f27, 0x30013f34, 0x9dc71833, 0x011d2907, 0x36321614, 0x0534013d,
+    0x20055e4a, 0x05ad6922, 0x86054251, 0x05e4621a, 0x32171624, 0x24821731, 0x03012708, 0x262f131a, 0x100404b3, 0x105a1610, 0x19070175, 0x07060c0a,
+    0x0e090e4d, 0x167a0109, 0x04041010, 0x132f26b3, 0x0f82131a, 0x4d0e3f08, 0x0a0c0607, 0x75010719, 0x13000110, 0x3f27800d, 0x15012f0a, 0x0717600b,
+    0x181d511e, 0x06050bb0, 0x820b1a07, 0x074d1a17, 0x50070909, 0x17078f0d, 0x01150b60, 0x273f0a2f, 0x13130d80, 0x1683500d, 0x171a4d2c, 0x061a0b82,
+    0xb00a0607, 0xd0821d18, 0x00000424, 0x1f5dc0ff, 0x00312406, 0x5d56004e, 0x0f351821, 0x1f062202, 0x33060701, 0x17373332, 0x2f323332, 0x26363701,
+    0x2ecc8223, 0x06222722, 0x32331614, 0x34353637, 0x45223023, 0x3a220592, 0x12823101, 0x26233422, 0x2e18345d, 0x02190b93, 0x04120101, 0x01010401,
+    0x82011616, 0x12043f06, 0x19020101, 0x3b04010b, 0x2f44442f, 0x07051315, 0x38270103, 0x03012738, 0x06060201, 0x4d5d7514, 0x78210817, 0x02040416,
+    0x0c041911, 0x1119040c, 0x16040402, 0x60434302, 0x05020743, 0x384e3806, 0xfe070e01, 0x05575d8d, 0x9b580320, 0x00192408, 0x825b0021, 0x531620e9,
+    0x3d210702, 0xbe541801, 0x3233230a, 0x39630417, 0x1e372306, 0x40191501, 0xba7109f2, 0x16172105, 0x20050f69, 0x06604d2f, 0x82343521, 0x011d310f,
+    0x0f161716, 0x26270601, 0x0622012b, 0x01171415, 0x13eb0b1a, 0x78fffe3c, 0x54785454, 0x19120eab, 0x08100812, 0x07080e11, 0x0606040c, 0x07051c07,
+    0x14932d09, 0x14070534, 0x07071c07, 0x100a0764, 0x7aac7a2c, 0x3848567a, 0x41820907, 0x45785439, 0x120f1805, 0x0810011a, 0x0b011008, 0x040b0705,
+    0x05080403, 0x950d030a, 0x06c34916, 0xc0010123, 0x22fb8300, 0xa335002d, 0x058f5ffd, 0x27220626, 0x16343526, 0x9b061141, 0x3e712dd7, 0x0803432b,
+    0x14404303, 0x0e140e0e, 0x9c2abb99, 0x4f241f2b, 0x244f0303, 0x2782351f, 0x00140e2b, 0xff040000, 0x02c0fffa, 0x3b9f8200, 0x001b0010, 0x00340025,
+    0x010e3700, 0x23060717, 0x26272622, 0x35013f36, 0x15351533, 0x2306274c, 0x32370617, 0x2106354c, 0x18820333, 0x8f431420, 0x08278205, 0x28d73720,
+    0x1a151616, 0x0d2e1920, 0x571e1112, 0x0d13a0a0, 0x08060280, 0xc0130dc0, 0xc0200d13, 0x1a827333, 0x1a832d20, 0x5e1e8935, 0x19131129, 0x16482117,
+    0xe0a0b041, 0x130d2020, 0x82100e02, 0x26088223, 0xd0b0f0fe, 0x85572640, 0x219b821d, 0x78180002, 0x1b2807a3, 0x00003b00, 0x010f1625, 0x0e724a18,
+    0x013f2628, 0x37011f36, 0x97841736, 0x2b061429, 0x010e0301, 0x182f2223, 0x3409aa9a, 0x13011f32, 0x0233013e, 0x2e0c0c3b, 0x160c0c2e, 0x2e2e0b0c,
+    0x8b06820b, 0x0a032d0d, 0xc30a0e0e, 0x10200662, 0x2c58121f, 0x51280c83, 0x553a0a13, 0xc50b1202, 0x16202e93, 0xe52b4a85, 0x0a300a0e, 0x1589fe0e,
+    0x84a41c14, 0x6a11250a, 0x0d0b4301, 0x022eb788, 0x1c00c001, 0x00003900, 0x15163205, 0xe7420714, 0x32332305, 0x0a821617, 0x62263021, 0x3621061e,
+    0x064c5537, 0x4418b483, 0x4e080e1c, 0x07540101, 0x2e2b0b09, 0x6a96966a, 0x030c2c2e, 0x02070d02, 0x577c7c57, 0x07a30702, 0x0d370403, 0x02040701,
+    0x03444403, 0x01070402, 0x0304370d, 0x03224c07, 0x1222030c, 0x040b0609, 0x96d49610, 0x0c0d0510, 0x7cae7c01, 0x0c01fc01, 0x824c3604, 0x24242e25,
+    0x4c050601, 0x010c0436, 0x0606450b, 0x08aa8245, 0xff080023, 0x01c0fffa, 0x00c001d6, 0x0020001d, 0x00290026, 0x002f002c, 0x00350032, 0x16172500,
+    0x07012b06, 0x054e4106, 0x27013f25, 0x553b3626, 0x2c0805d3, 0x0f163233, 0x07172301, 0x17072327, 0x33070333, 0x07371707, 0x37172733, 0x27333723,
+    0x0b359601, 0x386b1516, 0x380b2a0b, 0x0b16156b, 0x080e8d35, 0x14284222, 0x35703520, 0x17387035, 0x1414b82e, 0x8d142828, 0x28902e17, 0x1359c014,
+    0x12125e24, 0x5913245e, 0x012e0988, 0x58583721, 0x260e0158, 0xb0212138, 0x06827f21, 0x2709134d, 0x000900c9, 0x00270013, 0x372fc482, 0x011f3236,
+    0x34352311, 0x1d162137, 0x82112301, 0x2717240f, 0x83151617, 0x07262312, 0x1383010e, 0x013f3429, 0x37271736, 0x822b2636, 0x822220c6, 0x055345bc,
+    0x013b1636, 0x3f321617, 0x36323301, 0x040c0446, 0x02078026, 0x26800772, 0xe63b0a82, 0x2d600c80, 0x601e171e, 0x4814800c, 0x03021313, 0x01192703,
+    0x27190106, 0x8d020303, 0xfb2f080e, 0xfe2b0505, 0x080ae2f0, 0x01e20a08, 0x05052b10, 0x0f0a66be, 0x1d6086fe, 0x26040527, 0x7a015d18, 0x10660a0f,
+    0x021f1fe8, 0x02022805, 0x88020528, 0x0b002109, 0x2a08af4f, 0x00050002, 0x00140011, 0x821b0017, 0x00512fd1, 0x00570054, 0x2500005d, 0x07373327,
+    0x7a642427, 0x26222f05, 0x13341135, 0x37331737, 0x21110517, 0xd1540111, 0x20c38308, 0x25c48433, 0x34353637, 0x0583012f, 0x2321e784, 0x8be98431,
+    0x0736083f, 0x010f2317, 0x37271727, 0x01071733, 0x51241240, 0x9efe1312, 0x281c1c28, 0x1312dd1c, 0xfe12137c, 0xfe8001dd, 0x1d0303c3, 0x090c031d,
+    0x0c061d3c, 0x3c1d060c, 0x108f060c, 0x84730121, 0x12e02833, 0x12132c24, 0x82212142, 0x1d523302, 0xc81f1f89, 0x40fe0d13, 0x0d13130d, 0xfe0dc001,
+    0x00821fdb, 0xa0019837, 0x160160fe, 0x31050b05, 0x08060531, 0x0a0a310d, 0x05050b31, 0x200e8a06, 0x26348aaf, 0x1e1a1d7f, 0x82386f1e, 0x00002100,
+    0x2e0a3b52, 0x00390035, 0x0100003d, 0x14153732, 0x50012b06, 0x09820742, 0x21051a5d, 0xb079013d, 0x05204809, 0x56503620, 0x33163307, 0x35331507,
+    0x15233517, 0x40487801, 0x30200d13, 0x35640907, 0x50ff2007, 0x11850511, 0x130d202c, 0x60084840, 0xa00160a0, 0x0b826020, 0x20070925, 0x83f00907,
+    0x85f0202c, 0x82108405, 0x20602341, 0x00834060, 0x2c0a634d, 0x00440040, 0x25000048, 0x0f060716, 0x5e471801, 0x29138813, 0x26272627, 0x2735013f,
+    0x05843426, 0x013f3625, 0x82011e17, 0x16172233, 0x20058214, 0x2aaa8225, 0x21352105, 0x01087902, 0x84370801, 0x05d26671, 0x37200585, 0x21081683,
+    0x09093759, 0x03061b77, 0x07b7b707, 0x771b0603, 0xfe370909, 0x00ffc0c0, 0xc0fe4001, 0x080a052f, 0xd0851404, 0x1433058b, 0x050a0804, 0x04124031,
+    0x40320414, 0x04100610, 0x82045656, 0x32402106, 0x12231082, 0x8240e040, 0x00003702, 0xff000002, 0x010702fb, 0x00110085, 0x1300002d, 0x11151636,
+    0x4c450614, 0x4505200a, 0x1f3f167e, 0xd7071601, 0x0b1e1e0b, 0x0e0a6659, 0x01660a0e, 0x0c0c2d50, 0x2e0b0b17, 0x170b0b2e, 0x8c2d0c0c, 0x7901300d,
+    0xfe100c0b, 0x0b0c10b0, 0x900a0e59, 0x93600e0a, 0x43328624, 0xc82a05ef, 0xb801f001, 0x0f000700, 0x70181d00, 0x19470b47, 0x32262307, 0x4f453436,
+    0x06a94a06, 0x07820620, 0x2f05e14c, 0x13131aeb, 0x5008131a, 0x50283838, 0x28507070, 0x0d2bb318, 0x1b82e720, 0x6d1a132b, 0x70385038, 0x503870a0,
+    0x820e84b8, 0xffff3473, 0x4002c0ff, 0x1b00c201, 0x44003400, 0x00004c00, 0x181d2201, 0x2f15abb8, 0x01072111, 0x06010f16, 0x012e2726, 0x1f013e37,
+    0x2f260c84, 0x37170601, 0xc2541736, 0x08ca470f, 0xb8188820, 0x2b080dbf, 0x8001e0fe, 0x0570fe11, 0x190a270c, 0x46024607, 0x270b1908, 0x051a050c,
+    0x1b1b2d0c, 0x01050c2d, 0x13251b5b, 0x0da0fe0d, 0x831b2513, 0x0125cf84, 0x08100880, 0x3f038740, 0xfe406001, 0x18070df1, 0x4d080306, 0x05094ecf,
+    0x0d071807, 0x05010c3f, 0x01054a4a, 0x1b25700c, 0x0d0bb918, 0xff570020, 0x057b4a05, 0x1e000724, 0xdf823000, 0x5c005422, 0x2009e74b, 0x15a96717,
+    0x06220625, 0x5f171415, 0x3626083a, 0x06073435, 0x0383011f, 0x013f1623, 0x23038217, 0x37012f36, 0x26260382, 0x2627010f, 0xb3671707, 0x41122006,
+    0x01270692, 0x09090e17, 0x67a0090e, 0xaf300ec1, 0x09202f42, 0x09074007, 0x0703c320, 0x03074747, 0x6222c482, 0x06820862, 0x46460722, 0xfa200d88,
+    0x2005814a, 0x21428477, 0x47823801, 0xe70e0922, 0x3910dc67, 0x201a261e, 0x09070d13, 0x130d0709, 0x08811a20, 0x031e1e03, 0x03080e08, 0x06842b2b,
+    0x2a280d86, 0xef08032a, 0x121c1240, 0xaf474786, 0x01802708, 0x002000c7, 0x017a0023, 0x013b250f, 0x3f262713, 0x2a056748, 0x0f16011f, 0x07251301,
+    0x18700233, 0x2a09f653, 0x0935ef19, 0x0a0d190d, 0x820a2929, 0x35092706, 0x74e9feef, 0x6a5609e8, 0x4a012908, 0x13090d4a, 0x38380d09, 0x4a250684,
+    0xa0a0b6fe, 0x06174a00, 0xa0010030, 0x35002b00, 0x45003d00, 0x1e010000, 0xe0443301, 0x26222406, 0x5507013d, 0x2b2b0627, 0x35262201, 0x22263411,
+    0x84363426, 0x033e2612, 0x1415013f, 0x21238306, 0xf0180617, 0x01260eb8, 0x2e460923, 0x7d84110f, 0x20802008, 0x0709130d, 0x13261ab0, 0x0d13131a,
+    0x33133828, 0x40ab1c33, 0x40385038, 0x09090e0f, 0x8459090e, 0x00012505, 0xce043a2c, 0x902ccd83, 0x100d1360, 0x1a260907, 0x130d0001, 0x38303382,
+    0x271d5628, 0x4060040e, 0x38382886, 0x50408628, 0x2d0b7450, 0xfffcff02, 0x01c401c0, 0x001700c0, 0x4e180037, 0x1e4a093d, 0x15272405, 0x82233523,
+    0x01062403, 0x7f230616, 0x223a1254, 0x36013f26, 0x17322133, 0x354b3070, 0x304b3540, 0x30303028, 0x054e0128, 0xba841013, 0x3f069845, 0x0a061410,
+    0x6a011708, 0x40010817, 0x4b358080, 0x8080354b, 0xd0c5172e, 0xfe17c5d0, 0x701b0ffc, 0x7020b583, 0x1b240585, 0x1616200f, 0x2008cb41, 0x23978242,
+    0x003c001c, 0x28065975, 0x2622012b, 0x37363435, 0x24058334, 0x17163233, 0x2f048236, 0x36371415, 0x07060716, 0x35362726, 0x22232634, 0x1e850882,
+    0x1e172508, 0x010e0701, 0x01161415, 0x2f2a1f57, 0x3828f021, 0x38011d24, 0x0d2c1b28, 0x261a1a12, 0x040706d5, 0x25115435, 0x40081182, 0x0a071113,
+    0x114f7102, 0x05020612, 0x5f6d2923, 0x211f2e02, 0x1f28382f, 0x04010a31, 0x1b382801, 0x1a261217, 0x0b012711, 0x24054105, 0x28050610, 0x07070738,
+    0x70500c0d, 0x030d0103, 0x46294614, 0x26af825b, 0xff000003, 0x828002bf, 0x551d20af, 0x252105e1, 0x0b0b761e, 0x0628b18e, 0x06171625, 0x2606010f,
+    0x21087a5e, 0x665f1f36, 0x83012009, 0x222625cc, 0x34371406, 0x1721e083, 0x28dd8206, 0x3f02012e, 0x2838241d, 0x08c682fe, 0x01253426, 0x36222e42,
+    0x1a12100e, 0x52fe0126, 0x090f150f, 0x030d094c, 0x0808531d, 0x0d031d53, 0x05295809, 0x58290512, 0x30081282, 0x090d111e, 0x425c210e, 0x1923311c,
+    0x083b0a29, 0x271d0d0c, 0x1f310a7a, 0x28383828, 0x01033626, 0x422e0206, 0x260a1e24, 0x1604011a, 0x130f0810, 0x883d8c19, 0x02593250, 0x210d1406,
+    0x232e5c42, 0x24171b31, 0x05080444, 0x27f2822f, 0xfeff0a00, 0xe201beff, 0x0538f382, 0x17000e00, 0x27002000, 0x39003000, 0x48004200, 0x00004c00,
+    0x22271737, 0x0624e082, 0x34013d26, 0x0735de82, 0x17333626, 0x27061415, 0x34262703, 0x1636013f, 0x37231707, 0x05596036, 0x14011d26, 0x26032f06,
+    0x16272582, 0x32030714, 0x83010f16, 0x37270835, 0x23061617, 0x07332707, 0xd06c6b27, 0x06020404, 0x02040601, 0x0203414d, 0x0407cc03, 0x02025172,
+    0x04090597, 0x825f6d3d, 0x7d5f2fed, 0x01060402, 0x0450104c, 0x02970509, 0x23820202, 0x0704c332, 0x04026a75, 0x6419d004, 0xbee96464, 0x38040816,
+    0xa23f1582, 0x2e010203, 0x160602e7, 0x02050442, 0x01315901, 0x03620204, 0xa8990509, 0x1da80808, 0x82030201, 0x0327081f, 0x058f1b7a, 0x02620309,
+    0xd5fe0104, 0x02570206, 0xdf420405, 0x1608049c, 0x00b0b0c5, 0xff000003, 0x01c001bd, 0x820b00cb, 0x002326f1, 0x14160100, 0x08f3560f, 0x82163621,
+    0x20bc85c9, 0x82f38327, 0x2f2408ee, 0x01352601, 0xc60404a6, 0xa60404c6, 0x04b42020, 0x08982008, 0x0408f010, 0x980810c4, 0x02520120, 0x7777020a,
+    0x653b0482, 0x03921414, 0x26c60505, 0x0a055d13, 0x056de00a, 0xe0740305, 0x5d050a0a, 0x82002613, 0x00032a00, 0x02c0ff20, 0x00a30120, 0x05877f1e,
+    0x48172521, 0xbd55129f, 0x16142306, 0x1d842533, 0x35271522, 0x33248683, 0x011f1632, 0x06300482, 0x06222634, 0x01321614, 0x0709962a, 0xa0090740,
+    0x1c330584, 0x131a1324, 0xa0010d13, 0x80201a26, 0x351c0714, 0x83041108, 0x0970281d, 0x0e09090e, 0x43da36e0, 0xd625099e, 0x0d1f310a, 0x2f2e8213,
+    0x261a2070, 0x0b962e24, 0x0a1b0808, 0x0e090e08, 0x09202983, 0xff32a784, 0x02bffffc, 0x00c00182, 0x00410010, 0x37000047, 0x00782606, 0x14152405,
+    0x82222317, 0x1e052f0b, 0x010e0701, 0x26222123, 0x3e373435, 0xb2183702, 0x27270863, 0x013b3626, 0x63011f32, 0x2b250558, 0x012f2201, 0x30348223,
+    0x17160637, 0x0c123716, 0x11750909, 0x0f78122a, 0x087482df, 0x7f015b45, 0x03022320, 0x0dfe3048, 0x470e0a08, 0x2d5abc55, 0x04043c33, 0x04033e3c,
+    0x0a10ed05, 0x0f03064b, 0x0e1f1309, 0x1b401c09, 0x0b0e030e, 0x01c00513, 0x0e750716, 0x2b570c02, 0x0714292a, 0x3c104245, 0x82402f23, 0x033608b9,
+    0x03191110, 0x6d365f1e, 0x020a0219, 0x0a043219, 0x0a09630d, 0x121c0708, 0x1d251709, 0x110cae0e, 0x00130101, 0xff000001, 0x010302bf, 0x002800c1,
+    0x07160100, 0xc0820626, 0x23061728, 0x07012b22, 0xae821706, 0x2722062f, 0x27063726, 0x33363426, 0x3f161732, 0x08d88201, 0x0132364c, 0x1f0233cf,
+    0x011e1a48, 0x011f1d1e, 0x0f285601, 0x32230409, 0x22081712, 0x19231216, 0x0f160b0c, 0x8c323f28, 0x49338e01, 0x1e190911, 0x290a2158, 0x0c0b160e,
+    0x16122319, 0x12170822, 0x09042431, 0x4f56280f, 0x0000323f, 0x7f820c00, 0x1805db4f, 0x3f0be76e, 0x007f006f, 0x0099008f, 0x00ab00a2, 0x07163700,
+    0x2b060706, 0x37262201, 0x013e3736, 0x011e2517, 0x08677b18, 0x36373624, 0x4f180332, 0x6e180c2f, 0x1320110f, 0x2f233f84, 0x82012e01, 0x1636233f,
+    0xd182011f, 0x3f262726, 0x17163601, 0x06240182, 0x06162723, 0xf44a4f82, 0x215e8205, 0x4f9e1716, 0x32362725, 0x82141117, 0x2735238f, 0x08853736,
+    0x17161323, 0x08118415, 0x050b8121, 0x0d020105, 0x010a0761, 0x0e031303, 0x07110106, 0x04250306, 0x040b2a0b, 0x07060325, 0x18b0401f, 0x2008e086,
+    0x35098860, 0x090b05ad, 0x530b0908, 0x1e050306, 0x030d062a, 0x01020df5, 0x0f820505, 0x43820e20, 0x070a0127, 0x0603052a, 0x26228453, 0x0d032405,
+    0x92492a06, 0x0aa02943, 0x10080a0c, 0x140c4008, 0x80220582, 0x05820c14, 0x0d07fd3b, 0x0a0e0e0d, 0x062b2e07, 0x02880404, 0x0b68060d, 0x0d06680b,
+    0xe0fe0802, 0xfd9f1809, 0x05f37708, 0x01350f84, 0x06080c1c, 0x33070908, 0x24060e04, 0x07050318, 0x0d0e0ed6, 0x2c0e820d, 0x2e2b0604, 0x06a30a07,
+    0x0733040e, 0x26228209, 0x05075a0c, 0x94e71803, 0x02ee3444, 0x08dafe02, 0x0c12fd08, 0x0808e5fe, 0x120c1b01, 0x180808fd, 0x2a0ccb87, 0x002d0011,
+    0x0068004f, 0x18000071, 0x2211538b, 0x57343503, 0xab6f0a02, 0x82262005, 0x3b362d06, 0x32173201, 0x2f343536, 0x34352601, 0x08768b18, 0x14150627,
+    0x1516011f, 0x24338214, 0x3314011d, 0x823c8337, 0x16172408, 0x85363732, 0x220d823c, 0x18352607, 0x27153085, 0x14080860, 0x08141c1c, 0x07300082,
+    0x08070909, 0x19122c08, 0x0b02160e, 0x0c08080c, 0x60280988, 0x24081008, 0x24050e05, 0x10220782, 0x8a187910, 0xe82713bd, 0x141c0810, 0x821c1420,
+    0x07092d21, 0x60090720, 0x0c101017, 0x07020113, 0x0a8a1082, 0x0808782a, 0x05273715, 0x15372705, 0x24080982, 0x1f1a1a1f, 0x060a07b4, 0x05000780,
+    0xc0ff0000, 0xc0018001, 0x42000b00, 0x5e004e00, 0x00006e00, 0x07222301, 0x06cf6c35, 0x1415172c, 0x2115010f, 0x3d262735, 0xfc821601, 0x04853720,
+    0x0f061723, 0x05014101, 0x3f323327, 0x37013e01, 0x20f38532, 0x22378626, 0x7c2b2627, 0x1521079a, 0x9d6f1805, 0x3323210d, 0x01240f8e, 0x08083000,
+    0x2e08bd84, 0xff241c80, 0x08251b00, 0x0e122008, 0x0b20120e, 0x151b0c0b, 0x0301061b, 0x0402020e, 0x271a0603, 0x230d081f, 0x07091c14, 0x20261a70,
+    0x84200f11, 0xb0fe2333, 0x08840907, 0x20061342, 0x230e8320, 0x93032001, 0x29080783, 0x1c2858f0, 0x1b404024, 0x034e3525, 0x1a060c0c, 0x09281209,
+    0x03040302, 0x09040208, 0x08021f28, 0x141c0810, 0x3f250907, 0x2d837006, 0xa658b020, 0x6c802006, 0x0935060e, 0x0907a007, 0x00030000, 0x01b9ff00,
+    0x00c30180, 0x0026001e, 0x0af94d2e, 0x010f2627, 0x26012f06, 0x82068522, 0x35262405, 0x4c363411, 0x078707c7, 0x7452ba3f, 0x0c190714, 0x0b0b2b0a,
+    0x050e0529, 0x2b0b0b29, 0x07190c0a, 0x1a076c14, 0x131a1313, 0x08058493, 0x02c00121, 0xf0fe5171, 0x1208080b, 0x0c300b09, 0x05052e0c, 0x300c0c2e,
+    0x0812090b, 0x08010b08, 0x82de7650, 0x3202872a, 0xff020000, 0x02bfffff, 0x00c00147, 0x0027001b, 0x85162500, 0x013f2282, 0x08908327, 0x27013d42,
+    0x011f3236, 0x37170716, 0x17051736, 0x06071716, 0x37342622, 0x3b021625, 0x0b5a0c0c, 0x0c0c160c, 0x1a241d0b, 0x2f5a1331, 0x1a2d2f84, 0x0b0b1d09,
+    0x31f8fe0c, 0x12ee0704, 0x00142534, 0x0bfe05ff, 0x0b212682, 0x21168217, 0x2682091c, 0x2d131a23, 0x3427822f, 0x0b0c1d24, 0x0431080b, 0x2514ff05,
+    0x07ee1234, 0x10000000, 0x07536100, 0x0f000726, 0x1f001700, 0x2f3f8d82, 0x78006d00, 0x8e008300, 0xa4009900, 0xba00af00, 0xd000c500, 0x33130000,
+    0x23011d32, 0x86233435, 0x013b2107, 0x07870f85, 0x82151721, 0x200c821c, 0x201f8621, 0x55411821, 0x2e116108, 0x34013d23, 0x0ba16136, 0x61220421,
+    0x242008ac, 0x2014b761, 0xab158916, 0x10e8240a, 0x82382008, 0x20078303, 0x25078248, 0x10082060, 0x0983fe08, 0x07100223, 0x21476109, 0x1a07092a,
+    0x060c0e14, 0xb2fd1806, 0x01210785, 0x20078512, 0x200685de, 0x20068c32, 0x860d8c92, 0x2001251b, 0x08787808, 0x09220393, 0x40617007, 0x0770220f,
+    0x22158209, 0x83c0130d, 0x13c02207, 0x2a0f820d, 0x060b1020, 0x270a0a1b, 0x88100b0e, 0x20138909, 0x891d9240, 0x20099d27, 0x0b9f5200, 0x23000f24,
+    0x394e2b00, 0x37333810, 0x36372317, 0x0607013f, 0x011f1415, 0x2f013f23, 0x37010f01, 0x83011f07, 0xf0012109, 0xb364a583, 0x10b03605, 0x24116f90,
+    0x060438bc, 0x4010d056, 0x40202040, 0x10202080, 0x43038210, 0x202f06f8, 0x20400907, 0x6b1526fa, 0x0d0a0aa9, 0x8220ca0c, 0x20402221, 0x082184c0,
+    0x00201022, 0xfffeff04, 0x018001bf, 0x000a00c0, 0x00480019, 0x17000050, 0x0e071737, 0x27222301, 0x0e37012e, 0x2e207782, 0x3e267382, 0x011e1701,
+    0x03191707, 0x22210cf7, 0x249d822f, 0x1d161731, 0x05504e01, 0x35262732, 0x3e013f34, 0x1f323301, 0x34353301, 0x22263336, 0x3a05fc5b, 0x19342351,
+    0x040b1103, 0x120d0d04, 0x40070b02, 0x1a010706, 0x07213a08, 0x83e70207, 0x102a08c7, 0x0d300907, 0x0114160a, 0x1a13132f, 0x01095713, 0x1420051b,
+    0x232f1118, 0x285c0709, 0x1c281c1c, 0x65358a18, 0x03010d0b, 0x3982d117, 0x0b01102f, 0x221f6207, 0x060b0208, 0xfe07092b, 0x234183c0, 0x501709f0,
+    0x1a303d82, 0x13130d53, 0x0a56530d, 0x6b04040d, 0x2f111914, 0x40205982, 0x1c223f82, 0x58180028, 0x3c240a07, 0x00004400, 0x4e052d64, 0x23200a5f,
+    0x2208d94a, 0x88272206, 0x21c4820b, 0x81641732, 0x33362608, 0x3e171632, 0x07374f02, 0x1945022a, 0x090d1322, 0x09072007, 0x0805ad47, 0x337a3325,
+    0x07400709, 0x49507009, 0x100a0e37, 0x0f110e0a, 0x070c301d, 0x0e801a1f, 0x090e0909, 0x1a2a6001, 0x82130d5c, 0x2833822e, 0x090907b0, 0x17174707,
+    0x2ebf8447, 0x31295e42, 0x0a0e0e0a, 0x1a21060e, 0x4f090f03, 0xb384052d, 0x4102c028, 0x4900c001, 0xb3825100, 0x0f14152c, 0x2f260601, 0x15301502,
+    0xa3880714, 0x2507595d, 0x3526012f, 0x04833f34, 0x06353623, 0x76a2181d, 0x1533240a, 0x46013b36, 0x072405b1, 0x17160706, 0x081abe18, 0x14400228,
+    0x05180b21, 0x46511013, 0x86250805, 0x09021a18, 0x030c4208, 0x1a040219, 0x0911011f, 0x09071007, 0x2b1d2434, 0x78354ba0, 0x04010504, 0x09060712,
+    0x2eca8547, 0x08164d73, 0x0b09050d, 0x01660726, 0x83b2212d, 0x179634c4, 0x0c086940, 0x0807640c, 0x1d440b0c, 0x01050229, 0x8338130d, 0x24382f18,
+    0x35210134, 0x1304064b, 0x0907080b, 0x41830920, 0xff02002d, 0x02c0fff9, 0x00c10147, 0x82340017, 0x1e1723db, 0xd2843301, 0x2737272d, 0x23170717,
+    0x013d2622, 0x45353632, 0xc14507bb, 0x25372305, 0x43183236, 0x2c080ad5, 0x01db2001, 0x07090103, 0x946828b0, 0x9525683c, 0x04010907, 0x0b0cf601,
+    0xe50c0b15, 0x0ce50b0b, 0x0c0b160a, 0x1e0c0001, 0x0709650c, 0x3b1c8240, 0x0201c14d, 0x370907b9, 0x40778940, 0xb9070949, 0x0b480102, 0x0b0c180c,
+    0xca0a0aca, 0xe2240884, 0x345a0a0a, 0x8830b283, 0x00000100, 0x8001e0ff, 0x5900a001, 0x23250000, 0x39095051, 0x14150607, 0x32013b16, 0x1636013f,
+    0x0616011f, 0x2b06010f, 0x27262201, 0x3c563726, 0x23098a08, 0x26343536, 0x24821e82, 0x012f2624, 0x34823626, 0x16223a82, 0x4f871617, 0x64700124,
+    0x71838622, 0x071dcc39, 0x0954090c, 0x13080c06, 0x02071407, 0x251d0c08, 0x0e321c4f, 0x832a171b, 0x2024a31d, 0x05f247d0, 0x2f821b20, 0x09060c22,
+    0x182e4282, 0x0a061408, 0x2e181a18, 0x20070930, 0x1e9e0907, 0x00000035, 0x00f1ff03, 0x01950200, 0x00170080, 0x002b0021, 0x82320100, 0x070624a9,
+    0x47222306, 0xe28206c8, 0x3736372e, 0x37320636, 0x22262736, 0x04170607, 0x013e0988, 0x324ad741, 0x1d3f1b1f, 0x1a263f1f, 0x190c270c, 0x614f4026,
+    0x4a721713, 0x09215e4f, 0x04832109, 0x89310121, 0x6d80360a, 0x1e485749, 0x1126380d, 0x88382611, 0x1c2c6050, 0x0b0b29f4, 0x82038a29, 0x083f478a,
+    0x16001128, 0x16050000, 0x8b821415, 0x22212d08, 0x34352627, 0x32360137, 0x17010f17, 0x7b023337, 0x13090405, 0x0913c0fd, 0x20010504, 0x1b0a220a,
+    0x55402666, 0x0809080f, 0x07111107, 0x01270682, 0x4c0f0fc0, 0x5340269f, 0x802d0637, 0x4b00c001, 0x53004f00, 0x00005700, 0x0d125825, 0x21077c49,
+    0x26582135, 0x18138809, 0x2008dc76, 0x08e94135, 0x2c088547, 0x15163221, 0x23353325, 0x15233503, 0x2a038221, 0x07098002, 0x130d3868, 0x83a00d13,
+    0xfe382204, 0x270c8ad0, 0x09090768, 0x48180107, 0xc0201983, 0x48310483, 0x09071801, 0x808080fe, 0xc0016040, 0x0907b860, 0xde6a1828, 0x8b282009,
+    0x0709220b, 0x261c8d10, 0x40780709, 0x824080fe, 0x00003100, 0xf9ff0300, 0x8002c0ff, 0x3e00c101, 0x4e004600, 0x2308e544, 0x1707012b, 0x22062648,
+    0x4227012b, 0x222809ca, 0x3b161406, 0x14163201, 0x2007c142, 0x05d14b36, 0x3b363727, 0x011f3202, 0x3c1f8306, 0x17343632, 0x23373632, 0x02371707,
+    0x38130d60, 0x375c1728, 0x09130d1c, 0x954b5007, 0x20078340, 0x063847e0, 0x0d132c08, 0x05301e6c, 0x70281e07, 0x0f993850, 0x1a011411, 0x0e390d13,
+    0x090e0909, 0x05190f10, 0x660e774d, 0x0d13a001, 0x32382820, 0x820d136e, 0x509021c5, 0x1f820684, 0x131a132d, 0x1e2a1d25, 0x50022e26, 0x82085870,
+    0x29138215, 0x12570e09, 0x371c3b0e, 0xd7820300, 0x00020028, 0x0b008001, 0x9b641700, 0x07704606, 0x24344208, 0x14150622, 0x17323617, 0x05343536,
+    0x26373216, 0x93da9322, 0x0196d496, 0x0b70a050, 0x0b49d849, 0x9e39b8fe, 0x019c3a39, 0x623e5280, 0x3b53533b, 0x2f123e62, 0x2a0d0d21, 0x210d0d2a,
+    0x1917175a, 0x2b5f8300, 0xa001c0ff, 0x0700c001, 0x42001500, 0x2309c956, 0x011f1607, 0x2405dd4e, 0x013b3634, 0x06254125, 0x79012f21, 0x23250603,
+    0x012e2722, 0x05c9623f, 0x0f262725, 0x182e0601, 0x3509da9e, 0x1c282401, 0xce1c281c, 0x080a1a0c, 0x0d4d200d, 0x430d1313, 0x06831d01, 0x1e362808,
+    0x3e20140d, 0x1f050c0e, 0x05051807, 0x1c030c0c, 0x0a0f1555, 0x0c0d0f25, 0x101a0a28, 0x25270b03, 0x142a472c, 0x8260011a, 0x281c2b3e, 0x060f1cf9,
+    0x1a131d15, 0x03828013, 0x291b2208, 0x1e09244e, 0x0216660f, 0x570d1803, 0x162e0d32, 0x0a030557, 0x1503081e, 0x1c1e081b, 0x280b150b, 0x85bc8235,
+    0x800221cf, 0x0a2acf82, 0x26001a00, 0x32120000, 0xd25e1d16, 0x14013006, 0x26060706, 0x27341135, 0x15163221, 0x83172111, 0x06142606, 0x36322123,
+    0x31708235, 0x01090750, 0x1e171e00, 0x5001102d, 0xe0fe3828, 0x11820120, 0x2e422e08, 0x3828b0fe, 0x141cc001, 0x40070950, 0x187ffe14, 0x27050426,
+    0x1a70011d, 0xff283816, 0x07092000, 0x2838422e, 0xff040000, 0x01befffe, 0x227782c2, 0x74370023, 0x052805ad, 0x010f011e, 0x012f010e, 0x11984918,
+    0x3b453720, 0x52272007, 0x1520063d, 0x17209a82, 0x21052064, 0x77423637, 0x86262006, 0xb7012c07, 0x0e030406, 0xbb050d03, 0x820d05bb, 0x06042308,
+    0x11908e8e, 0x26209335, 0x26547854, 0x0b020620, 0x0a087e08, 0x131a9402, 0x58131a13, 0x052405f2, 0x1c060d03, 0x5a233182, 0x8204035a, 0x030d2308,
+    0x11904545, 0x3a119330, 0x4b4b3522, 0x113a2235, 0x0f0f0a1a, 0x514c970a, 0x0025080c, 0xf9ff0100, 0x8702b9ff, 0x0b00c701, 0x01050000, 0x36013f26,
+    0x0f160117, 0x53020601, 0x090cb3fd, 0x020c0a14, 0x2906834d, 0x0ac7013d, 0x090c190d, 0x068339fe, 0x93430020, 0x01472b06, 0x001300c2, 0x0083006f,
+    0x26491300, 0x011f2b07, 0x010f011e, 0x010f0617, 0x48830523, 0x23012f22, 0x25054b49, 0x2622012b, 0x7018013d, 0xea4709b6, 0x3f342609, 0x06072301,
+    0x237d842f, 0x2627013b, 0x1f2b0985, 0x3e373302, 0x021e3203, 0x8233011f, 0x841f2096, 0x010f2496, 0x46173233, 0x16200672, 0x30081282, 0x020f1415,
+    0x27262723, 0x01031b97, 0x060c021a, 0x02060610, 0x01021418, 0x8c010505, 0x0e0d0d09, 0x3d2f3009, 0x10070905, 0x024a0907, 0x02375237, 0x080b844a,
+    0x2f3d0526, 0x0d0e0930, 0x0a34090d, 0x0a454e11, 0x0d093507, 0x32090d0e, 0x020a243d, 0x241c0f07, 0x02070f1c, 0x323d240a, 0x352a1584, 0x4e450a07,
+    0x18730a11, 0x5d820602, 0x1a020c26, 0x1a1b0301, 0x02285e82, 0x07361901, 0x4e050507, 0x05207182, 0x483f7982, 0x1a060628, 0x08090ead, 0x61480d09,
+    0x074e0908, 0x49070909, 0x280d1e77, 0x0e283d3d, 0x8349771d, 0x094e250f, 0x0d486108, 0x0e262282, 0x04180e4f, 0x2d845009, 0x34144c2d, 0x0f171006,
+    0x0610170f, 0x844c1434, 0x09502a1d, 0xac0e1804, 0x020c0648, 0x36758205, 0x0706044e, 0x1a093607, 0x00000606, 0xfffeff07, 0x014002c0, 0x181900c0,
+    0x340cad66, 0x0e211300, 0x14011d01, 0x0607010e, 0x26222123, 0x3d053e37, 0x11964e01, 0x260fa64e, 0x14163236, 0x63262206, 0x803c0851, 0x201c1c01,
+    0x07090808, 0x08e7fe17, 0x0d03030a, 0x02020704, 0x090e0138, 0x49090e09, 0xa8210590, 0x6acf1850, 0x1dc0360a, 0x19ac3e65, 0x161a1a31, 0x2609080d,
+    0x140d190c, 0x7050ac0a, 0x933882e0, 0x70d72c02, 0xa07070a0, 0x25362590, 0x18003625, 0x2d0ad751, 0x000700c1, 0x006b000f, 0x00780073, 0x9d8e2400,
+    0x56321321, 0x26230513, 0x4a072223, 0x062205d8, 0x37651707, 0x42062007, 0x2621094f, 0x0aba7d27, 0x7d08d446, 0xf84a07ba, 0x011f2506, 0x37343533,
+    0x2205324f, 0x18011d06, 0x08070fc0, 0x27333738, 0xec011523, 0x48343448, 0x0e144e34, 0x680e140e, 0x3309130d, 0x243b1b19, 0x07090d51, 0x06050705,
+    0x12071f06, 0x0f0e0506, 0x092c090d, 0x050e0f0d, 0x1f071206, 0x19820606, 0x0d090722, 0x0e3c2288, 0x85141c0f, 0x66380d20, 0x050f041e, 0x0d080916,
+    0x2f426ffe, 0x662f422f, 0x706b296e, 0x34225b82, 0x5b823c48, 0x01140e2c, 0x330d1312, 0x0c33090d, 0x4c990630, 0x0d336f91, 0x1c14930c, 0x2e28831d,
+    0x18050624, 0x16110a0a, 0x8200ff28, 0x422f255d, 0x006060d1, 0x07250082, 0xc0ff0000, 0x08018201, 0x0006002a, 0x0014000a, 0x00200019, 0x003c0028,
+    0x23070100, 0x3233013e, 0x16372317, 0x35262206, 0x16333734, 0x36051415, 0x27231737, 0x15220c82, 0x12462622, 0x64272006, 0xeb49083e, 0x27630805,
+    0x37321633, 0x525a1501, 0x1b28400f, 0x1942675c, 0x024b6a36, 0xf0fe02fc, 0x8062100e, 0x1c143050, 0x1c140001, 0x2a0d141c, 0x1c4f3771, 0x2f105014,
+    0x072a4621, 0x01234c23, 0x2c2444b4, 0xcd153250, 0x0d03354b, 0x7735030d, 0x30de0307, 0xc0293d2a, 0x281c441c, 0x4f80601c, 0x1c142a37, 0x2f211a16,
+    0x82101060, 0x051747b7, 0x80018024, 0x3f4e1b00, 0x4d012005, 0xac49099b, 0x010e2305, 0xb882012b, 0x36341122, 0x36219182, 0xdffb1834, 0x6002320b,
+    0x0d13130d, 0x082013a0, 0x0d3a0d1b, 0x1320081b, 0x261083a0, 0x25253665, 0x86012536, 0x13803506, 0x0dc0fe0d, 0x3d111513, 0x113d1d1d, 0x010d1315,
+    0xf0130d40, 0x02872082, 0x83820020, 0x02d9ff35, 0x00a7010a, 0x003f001f, 0x37000059, 0x16171632, 0x18222306, 0x24084281, 0x27363233, 0x2187842e,
+    0x6118013d, 0x332809f1, 0x37363221, 0x22232636, 0x0891d618, 0x011e1722, 0x17273883, 0x0e071632, 0x8b060701, 0x3422083f, 0x26012b26, 0x39259d27,
+    0x2b3a0604, 0x02063523, 0x0c20080a, 0x0f170704, 0x14020213, 0x09078e0c, 0x03830709, 0x4e014008, 0x0202140c, 0x07170f13, 0x08200c04, 0x4307020a,
+    0x06281b29, 0x302d3a09, 0x070d4436, 0x482b1f2f, 0x080a030e, 0x0e040a22, 0x1c1c141c, 0x1d0b7414, 0x2c242fc0, 0x07222c41, 0x17160a0b, 0x4b0f0c0e,
+    0x23080a23, 0x170e0c0f, 0x070b0a16, 0x06082d27, 0x472e1b28, 0x1e375420, 0x2b0a062e, 0x080d0827, 0x1c281c18, 0x00001a26, 0x24055f66, 0x00c70107,
+    0x28fd821b, 0x0f160100, 0x07270601, 0x06f27616, 0x3f342627, 0x17013e01, 0x05264637, 0x27372508, 0x0cfb0107, 0x0b0c160c, 0x1c0f104d, 0x1335139e,
+    0x9e13135a, 0x4c234e1c, 0x0b170b0b, 0x7afcfe0b, 0x77017a5a, 0x4c220b84, 0x20824e23, 0x35201f82, 0x0f232082, 0x820b4d10, 0xfe0c2235, 0x2120825e,
+    0xf75d0000, 0x00c02808, 0x000f0007, 0x1857002d, 0x4409b55f, 0x27270701, 0x16071416, 0x18230607, 0x0808b2b7, 0x26372623, 0x36263734, 0x17323617,
+    0x14361636, 0x26012b06, 0x26232627, 0x07220722, 0x22230706, 0x36343526, 0x0dd95c37, 0x013a0724, 0xe5823231, 0x01230282, 0x821c28bc, 0x17473106,
+    0x0c120817, 0x0c080511, 0x06070c32, 0x08120c11, 0x24211082, 0x2b0d8218, 0x389f2319, 0x09062b28, 0x3c151e15, 0x09340382, 0x38282b06, 0x42021d25,
+    0x0e35202e, 0x2f212518, 0x28010102, 0x8305cb48, 0x281c2247, 0x27338311, 0x17030d11, 0x120d0317, 0x4b844085, 0x38509b25, 0x82150a0c, 0x0d093100,
+    0x321f2838, 0x2e0a0b0a, 0x1d1c2142, 0x0709212f, 0x085b6418, 0xc001422e, 0x35001900, 0x4f004200, 0x69005c00, 0x0ff95218, 0x31013c25, 0x82333634,
+    0x323322e5, 0x21ea8216, 0xdc820607, 0x2e272228, 0x27262701, 0x1782013e, 0x5d011e21, 0x07230598, 0x82010f16, 0x2627251b, 0x013e013f, 0x3b080ca6,
+    0x251d5e01, 0x00ff212f, 0x1b252f21, 0x1d312838, 0x2c1d1210, 0x030405df, 0x0503452b, 0x26040206, 0x032b101c, 0x0d0d3a54, 0x1a050205, 0x0e97521f,
+    0x09052408, 0x080e0404, 0x5b0d0325, 0x2e080ca5, 0x1d2c05de, 0x212f2f21, 0x01052c1d, 0x28382801, 0x011b2508, 0x01350408, 0x0a2f1d01, 0x503a132b,
+    0x020a0102, 0x351e350f, 0x0e08b844, 0x82020840, 0x03062204, 0x200a9f03, 0x0c334200, 0x2b001d2d, 0x47003900, 0x32010000, 0x5b061416, 0xfb41050b,
+    0x36052412, 0x601e1732, 0x35230523, 0x9a373634, 0xa001270d, 0x28383828, 0xf241c0fe, 0xb8fe2b10, 0x06020c02, 0x1c281c22, 0x0992a622, 0x38400123,
+    0x41388250, 0xf62c0de6, 0x32150606, 0x1d1d1511, 0x15331015, 0xce820b96, 0xff06003a, 0x02c0fffe, 0x00c00100, 0x001b000d, 0x00370029, 0x00630045,
+    0x011e3600, 0x5205d641, 0x0d8b05ac, 0x8c263621, 0x8c24200d, 0x201b8d0d, 0x1c194137, 0x030cb229, 0x09054003, 0x82060404, 0x6d032107, 0xb3200d8c,
+    0x01210d8c, 0x200e8c8d, 0x200d8c53, 0x1635413b, 0x0d065127, 0x02087006, 0x21058203, 0x0bae0306, 0x5141f220, 0x00002e12, 0xffffff07, 0x014002c0,
+    0x001900c1, 0x06354344, 0x83007622, 0x281b3943, 0x06171605, 0x31161415, 0x17266007, 0x3122302c, 0x06260722, 0x37140607, 0x38440706, 0x06172205,
+    0x33534305, 0x5343fe20, 0x1c242107, 0x39075343, 0x070383fe, 0x083b0106, 0x4719020b, 0x19470707, 0x4b080b02, 0x04100423, 0x12824b23, 0x25020932,
+    0x1a491c20, 0x121b621c, 0x121a2615, 0x44011a10, 0x43255b43, 0x68430c82, 0x023f2711, 0x02121206, 0x6c8c1405, 0x1a307f88, 0x1a041715, 0x0c1e501c,
+    0x1a1c1319, 0xfc1c0a26, 0x431f7443, 0x00200a95, 0x25080082, 0xfffaff05, 0x018702c0, 0x003000c5, 0x00620049, 0x008f007b, 0x0f162500, 0x2e270601,
+    0x21152706, 0x2b060727, 0xc84b2201, 0x26372405, 0x71012e27, 0x162b0515, 0x07061617, 0x16323317, 0x6f360517, 0x0f2f05b0, 0x1f062202, 0x16140701,
+    0x1617013f, 0x6f273536, 0x17a707c8, 0x21350522, 0x0810bc5f, 0x097d024a, 0x090d1b0d, 0x07030a03, 0x04050503, 0x2636a0fe, 0x131f0d0a, 0x0b080f09,
+    0x0805014b, 0x09030c03, 0x2a2b0705, 0x0c020a03, 0xec510f04, 0xfe154326, 0x030102be, 0x06020a17, 0x03160b01, 0x04100202, 0x14140305, 0x80040503,
+    0xfe2416ac, 0x096001c8, 0x37090c60, 0x12090dbf, 0x0f040e09, 0x06030a05, 0x6c4e0304, 0x1c120923, 0x01631012, 0x0c235c82, 0x83090d23, 0x04012d81,
+    0x510f2a11, 0x020f2024, 0x03150306, 0x062d0282, 0x03171002, 0x0a0a0204, 0x17030402, 0x2815aa10, 0x079090ed, 0x50070909, 0x3e058250, 0x08000000,
+    0xc0ff0000, 0xc5010002, 0x1f000d00, 0x53003100, 0x63005b00, 0x73006b00, 0x49120000, 0x35350951, 0x16013411, 0x15373233, 0x010e0714, 0x0706012e,
+    0x16013e35, 0x23118437, 0x2726010e, 0x26241188, 0x17161527, 0x1e27168f, 0x36373601, 0x84011d16, 0x06736539, 0x07dd4818, 0x0f8f7018, 0x131a1338,
+    0x07200709, 0x3e2c0109, 0x123d3326, 0x413f5331, 0x4f2b3357, 0x0e83252d, 0x26230783, 0x822c542e, 0x0c2e2807, 0x35070509, 0x87483621, 0x573a2e13,
+    0x2f483235, 0x3b262011, 0x0eb61d33, 0x084a4c09, 0x85058c4c, 0xc001250e, 0x30fe0d13, 0x0731f782, 0xfe0dd001, 0x241810e3, 0x03150815, 0x190a1113,
+    0x38758245, 0x3e181056, 0x09070912, 0x1108080a, 0x0709133d, 0x21020474, 0x1f100201, 0x2e148745, 0x13091a98, 0x09180612, 0x111f1311, 0x76060111,
+    0x2f260547, 0x0a0a0d09, 0x0584390d, 0x2a080b85, 0x00040000, 0x02bfff00, 0x00c00100, 0x002d0025, 0x003f0037, 0x07060100, 0x15161716, 0x07060714,
+    0x0615010e, 0x37342622, 0x82373632, 0x32332401, 0x84171617, 0x211d8207, 0xf34f3402, 0x14272105, 0x36232183, 0x4d151632, 0x29080575, 0xff013236,
+    0x040f201d, 0x424c020b, 0xa2390201, 0x02013972, 0x03924401, 0x01040c04, 0x02615b04, 0xc0090703, 0x4b4b6a4b, 0xb54f356a, 0x84202005, 0xab0123ef,
+    0x1f825b61, 0x04040b24, 0x2f824492, 0xa2723933, 0x42010239, 0x030b024c, 0x011d2010, 0xfe03060a, 0x2333839e, 0x130da04b, 0x0d203683, 0x48052a41,
+    0x4020086f, 0x092fbf82, 0x39003100, 0x55004e00, 0x00006200, 0x43333517, 0x13200641, 0x20080d52, 0x0afe5815, 0x35263022, 0x28055a67, 0x3b363402,
+    0x011f3201, 0x82e68226, 0x371424c4, 0x83113335, 0x143526d1, 0x26222306, 0x22048327, 0x8327013f, 0x23152224, 0x0b644225, 0xd47bc020, 0x82202005,
+    0x3a0d2b90, 0x29150e13, 0x121b1307, 0x9d82021e, 0x821a2621, 0x592d2804, 0x281c1c28, 0x84c0b01c, 0x120d30ae, 0x0e1a0601, 0x801f0415, 0x40200d13,
+    0x420d6001, 0x30270539, 0x0907b0b0, 0x82170109, 0x150e2623, 0x100d3d51, 0x244d8338, 0x01012b38, 0x25088365, 0x261a60a0, 0x93492d13, 0x20442205,
+    0x2d3582fe, 0x130d0d13, 0x171e0c12, 0x0ddf9b0f, 0x2242c013, 0x4af02009, 0x012b05e3, 0x00c001c0, 0x004c0016, 0x45322500, 0x262405e6, 0x2223013f,
+    0xe4830482, 0x37221182, 0xf682011e, 0x37012b25, 0x18262736, 0x2107ab62, 0xce770f06, 0x065c4a05, 0x32013b23, 0x8b5c1836, 0x3401330e, 0x58040707,
+    0x07060703, 0x053b1701, 0x02100108, 0x0b82440a, 0x7c122508, 0x212f2b1f, 0x0d0d081e, 0x0610190d, 0x44161a06, 0x10031910, 0x2b2f2130, 0x1a260a1f,
+    0x0f2f2110, 0x38280609, 0x27081882, 0x060c7026, 0x06090698, 0x78060861, 0x4106090a, 0x1f2e026f, 0x160e2f21, 0x15191616, 0x78101622, 0x1f212f02,
+    0x1110022e, 0x0cb63919, 0x00001137, 0xff000003, 0x014002e0, 0x001e00a5, 0x0059003c, 0x1e360100, 0x0a2d5901, 0x26272622, 0x220c3c59, 0xa9163617,
+    0x8c22201d, 0x0c012d3a, 0x09538e53, 0x09072007, 0x9866536f, 0x9b230884, 0x8482576c, 0x31422308, 0x08845439, 0x2d4e5f23, 0x43088446, 0x2b3207f9,
+    0x4b069f01, 0x07905189, 0x88070909, 0x0d0b8556, 0x0b846586, 0xae748626, 0x56740c5a, 0x8a260b84, 0x06044e33, 0x0b84384d, 0x724a8926, 0x2d3a0957,
+    0x90240b84, 0x0d13130d, 0x8c250984, 0x00003923, 0x2eeb8205, 0x018002dc, 0x000900a0, 0x003b0022, 0x827f0054, 0x211521ef, 0x2006d05a, 0x1f841805,
+    0x1b981815, 0x0e022607, 0x07011f01, 0x056f4606, 0x98182f20, 0x168e0832, 0x1632172c, 0x0614011d, 0x3d012e27, 0x60462301, 0x013d2310, 0x41771521,
+    0x36250806, 0xfd200233, 0xe0425ee0, 0x90fe5e42, 0x1b040203, 0x0108010d, 0x02041b0d, 0x01051403, 0x18180406, 0x05010604, 0x2d18b0a4, 0x350907b4,
+    0x20291f23, 0x07600709, 0x0584c009, 0x20022608, 0x09090e09, 0x40000107, 0x5e5e4240, 0x0107022c, 0x03031904, 0x07010419, 0x041b1402, 0x0d0d0204,
+    0x1b040402, 0x2b17ae14, 0x40070982, 0x04033023, 0x702b2031, 0x21084046, 0x0b84b007, 0x09074023, 0x086b4b00, 0xc0018023, 0x05336500, 0xda184720,
+    0xc3641193, 0x4121200f, 0x5c18053e, 0x27220877, 0xc54c2622, 0x4433200a, 0x06210567, 0x2a801822, 0x091e7a07, 0x83838020, 0x83200221, 0x05e46105,
+    0x543c5037, 0x2b3d3c54, 0x44283d2b, 0x2e1a1812, 0x3c2e4242, 0x50255e25, 0x8a4d1809, 0x89602008, 0x2d09890a, 0x547854b0, 0x222a2d2d, 0x425c420c,
+    0x5f522020, 0x82002008, 0x860720c3, 0x824120c5, 0x0e5f5215, 0x44180720, 0x34330ad5, 0x02163236, 0x34353632, 0x26343527, 0x011d0622, 0x44141506,
+    0x5c4e0512, 0x83352005, 0x01152220, 0x0a025378, 0x82208021, 0x82202075, 0x42912a71, 0x281c202f, 0x0e60201c, 0x27068212, 0x0e090e12, 0x38c00109,
+    0x48292983, 0x13131a13, 0x28a6031a, 0x22d68332, 0x82a62931, 0x82fe32d0, 0x1828212f, 0x1c1c14c0, 0x2818c014, 0x19054e21, 0x270b830f, 0xd305190f,
+    0x07090907, 0x2105ef42, 0xbb4002c0, 0x851320ae, 0x059744bb, 0xa0018028, 0x29001f00, 0x39423900, 0x013b2910, 0x1d222315, 0x21331401, 0x21054c64,
+    0x65180735, 0x15240792, 0x011f0605, 0x2505426f, 0x27010f26, 0xdd510726, 0xc0fd3105, 0x0d13130d, 0x0a0a1640, 0x0a0aec01, 0x80fe2016, 0x3005c151,
+    0x0707d3fe, 0x8107084a, 0x08190808, 0x08295f08, 0x20178207, 0x822a8360, 0x08402304, 0x02820810, 0x01404023, 0x30118340, 0x4b07088a, 0x087f0808,
+    0x08081a07, 0x0808295e, 0x83008200, 0x02ff2aa7, 0x00810140, 0x0055002a, 0x45a78280, 0x2323053e, 0x50062726, 0x07200574, 0x6805305b, 0x1e250513,
+    0x013e3701, 0x24058217, 0x16173236, 0x2a2ad437, 0x08063202, 0x242b070a, 0x822b6c29, 0x2c232e02, 0x06080a07, 0x1a0b1821, 0x1d581d0a, 0x2605820a,
+    0x1b0b1c59, 0xc721190a, 0x40182a24, 0x20060901, 0x16040907, 0x3000821a, 0x07090416, 0x01090620, 0x02091204, 0x17011709, 0x22058508, 0xca8c1308,
+    0x82002025, 0xff043200, 0x01c0fffd, 0x00c00183, 0x00160007, 0x003d0025, 0x071e7100, 0x16170322, 0x2407a35d, 0x17013f34, 0x05e95537, 0xa05a2320,
+    0x36320806, 0x010f0616, 0x23150706, 0x012f2635, 0x013e012e, 0x3216011f, 0xe136013f, 0x422f2f42, 0x0a1d852f, 0x0d0b0d05, 0x08300c14, 0x753d2e09,
+    0x3008092e, 0x1082140c, 0x1d0a053b, 0x05139319, 0x1f17290e, 0x29171fa0, 0x2013050e, 0x6227290e, 0x010e2927, 0x31368220, 0xd8fe422f, 0x0a210d27,
+    0x0b401008, 0x33390b1b, 0x06823933, 0x0810403d, 0x270d210a, 0x201cf620, 0x0b111c0a, 0x110b1f1f, 0x1c200a1c, 0x1b1d0905, 0x45091d1b, 0x0022081f,
+    0xc382c301, 0x3900312f, 0x00004100, 0x34211713, 0x16363736, 0x05074505, 0x15012b24, 0x7d500714, 0x06372208, 0x08055922, 0x26373628, 0x34352135,
+    0x7f563336, 0x34202107, 0x31052b4a, 0x00ff6f91, 0x210c2b30, 0x09076801, 0x3c300709, 0x9f82221a, 0x46210424, 0x07820421, 0x3c1a2227, 0x1a268001,
+    0x05075afe, 0x60012408, 0x13131a13, 0xafaf011a, 0x0a226036, 0x07095c06, 0x40090720, 0x2b06384b, 0x2f2f211c, 0x090d0c21, 0x830c0d09, 0x2b1c2909,
+    0x404b3806, 0x90fe261a, 0x34833084, 0xbf821320, 0xfeff0526, 0x4202b6ff, 0x2108bf82, 0x0015000a, 0x00650020, 0x0100006d, 0x27260722, 0x06173236,
+    0x2e032607, 0x33362701, 0x17161732, 0xd4823706, 0x0e2e0982, 0x37260701, 0x06161716, 0x26272627, 0x0982010e, 0x14161723, 0x200d8307, 0x20058306,
+    0x24268234, 0x012e013e, 0x200d8207, 0x830b8226, 0x211382e4, 0xc4180716, 0x262608d6, 0x15161736, 0xb2610714, 0x014e0808, 0x141c1920, 0x27562709,
+    0x951c1409, 0x0b032c25, 0x060e0c0c, 0x34ce0635, 0x0b0c0f06, 0x242c030b, 0x14366b12, 0x0e040c03, 0x32602b0f, 0x140f2b1a, 0x363d0707, 0x19141419,
+    0x06063e36, 0x1a2b0f15, 0x0f2b6032, 0x020c040e, 0x1f183615, 0x0882290a, 0x46074708, 0x02074664, 0x0a29040c, 0x1c28d11f, 0x011c281c, 0x19100a50,
+    0x10191111, 0x1bb9fe0a, 0x05032f50, 0x19192a43, 0x0305432a, 0x121b502f, 0x063d20e6, 0x09100507, 0x62581b1a, 0x0104091a, 0x200c010e, 0x0f19190f,
+    0x0a820c20, 0x08052708, 0x1b58621a, 0x0511081a, 0x203d0607, 0x1b1d060e, 0x0605313f, 0x33121407, 0x12334848, 0x05060714, 0x1d1b4030, 0x64828f06,
+    0x44281c21, 0xb42f064b, 0xc0010102, 0x33001f00, 0x00004700, 0x55011e37, 0x3d2405ff, 0x3b363401, 0x2705a363, 0x35363216, 0x26272634, 0x1f821283,
+    0x0614172c, 0x2622012b, 0x27012e35, 0x1383012e, 0x011e1722, 0x7b44138a, 0x3aac2d05, 0x3c090d44, 0x0e6a4529, 0x0e0a300a, 0x11356e82, 0x3011110e,
+    0x0906af7a, 0x09072007, 0x06618a06, 0x53070a09, 0x220e8576, 0x82395305, 0x0bdd2f0e, 0x3c293d64, 0x44570e09, 0x0e0e0af8, 0x5946f80a, 0x10062f06,
+    0xe10e0c32, 0x077aaf06, 0x6106090a, 0xd543058b, 0x06602f05, 0x0a075376, 0x523a0708, 0x20060a05, 0xcb860a07, 0x2a054758, 0x00190009, 0x15000037,
+    0x53112111, 0x37230566, 0x82161415, 0x823620cc, 0x822620ad, 0x250622bb, 0xa84a1832, 0x085a6408, 0x09883320, 0x079d4118, 0x07094025, 0x84090760,
+    0x50012804, 0x40fe1c14, 0x8430141c, 0x848020be, 0x01102405, 0x82f0fe10, 0x6cd420a4, 0xc92008ae, 0x30222082, 0xb9771c14, 0x2297a10b, 0x84322133,
+    0x21232297, 0x2097a922, 0x05764801, 0x0907e022, 0x4218999c, 0x999308c6, 0xff072e08, 0x02c0fffd, 0x00c0010c, 0x00290022, 0x0031002d, 0x003b0035,
+    0x01000043, 0x05070616, 0x2f222306, 0x37362601, 0x27013e25, 0x0f222326, 0x32108601, 0x3336013f, 0x36071632, 0x07062737, 0x27370317, 0x85013f07,
+    0x16372603, 0x27263717, 0x3d188217, 0x07060714, 0x291af201, 0x08a4fe36, 0x200a1208, 0x010c0607, 0x07060c61, 0x08091209, 0x0582081b, 0x07072138,
+    0x2c251c0b, 0x0c9d4f2e, 0x0e101510, 0x3d1fab14, 0x3c1fa81f, 0x0382ab1f, 0x0e513508, 0x0c0a2d09, 0x3d030724, 0x01060201, 0x21773964, 0x361004cf,
+    0xd2061a0c, 0x100b1a07, 0x0f041104, 0x071a0b37, 0x38311710, 0x033e0107, 0xbafe3d07, 0x19122712, 0x1b350382, 0x9f132712, 0x0d2e0e08, 0x100e9909,
+    0x08070714, 0x00000009, 0x22e38202, 0x820002be, 0x001d2ae3, 0x0100002a, 0x0607011e, 0x20d0820f, 0x057e7b07, 0x26272633, 0x16171337, 0x2f363732,
+    0x37013e01, 0x0e171636, 0x08f58401, 0x01011e58, 0x17222e2a, 0x39662712, 0x05050b0b, 0x12088631, 0x80040404, 0x050d0433, 0x1b370c0c, 0x441e8453,
+    0x21581f18, 0x26042208, 0x2301101d, 0x262e6216, 0x0c393213, 0x040e040c, 0x06044231, 0x010a0909, 0x05053207, 0x20380b0b, 0x100f1013, 0x2204261d,
+    0x1f582108, 0x93824418, 0xffff0a26, 0x0102c0ff, 0x29359382, 0x49003900, 0x5d005900, 0x7d006d00, 0x99008900, 0x0000a900, 0x614d1825, 0x013e210d,
+    0x22070a7b, 0x6a333634, 0x17210c73, 0x0ed54207, 0x18220721, 0x2608ba68, 0x2634013d, 0x8d232723, 0x33272310, 0x99182335, 0x184310df, 0x1715240d,
+    0x792b3435, 0x3220062d, 0x0f05be18, 0x01220f8f, 0xfb7b01ff, 0x1b012c05, 0x550c1201, 0x09090760, 0x83000107, 0xf5602505, 0xcc02110c, 0x2009e34a,
+    0x06646820, 0x30070923, 0x230a8710, 0x28c0c08f, 0x20201688, 0xd8232b89, 0x8208b008, 0x89182002, 0x89302011, 0x05452d0a, 0x130d5b05, 0x055b0d13,
+    0x0f0ca005, 0x230aa043, 0x1d0c0f40, 0x47205a88, 0x7d4b3089, 0x2098210a, 0x0a155918, 0x7a884020, 0x08108026, 0x78081008, 0x57203c88, 0x2f470988,
+    0x02b92e06, 0x00c00100, 0x002b0015, 0x00560040, 0x066c5c00, 0x5d012f21, 0x272408b8, 0x37333626, 0x2e05f644, 0x3637011f, 0x16011f32, 0x17010f14,
+    0x5d230616, 0x2b8306f2, 0x50452620, 0x01072107, 0x7609cf4e, 0x32830607, 0x0e0ac832, 0x631f0b1e, 0x19050d05, 0x21630505, 0xe0100c0b, 0x10321190,
+    0x19050563, 0x1f630c0b, 0x0a0e1e0b, 0x0b0c1070, 0x0987fefe, 0x1a832120, 0x63213c82, 0x881985a0, 0x202b820f, 0x20129140, 0x21688488, 0x68840c0c,
+    0x68837020, 0x82020121, 0x88098472, 0x066f4784, 0x4202e034, 0x0800a001, 0x10000c00, 0x43001900, 0x23010000, 0xe4833327, 0x15250629, 0x17333723,
+    0x50053523, 0x0720068b, 0x18084348, 0x20138a77, 0x08de5e27, 0x21272c08, 0x61300207, 0x040c631a, 0xfe090118, 0xe81a7ed8, 0xe0fe7e1a, 0x18010908,
+    0x1a630c04, 0x0907bf01, 0x141c0709, 0x07200709, 0x84c0fe09, 0x1c142106, 0x142c1383, 0x04000204, 0x0c802001, 0x800c0860, 0x0c240084, 0x800c6008,
+    0x2005b251, 0x05b741a0, 0xa0200585, 0x20213584, 0x37c28220, 0xfeff0700, 0x8002e0ff, 0x0500a101, 0x1c000900, 0x3f002500, 0x5e004e00, 0x0625c782,
+    0x33352307, 0x22c48223, 0x83012f05, 0x06322bd1, 0x26273031, 0x0607012f, 0xd3882607, 0x15061724, 0x574f1714, 0x20c58a09, 0x08264925, 0x37362608,
+    0x17361716, 0x2627013e, 0x27260727, 0x1415010e, 0x01323316, 0x3d191da3, 0x1a7e8464, 0x0c0c2101, 0x18020d63, 0x26008301, 0x0b071515, 0x8727fe17,
+    0x35e423ec, 0xe18dd131, 0x3425073c, 0x445e845e, 0x131f2834, 0x0e0c1902, 0x3f270503, 0x33161b05, 0x58011d26, 0xf4821f19, 0x3e0a4825, 0x8202600c,
+    0x13132f4a, 0x1f1b0b06, 0x0c60080c, 0x374b2080, 0xf98c3648, 0x60211d3c, 0x5d5d411e, 0x2f6d2641, 0xd3162824, 0x071b3f12, 0x05532f07, 0x27132821,
+    0xfa820031, 0x00260382, 0x80010002, 0xa3663300, 0x2335210a, 0x8606f879, 0x08776707, 0x3b363422, 0x26072e71, 0x3233011d, 0x6c011d16, 0x502205ff,
+    0x01844020, 0x7f075021, 0x302a0594, 0x07e00709, 0x09073009, 0x09840001, 0x0284ae82, 0x16820c84, 0x23051947, 0x00300709, 0x3c08e353, 0x00c20180,
+    0x003c0035, 0x00630043, 0x0077006d, 0x010e3700, 0x1714011d, 0x35262223, 0x29778311, 0x013f2627, 0x27011f36, 0xef693626, 0x3e372205, 0x05b76301,
+    0x2708c164, 0x06173233, 0x15333503, 0x20543282, 0x11232105, 0x2323a283, 0x82032b35, 0x823420cf, 0x062559bb, 0x2b05377a, 0x26332307, 0x15062223,
+    0x37161714, 0x3e063b7a, 0x15f13633, 0x0da9091c, 0x1d0d1313, 0x09090d1e, 0x0c200e09, 0x10060502, 0x14020c06, 0x820c0214, 0x02053f08, 0x0d06200c,
+    0x02040904, 0x141d1e06, 0xc0142909, 0xe0130da0, 0x0d0d13c0, 0x010fc013, 0x09820f01, 0x04142f08, 0x21372028, 0x28203721, 0x1535fc04, 0x090c0c18,
+    0x0c09cb03, 0x3515180c, 0x2305fe04, 0x0f11e016, 0x60010d13, 0x0916130d, 0x090d0d0d, 0x5c821f17, 0x64820620, 0x06363625, 0x82060205, 0x171f2164,
+    0x0d2d5c82, 0x16040d05, 0xaffe1d12, 0x13138060, 0x252d8280, 0x0d132001, 0x09838060, 0x0c0c2708, 0x4b4b2c1c, 0x0d0b1c2c, 0x0b090f30, 0x08030308,
+    0x300f090b, 0xff030002, 0x02bdfffd, 0x00c30183, 0x003d0039, 0xdb580041, 0x36262a06, 0x0627013f, 0x2f262223, 0x054b6e01, 0x1e17072e, 0x2f060701,
+    0x3e372601, 0x37011f01, 0x8205a65b, 0x05086608, 0x37170727, 0x37011636, 0x08078227, 0x0207275d, 0xa207037f, 0x0d060308, 0x0c27160f, 0x0b3f2801,
+    0x3f0b1414, 0x270c0128, 0x060d0f16, 0x07a20803, 0x101e0603, 0x14252716, 0x17065716, 0x0b72720b, 0x16570617, 0x16272514, 0x9bfe1e10, 0xc8245f13,
+    0x0e5f2470, 0x04430307, 0x061f0f08, 0x2e016809, 0x274b4b27, 0x0968012e, 0x820f1f06, 0x03720816, 0x060c1007, 0x571a6609, 0x080a9628, 0x04303004,
+    0x28960a08, 0x09661a57, 0x00010c06, 0x2e402747, 0x0027402e, 0xfeff0200, 0x0202e0ff, 0x0f00a001, 0x00001300, 0x07163201, 0x23010e03, 0x27262221,
+    0x33362603, 0x21172105, 0x130fe001, 0x24033802, 0x18effe18, 0x02380424, 0x9b010f13, 0x011f8afe, 0x16a00139, 0x189bfe0e, 0x01181f1f, 0x40160e65,
+    0xcb4500c0, 0x01c82f06, 0x00b801f0, 0x00640007, 0x00920074, 0x55511200, 0x34052406, 0x82222326, 0x18072001, 0x21081277, 0x1a823337, 0x06010f22,
+    0x15210282, 0x23048214, 0x1614011d, 0x8205726c, 0x82142005, 0x013d2503, 0x36013f34, 0x200a254b, 0x05646c06, 0x1f262684, 0x011d1601, 0x06820607,
+    0x36013b23, 0x85128424, 0x22262f2c, 0x3e13010f, 0x22233701, 0x2b26012f, 0x03822701, 0x75831182, 0x32252b84, 0xce911516, 0x08028291, 0x75c00123,
+    0x01030153, 0x08031d01, 0x15100810, 0x1b030704, 0x06280202, 0x09051407, 0x040a1607, 0x0305020a, 0x31198208, 0x090b1f06, 0x07042507, 0x05200407,
+    0x07030a03, 0x06831004, 0x09090c29, 0x14070420, 0x86c2fe0b, 0x09073f10, 0x357d1a03, 0x080d1957, 0x0d091205, 0x110c2b13, 0x2b0b0c20, 0x10161216,
+    0x09071414, 0x7384b801, 0x75536727, 0x14040216, 0x08578208, 0x04090727, 0x0d01021a, 0x080a0602, 0x19070414, 0x13080907, 0x02081005, 0x040b0106,
+    0x0a06050b, 0x05090507, 0x03090406, 0x2d04830a, 0x090c0905, 0x1f042108, 0x03060a91, 0x80820409, 0x04072508, 0x03c5fe19, 0x11052d38, 0x070b250a,
+    0x181a0d1a, 0x0b110e16, 0x0200060a, 0x60000000, 0x20010002, 0x1f000f00, 0x18105d51, 0x53079755, 0x61440887, 0x05617105, 0x71e00121, 0xda45096d,
+    0x0a874b05, 0x09039718, 0xc0ff2024, 0xfb53e000, 0x4c002006, 0x11200792, 0x2105c74c, 0xb64c1315, 0x200f8706, 0x8f378460, 0x83302047, 0x856e8b68,
+    0x25ba820b, 0xfbff0200, 0xbf82bbff, 0x2b00c136, 0x00003300, 0x0f141601, 0x020f0601, 0x07161716, 0x010e0706, 0x06270482, 0x3637022e, 0x82013e37,
+    0x17362604, 0x013f1716, 0x21028236, 0x2f4f1732, 0x012d0807, 0x2f0909f7, 0x4c240806, 0x230d050e, 0x140d140e, 0x23180401, 0x230b536b, 0x180e2618,
+    0x220f0604, 0x4c151437, 0x2f05030c, 0xfe091b09, 0x05094ee3, 0x0b829920, 0x052f2908, 0x154c0c03, 0x0f223714, 0x0e180406, 0x0b221926, 0x18236b53,
+    0x0e130104, 0x0d230e14, 0x254c0e05, 0x092f0607, 0x1ca9fe09, 0x002b3383, 0xfffeff01, 0x010202df, 0x821800a4, 0x011e21a5, 0x2220a582, 0x08058668,
+    0x1f013e3e, 0x27170701, 0x16362737, 0x24da0117, 0x06d42104, 0x21d4050f, 0x22032404, 0x601d2662, 0x22603090, 0x01226126, 0x28692576, 0xdb0505db,
+    0x03256928, 0x571c0723, 0x40809040, 0x23071b68, 0x25060f48, 0x01c201bc, 0x4f7500c0, 0x003f2205, 0x09055169, 0x67343221, 0x222106a3, 0x2b098426,
+    0x16170607, 0x07060706, 0x1617010e, 0x062d0985, 0x27343526, 0x36373626, 0x27013e37, 0x20098226, 0x280b8233, 0x16321716, 0x14150607, 0x7a118206,
+    0x262c0588, 0x36272227, 0x3c352627, 0x36343501, 0x1e213b82, 0x20458201, 0x20438206, 0x21e083a4, 0xe784401c, 0x0b852820, 0x03180133, 0x16170708,
+    0x05030c0b, 0x07070309, 0x13093237, 0x21118217, 0x11871716, 0x0834392c, 0x0807e310, 0x09131604, 0x07823732, 0x03050930, 0x0e010b0c, 0x1014090a,
+    0x07393408, 0x10840307, 0x00011722, 0x1c205585, 0x9b590682, 0x3da73805, 0x010d0733, 0x14030702, 0x0615170c, 0x1d05010d, 0x3a0a0b05, 0x820c0732,
+    0x04280813, 0x14180b14, 0x1f060d07, 0x0d8c0904, 0x0b3a3107, 0x051c060b, 0x15070d01, 0x04140c16, 0x2b131403, 0x01030133, 0x1f050a09, 0x03211487,
+    0x05cb5907, 0x01060228, 0x002e00c3, 0xa5450036, 0x012b3405, 0x06012f22, 0x27262223, 0x010f012e, 0x011e1706, 0x6b171517, 0x3d260584, 0x023e3401,
+    0xff82013f, 0x15820720, 0x0807f172, 0x07fe0159, 0x0d092e0e, 0x2e0a1033, 0x2f1d1816, 0x0309010c, 0x0f03040c, 0x08292237, 0x0dec1213, 0x42251013,
+    0x020aca30, 0x3220300e, 0x0e147a0b, 0x740e140e, 0x09280f14, 0x200d400d, 0x03020419, 0x1d05050c, 0x52010226, 0x0d131e10, 0x55623f51, 0x044b123b,
+    0x061c360a, 0x82381f2a, 0x140e222a, 0x34008200, 0xfffcff01, 0x010302bf, 0x001a00c0, 0x06030100, 0x07032722, 0x87a68206, 0x03273304, 0x21333626,
+    0xff011632, 0x010e0157, 0x0c022e42, 0x04832202, 0x82242c21, 0x04573f09, 0xc0011013, 0x9a01130f, 0x06062cfe, 0x06ac6c01, 0x06c58506, 0x057dbc06,
+    0x0f120105, 0x5f82171a, 0x00000838, 0x4002e0ff, 0x0600a001, 0x0f000b00, 0x1d001400, 0x30002700, 0x6d823800, 0x21153008, 0x3233013e, 0x34231507,
+    0x17162537, 0x33351723, 0x34071516, 0x14153327, 0x13012b06, 0x012e2315, 0x23070622, 0x33350335, 0x23011d06, 0x47362622, 0x610805e8, 0xfe400134,
+    0x4a7e27f1, 0x1e60cf0f, 0x3f704201, 0x1e4280af, 0x13a404a0, 0x3220800d, 0x3a463a11, 0xa4803211, 0x130d8004, 0xc03850f8, 0x3b7e9e01, 0x4380a045,
+    0x5f1a993d, 0x433d80a0, 0x60120e40, 0x2001130d, 0x23231d80, 0x00ff801d, 0x600e1260, 0x2838ad13, 0x00286060, 0xf6ff0200, 0xc301c0ff, 0xa782ca01,
+    0xb3441e20, 0x1e243211, 0x21010f01, 0x013e2627, 0x37011f16, 0x07700136, 0x07107509, 0x28650130, 0xfe481105, 0x400e30cb, 0x1e0d6574, 0xe1731115,
+    0x07093205, 0xe2090740, 0x57143522, 0x1b653ad0, 0x19803a40, 0x09b75814, 0xc0010026, 0x27001300, 0x21069753, 0x84672726, 0x16172108, 0x20051442,
+    0x20139237, 0x05a15817, 0x3a05dd44, 0x3634013d, 0x36320533, 0x012b2634, 0x12047f15, 0x0a010623, 0x020e1107, 0x851f1604, 0x926e2009, 0x9f200813,
+    0x2e42422e, 0xc0283810, 0x0d133828, 0x1c147001, 0x0110141c, 0x2313192e, 0x0e0b0731, 0x2c1f161f, 0x0d8c0682, 0x5c422025, 0x82382842, 0x0d210830,
+    0x281ca013, 0x0000601c, 0xffffff04, 0x01f101c8, 0x000c008e, 0x0022001a, 0x2500002f, 0x3e372734, 0x051b5201, 0x82072321, 0x060721bf, 0x21050f55,
+    0x955d3216, 0x25290807, 0x3e352622, 0x16363701, 0x1506011f, 0x51264801, 0x2c060e03, 0x07090436, 0x030351be, 0x377c3706, 0x51030306, 0x28032d14,
+    0x0865821c, 0x07e8fe24, 0x2c360409, 0x51030e06, 0x182cc026, 0x04030680, 0x07386020, 0x0680440a, 0x1e1e030d, 0x80060d03, 0x2782200c, 0x14281c34,
+    0x6038070a, 0x06030420, 0x002c1880, 0x00060000, 0xf747ff00, 0x000b2a05, 0x00250019, 0x0035002d, 0x209f883d, 0x24998216, 0x32160723, 0x25a18837,
+    0x26222737, 0x95863637, 0xcb441620, 0x22022706, 0x32161406, 0x155f3436, 0x01143106, 0x032a1e38, 0x0734060f, 0xb1070a01, 0x2a102410, 0x2222b082,
+    0xb0822248, 0x07433f08, 0x3407010a, 0x2a030f06, 0x91cea71e, 0xac91ce91, 0x986c6c98, 0x131aab6c, 0xc0131a13, 0x06431323, 0x422a0402, 0x0a360a07,
+    0x0d06430a, 0x04101004, 0x0a79060d, 0x042a4207, 0x13430602, 0x3182f823, 0x01ce9123, 0x8232821f, 0x21328202, 0xc3821a13, 0x20000525, 0x5602c0ff,
+    0x0f26057b, 0x39002900, 0x77455500, 0x86042009, 0x161322a3, 0x524b1806, 0x2223260a, 0x36013f26, 0x21d98237, 0xe25e1716, 0x3634230c, 0x06580733,
+    0x222d8d05, 0x8334013d, 0x349a272e, 0x26342626, 0x06845a01, 0x0f033f37, 0x0a0e370c, 0x370e0a30, 0x2e020f0c, 0x38181806, 0xfe061818, 0x08d37cfe,
+    0x19137c33, 0x0e080a0e, 0x0e0a500a, 0x190e0a08, 0x01381813, 0x873e8240, 0xf8fe3502, 0x0a68120c, 0x680a0e0e, 0x16b90c12, 0x03101003, 0x0709a916,
+    0x2609d447, 0x131b0290, 0x820e0a88, 0x0a0e2202, 0x23028288, 0x10021b13, 0x0032ee82, 0xffffff03, 0x010102bf, 0x003b00c1, 0x0043003f, 0x7d442500,
+    0x15162805, 0x010e0714, 0x8207012f, 0x83062008, 0x323325f6, 0x26273717, 0x8205ea55, 0x82342008, 0x013b22f2, 0x0c864f32, 0x25145c08, 0x05072737,
+    0x01170727, 0x1b0961f7, 0x110a5009, 0x050f0317, 0x1201126b, 0x0d13131b, 0x6c120602, 0x2a060205, 0x0a262930, 0x61090951, 0x0d010d09, 0x0a305009,
+    0x0a2f0a1c, 0x0951300a, 0x4549dcfe, 0x45320149, 0x618a4449, 0x0a510909, 0x2a302926, 0x6c050206, 0x0d020612, 0x821b1313, 0x056b2745, 0x1117030f,
+    0x5b825109, 0x30212183, 0x2e39820a, 0x50300a1c, 0x49681b09, 0x459f4a45, 0x82004549, 0xfff822cf, 0x2fcf82b8, 0x001900c0, 0x00490031, 0x06160500,
+    0x022e0607, 0x2e058a4b, 0x36343526, 0x06141632, 0x07272223, 0x55311425, 0x33270f5f, 0x011e3132, 0x89153007, 0x05984d17, 0x01311784, 0x07020631,
+    0x12628839, 0x0510041f, 0x13021c75, 0x32d4841a, 0x0943011b, 0x0a062007, 0x06618a06, 0x01070909, 0x825aaf7a, 0x0907240f, 0x84395305, 0x76532f0f,
+    0x0410050f, 0x88621320, 0x06020739, 0xcd841b74, 0x01131a27, 0x07012b1b, 0x0a675509, 0x7aaf0622, 0x08241082, 0x05523a07, 0x06313f84, 0x00040076,
+    0x01c0ff00, 0x00c00180, 0x0011000d, 0x20d18215, 0x06f96c00, 0x2221232b, 0x37113526, 0x15233517, 0x2d038633, 0x261a4001, 0x00ff1a26, 0x2080261a,
+    0x01828030, 0x26c00125, 0x8380fe1a, 0x40012414, 0x8460a080, 0x64002000, 0x53880503, 0x1f001833, 0x2a002300, 0x35002e00, 0x34110000, 0x17013b36,
+    0x05c85511, 0x84373521, 0x26342a57, 0x021d012b, 0x3d363233, 0x296a8501, 0x013b1614, 0x21152735, 0x79832535, 0x26062225, 0x8580c01a, 0x40e02976,
+    0x200d13a0, 0xa0130d20, 0x40250884, 0x00ff0001, 0x200e8240, 0x22838201, 0x83c0fe80, 0x40c02188, 0x40251083, 0x0d134080, 0x210a8520, 0x07824060,
+    0x00134026, 0xf9ff0500, 0xc020eb82, 0x0728eb82, 0x28001800, 0x4f003200, 0x22098b5d, 0x41163212, 0xa2830693, 0x34363236, 0x16173621, 0x22060714,
+    0x3626012f, 0x3216011f, 0x011f1637, 0x26250e82, 0x22013f34, 0x25238426, 0x22010f16, 0xb1623106, 0x3626340a, 0x7c01013f, 0x281c1c28, 0x090e291c,
+    0x0760141c, 0x82070909, 0xfe300804, 0x050b0bf6, 0x0e270e05, 0x0b170c44, 0x3d0d0544, 0x5c1e0706, 0x09131a09, 0x13130d30, 0x151acd0d, 0x01015213,
+    0x1a130e3d, 0x02144e13, 0xc0011515, 0x1c3c4082, 0x095cfe28, 0x091c1407, 0x0e09090e, 0x0e040c0c, 0x440e0e04, 0x440c170b, 0x0809b804, 0x13233d82,
+    0x82d20a1a, 0x13312230, 0x21398253, 0x48835914, 0x144e532d, 0x00111238, 0xfeff0300, 0x5d02c0ff, 0x242205b7, 0xe3824300, 0x20065344, 0x23d08312,
+    0x25272223, 0x2405b75a, 0x37262737, 0x0535731f, 0x36371623, 0x820d8201, 0x163738e8, 0x36371715, 0x1e021f16, 0x2f010e01, 0x012f2601, 0x06012f07,
+    0x84c40127, 0x123b08d6, 0x251a070e, 0x78fe1114, 0x13090609, 0x4b2ec609, 0x286b0517, 0x310a030d, 0x07141988, 0x041a9afe, 0x23030203, 0x523e150b,
+    0x1107301d, 0x0c090c34, 0x123a0c19, 0x73200706, 0x7518132f, 0x3c080685, 0x140e87fe, 0xcb081a07, 0x06121304, 0x4b456605, 0x28351f17, 0x4a0e230c,
+    0x07140b46, 0x04176101, 0x06010204, 0x1f180b15, 0x161d0c20, 0x19061a33, 0x1d060918, 0x0d131309, 0x0c111839, 0x05af4200, 0x0140022b, 0x000700c0,
+    0x0042002e, 0x22dd8a4e, 0x42151632, 0x342b0558, 0x13013b36, 0x26352630, 0x82013f36, 0x1f1623d2, 0x1b833301, 0x06820f20, 0x07343623, 0x05697637,
+    0x010f2627, 0x33030706, 0x241d8237, 0x23373307, 0x078a7622, 0x84640121, 0x149e31e9, 0xfe1e2a0e, 0x0e0e0a20, 0x02362b0a, 0x280a0308, 0x2a054b76,
+    0x14130d2c, 0x0e0a461a, 0x765519ec, 0x2734066a, 0x18340606, 0x16120c3e, 0x2119cf2b, 0x20140d1e, 0x050c0f3d, 0xa42ded88, 0x2a1e0a0e, 0x010e140e,
+    0x0a01010f, 0x075a761b, 0x160d1328, 0x140eb208, 0x78765122, 0x02042908, 0x1284fbfe, 0xb05b0d0a, 0x33069976, 0x0002004c, 0x02e0ff00, 0x00a00183,
+    0x003e0019, 0x07162500, 0x2c05314f, 0x3634013d, 0x36322133, 0x012f3435, 0x22e18226, 0x42352517, 0x1e210691, 0x05185902, 0x1423ee82, 0x83152306,
+    0x232f0803, 0x23152335, 0x02012e35, 0x02021d65, 0xfcfd1e2c, 0x07090907, 0x0e0b0702, 0x0a0c0a09, 0xfd0c0a0a, 0x13130dc5, 0x5431150d, 0x1531542c,
+    0x8360261a, 0x3825080d, 0x40c04028, 0x1761362a, 0x09271d26, 0x09071007, 0x080b0b0e, 0x0c0d0a07, 0x80770a0d, 0x34131a13, 0x1a263458, 0x2c088240,
+    0x30382860, 0x0b343030, 0xff040045, 0x20ab82fe, 0x26ab8200, 0x00340012, 0x18770055, 0x260c5f73, 0x37023e26, 0x18343526, 0x2022d944, 0x06df7b35,
+    0x2b262724, 0xc04f2201, 0x16172608, 0x15013f32, 0x20dc8214, 0x18f68633, 0x18191c45, 0x28088473, 0x11070405, 0x8039061c, 0xec441812, 0x82cc2011,
+    0x040a25d5, 0x0a041212, 0x0827dc82, 0x02190810, 0x8219020a, 0x92302007, 0xa0012f2b, 0x137aac7a, 0x15070a33, 0x4a391631, 0x44189656, 0x11250cf4,
+    0x0201130b, 0x33398207, 0x09076808, 0x09232309, 0x08680709, 0x04384408, 0x08443804, 0x00202995, 0x28069f43, 0x00c30102, 0x00450007, 0xd55b1851,
+    0x010f280e, 0x16170706, 0x821e3637, 0x23062e07, 0x26252722, 0x013e2627, 0x1f161716, 0x25098201, 0x35013f36, 0xab763f34, 0x21158205, 0x1682021f,
+    0x07011e22, 0x07242882, 0x06141527, 0x26213c84, 0x06ad4337, 0x54134608, 0x07193442, 0x5a0e0415, 0x13090e10, 0x11090708, 0xfe0f0f13, 0x04102193,
+    0x04131207, 0x06260f07, 0x0d0c0502, 0x112a234a, 0x061d0913, 0x06191809, 0x15193f1a, 0x08040b6f, 0x990b100a, 0x550f123c, 0x05aa0602, 0x06b84302,
+    0x1e3fb62b, 0x661e1327, 0x0522060f, 0x08408407, 0x85050834, 0x1209210c, 0x0f090709, 0x07060e05, 0x1904170d, 0x15112835, 0x3a120606, 0x080b1a0b,
+    0x0815340c, 0x1b085310, 0x2d2d0d0a, 0x05191014, 0x3d01011c, 0xed820a0a, 0xfeff0728, 0x0202c0ff, 0xfb82c101, 0x6100592e, 0x71006900, 0x84007c00,
+    0x16010000, 0x1425c082, 0x14151416, 0x05634e07, 0x22012b24, 0xf0822e27, 0x35263723, 0x05b64330, 0x0c868218, 0x15311424, 0x1b823617, 0x32363423,
+    0x22338416, 0x51343037, 0x372c09c4, 0x24171636, 0x26343632, 0x12140622, 0x200e276a, 0x220f8636, 0x83353637, 0x1415231f, 0x12871716, 0xff012d08,
+    0x87060502, 0x08210401, 0x10252309, 0x0d126315, 0x042c2621, 0x05068701, 0x0c030602, 0x07091c06, 0x38090710, 0x38160d09, 0x0d163850, 0x0f830982,
+    0x0d061c2b, 0x0ee0fe02, 0x090e0909, 0x82058429, 0x21028808, 0x0a821010, 0x1d040822, 0x013b1884, 0x030c0628, 0x04050137, 0x22100d02, 0x19512e2d,
+    0x4315080c, 0x102c3f28, 0x82370c0d, 0x820e205e, 0x1d0c3966, 0x07090907, 0x1701012e, 0x211b0c0f, 0x28383828, 0x0f0c1a22, 0x2e010117, 0x1d211783,
+    0x209f820c, 0x215c842a, 0x0684e7fe, 0x058a3720, 0x09174f22, 0x04232483, 0x84320610, 0x82002015, 0x00072100, 0x0f374518, 0x5f005a24, 0xed726b00,
+    0x32362109, 0x8d07176a, 0x76052007, 0x262308e4, 0x4523013d, 0x3523075d, 0x18373634, 0x280c367c, 0x33011d16, 0x013f3435, 0x062c5936, 0x011d063b,
+    0x17150114, 0x32132733, 0x23263436, 0x14062221, 0x146e3316, 0x0e140e0e, 0x0805905e, 0x24070121, 0x05160505, 0x2925050d, 0x2e420b2b, 0x422e00ff,
+    0x141c1d23, 0x90141c10, 0x054f0c20, 0x82252940, 0x0516301b, 0xfe172405, 0x447a4080, 0x1c1c143a, 0x8300ff14, 0x82482005, 0x2002934f, 0x39318723,
+    0x17133a2a, 0x42422e19, 0x0e36212e, 0x701c145b, 0xb71d1c14, 0x13330d0c, 0x72872a3a, 0x6620162d, 0x60530120, 0x80fea040, 0x821c281c, 0x05734502,
+    0x0180012b, 0x001300a0, 0x0100001f, 0x29cb8232, 0x1415012b, 0x3d22012b, 0x03822301, 0x25333422, 0xd5821383, 0x34013d2a, 0x0c740133, 0x380c8c0c,
+    0x0c2a0382, 0x0c0c6801, 0x0c0c98fe, 0x0f822001, 0x0c0ce423, 0x200682e4, 0x82038280, 0x08375e02, 0xc0018028, 0x31002500, 0x59823900, 0x16152322,
+    0x250aa57b, 0x012e013f, 0xe0183435, 0x3320087a, 0x21061c5c, 0x9e541505, 0x187f8206, 0x3708b254, 0x2f201070, 0x13041628, 0x1310c010, 0x2f281604,
+    0x09071020, 0x60010709, 0xfe240582, 0x083008d9, 0x363a0282, 0x74525274, 0x9d900152, 0x54321310, 0x1a0f471a, 0x1a470f1a, 0x10133254, 0xc066099d,
+    0x10182608, 0x08100808, 0x05954cd0, 0xffff042c, 0x0502bfff, 0x1500c501, 0xb34e2f00, 0x16252705, 0x06010f14, 0x99822f22, 0x2327373a, 0x15173727,
+    0x17163617, 0x27072227, 0x013e3726, 0x0f011e17, 0x37011f01, 0x16231282, 0x82060706, 0x06072214, 0x061f4917, 0x0808df50, 0x0b0bf542, 0x0b1f0a35,
+    0x0b081175, 0x40603e6b, 0x30146b80, 0x0c0d3411, 0x1b2a0152, 0x03072549, 0x440b4a05, 0x020d054b, 0x131b1409, 0x941f1319, 0x137c0c07, 0x98132535,
+    0x0e0e1475, 0x0b340e14, 0x0b350b1e, 0x2d083c82, 0x806b1430, 0x6b3e6040, 0x3611080b, 0x2b3d5203, 0x0209141b, 0x444b040e, 0x03054a0b, 0x1b4a2407,
+    0x1f130b12, 0x7b201f52, 0x13352513, 0x3982de99, 0x00140e22, 0x2405d772, 0x00c00102, 0x080f5f07, 0x69453d20, 0x16322309, 0x58180f06, 0x232108ba,
+    0x081b5921, 0x23220732, 0x36262722, 0x01362537, 0x25152335, 0x2b353315, 0x02212682, 0x05035322, 0x1a2d0132, 0x131a1313, 0x070603be, 0x130db0e4,
+    0x80fe0d13, 0xb0350583, 0x0c0202dc, 0x06070203, 0xfe06e001, 0x000160be, 0x60608060, 0x212a8463, 0x2f828001, 0x0d1a1329, 0x5c3c020c, 0x83e00d13,
+    0x2a04822d, 0x060c3b53, 0x0280010c, 0x8460a7fe, 0x20012100, 0x9e822584, 0x00020022, 0x25073f79, 0x001e000e, 0x955a0100, 0x5a13200d, 0x49080f95,
+    0x83483444, 0x495f83ba, 0x0a1b2a39, 0x06151324, 0x075c3a06, 0x384b2128, 0x308d012b, 0x875f2b8c, 0xa0365f87, 0x203a3544, 0x591ac7fe, 0x430b0927,
+    0x38300875, 0x0045381b, 0xffff0200, 0x4102c0ff, 0x2800c001, 0x00005100, 0xbe820e36, 0xf9830720, 0x30373627, 0x3e373637, 0x32048204, 0x1f323336,
+    0x0e070601, 0x010e0705, 0x07061625, 0x82220706, 0x040e2103, 0x06240482, 0x012f2223, 0x05232682, 0x82053e37, 0xeb290829, 0x11142120, 0x09242335,
+    0x37240a01, 0x051c4502, 0x43242008, 0x080e1b29, 0x25090d0a, 0x16132e1e, 0x0a1a2526, 0x01080707, 0x29218435, 0x1c450101, 0x25200706, 0x228f2843,
+    0x17090622, 0x26084a85, 0x09162180, 0x23211406, 0x1e081b0a, 0x4a170115, 0x2636120f, 0x0a0a0f30, 0x1c250906, 0x1a0a0712, 0x13152625, 0x8ab71312,
+    0x2f27211e, 0x19211e89, 0x201e8426, 0x20448521, 0x087f4300, 0xef82c020, 0x32001624, 0x61183a00, 0x052318e1, 0x483b1415, 0x3d220569, 0x1a683301,
+    0x05445f06, 0x18222321, 0x2518c661, 0x3808d0fe, 0x03823008, 0xed200686, 0x17a56118, 0x248a8e20, 0xfe380830, 0x1c1240e0, 0x01000012, 0xc0ff0000,
+    0x9b824002, 0x00001322, 0x2005874c, 0x07224d23, 0x22112208, 0xa1343526, 0x1d23a1fe, 0x88fe0f15, 0x231d150f, 0x3e6bc001, 0x00ff1f18, 0x0d13130d,
+    0x181f0001, 0x05b3443e, 0x01000226, 0x000900a1, 0x35214e82, 0x06064b21, 0x1e01352b, 0x25211501, 0x02303336, 0x06db5f00, 0x7b592c2a, 0x170100fe,
+    0xa0a00c08, 0xa02b3f84, 0xd95a8105, 0x00000007, 0x84ffff03, 0x00c12683, 0x002c0010, 0x41461848, 0x051c4309, 0x35363227, 0x2b343505, 0x23038301,
+    0x23011d22, 0x27410382, 0x1637230b, 0x54621415, 0x085d6207, 0x37343526, 0x17323625, 0x07554618, 0x0760fe27, 0x01040109, 0x0d2a413b, 0x0405bb2d,
+    0x07070515, 0x0c05e504, 0x8204e505, 0x04163508, 0x0c000105, 0x4d010c1e, 0xb90201c1, 0x07090907, 0x440102b9, 0x290c3741, 0x06070594, 0x04051805,
+    0x028204ca, 0x06260882, 0x0ae20507, 0x0741000a, 0x00a02408, 0x4a320016, 0x3123087f, 0x18062722, 0x9a0be17d, 0xd49632c6, 0x016a9696, 0x4c413337,
+    0x11040208, 0x0139061c, 0x18ad8d60, 0x27099b7d, 0x16311503, 0x6e56493a, 0x0020988c, 0x2b054741, 0x010002bf, 0x000f00c0, 0x002e0025, 0x23065958,
+    0x26012f22, 0x26062147, 0x06071737, 0x8506020f, 0x36022811, 0x0717013f, 0x82273717, 0x37012413, 0x47fb0136, 0xb52e050b, 0x04170505, 0x3702040e,
+    0x1b136e2d, 0x01476678, 0x1b663105, 0x2d6e1307, 0x440a0d37, 0x1302060a, 0x06010950, 0x17232282, 0x85b50505, 0x83f7201e, 0x1b07222c, 0x22418566,
+    0x831b7866, 0x837b202c, 0x5009242c, 0x82000213, 0xff042200, 0xeba618f4, 0x432a2008, 0x1e230605, 0x18010f01, 0x201df1a6, 0x062a4904, 0x2f0f5a73,
+    0x0625d801, 0x021c3e22, 0x1d480305, 0x46201937, 0x1309a718, 0x18fefe21, 0x490a754e, 0xfc330518, 0x1f12430c, 0x223e1c0f, 0x1329161a, 0x34090f07,
+    0x181a391f, 0x210e1ca7, 0x35831353, 0x05847320, 0xc5486d20, 0x50012006, 0x0b2408a7, 0x32120000, 0x32091645, 0x325d628f, 0x3270a070, 0x9475c001,
+    0x70705037, 0x82943750, 0x060021ea, 0xe02c2f82, 0xa0010002, 0x1b000b00, 0x2f002700, 0x22053773, 0x4e163225, 0x33200722, 0x4206df60, 0x342f05e0,
+    0x22373336, 0x013e3726, 0x16171632, 0x18262306, 0x200e3343, 0x270f8606, 0x1c14d001, 0x60fe141c, 0x013a0583, 0x260907b0, 0x1aa0fe1a, 0x1b070926,
+    0x1f0f181a, 0x1f7e967e, 0x3e1a180f, 0xb482090e, 0x058a8920, 0x5c48c020, 0x09803405, 0x261a1007, 0x07101a26, 0x1834a009, 0x32424232, 0x84703418,
+    0x842920df, 0x84172005, 0x00002a05, 0xff200001, 0x01e001c0, 0x21b382c1, 0x95502500, 0x012f2a05, 0x34013d26, 0x1415013f, 0x21078232, 0x77623f36,
+    0x260b8405, 0x1e313233, 0x85011d01, 0x011f2118, 0x26080b83, 0x01011e17, 0xd72e42e0, 0x0b1f212e, 0x11101b15, 0x150d1f0e, 0x01141c10, 0x15101b14,
+    0x0d0a270d, 0x83100c24, 0x82422e53, 0x0f28081d, 0x0f0a174a, 0x9308084c, 0x0602120b, 0x200b0f02, 0x14c80808, 0x141d011c, 0x200808c6, 0x07020f0b,
+    0x32080d02, 0x00140309, 0x02200082, 0x01260485, 0x00130080, 0x99820023, 0x34352124, 0x4b183736, 0x372209cf, 0x8f6f011e, 0x08534106, 0xfee0012e,
+    0x29354240, 0x07600709, 0x42352909, 0x3054f982, 0x40a03007, 0x16613b40, 0x09077052, 0x52700709, 0x5b9b6116, 0x002009c1, 0x35084776, 0x00c00181,
+    0x001f0007, 0x004a003e, 0x00720056, 0x008a007e, 0x8d472400, 0x32072306, 0x47531516, 0x82302008, 0x3233288a, 0x37321617, 0x83060736, 0x21172116,
+    0x82077360, 0x013b2319, 0xeb601632, 0x07062106, 0x210a1465, 0x2065013d, 0x0fef450b, 0x44011d21, 0x486507e3, 0x23338b0b, 0x38500802, 0x07d51f19,
+    0x1c14e03f, 0x03042e42, 0x03142a14, 0xfe102ac2, 0x130907e0, 0x0d13200d, 0x20130da0, 0xc40c130d, 0x2783180c, 0x1a30260a, 0x061a0606, 0x84038214,
+    0x8b502006, 0x8280201b, 0x3827084f, 0x2e425850, 0x1c1c1301, 0x422e0113, 0x01070701, 0x013c2a0a, 0x0709151a, 0x130d7001, 0x13130d40, 0x0d13400d,
+    0x843407d9, 0x848c2052, 0x8a862005, 0x061a224f, 0x08198af4, 0x0400002c, 0xbefffeff, 0xc2010202, 0x37000d00, 0x4b004100, 0x16000000, 0x06010714,
+    0x35262223, 0x36013734, 0x26343617, 0x07060722, 0x0289010e, 0x0607062a, 0x37321614, 0x013e3736, 0x2c080289, 0x2e270536, 0x36013f01, 0x1e031f16,
+    0x06010f01, 0x01012f26, 0xfe172fd1, 0x212218a0, 0x6001182f, 0x09042818, 0x170c050d, 0x04062720, 0x20058718, 0x2b139214, 0x130b7cfe, 0x11d01102,
+    0x9f0b1333, 0x01240988, 0x18422fc0, 0x2f224b82, 0x4b822221, 0x0577172c, 0x0c050a0d, 0x20270604, 0x05871817, 0x13921320, 0x130bb823, 0x204a8233,
+    0x864a8402, 0x02002d09, 0xbfff2000, 0xc101a001, 0x1b001500, 0x620aa37d, 0x322e0740, 0x07141516, 0x07212703, 0x70012206, 0x87181c14, 0x012c08cd,
+    0x01547854, 0x000163ac, 0x01280963, 0x2f058158, 0x3b09081c, 0x093b5555, 0xceb2fe08, 0x000012ce, 0x22068352, 0x82c00180, 0x00252e59, 0x00410029,
+    0x3d223700, 0x013b3401, 0x23038235, 0x33011d32, 0x210c354c, 0x5a701125, 0x82032007, 0x0e754409, 0x8a603b20, 0x37362305, 0x6a4608e8, 0x20012e0b,
+    0x141c00fe, 0x1c14a001, 0x0180fe40, 0xff9518f0, 0x48e02010, 0x08240b6e, 0xb0feb038, 0x0ad29518, 0x67446020, 0x150b2309, 0xaf830f11, 0x0200002c,
+    0x00800100, 0x0019000f, 0x25640023, 0xa4b51805, 0x3513210c, 0x2a065e68, 0x34353733, 0x15012b26, 0x83363233, 0x21232409, 0x821d0622, 0x213329a2,
+    0xc0013632, 0x1a26261a, 0x2605ee55, 0x09075060, 0x79d00709, 0xa02d05f7, 0xc0fe0d13, 0x0d13130d, 0x130d4001, 0x06aa5501, 0x011a2627, 0xfe261a00,
+    0x05ef67d0, 0x07101026, 0x87093009, 0x8205bb42, 0x0200232a, 0xa3540000, 0x00132806, 0x2500002e, 0x180e1733, 0x3707f370, 0x1737033e, 0x14151637,
+    0x35232707, 0x32333627, 0x26273617, 0x013f3435, 0x4a080a83, 0x0106011e, 0x13256b4b, 0x4c8f6a4b, 0x17212117, 0x1e293f28, 0x83350f21, 0x59360632,
+    0x1e28244b, 0x0214151c, 0x03021703, 0x0c0a0304, 0x2227b904, 0x21294047, 0x3e26212e, 0x18124540, 0x11442e26, 0x224e3916, 0x1d2b0c17, 0x83030302,
+    0x240d2226, 0x08a37337, 0xc101023d, 0x19000d00, 0x29002100, 0x00003100, 0x17011e13, 0x010f0616, 0x3727012e, 0x8207013e, 0x4305200d, 0x2850062f,
+    0x0f737a07, 0xc9889f39, 0x0c0d0110, 0x8cb00639, 0x2f14030f, 0xfe04a484, 0x06020385, 0x1972010a, 0x200a4c61, 0x3a0b847b, 0xc50dc001, 0x03150c88,
+    0x04ad8c10, 0x710e0b39, 0x6983a102, 0x02060a01, 0x83134c02, 0x8485201f, 0x847b2005, 0x0abb4a05, 0x0900c125, 0x82001f00, 0x03172bb1, 0x010e0321,
+    0x2622012b, 0xdd180637, 0x33280b2f, 0x012f3632, 0x37072226, 0x080d0575, 0x37013b2c, 0x32013b36, 0x1535011f, 0x01158001, 0x13f6131c, 0x0807451c,
+    0x0709390b, 0x39090720, 0x5a07080b, 0xdb040e04, 0x07090907, 0x058360fe, 0x07097832, 0x070f720f, 0x53011309, 0x1a13adfe, 0x1508c31a, 0x2505a745,
+    0x055e0815, 0xa945a505, 0x0d132309, 0x7c18130d, 0x9f890957, 0xac09ab6d, 0x0120229f, 0x05884380, 0x9da35b20, 0x50011028, 0x1c14b0fe, 0x9d9dc11c,
+    0x2b06af43, 0xc001c001, 0x1e000e00, 0x42003a00, 0x220fb17f, 0x47223617, 0x3628055d, 0x16011f32, 0x2714011d, 0x081a054c, 0x14150723, 0x3d363216,
+    0x363f0101, 0xfe18224b, 0x4b2218b4, 0x6a355f36, 0x0a55154b, 0x15550a18, 0x051605a8, 0x86038210, 0x2f283e06, 0x02802f42, 0x2218364e, 0x4e361822,
+    0x4b6f5f02, 0x08166e35, 0x20040420, 0x356e1608, 0x3c298a9d, 0x105d1605, 0x212f2f21, 0x00010010, 0x02e0ff00, 0x00a00180, 0x0500002d, 0x35262223,
+    0x09b26811, 0xbd673420, 0x11152209, 0x08db4633, 0x2d5c1420, 0xdc012f05, 0x60150f98, 0x078c0f15, 0x70070909, 0x0d8c0f15, 0x0f15202c, 0x0f9c5c01,
+    0x20070915, 0x07820907, 0xfe0f1523, 0x210e8aa4, 0x27520600, 0x0731490a, 0x9d544720, 0x9c54180e, 0x3336250d, 0x33011f32, 0x2105b35e, 0xd5761622,
+    0x4549180e, 0x6101200f, 0x250805f0, 0x2a3b2934, 0x131a130e, 0x700b0e52, 0x090b0c09, 0x130d3547, 0x0b400d13, 0x4b4b6a36, 0x34664b6a, 0x26342626,
+    0x0c8a8bfe, 0x26067e54, 0x1b322195, 0x8380110a, 0x366f292c, 0x090f110a, 0x39070860, 0x20204782, 0x4b223582, 0x3582756a, 0x9a342622, 0x00220b8a,
+    0xcf820500, 0xc001e02f, 0x0f00a001, 0x17001300, 0x1f001b00, 0x0ddd5a00, 0x33363427, 0x33152305, 0x24038227, 0x23353307, 0x21038217, 0xd84fa001,
+    0x60012509, 0x80c08080, 0x05820083, 0x4fa00121, 0x012007ef, 0x40208482, 0x14821582, 0x82008021, 0x8a152000, 0x1f270867, 0x3f002f00, 0x5f004f00,
+    0x7f006f00, 0x9f008f00, 0xbf00af00, 0xdf00cf00, 0xff00ef00, 0x1f010f01, 0x3f012f01, 0x6c004f01, 0x2b220779, 0x4c6c2201, 0x181d2008, 0x480a6454,
+    0x076005b1, 0x0610520a, 0x33202f87, 0xa8066949, 0x5649183f, 0x206f8508, 0x200f8f33, 0x05334407, 0x1f8f5f88, 0x1f8e0320, 0x0f8d1320, 0x0f8faf8f,
+    0x97076d4b, 0x8f8f90bf, 0x900f8e7f, 0x5ef0205f, 0x802008c5, 0xff210992, 0x93149200, 0x88202028, 0x20098927, 0x201392a0, 0x204fa640, 0x933c93fe,
+    0x89138964, 0x45e02096, 0x099d0969, 0x9805576d, 0x89602023, 0x95298a19, 0x8afe200a, 0x80012174, 0x18845298, 0x6d954195, 0x5489158a, 0x08000022,
+    0x20163b43, 0x10214384, 0x42233321, 0x41421d71, 0x0e214310, 0x200f3143, 0x0ec14233, 0x23223f87, 0x76431121, 0x11352405, 0x42333634, 0xf1410956,
+    0x41e02009, 0xd24112fb, 0x211d841d, 0xf88490fe, 0x200d1322, 0x41285541, 0x0a8a0a34, 0x408a0120, 0xfe211685, 0x24928390, 0x130d9001, 0x22008200,
+    0x61ffff02, 0x2324066f, 0x00002b00, 0x3e05d24e, 0x1516012f, 0x06070614, 0x06013f26, 0x27262223, 0x011f3626, 0x36343526, 0x0f163637, 0x4f063601,
+    0x013106e4, 0x085a3d61, 0x7b080b01, 0x083c510d, 0x230c010c, 0x200f8e2a, 0x05bf4844, 0x1e964020, 0xa0202e88, 0x2006bc48, 0x06eb5905, 0x1200c22c,
+    0x32002a00, 0x66004800, 0xe4610000, 0x1f162105, 0x2306cc7a, 0x2206010f, 0x480eac41, 0x988708b2, 0x82322521, 0x220621a6, 0x0e2b4118, 0x7d711320,
+    0x26222805, 0x32333634, 0x82073517, 0x820b87e1, 0x617538d9, 0x15180215, 0x0a0a1335, 0x18153513, 0x04611502, 0x100b8c0e, 0x83ea0b10, 0x302f0804,
+    0x48130707, 0x5b080613, 0x2c1e1e2c, 0x0897011e, 0x045c0407, 0x1802080d, 0x0108063e, 0x4c0b0111, 0x16020806, 0x26140e27, 0x1b252535, 0x86700808,
+    0x0b0f3707, 0x3e1663e5, 0x13051214, 0x05130b0b, 0x163e1412, 0x10600563, 0x52838a0b, 0x0e240482, 0x940e1212, 0x1e3f4f82, 0x050b562c, 0x0508058b,
+    0x6b050753, 0x33050809, 0x13026001, 0x1c14900f, 0x021c281c, 0x856c1230, 0x0c6b2808, 0x00000212, 0x4b000100, 0xc125050b, 0x00001e00, 0x074a5325,
+    0xf34a0020, 0x011f2106, 0x16221184, 0xe3833717, 0xf1013808, 0x0418010f, 0xf0fec013, 0x03026813, 0x02300610, 0x79383c09, 0x050b0831, 0x10065604,
+    0x13680203, 0x13c01001, 0x0f011804, 0x0b050470, 0x38793108, 0x0002093c, 0x43020000, 0x2e200a67, 0x2e110547, 0x34353401, 0x2326012f, 0x26010f22,
+    0x86363727, 0x0723280c, 0x16141506, 0x18373233, 0x380b9279, 0x46095001, 0x05070303, 0x26234b1f, 0x041e0105, 0x4101020a, 0x0c78aa0c, 0x8a791803,
+    0x01cd370e, 0x1e040a02, 0x23260501, 0x07051f4b, 0x09460303, 0x780c030f, 0xf3430caa, 0x02c03405, 0x00c00180, 0x001c0010, 0x00340028, 0x00500040,
+    0x885f0058, 0x012b2997, 0x23152311, 0x33363435, 0x200b794f, 0x16b94f05, 0x220b914f, 0x4c163207, 0x16200cd8, 0x3506b851, 0x07273505, 0x02150727,
+    0x13130d60, 0xa0c0800d, 0x09480d13, 0x0282091e, 0x85600121, 0x20058b07, 0x090248a8, 0xef424d20, 0x60002605, 0x01402080, 0x05e84cc0, 0x40400122,
+    0x67204682, 0xc7203e84, 0x71200584, 0x3020058a, 0xe0202482, 0x012b4083, 0x40130d20, 0x13131a13, 0x8360cd1a, 0x5620203e, 0xfb840887, 0x3b001327,
+    0x00003f00, 0x0fd54425, 0x07173724, 0x4e551605, 0x01272106, 0x2207f94c, 0x7635011f, 0x222b0b32, 0x23013d26, 0x23372707, 0x18500115, 0x2e08f17a,
+    0x09431b20, 0x03063501, 0x05080514, 0x86b3fd04, 0x09732308, 0x84460107, 0x31762407, 0x44762043, 0x50230a3d, 0x822a1c34, 0x1905252c, 0xc7010306,
+    0x59210886, 0x2050832c, 0x3a048360, 0x60349420, 0x0400001d, 0xdffffdff, 0xa001c001, 0x35001500, 0x52004f00, 0x43370000, 0x2f27058e, 0x3b362601,
+    0x82341101, 0x16322304, 0x37751115, 0x013f2105, 0x84081b74, 0x010f22db, 0x22078433, 0x63172306, 0x2f200662, 0x0623bb82, 0x8522012b, 0x013b38dc,
+    0x33071732, 0x080bb027, 0x0e045008, 0x08085004, 0x0709300b, 0x82090720, 0x190b20b5, 0x080f86fa, 0x09011f23, 0x030c1907, 0x04044705, 0x0907190b,
+    0x0b043b01, 0x34040b2a, 0x14601020, 0x05056007, 0x01140760, 0x28ba8330, 0x0980d0fe, 0x0a0e1207, 0x8a498446, 0x02eb310a, 0x0b090703, 0x090b0d0d,
+    0xa0020307, 0x30650b0b, 0x1323df93, 0x5c3f2622, 0xa78205cf, 0x21080f46, 0x264c2217, 0x20dfb405, 0x20df9010, 0xa88882e0, 0x200121df, 0xfe21e087,
+    0x22e083d0, 0xa8403001, 0x000025e0, 0xfdff0500, 0x21069f61, 0xa34a000f, 0x00552305, 0x7b4a1300, 0x0723210d, 0xcd530f8e, 0x8e35200f, 0x4221201f,
+    0xf0201405, 0xac7a9e83, 0x18072008, 0x4909917d, 0x07240584, 0xc0070909, 0xff210483, 0x10114100, 0xc76f0120, 0x0a674815, 0x24051e76, 0x07200709,
+    0x0ff04109, 0x2520e3d5, 0xa7140942, 0x60fe21e3, 0xc020e3bd, 0x200ff441, 0x2e008200, 0xfffdff04, 0x01b101e0, 0x001500a8, 0x434a0035, 0xc177198f,
+    0x08df5c08, 0x73432320, 0x1d162309, 0x3e470301, 0x06072d05, 0x26012f26, 0x2e373637, 0x013e3701, 0x4307e757, 0x0121118f, 0x08194410, 0x0a821020,
+    0x04100233, 0x0907300a, 0x2a3e2836, 0x020d062c, 0x0c0d050a, 0x91fa1909, 0x1090430a, 0x820aba41, 0x03042c0a, 0x07090920, 0x0b7d0170, 0x190b2731,
+    0x821590fa, 0x920020ea, 0x171322eb, 0x0b944316, 0x3f24d282, 0x01323601, 0x200f4745, 0x20ebaa35, 0x0974446b, 0xb0413020, 0x29012105, 0x0124ebab,
+    0x1407609b, 0x24079743, 0x05600714, 0x0a394bfe, 0x0637eca8, 0xbfff0000, 0xc0014102, 0x1e001600, 0x40002600, 0x58004300, 0x43250000, 0x17340975,
+    0x07141514, 0x15141516, 0x2723010e, 0x36323315, 0x07232634, 0x27200786, 0x23185d45, 0x05273307, 0x5a07cb5f, 0x36220885, 0xcf411732, 0x204b3005,
+    0x19090332, 0x33213202, 0x0e0e0a28, 0x8338280a, 0x44d52105, 0x08056745, 0x0c580c3c, 0x07190c03, 0x07440109, 0x3b171a17, 0xcb01172e, 0x04d00505,
+    0x0570040e, 0x0d052d05, 0x04983705, 0x09c0050d, 0x0907e007, 0x04031f2a, 0x23171214, 0x2b200302, 0x140e30c8, 0x0483600e, 0x02d68232, 0x0c090702,
+    0x090c2424, 0xd6020207, 0xc9459016, 0xd0233682, 0x82700505, 0x052d2706, 0x05983805, 0x00820005, 0xffff032e, 0x80022000, 0x13004001, 0x23001b00,
+    0x23069769, 0x26222123, 0x2506dc63, 0x34352633, 0x9c421404, 0x29ac1805, 0x78b43708, 0xfe3c5454, 0x54543ca0, 0x70185478, 0x2fe0fe18, 0x422f2f42,
+    0x05836001, 0x40012f22, 0x542a1582, 0x3b555577, 0x2c24242c, 0x14841b3c, 0x2184a020, 0x0f490020, 0x80022f05, 0x0d008001, 0x00003200, 0x27220625,
+    0x3f583336, 0x28068305, 0x0e071415, 0x032e2204, 0x056c7827, 0x33041e26, 0x37033e32, 0x46082182, 0xc647ea01, 0x123b2747, 0x0f280f13, 0xb63b1213,
+    0x0e030107, 0x88744234, 0x0e344274, 0x07090103, 0x38100906, 0x3635653f, 0x11373f64, 0x05060504, 0xe9171797, 0x0e0c0c0e, 0x030904c4, 0x441e0703,
+    0x352b2b35, 0x82071e44, 0x08092b0b, 0x1318200c, 0x0d1f1813, 0x8f820404, 0xfffbff23, 0x208f82e0, 0x208f8281, 0x3c8f822a, 0x33011e17, 0x26272221,
+    0x33013e37, 0x031e0532, 0x23061415, 0x2f022e22, 0x22232601, 0x21148207, 0x8c82013f, 0x17166008, 0x42620501, 0xdefd485f, 0x050e0e16, 0x353a5a0f,
+    0x3d291601, 0x141c0e1d, 0x25343823, 0x40366220, 0x03061004, 0x06bf141c, 0x04231807, 0x2f39559d, 0x461a1515, 0x20031156, 0x140c242c, 0x1c1e0b1c,
+    0x022b541c, 0x041f1541, 0x171e0129, 0x00000300, 0x8001c0ff, 0x0900c001, 0x17001000, 0x183d0000, 0x2208ca79, 0x52231513, 0x232a086a, 0x5e800135,
+    0x5e424042, 0x0685b0b0, 0x80806029, 0x015e5e42, 0x8220c0a2, 0x20422306, 0x008200c0, 0x0800042c, 0xf801c8ff, 0x0700b801, 0x4b820f00, 0x8f5d1f20,
+    0xf35b1806, 0x5202200a, 0xd5250e2f, 0x563d3d56, 0x0521643d, 0x91ce4f2d, 0xc391ce91, 0x6a4b4b6a, 0x8228014b, 0x563d2916, 0x0e140e43, 0x0201140e,
+    0x91221782, 0x1782e7ce, 0x826a4b21, 0x82052067, 0x02e021b3, 0x0728b383, 0x2a002200, 0x44003a00, 0x09bf5b18, 0x2008bf46, 0x10c71814, 0x1d16220d,
+    0x07424201, 0x180f067f, 0x080ac294, 0x090e9920, 0xe0090e09, 0x07090907, 0x5038b0fe, 0x261a2038, 0x60011a26, 0x6cfe5e42, 0x281c1c28, 0x6218701c,
+    0xc0260954, 0x0d400d13, 0x2e82f013, 0x670e092b, 0x07200709, 0x38382809, 0x262d8228, 0x5e261a00, 0x8270a042, 0x281c222d, 0x08fd56d4, 0x0dc07326,
+    0xc00d1313, 0x0282be82, 0x56011c24, 0x07820100, 0x1a220283, 0x0b863600, 0x19000124, 0x0b868500, 0x05000224, 0x0b86ab00, 0x20000324, 0x0b86f300,
+    0x19000424, 0x0b864801, 0x26000524, 0x0b86b001, 0x16000624, 0x0b860502, 0x2c000a24, 0x0b867602, 0x17000b24, 0x0b86d302, 0x13001024, 0x0b861303,
+    0x05001124, 0x0b863303, 0x19001224, 0x0b866d03, 0x23821520, 0x0b86af20, 0x23821620, 0x0300cf26, 0x09040100, 0x3420a882, 0x0b850382, 0x32000124,
+    0x17865100, 0x0a000224, 0x0b869f00, 0x40000324, 0x0b86b100, 0x32000424, 0x0b861401, 0x4c000524, 0x0b866201, 0x2c000624, 0x0b86d701, 0x58000a24,
+    0x0b861c02, 0x2e000b24, 0x0b86a302, 0x26001024, 0x0b86eb02, 0x0a001124, 0x0b862703, 0x32001224, 0x0b863903, 0x26001524, 0x0b868703, 0x23821620,
+    0x4300c33a, 0x70006f00, 0x72007900, 0x67006900, 0x74006800, 0x28002000, 0x29006300, 0x46200782, 0x6e201b82, 0x41261184, 0x65007700, 0x0f827300,
+    0x07826d20, 0x6f43003c, 0x69727970, 0x20746867, 0x20296328, 0x746e6f46, 0x65774120, 0x656d6f73, 0x34970000, 0x35002022, 0x72205284, 0x65204082,
+    0x53200982, 0x6c204c82, 0x64207482, 0x408a3282, 0x2035202b, 0x65657246, 0x6c6f5320, 0x8a1a8269, 0xb1118625, 0x822d205f, 0x002e2279, 0x20058431,
+    0x256d9a33, 0x312e352d, 0x21832e35, 0xc2b5f796, 0x33003322, 0x2e207c82, 0x32207e82, 0x20220982, 0x22412800, 0x0076281a, 0x00720065, 0x84690073,
+    0x003a2181, 0xba897183, 0x0000292b, 0x2e313333, 0x20333235, 0x0b744128, 0x65762029, 0x6f697372, 0x85203a6e, 0x412782c1, 0xb8410725, 0x8235200d,
+    0x057f417a, 0x41002d21, 0xbf410e7f, 0x46352506, 0x2d656572, 0x22066a41, 0x82680054, 0x0020228f, 0x22058277, 0x82270062, 0x00202297, 0x2299826d,
+    0x82740073, 0x82702099, 0x00702609, 0x006c0075, 0x20b38261, 0x20b38220, 0x20b58463, 0x20278220, 0x24218465, 0x006e0061, 0x20298264, 0x20178274,
+    0x2027826f, 0x0823826b, 0x2e00742f, 0x68540000, 0x65772065, 0x20732762, 0x74736f6d, 0x706f7020, 0x72616c75, 0x6f636920, 0x6573206e, 0x6e612074,
+    0x6f742064, 0x696b6c6f, 0x202d8274, 0x224c8268, 0x82700074, 0x003a2256, 0x2001822f, 0x20668466, 0x42768274, 0x2e220b94, 0x17826300, 0x00006d2f,
+    0x70747468, 0x2f2f3a73, 0x746e6f66, 0x05954261, 0x6f632e22, 0x39421882, 0x41002025, 0x8d420c59, 0x41002005, 0x87420b2d, 0x42599338, 0x9bcd07e7,
+    0x00020022, 0xff230084, 0x841900db, 0x21048e08, 0x1082ec03, 0x0001ed0f, 0x01020102, 0x01040103, 0x01060105, 0x01080107, 0x010a0109, 0x010c010b,
+    0x010e010d, 0x0110010f, 0x01120111, 0x01140113, 0x01160115, 0x01180117, 0x011a0119, 0x011c011b, 0x011e011d, 0x0120011f, 0x01220121, 0x01240123,
+    0x01260125, 0x01280127, 0x012a0129, 0x012c012b, 0x012e012d, 0x0130012f, 0x01320131, 0x01340133, 0x01360135, 0x01380137, 0x013a0139, 0x013c013b,
+    0x013e013d, 0x0140013f, 0x01420141, 0x01440143, 0x01460145, 0x01480147, 0x014a0149, 0x014c014b, 0x014e014d, 0x0150014f, 0x01520151, 0x01540153,
+    0x01560155, 0x01580157, 0x015a0159, 0x015c015b, 0x015e015d, 0x0160015f, 0x01620161, 0x01640163, 0x01660165, 0x01680167, 0x016a0169, 0x016c016b,
+    0x016e016d, 0x0170016f, 0x01720171, 0x01740173, 0x01760175, 0x000e0077, 0x010d00ef, 0x01790178, 0x017b017a, 0x017d017c, 0x017f017e, 0x01810180,
+    0x01830182, 0x01850184, 0x01870186, 0x01890188, 0x018b018a, 0x018d018c, 0x018f018e, 0x01910190, 0x01930192, 0x01950194, 0x01970196, 0x01990198,
+    0x019b019a, 0x019d019c, 0x019f019e, 0x01a101a0, 0x01a301a2, 0x01a501a4, 0x01a701a6, 0x01a901a8, 0x01ab01aa, 0x01ad01ac, 0x01af01ae, 0x01b101b0,
+    0x01b301b2, 0x01b501b4, 0x01b701b6, 0x01b901b8, 0x01bb01ba, 0x01bd01bc, 0x01bf01be, 0x01c101c0, 0x01c301c2, 0x01c501c4, 0x01c701c6, 0x01c901c8,
+    0x01cb01ca, 0x01cd01cc, 0x01cf01ce, 0x01d101d0, 0x01d301d2, 0x01d501d4, 0x01d701d6, 0x01d901d8, 0x01db01da, 0x01dd01dc, 0x01df01de, 0x01e101e0,
+    0x01e301e2, 0x01e501e4, 0x01e701e6, 0x01e901e8, 0x01eb01ea, 0x01ed01ec, 0x01ef01ee, 0x01f101f0, 0x01f301f2, 0x012200f4, 0x01f601f5, 0x01f801f7,
+    0x01fa01f9, 0x01fc01fb, 0x01fe01fd, 0x020002ff, 0x02020201, 0x02040203, 0x02060205, 0x02080207, 0x020a0209, 0x020c020b, 0x020e020d, 0x0210020f,
+    0x02120211, 0x02140213, 0x02160215, 0x02180217, 0x021a0219, 0x021c021b, 0x021e021d, 0x0220021f, 0x02220221, 0x02240223, 0x02260225, 0x02280227,
+    0x022a0229, 0x022c022b, 0x022e022d, 0x0230022f, 0x02320231, 0x02340233, 0x02360235, 0x02380237, 0x023a0239, 0x023c023b, 0x023e023d, 0x0240023f,
+    0x02420241, 0x02440243, 0x02460245, 0x02480247, 0x024a0249, 0x0288004b, 0x024d024c, 0x024f024e, 0x02510250, 0x02530252, 0x02550254, 0x02570256,
+    0x008b0058, 0x02590223, 0x025b025a, 0x025d025c, 0x025f025e, 0x02610260, 0x02630262, 0x02650264, 0x02670266, 0x02690268, 0x026b026a, 0x026d026c,
+    0x026f026e, 0x02710270, 0x02730272, 0x02750274, 0x02770276, 0x02790278, 0x027b027a, 0x027d027c, 0x027f027e, 0x02810280, 0x02830282, 0x02850284,
+    0x02870286, 0x02890288, 0x028b028a, 0x028d028c, 0x028f028e, 0x02910290, 0x02930292, 0x00950294, 0x028a008c, 0x02970296, 0x02990298, 0x029b029a,
+    0x029d029c, 0x029f029e, 0x02a102a0, 0x02a302a2, 0x020800a4, 0x02a602a5, 0x02a802a7, 0x02aa02a9, 0x02ac02ab, 0x02ae02ad, 0x02b002af, 0x02b202b1,
+    0x02b402b3, 0x02b602b5, 0x02b802b7, 0x02ba02b9, 0x02bc02bb, 0x02be02bd, 0x02c002bf, 0x02c202c1, 0x02c402c3, 0x02c602c5, 0x02c802c7, 0x02ca02c9,
+    0x02cc02cb, 0x02ce02cd, 0x02d002cf, 0x02d202d1, 0x02d402d3, 0x02d602d5, 0x02d802d7, 0x02da02d9, 0x02dc02db, 0x02de02dd, 0x02e002df, 0x02e202e1,
+    0x02e402e3, 0x02e602e5, 0x02e802e7, 0x02ea02e9, 0x02ec02eb, 0x02ee02ed, 0x02f002ef, 0x02f202f1, 0x02f402f3, 0x02f602f5, 0x02f802f7, 0x02fa02f9,
+    0x02fc02fb, 0x02fe02fd, 0x030003ff, 0x03020301, 0x03040303, 0x03060305, 0x03080307, 0x030a0309, 0x030c030b, 0x030e030d, 0x0310030f, 0x03120311,
+    0x03140313, 0x03160315, 0x03180317, 0x031a0319, 0x031c031b, 0x031e031d, 0x0320031f, 0x03220321, 0x03240323, 0x03260325, 0x03280327, 0x032a0329,
+    0x032c032b, 0x032e032d, 0x0330032f, 0x03320331, 0x03340333, 0x03360335, 0x03380337, 0x033a0339, 0x033c033b, 0x033e033d, 0x0340033f, 0x03420341,
+    0x03440343, 0x03460345, 0x03480347, 0x034a0349, 0x034c034b, 0x034e034d, 0x0350034f, 0x03520351, 0x03540353, 0x03560355, 0x03580357, 0x035a0359,
+    0x035c035b, 0x035e035d, 0x0360035f, 0x03620361, 0x03640363, 0x03660365, 0x03b80067, 0x03690368, 0x036b036a, 0x036d036c, 0x036f036e, 0x00710370,
+    0x03720392, 0x03740373, 0x03760375, 0x03780377, 0x037a0379, 0x037c037b, 0x037e037d, 0x0380037f, 0x03820381, 0x03840383, 0x03860385, 0x03880387,
+    0x038a0389, 0x038c038b, 0x038e038d, 0x0390038f, 0x03920391, 0x03940393, 0x03960395, 0x03980397, 0x039a0399, 0x039c039b, 0x039e039d, 0x03a0039f,
+    0x03a203a1, 0x03a403a3, 0x03a603a5, 0x03a803a7, 0x03aa03a9, 0x03ac03ab, 0x03ae03ad, 0x03b003af, 0x03b203b1, 0x03b403b3, 0x03b603b5, 0x03b803b7,
+    0x03ba03b9, 0x03bc03bb, 0x03be03bd, 0x03c003bf, 0x03c203c1, 0x03c403c3, 0x03c603c5, 0x03c803c7, 0x03ca03c9, 0x03cc03cb, 0x03ce03cd, 0x03d003cf,
+    0x03d203d1, 0x03d403d3, 0x03d603d5, 0x03d803d7, 0x03da03d9, 0x03dc03db, 0x03de03dd, 0x03e003df, 0x03e203e1, 0x03e403e3, 0x03e603e5, 0x03e803e7,
+    0x03ea03e9, 0x03ec03eb, 0x03ee03ed, 0x03f003ef, 0x03f203f1, 0x03f403f3, 0x03f603f5, 0x03f803f7, 0x03fa03f9, 0x03fc03fb, 0x03fe03fd, 0x040004ff,
+    0x04020401, 0x04040403, 0x04060405, 0x04080407, 0x040a0409, 0x040c040b, 0x040e040d, 0x0410040f, 0x04120411, 0x04140413, 0x04160415, 0x04180417,
+    0x041a0419, 0x041c041b, 0x041e041d, 0x0420041f, 0x04220421, 0x04240423, 0x04260425, 0x04280427, 0x042a0429, 0x042c042b, 0x042e042d, 0x0430042f,
+    0x04320431, 0x04340433, 0x04360435, 0x04380437, 0x043a0439, 0x043c043b, 0x043e043d, 0x0440043f, 0x04420441, 0x04440443, 0x04460445, 0x04480447,
+    0x044a0449, 0x044c044b, 0x044e044d, 0x0450044f, 0x04520451, 0x04540453, 0x04560455, 0x04580457, 0x045a0459, 0x045c045b, 0x045e045d, 0x0460045f,
+    0x04620461, 0x00640463, 0x046504dd, 0x00670466, 0x04680412, 0x046a0469, 0x046c046b, 0x046e046d, 0x0470046f, 0x04720471, 0x04740473, 0x04760475,
+    0x04780477, 0x047a0479, 0x047c047b, 0x047e047d, 0x0480047f, 0x04820481, 0x04840483, 0x04860485, 0x04880487, 0x048a0489, 0x048c048b, 0x048e048d,
+    0x0490048f, 0x04920491, 0x04940493, 0x04960495, 0x04980497, 0x049a0499, 0x049c049b, 0x049e049d, 0x04a0049f, 0x04a204a1, 0x04a404a3, 0x04a604a5,
+    0x04a804a7, 0x04aa04a9, 0x04ac04ab, 0x04ae04ad, 0x04b004af, 0x04b204b1, 0x04b404b3, 0x04b604b5, 0x04b804b7, 0x04ba04b9, 0x04bc04bb, 0x04be04bd,
+    0x04c004bf, 0x04c204c1, 0x04c404c3, 0x04c604c5, 0x04c804c7, 0x04ca04c9, 0x04cc04cb, 0x04ce04cd, 0x04d004cf, 0x04d204d1, 0x04d404d3, 0x04d604d5,
+    0x04d804d7, 0x04da04d9, 0x06dc04db, 0x63756166, 0x74077465, 0x6c696172, 0x62087265, 0x65746361, 0x09616972, 0x22080886, 0x620a6d75, 0x742d786f,
+    0x75737369, 0x61681465, 0x682d646e, 0x69646c6f, 0x6d2d676e, 0x63696465, 0x840d6c61, 0x70732814, 0x6c6b7261, 0x830a7365, 0x2d73260d, 0x68736177,
+    0x2a0a8413, 0x656b6168, 0x746c612d, 0x826c732d, 0x890f2013, 0x2f0f8613, 0x2d646165, 0x65646973, 0x756f632d, 0x68156867, 0x35850f8d, 0x15890e20,
+    0x73616d24, 0x0e890f6b, 0x72697623, 0x24738275, 0x6573756f, 0x2703822d, 0x616c0c72, 0x706f7470, 0x0d82a382, 0x756c0b26, 0x2d73676e, 0x0d252384,
+    0x706f6570, 0x2a89826c, 0x776f7272, 0x6c700b73, 0x85656e61, 0x700c245c, 0x87706d75, 0x840920cc, 0x6f732a0c, 0x730c7061, 0x6c656968, 0x253d8564,
+    0x6e697304, 0x1685046b, 0x772c5e82, 0x68637461, 0x0f30322d, 0x726f7473, 0x0b20dd8a, 0xd9840f85, 0x6f74122c, 0x74656c69, 0x7061702d, 0x69857265,
+    0x93820b20, 0x85737221, 0x8405200b, 0x840b2095, 0x20118505, 0x270b8407, 0x76047365, 0x0c747365, 0x3b820483, 0x653e6782, 0x6c670d73, 0x2d737361,
+    0x7472616d, 0x05696e69, 0x6973756d, 0x65730663, 0x68637261, 0x06826805, 0x73047426, 0x04726174, 0x04315d83, 0x6d6c6966, 0x2d687408, 0x6772616c,
+    0x68740265, 0x2f0b8307, 0x05747369, 0x63656863, 0x6974056b, 0x0b73656d, 0x2d253b85, 0x73756c70, 0x280b860c, 0x756e696d, 0x6f700973, 0x08ac8277,
+    0x66666f23, 0x67697306, 0x036c616e, 0x04676f63, 0x656d6f68, 0x6f6c6305, 0x72046b63, 0x0864616f, 0x6e776f64, 0x3108826c, 0x626e6905, 0x7204786f,
+    0x046f6465, 0x636e7973, 0x67826c08, 0x6c612d24, 0x2b840474, 0x616c6624, 0x9e820a67, 0x6870642e, 0x73656e6f, 0x6c6f760a, 0x2d656d75, 0x0b205c82,
+    0x64200a86, 0x09204882, 0x752a0b86, 0x72710670, 0x65646f63, 0xd7826207, 0x03240782, 0x04676174, 0x73260382, 0x6f6f6204, 0x0483086b, 0x72616d35,
+    0x7270056b, 0x06746e69, 0x656d6163, 0x66046172, 0x82746e6f, 0x646c351f, 0x61746906, 0x0b63696c, 0x74786574, 0x6965682d, 0x0a746867, 0x77250b84,
+    0x68746469, 0x271b820a, 0x6c2d6e67, 0x0c746665, 0x63260a85, 0x65746e65, 0x0c850b72, 0x2e837220, 0x0b850d20, 0x73756a27, 0x79666974, 0x24cb8304,
+    0x74756f07, 0x22288264, 0x836e6906, 0x76053006, 0x6f656469, 0x616d6905, 0x6d0a6567, 0x832d7061, 0x7265248f, 0x83646106, 0x74042134, 0x04379782,
+    0x74696465, 0x6574730d, 0x61622d70, 0x61776b63, 0x660d6472, 0x88747361, 0x8708200d, 0x70043316, 0x0579616c, 0x73756170, 0x74730465, 0x6607706f,
+    0x2e83726f, 0x2e840c20, 0x49840c87, 0x052c0c86, 0x63656a65, 0x68630c74, 0x6f727665, 0x0d20cc85, 0xc1840c87, 0x6c700b2f, 0x632d7375, 0x6c637269,
+    0x696d0c65, 0x230c896e, 0x656d6974, 0x33821988, 0x866b6321, 0x710f2326, 0xef826575, 0x36854e82, 0x6e690b24, 0x1b866f66, 0x72630a3a, 0x6873736f,
+    0x73726961, 0x6e616203, 0x7272610a, 0x6c2d776f, 0x0b746665, 0x74840a85, 0x0b850820, 0x86707521, 0x6f64241f, 0x82056e77, 0x65723b35, 0x70786506,
+    0x08646e61, 0x706d6f63, 0x73736572, 0x63786512, 0x616d616c, 0x6e886974, 0x69670433, 0x6c047466, 0x04666165, 0x65726966, 0x65796503, 0x26038209,
+    0x616c732d, 0x8b146873, 0x72743c2f, 0x676e6169, 0x7005656c, 0x656e616c, 0x6c61630c, 0x61646e65, 0x6c612d72, 0x82720674, 0x6d6f2265, 0x2b678207,
+    0x746e656d, 0x67616d06, 0x0a74656e, 0x21071a41, 0x32417075, 0x3d9b8308, 0x74657207, 0x74656577, 0x6f68730d, 0x6e697070, 0x61632d67, 0x66067472,
+    0x65646c6f, 0x06850b72, 0x706f2d27, 0x63096e65, 0x23188268, 0x7261622d, 0x6d326d82, 0x2d617265, 0x72746572, 0x656b036f, 0x6f630479, 0xd7837367,
+    0x73236f83, 0x82747309, 0x61682e88, 0x7409666c, 0x626d7568, 0x6b636174, 0x33298206, 0x06796870, 0x6f6c7075, 0x6c056461, 0x6e6f6d65, 0x6f687005,
+    0x0584ba82, 0x71732d34, 0x65726175, 0x6c6e7506, 0x0b6b636f, 0x64657263, 0x89837469, 0x7203643f, 0x68037373, 0x62086464, 0x686c6c75, 0x0b6e726f,
+    0x74726563, 0x63696669, 0x10657461, 0x2cea8268, 0x696f702d, 0x722d746e, 0x74686769, 0x23108a0f, 0x7466656c, 0x85058b45, 0x70752120, 0xfb831d8b,
+    0xab411120, 0x05ea4105, 0x2f832d20, 0x118c1220, 0x128c5285, 0x8d707521, 0x08468334, 0x6c670523, 0x0665626f, 0x6e657277, 0x74056863, 0x736b7361,
+    0x6c696606, 0x09726574, 0x65697262, 0x73616366, 0x050d4265, 0x612d7338, 0x7505746c, 0x73726573, 0x6e696c04, 0x6c63056b, 0x0564756f, 0x33826c66,
+    0x75630338, 0x6f630474, 0x70097970, 0x72657061, 0x70696c63, 0x76617304, 0x1a410665, 0x62042c05, 0x07737261, 0x7473696c, 0x856c752d, 0x6c6f3507,
+    0x7274730d, 0x74656b69, 0x756f7268, 0x75096867, 0x7265646e, 0x65205782, 0x25088482, 0x05656c62, 0x6967616d, 0x72740563, 0x0a6b6375, 0x656e6f6d,
+    0x69622d79, 0x630a6c6c, 0x74657261, 0x776f642d, 0x0a85086e, 0x86707521, 0x656c2413, 0x850b7466, 0x2dfb8413, 0x6c6f6307, 0x736e6d75, 0x726f7304,
+    0x04830974, 0x07203684, 0x752b0984, 0x6e650870, 0x6f6c6576, 0x82046570, 0x056f2279, 0x08ad8267, 0x62046c2f, 0x07746c6f, 0x65746973, 0x0870616d,
+    0x72626d75, 0x616c6c65, 0x73617005, 0x6c096574, 0x74686769, 0x626c7562, 0x65737507, 0x646d2d72, 0x2315820b, 0x736f6874, 0x652bf782, 0x69757308,
+    0x73616374, 0x82620465, 0x63062732, 0x6566666f, 0x1c820865, 0x74697027, 0x61096c61, 0x2c38826d, 0x65636e61, 0x64656d06, 0x0b74696b, 0x824c8366,
+    0x656a2245, 0x23318274, 0x68087265, 0x43064542, 0x364105f7, 0x61112505, 0x656c676e, 0x7521b582, 0x41068262, 0x118b05e2, 0x0f20e684, 0x7521248c,
+    0x24348d70, 0x6e776f64, 0x8321850a, 0x850b203f, 0x2038840a, 0x210b8508, 0x1f867075, 0x07282a83, 0x6b736564, 0x06706f74, 0x22057947, 0x82617406,
+    0x06742e79, 0x69626f6d, 0x710a656c, 0x65746f75, 0x8547842d, 0x2847840a, 0x69707307, 0x72656e6e, 0x058a4206, 0x6d730522, 0x05222b82, 0x79827266,
+    0x6d033f08, 0x67076865, 0x70656d61, 0x6b086461, 0x6f627965, 0x0e647261, 0x67616c66, 0x6568632d, 0x72656b63, 0x74086465, 0x696d7265, 0x046c616e,
+    0x65646f63, 0x70657209, 0x612d796c, 0x6c0e6c6c, 0x5e44636f, 0x72612105, 0x04254b82, 0x706f7263, 0x3322830b, 0x6172622d, 0x0668636e, 0x696c6e75,
+    0x69046b6e, 0x0b6f666e, 0x2f0a5d44, 0x7075730b, 0x63737265, 0x74706972, 0x62757309, 0x06360985, 0x73617265, 0x700c7265, 0x6c7a7a75, 0x69702d65,
+    0x0a656365, 0x5483696d, 0x6e6f6824, 0x0a891065, 0x2005af44, 0x07944408, 0x6966112f, 0x652d6572, 0x6e697478, 0x73697567, 0x21e78268, 0xb9826f72,
+    0x44137421, 0x81430793, 0x8e14200a, 0x69722513, 0x11746867, 0x7521148e, 0x243a8f70, 0x6e776f64, 0x22d38306, 0x440a726f, 0x2d370544, 0x08746c61,
+    0x6c6c7562, 0x65796573, 0x6c6c650a, 0x69737069, 0x89682d73, 0x0a76240a, 0x42737372, 0x61210933, 0x0d2b4679, 0x20054042, 0x217a820c, 0x25866b63,
+    0x65700a23, 0x230a866e, 0x6168730c, 0x2485d582, 0x6f630728, 0x7361706d, 0x3b431173, 0x20148505, 0x2093832d, 0x22118c0f, 0x8c127075, 0x2fdc840f,
+    0x72756509, 0x69732d6f, 0x700a6e67, 0x646e756f, 0x0b260a84, 0x6c6c6f64, 0x0b847261, 0x75720a25, 0x84656570, 0x7908210a, 0x2a838083, 0x62757223,
+    0x2113866c, 0x94826f77, 0x04251382, 0x656c6966, 0x83048308, 0x730f24fb, 0x8274726f, 0x68702208, 0x20898461, 0x220f8a0d, 0x85107075, 0x826d200d,
+    0x050a4470, 0x108b0e20, 0x11707522, 0x6e260e84, 0x72656d75, 0x3f846369, 0x11874f85, 0x45707521, 0x732a05dc, 0x0b70752d, 0x6d756874, 0x25847362,
+    0x65660627, 0x656c616d, 0x34048304, 0x6e757303, 0x6f6f6d04, 0x7261076e, 0x76696863, 0x75620365, 0x0d224167, 0x66656c27, 0x6f640a74, 0x06794174,
+    0x68770a2f, 0x636c6565, 0x72696168, 0x72696c09, 0x24f38461, 0x6170730d, 0x26ea8263, 0x74747568, 0x440f656c, 0x87410773, 0x750a2206, 0x2a59826e,
+    0x74697372, 0x72670e79, 0x42756461, 0x633905f0, 0x6c087061, 0x75676e61, 0x03656761, 0x08786166, 0x6c697562, 0x676e6964, 0x2b898205, 0x7003646c,
+    0x63047761, 0x05656275, 0x733e0483, 0x63657207, 0x656c6379, 0x72616303, 0x78617404, 0x72740469, 0x64086565, 0x62617461, 0x53417361, 0x64702d06,
+    0x69660966, 0x772d656c, 0x0a64726f, 0x65250984, 0x6c656378, 0x290a840f, 0x65776f70, 0x696f7072, 0x1a85746e, 0x826d6921, 0x840c2079, 0x85fd861a,
+    0x75612417, 0x856f6964, 0x6976240a, 0x856f6564, 0x6f632352, 0xf1826564, 0x2d656623, 0x20a38272, 0x060f430c, 0x746f6e2c, 0x700b6863, 0x72657061,
+    0xcd82702d, 0x6807652c, 0x6f747369, 0x68077972, 0xcc836165, 0x6c730922, 0x72244382, 0x09682d73, 0x23058e42, 0x10746c61, 0x21410988, 0x04240806,
+    0x626d6f62, 0x74756606, 0x036c6f62, 0x0a797474, 0x6f6e6962, 0x616c7563, 0x70047372, 0x0967756c, 0x7377656e, 0x04286484, 0x69666977, 0x6c61630a,
+    0x67821d83, 0x65620a24, 0xcc436c6c, 0x74052e05, 0x68736172, 0x6579650b, 0x6f72642d, 0x82918270, 0x34ec8297, 0x7572622d, 0x620d6873, 0x68747269,
+    0x2d796164, 0x656b6163, 0x0529480a, 0x65726123, 0x06344861, 0x87697021, 0x696c2f14, 0x740a656e, 0x6c67676f, 0x666f2d65, 0x0a870966, 0x62076e23,
+    0x05824169, 0x73756229, 0x6f6c6311, 0x82646573, 0x74702d4c, 0x696e6f69, 0x730b676e, 0x656b6568, 0x69288b82, 0x63096e67, 0x2d747261, 0x7321b982,
+    0x3d09840f, 0x6f727261, 0x6f642d77, 0x73046e77, 0x0b706968, 0x72657375, 0x6365732d, 0x0a746572, 0xc6826f6d, 0x0b2e5784, 0x65727473, 0x762d7465,
+    0x09776569, 0x42826568, 0x61656237, 0x65760574, 0x0473756e, 0x7372616d, 0x72656d07, 0x79727563, 0x28e9820b, 0x6567736e, 0x7265646e, 0x240b8a0f,
+    0x746c612d, 0x462e840c, 0x0b20064d, 0x0b863583, 0x18850a20, 0x16851183, 0x6f236d82, 0x840d656b, 0x210b8522, 0x0d8c762d, 0x6e066828, 0x65747565,
+    0x69850a72, 0x73656c24, 0xb8820673, 0x72657623, 0x83c08409, 0x840a20df, 0x69742909, 0x0373656d, 0x05646562, 0x69368d82, 0x7573066e, 0x79617762,
+    0x7461620c, 0x79726574, 0x6c75662d, 0x0c87166c, 0x82687421, 0x712d22e4, 0x22de8275, 0x88737265, 0x61682423, 0x870f666c, 0x201d8623, 0x270f870d,
+    0x74706d65, 0x6f6d0d79, 0x4a496c82, 0x72653805, 0x632d6908, 0x6f737275, 0x626f0c72, 0x7463656a, 0x6f72672d, 0x860e7075, 0x6e75210c, 0x0b310e84,
+    0x63697473, 0x6e2d796b, 0x0565746f, 0x6e6f6c63, 0x2f528265, 0x636e616c, 0x63732d65, 0x0f656c61, 0x72756f68, 0x2505a94d, 0x72617473, 0x0f890e74,
+    0x0d208f83, 0x65230e89, 0x8809646e, 0x68092a0d, 0x2d646e61, 0x6b636f72, 0x2409840a, 0x65706170, 0x05c74972, 0x69637323, 0x21948273, 0x18840b73,
+    0x7a696c25, 0x85647261, 0x70732124, 0x0c202f82, 0x2109fc49, 0x17857265, 0x61657028, 0x74026563, 0x204b0d76, 0x6c702408, 0x880e7375, 0x696d220d,
+    0x230e8b6e, 0x656d6974, 0x63361d8a, 0x6b636568, 0x646e6908, 0x72747375, 0x616d0779, 0x69702d70, 0x0783096e, 0x67697325, 0x8203736e, 0x4b0b2009,
+    0x2d290666, 0x0c746c61, 0x73756170, 0x06cb4465, 0x74730b24, 0x0b86706f, 0x5c4b0c20, 0x61622308, 0x0c8a0f67, 0x656b732c, 0x61680774, 0x61746873,
+    0xc9441067, 0x6c612b06, 0x6363612d, 0x05737365, 0x7b826c62, 0x75611128, 0x2d6f6964, 0x85476564, 0x6f692305, 0x324b0c6e, 0x05284e05, 0x72620733,
+    0x6c6c6961, 0x73611b65, 0x74736973, 0x2d657669, 0x3407826c, 0x6e696e65, 0x79732d67, 0x6d657473, 0x6d612373, 0x63697265, 0x05264661, 0x17452d20,
+    0x692d2907, 0x7265746e, 0x74657270, 0x04252b82, 0x66616564, 0x88d6830d, 0x6c0a271f, 0x762d776f, 0x72827369, 0xa6500920, 0x450d2008, 0x6f28087f,
+    0x0c6e6570, 0x72646461, 0x2d24aa82, 0x6b6f6f62, 0x63230c88, 0x43647261, 0xc8440586, 0x69082905, 0x61622d64, 0x07656764, 0x1c830882, 0x68741031,
+    0x6f6d7265, 0x6574656d, 0x75662d72, 0x8b1a6c6c, 0x0dc44210, 0x68242b8c, 0x13666c61, 0xcc422b8b, 0x8b112006, 0x6d653d13, 0x06797470, 0x776f6873,
+    0x62047265, 0x07687461, 0x63646f70, 0x0f747361, 0x646e6977, 0x6d27d382, 0x6d697861, 0x88657a69, 0x6e69210f, 0x0e200f84, 0x29081f86, 0x74736572,
+    0x0965726f, 0x7263696d, 0x6968636f, 0x6e730970, 0x6c66776f, 0x0d656b61, 0x6e657475, 0x2d6c6973, 0x6f6f7073, 0x0d86086e, 0x75087322, 0x2d295882,
+    0x09746c61, 0x73617274, 0x24098368, 0x6e797308, 0x82128463, 0x77702e4c, 0x68637461, 0x6769730c, 0x756f2d6e, 0x20168374, 0x210c840b, 0x2b846e69,
+    0x64657223, 0x2008836f, 0x2b558203, 0x616d6906, 0x0a736567, 0x636e6570, 0x54826882, 0x0a820320, 0x03820720, 0x13252183, 0x676e6f6c, 0x05f3442d,
+    0x2d201a82, 0x6e20cf82, 0x6c24138f, 0x14746665, 0x7225278e, 0x74686769, 0x22148e11, 0x4e117075, 0x50850594, 0xae847320, 0x696c6329, 0x616f6270,
+    0x840c6472, 0x21148465, 0x0c8b682d, 0x89157621, 0x05e1417f, 0x15918684, 0x16208883, 0x8a842b90, 0x16901320, 0x742b8c84, 0x616e7265, 0x696c2d6c,
+    0x822d6b6e, 0x651822de, 0x49118b78, 0x18820658, 0x78650c28, 0x6e616863, 0x25836567, 0x6c631225, 0x8464756f, 0x6f6c2383, 0x12836461, 0x12851020,
+    0x83056f4e, 0x67032910, 0x6c0e6d65, 0x6c657665, 0x12832784, 0x0e850c20, 0x84707521, 0x6f6c29f6, 0x6f2d6b63, 0x0e6e6570, 0x8309ca50, 0x4a0e2018,
+    0x78820ad7, 0xc84b0a20, 0x4d198505, 0x0e830853, 0x96430b20, 0x6c733505, 0x08687361, 0x74726f70, 0x74696172, 0x70657205, 0x730a796c, 0x83053b53,
+    0x050f4c3f, 0x74233f84, 0x43686361, 0x19840604, 0x6b636924, 0x19837465, 0x73750824, 0xa2847265, 0x82069142, 0x657322cd, 0x0739500c, 0x0a201983,
+    0x2b07b841, 0x620d746c, 0x62657361, 0x2d6c6c61, 0x0f200483, 0x6b220d82, 0x0f887465, 0x6f620c27, 0x6e696c77, 0x261c8467, 0x65686305, 0x840c7373,
+    0x622d2705, 0x6f687369, 0x0c860b70, 0x72616f24, 0x0b850a64, 0x2e826b20, 0x6b252386, 0x6867696e, 0x23178674, 0x6e776170, 0x71242e86, 0x6e656575,
+    0x72301686, 0x086b6f6f, 0x626d7564, 0x6c6c6562, 0x6f6f660d, 0x09247c89, 0x666c6f67, 0x0b227984, 0xdd826f68, 0x702d7930, 0x096b6375, 0x64697571,
+    0x63746964, 0xd1410b68, 0x75663706, 0x740c6c6c, 0x656c6261, 0x6e65742d, 0x0f73696e, 0x6c6c6f76, 0xc5887965, 0xde820920, 0x67726533, 0x08736569,
+    0x646e6162, 0x6469612d, 0x786f6203, 0x22038205, 0x4f117365, 0xb6540866, 0x62042e07, 0x086e7275, 0x73706163, 0x73656c75, 0x08d2420f, 0x2005334d,
+    0x330f890e, 0x7473696c, 0x61696409, 0x736f6e67, 0x64037365, 0x6405616e, 0x79217982, 0x2705840d, 0x616c662d, 0x64656274, 0x2005c749, 0x05df556d,
+    0x69661022, 0x0c86a682, 0x6c612d29, 0x69660974, 0x83747372, 0x4e0c2092, 0x168307ad, 0x0c880f20, 0x6d797326, 0x0b6c6f62, 0x8306fc44, 0x6e0d251b,
+    0x7365746f, 0x0621ad87, 0x29dd8370, 0x69700574, 0x13736c6c, 0xea457270, 0x622d2709, 0x6c74746f, 0x13921765, 0x0a274683, 0x636f7270, 0x82756465,
+    0x730d2331, 0xbf516968, 0x61662f05, 0x73077473, 0x696b6f6d, 0x7307676e, 0x06827279, 0x74076529, 0x656c6261, 0x450b7374, 0x04250a27, 0x6c616976,
+    0x08048305, 0x7709732e, 0x68657261, 0x6573756f, 0x69657706, 0x05746867, 0x61722d78, 0x6f620879, 0x706f2d78, 0x630c6e65, 0x656d6d6f, 0x642d746e,
+    0x0d73746f, 0x73360c87, 0x6873616c, 0x756f6305, 0x64066863, 0x74616e6f, 0x6f640465, 0x86476576, 0x06145705, 0x21571220, 0x6568240c, 0x51747261,
+    0x1f8605b4, 0x73752d23, 0x20238d64, 0x21478277, 0x36830572, 0x840d7321, 0x682d2405, 0x82706c65, 0x700d2ac4, 0x63617261, 0x65747568, 0x2097822d,
+    0x06bf560c, 0x72616339, 0x700a7972, 0x79676769, 0x6e61622d, 0x6972066b, 0x6e6f6262, 0x826f7205, 0x73082528, 0x6c646565, 0x043f3b82, 0x6e676973,
+    0x696d730a, 0x772d656c, 0x046b6e69, 0x65706174, 0x7572740d, 0x6c2d6b63, 0x8264616f, 0x850c2022, 0x6f6d220d, 0x250c8276, 0x6469760b, 0xfa4a6f65,
+    0x820a2005, 0x2d652730, 0x73616c67, 0x97430e73, 0x86198507, 0x7473220e, 0x21fd8272, 0xae497475, 0x68632405, 0x866b6365, 0x6f6c230a, 0xcb436b63,
+    0x6f632305, 0x3c840967, 0x69646524, 0x09840c74, 0x69726627, 0x73646e65, 0x4c0c840d, 0x652006ba, 0x37832485, 0x6d244285, 0x73756e69, 0x6e240a85,
+    0x616a6e69, 0x44055647, 0x1685054e, 0x98827320, 0x64856820, 0x67617422, 0x69200886, 0x73214885, 0x2277822d, 0x49616212, 0x2d250a95, 0x7466656c,
+    0x27128d13, 0x68676972, 0x6c620774, 0x65258e82, 0x6f620972, 0x0508456f, 0x72620f30, 0x6364616f, 0x2d747361, 0x65776f74, 0x0f820572, 0x0a6d6f2d,
+    0x6c616863, 0x616f626b, 0x89126472, 0x742d230a, 0xf9826165, 0x06722008, 0x72756863, 0x63056863, 0x736e696f, 0x6d6f630c, 0x74636170, 0x7369642d,
+    0x72630463, 0x8305776f, 0x046e2604, 0x65636964, 0x23048309, 0x7669662d, 0x6f230987, 0x84087275, 0x6e6f2213, 0x23088565, 0x0a786973, 0x74231184,
+    0x86657268, 0x77742f13, 0x6f640b6f, 0x632d726f, 0x65736f6c, 0x0b840964, 0x706f2b08, 0x65066e65, 0x6c617571, 0x65660773, 0x65687461, 0x72660472,
+    0x6708676f, 0x702d7361, 0x07706d75, 0x73616c67, 0x0c736573, 0x1e827267, 0x2d726527, 0x6e616874, 0x200c8b12, 0x393e842d, 0x6c65680a, 0x706f6369,
+    0x09726574, 0x6977696b, 0x7269622d, 0x656c0964, 0x31847373, 0x09880f20, 0x06272e85, 0x6f6d656d, 0x46147972, 0x1c420d22, 0x530f2005, 0x2d250971,
+    0x65766177, 0x240f8e13, 0x746c612d, 0x2413850b, 0x63656863, 0x842f866b, 0x231b830b, 0x746f6e09, 0x07276585, 0x656c6170, 0x82657474, 0x722c0807,
+    0x676e696b, 0x7265700a, 0x746e6563, 0x0f656761, 0x6a6f7270, 0x2d746365, 0x67616964, 0x076d6172, 0x65636572, 0x05747069, 0x6f626f72, 0x75250582,
+    0x0e72656c, 0x29058372, 0x6d6f632d, 0x656e6962, 0x0e851064, 0x726f6825, 0x826f7a69, 0x866c2044, 0x6576371f, 0x63697472, 0x73066c61, 0x6f6f6863,
+    0x63730b6c, 0x64776572, 0x17826972, 0x68730b30, 0x702d656f, 0x746e6972, 0x6b730573, 0x1d826c75, 0x2a055f44, 0x6e61622d, 0x6f747305, 0x84096572,
+    0x27b88305, 0x72747306, 0x0b6d6165, 0x6f290682, 0x6177706f, 0x076c6566, 0x2d518274, 0x06786f62, 0x69687374, 0x77077472, 0xc8836c61, 0x07820620,
+    0x656c4208, 0x6e610574, 0x07797267, 0x68637261, 0x05796177, 0x616c7461, 0x77610573, 0x09647261, 0x6b636162, 0x63617073, 0x65620c65, 0x7265697a,
+    0x7275632d, 0x62046576, 0x05676e6f, 0x73757262, 0x75620768, 0x28748373, 0x6e616308, 0x6962616e, 0x06af5173, 0x756f6433, 0x08656c62, 0x6b636f63,
+    0x6c696174, 0x6e6f630e, 0x233f8263, 0x622d6567, 0x26055c54, 0x65696b6f, 0x836f630b, 0x622d2306, 0x2a827469, 0x706f7222, 0x23084983, 0x67696412,
+    0x6c617469, 0x6361742d, 0x72676f68, 0x05687061, 0x7a7a6964, 0x72641079, 0x69746661, 0x632d676e, 0x2505ed51, 0x75726404, 0x04830d6d, 0x74732d29,
+    0x706c6565, 0x420b6e61, 0x4883067d, 0x69660d24, 0x2b82656c, 0x72746e25, 0x85746361, 0x072a5a0d, 0x1b840b20, 0x70786525, 0x8574726f, 0x6d69210b,
+    0x68460b83, 0x6e692705, 0x63696f76, 0x24841365, 0x2d200c86, 0x20051052, 0x46138411, 0x0e200b0e, 0x73281184, 0x616e6769, 0x65727574, 0xf7484d85,
+    0x82042005, 0x096c211a, 0x2d260483, 0x70697264, 0xbc82660b, 0x70726526, 0x746e6972, 0x73361a82, 0x6c660768, 0x65687375, 0x72660a64, 0x2d6e776f,
+    0x6e65706f, 0x5a5b6711, 0x2dc6830b, 0x6f6c670c, 0x612d6562, 0x63697266, 0x0c860e61, 0x21054f4c, 0x0e860a73, 0x6169732b, 0x69726707, 0x6563616d,
+    0x21078204, 0x0483086e, 0x09203c83, 0x62240884, 0x0f6d6165, 0x2d260988, 0x61657773, 0x0f840b74, 0x61656825, 0x85737472, 0x7173220b, 0x20988275,
+    0x85178411, 0x742d210b, 0x64821e82, 0x2d24b082, 0x72617473, 0x15840a86, 0x74263385, 0x75676e6f, 0x33841265, 0x2d200b85, 0x10203a85, 0x7723128b,
+    0x856b6e69, 0x83098389, 0x2d702189, 0x2009ff42, 0x212a820d, 0xfe422d70, 0x5b0e2007, 0xc08309a1, 0x0e830720, 0x74657328, 0x6769680b, 0x71566c68,
+    0x68072805, 0x742d746f, 0x82056275, 0x6c652407, 0x826f6a05, 0x6b0425b6, 0x09737369, 0x2d200483, 0x0984ed84, 0x2d206d83, 0x0526e284, 0x6775616c,
+    0x05840a68, 0x0c202084, 0xac850a85, 0x2e831786, 0x756c0c2c, 0x67616767, 0x61632d65, 0x545b7472, 0x4a642009, 0x64200994, 0x06209683, 0x30056a5b,
+    0x64656d05, 0x6d096c61, 0x622d6865, 0x6b6e616c, 0x08098310, 0x6c6f7225, 0x676e696c, 0x6579652d, 0x6f6d0873, 0x656d756e, 0x6d0d746e, 0x6174726f,
+    0x65702d72, 0x656c7473, 0x8261700c, 0x832d20b3, 0x72652729, 0x73617008, 0x1e827073, 0x6570092a, 0x61662d6e, 0x0779636e, 0x6e230983, 0x4c0c6269,
+    0x72260683, 0x72656c75, 0x6282700d, 0x612d6529, 0x76697272, 0x850f6c61, 0x6564220d, 0x21a88270, 0x52827275, 0x280ab648, 0x64617307, 0x7972632d,
+    0x28078308, 0x72616574, 0x7568730b, 0x24788274, 0x6e61762d, 0x08ab4209, 0x27069047, 0x6d616562, 0x6c6f730b, 0x20089e83, 0x6c656e61, 0x61707303,
+    0x6c707307, 0x6863746f, 0x72707309, 0x632d7961, 0x73056e61, 0x706d6174, 0x085c5a0d, 0x6c612d25, 0x58731074, 0xca840632, 0x082cf482, 0x70727573,
+    0x65736972, 0x6177730a, 0x62293e82, 0x076b6f6f, 0x6d697773, 0x84bf826d, 0x28248207, 0x6f6f702d, 0x69740a6c, 0x06835f6e, 0x6974052c, 0x05646572,
+    0x746f6f74, 0xb1580e68, 0x822d2007, 0x68632895, 0x6365760d, 0x53726f74, 0x0e200649, 0x24051c49, 0x6e61682d, 0x20478267, 0x0918480e, 0x0d338c83,
+    0x2d726961, 0x73657266, 0x656e6568, 0x70610972, 0x83656c70, 0x61042a17, 0x046d6f74, 0x656e6f62, 0x2e8e830b, 0x6165722d, 0x05726564, 0x69617262,
+    0x5b63076e, 0x0b2005b3, 0x90510783, 0x83092006, 0x7263250b, 0x08687361, 0x73280983, 0x10656469, 0x72616863, 0x2d207283, 0x7427fe82, 0x0a6e6f69,
+    0x82726964, 0x25098299, 0x72640c73, 0xd2827761, 0x67796c25, 0x580b6e6f, 0x2d240574, 0x65646f63, 0x79220b82, 0xba517265, 0x6c052505, 0x73676e75,
+    0x3905ad57, 0x706f6373, 0x696f0765, 0x61632d6c, 0x6f70046e, 0x7306706f, 0x65706168, 0x5c820c73, 0x6f2d722f, 0x696c2d66, 0x74056566, 0x68746565,
+    0x2005840a, 0x2330822d, 0x68740d6e, 0x2c053a47, 0x6b73616d, 0x72740d73, 0x69666661, 0x222b8263, 0x49746867, 0x6d260649, 0x74736e6f, 0x49497265,
+    0x70270806, 0x756b6369, 0x64610270, 0x6b6e6104, 0x69620568, 0x0d656c62, 0x69737562, 0x7373656e, 0x6d69742d, 0x69630465, 0x4a0e7974, 0x6c24095b,
+    0x0f72616c, 0x73200e86, 0x2406f044, 0x6f726305, 0x2be48273, 0x6d726168, 0x61686361, 0x1261726b, 0x290c8250, 0x7865742d, 0x6f660c74, 0xec82646c,
+    0x6e696d24, 0xb55c7375, 0x6c702a07, 0x660d7375, 0x656e6e75, 0x084c866c, 0x6f670736, 0x61727570, 0x6168056d, 0x0561736d, 0x61686162, 0x656a0469,
+    0x6a0e6964, 0x6e72756f, 0x772d6c61, 0x6c6c6968, 0x616b0573, 0x06616261, 0x6e61686b, 0x6c086164, 0x37080582, 0x6b72616d, 0x69616d09, 0x75622d6c,
+    0x6d076b6c, 0x726f6e65, 0x6d066861, 0x7571736f, 0x6d6f0265, 0x7361700e, 0x61666174, 0x6e616972, 0x056d7369, 0x63616570, 0x6c701065, 0x2d300582,
+    0x772d666f, 0x6873726f, 0x70047069, 0x066c6c6f, 0x2d270483, 0x72700468, 0x830d7961, 0x6e692304, 0x69832d67, 0x71057322, 0x6e219c82, 0x0681600d,
+    0x2005f045, 0x2e0d860f, 0x61636f6c, 0x6e6f6974, 0x636f7305, 0x820f736b, 0x72612c76, 0x6f722d65, 0x612d746f, 0x8211746c, 0x2d72217c, 0x2d28a782,
+    0x73657263, 0x746e6563, 0x82052843, 0x6164307a, 0x09646976, 0x616e7973, 0x75676f67, 0x83740565, 0x820a20b8, 0x69692e05, 0x7461672d, 0x69760665,
+    0x61726168, 0x054e520b, 0x756d2d2e, 0x79086574, 0x792d6e69, 0x0d676e61, 0x2506134a, 0x6f68702d, 0x194a656e, 0x64240805, 0x0a646165, 0x706d6163,
+    0x756f7267, 0x6303646e, 0x63057461, 0x72696168, 0x6f6c630a, 0x6d2d6475, 0x096e6f6f, 0x732c0a85, 0x64086e75, 0x2d656369, 0x07303264, 0x36270885,
+    0x676f6403, 0x82726406, 0x0e6e378c, 0x6d757264, 0x63697473, 0x69622d6b, 0x64076574, 0x65676e75, 0xc1586e6f, 0x63470805, 0x660b7673, 0x2d747369,
+    0x73696172, 0x67056465, 0x74736f68, 0x6d616806, 0x0872656d, 0x756e6168, 0x6861696b, 0x7461680a, 0x7a69772d, 0x06647261, 0x696b6968, 0x6805676e,
+    0x6f707069, 0x726f6805, 0x680c6573, 0x8273756f, 0x6122087c, 0x6567616d, 0x79726807, 0x61696e76, 0x73616d04, 0x6f6d086b, 0x61746e75, 0x6e0d6e69,
+    0x6f777465, 0x44826b72, 0x64827220, 0x74746f29, 0x72077265, 0x826e6e75, 0x73062d4a, 0x6c6f7263, 0x6b73106c, 0x2d6c6c75, 0x732e0b82, 0x6e6f6273,
+    0x73067365, 0x65646970, 0xcf620c72, 0x7407270b, 0x74636172, 0xd94b726f, 0x6e692305, 0x4e82756a, 0x72760c24, 0x9a82632d, 0x826f6221, 0x77042504,
+    0x0b646e69, 0x65200482, 0x2006d34d, 0x0523410e, 0x61656d28, 0x6c616274, 0x3d410f6c, 0x20f28309, 0x064d416e, 0x6e21fd82, 0x521a8513, 0x732605d0,
+    0x6165682d, 0x3d867976, 0x6e757322, 0x08362d84, 0x6f6d6564, 0x74617263, 0x616c6608, 0x73752d67, 0x656d0661, 0x90826574, 0x72657025, 0x826e6f73,
+    0x746f2d73, 0x6f700968, 0x74732d6f, 0x076d726f, 0x62365783, 0x720a776f, 0x62757065, 0x6163696c, 0x6d73046e, 0x7410676f, 0x31826d65, 0x82746121,
+    0x682d25bf, 0x0f686769, 0x6c37108b, 0x7608776f, 0x2d65746f, 0x05616579, 0x65746177, 0x61620472, 0x830d7962, 0x2be98304, 0x67616972, 0x69620965,
+    0x7a61686f, 0x6223f283, 0x60676f6c, 0x6422099a, 0x86557961, 0x65772409, 0x820a6b65, 0x79642175, 0x6e283882, 0x61630665, 0x746f7272, 0x73271f82,
+    0x65722d68, 0x82736967, 0x5013205c, 0x1c8209ef, 0xe7497720, 0x75642305, 0x1c83706d, 0x08870d20, 0x69662d34, 0x65086572, 0x72656874, 0x0574656e,
+    0x74666967, 0xc5480c73, 0x68632205, 0x64fd8265, 0x7726062d, 0x6b736968, 0xce487965, 0x75653106, 0x65706f72, 0x6972670a, 0x696c2d70, 0x1373656e,
+    0x0b480a89, 0x06260808, 0x74697567, 0x680c7261, 0x74726165, 0x6f72622d, 0x0b6e656b, 0x6c6c6f68, 0x65622d79, 0x0a797272, 0x73726f68, 0x1e822d65,
+    0x07642808, 0x63696369, 0x0573656c, 0x6f6c6769, 0x696d066f, 0x6e657474, 0x67756d07, 0x746f682d, 0x64617209, 0x69746169, 0x880d6e6f, 0x612d3709,
+    0x7208746c, 0x72747365, 0x096d6f6f, 0x65746173, 0x74696c6c, 0x09880e65, 0x69642d30, 0x73076873, 0x61632d64, 0x73086472, 0x08846d69, 0x6b730722,
+    0x6e294882, 0x6b730667, 0x676e6969, 0x3806850d, 0x726f6e2d, 0x06636964, 0x69656c73, 0x73036867, 0x730c736d, 0x62776f6e, 0x823a826f, 0x83072025,
+    0x616d230c, 0x0783086e, 0x6f6c7024, 0x9c820577, 0x06656722, 0x2f05c142, 0x6f6f7405, 0x7404736c, 0x086d6172, 0x65726966, 0x052a9983, 0x6f636162,
+    0x6f620c6e, 0xa4506b6f, 0x620b3907, 0x64616572, 0x696c732d, 0x63066563, 0x73656568, 0x6c630e65, 0x63696e69, 0xba452187, 0x270f8707, 0x75726306,
+    0x07686374, 0x6531c882, 0x03657361, 0x09676765, 0x626d6168, 0x65677275, 0x05f44f72, 0x64696d26, 0x2d656c64, 0x2105984a, 0xae826808, 0x61682d24,
+    0x39510d74, 0x73752b08, 0x68067265, 0x6f64746f, 0x77820967, 0x82632d21, 0x0e6d2183, 0x2106e446, 0xf382656d, 0x056c6124, 0x4f826170, 0x65700a27,
+    0x72657070, 0x252c822d, 0x7a69700b, 0xa985617a, 0xd6820d20, 0x2d687322, 0x2006d155, 0x830d8c11, 0x05434fe8, 0x72756e29, 0x770b6573, 0x47657661,
+    0x062b06e9, 0x696b6962, 0x620a676e, 0x8264726f, 0x6c612354, 0x0a860b6c, 0x6e6f6e24, 0x0b860c65, 0x79747331, 0x6603656c, 0x69056e61, 0x736e6f63,
+    0x82687009, 0x2055831c, 0x0bd46210, 0x0b201083, 0x742c1082, 0x69762d6f, 0x0d6f6564, 0x6f6d6572, 0x66266982, 0x616d726f, 0xa65d1374, 0x05cd450e,
+    0x5409ba5d, 0x1420059d, 0x830fae5d, 0x5d122026, 0x12830db2, 0xb65d1520, 0x85158310, 0x09ba5d63, 0x20089184, 0x6c657073, 0x68632d6c, 0x096b6365,
+    0x63696f76, 0x69616d65, 0x61680a6c, 0x6f632d74, 0x796f6277, 0x210a890f, 0xb782732d, 0x6f6d052c, 0x0c657375, 0x6f636572, 0xc9826472, 0x6c796e2b,
+    0x72616307, 0x6e617661, 0x26008300, 0x00ffff01, 0x82010002, 0x820c200a, 0x82162003, 0x260d8303, 0x00eb0303, 0x84040002, 0x8204820d, 0x82012002,
+    0xdb002403, 0x83d466d8, 0x76dc2b07, 0x00008a7b, 0x76dc0000, 0xfa05927b, 0x98ba9923
+};
@@ -8,27 +8,100 @@
 #include <vector>
 #include <string>
 #include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+#include <ctime>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstdio>
+#include <cmath>
 #include "font_awesome_5.h"
-#include "fa_solid_900.h"
 
 #define NOTIFY_MAX_MSG_LENGTH			4096		// Max message content length
-#define NOTIFY_PADDING_X				20.f		// Bottom-left X padding
-#define NOTIFY_PADDING_Y				20.f		// Bottom-left Y padding
+#define NOTIFY_LOG_MIN_LEVEL			ImGuiNotifyLogLevel_Warning	// Log messages below this level never become toasts (per category, see SetNotificationLogLevel)
+#define NOTIFY_MAX_TOASTS				32			// Max toasts alive at once, the oldest toast of the lowest priority is evicted when full
+#define NOTIFY_HISTORY_SIZE				4096		// Max records kept by the notification history (see ShowNotificationHistory), 0 to disable
+#define NOTIFY_PADDING_X				20.f		// X padding from the viewport work area
+#define NOTIFY_PADDING_Y				20.f		// Y padding from the viewport work area
+#define NOTIFY_DEFAULT_POS				ImGuiToastPos_BottomRight	// Stack toasts are placed in, unless set_position() picks another one
 #define NOTIFY_PADDING_MESSAGE_Y		10.f		// Padding Y between each message
 #define NOTIFY_FADE_IN_OUT_TIME			150			// Fade in and out duration
+#define NOTIFY_REFLOW_TIME				200			// ms for a toast to (almost) reach its new place when the stack reflows, 0 to jump there
 #define NOTIFY_DEFAULT_DISMISS			3000		// Auto dismiss after X ms (default, applied only of no data provided in constructors)
 #define NOTIFY_OPACITY					1.0f		// 0-1 Toast opacity
+#define NOTIFY_PROGRESS_BAR_HEIGHT		3.f			// Height of the progress bar drawn at the bottom of progress toasts
+#define NOTIFY_MAX_ACTIONS				3			// Max action buttons per toast (see ImGuiToast::add_action)
+#define NOTIFY_ACTION_LABEL_LENGTH		32			// Max action button label length
+#define NOTIFY_ACTION_DATA_SIZE			64			// Max state captured by an action callback, copied into the toast
+#define NOTIFY_DRAW_DATA_SIZE			128			// Max state captured by a draw callback, copied into the toast (see ImGuiToast::set_draw_callback)
+#define NOTIFY_MAX_SPANS				16			// Max styled runs of a markup content (see ImGuiToast::set_markup), further style changes are ignored
 #define NOTIFY_TOAST_FLAGS				ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoFocusOnAppearing
 // Comment out if you don't want any separator between title and content
 #define NOTIFY_USE_SEPARATOR
+// Comment out to keep toasts from reacting to the mouse (hovering a toast pauses its timer, clicking dismisses it)
+#define NOTIFY_USE_MOUSE
+// Comment out to embed the raw (uncompressed) Font Awesome TTF instead of the stb-compressed one
+#define NOTIFY_USE_COMPRESSED_FONT
+#define NOTIFY_ICONS_FONT_NAME			"fa-solid-900"	// ImFontConfig::Name of merged icon fonts, used to find the shared decompressed data
+#define NOTIFY_ATLAS_CACHE_VERSION		1			// Bump to invalidate font atlas cache files written by BuildFontAtlasCached()
+// Uncomment to only rasterize the icons toasts actually use, instead of the whole Font Awesome range (see UpdateNotificationIcons())
+//#define NOTIFY_USE_DYNAMIC_ICONS
+// Uncomment to journal every toast to disk from a background thread, and browse previous sessions in ShowNotificationHistory() (see OpenNotificationJournal())
+//#define NOTIFY_USE_JOURNAL
+#define NOTIFY_JOURNAL_VERSION			1			// Journals written with another version are not reopened
+// Uncomment to let other processes post toasts through a shared memory ring (see OpenNotificationSharedMemory() and imgui_notify_shm.h)
+//#define NOTIFY_USE_SHARED_MEMORY
+// Uncomment to record NOTIFY_TRACE() zones of the hot paths, and dump them as Chrome trace events (see SaveNotificationTrace())
+//#define NOTIFY_USE_TRACE
+#define NOTIFY_TRACE_EVENTS				16384		// Zones kept per thread, the oldest are overwritten
+
+#ifdef NOTIFY_USE_COMPRESSED_FONT
+#include "fa_solid_900_compressed.h"
+#else
+#include "fa_solid_900.h"
+#endif
+
+#ifdef NOTIFY_USE_SHARED_MEMORY
+#include "imgui_notify_shm.h"
+#endif
+
+#ifdef NOTIFY_USE_JOURNAL
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX						// Keep std::min/std::max usable
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#endif
 
 #define NOTIFY_INLINE					inline
+#ifdef NOTIFY_USE_TRACE
+#define NOTIFY_TRACE_CONCAT_(a, b)		a##b
+#define NOTIFY_TRACE_CONCAT(a, b)		NOTIFY_TRACE_CONCAT_(a, b)
+#define NOTIFY_TRACE(name)				ImGui::ImGuiNotifyTraceZone NOTIFY_TRACE_CONCAT(notify_trace_zone_, __LINE__)(name)
+#else
+#define NOTIFY_TRACE(name)
+#endif
+#define NOTIFY_LOG(level, category, ...)	do { if (ImGui::ShouldLogNotification(level, category)) ImGui::NotifyLogFormat(category, __VA_ARGS__); } while (0)
 #define NOTIFY_NULL_OR_EMPTY(str)		(!str ||! strlen(str))
 #define NOTIFY_FORMAT(fn, format, ...)	if (format) { va_list args; va_start(args, format); fn(format, args, ##__VA_ARGS__); va_end(args); }
 
 typedef int ImGuiToastType;
 typedef int ImGuiToastPhase;
 typedef int ImGuiToastPos;
+typedef int ImGuiToastPriority;
+typedef int ImGuiNotifyLogLevel;
+typedef unsigned long long (*ImGuiNotifyClockFn)();	// Milliseconds, monotonic
+typedef unsigned int ImGuiToastHandle;	// Generation (16 high bits) + slot (16 low bits), 0 is never a valid handle
+typedef void (*ImGuiToastActionFn)(ImGuiToastHandle toast, int action, void* user_data);	// Run off the UI thread, the toast may be gone by then
+typedef void (*ImGuiToastDrawFn)(ImDrawList* draw_list, const ImVec2& min, const ImVec2& max, float opacity, void* user_data);	// Run by RenderNotifications()
 
 enum ImGuiToastType_
 {
@@ -61,21 +134,202 @@ enum ImGuiToastPos_
 	ImGuiToastPos_COUNT
 };
 
+enum ImGuiToastPriority_
+{
+	ImGuiToastPriority_Auto = -1,	// Derived from the type (see ImGuiToast::get_priority)
+	ImGuiToastPriority_Low,
+	ImGuiToastPriority_Normal,
+	ImGuiToastPriority_High,
+	ImGuiToastPriority_Critical,
+	ImGuiToastPriority_COUNT
+};
+
+enum ImGuiNotifyLogLevel_
+{
+	ImGuiNotifyLogLevel_Trace,
+	ImGuiNotifyLogLevel_Debug,
+	ImGuiNotifyLogLevel_Info,
+	ImGuiNotifyLogLevel_Warning,
+	ImGuiNotifyLogLevel_Error,
+	ImGuiNotifyLogLevel_Critical,
+	ImGuiNotifyLogLevel_COUNT
+};
+
+struct ImGuiToastAction
+{
+	char				label[NOTIFY_ACTION_LABEL_LENGTH];
+	ImGuiToastActionFn	fn;
+	unsigned char		user_data[NOTIFY_ACTION_DATA_SIZE];	// Copy of the state captured by add_action()
+};
+
+struct ImGuiToastLayout
+{
+	ImU64				key = 0;							// Fonts, scale, style and wrap width it was computed with, 0 when the text changed
+	ImVec2				size;								// Window size
+	ImVec2				actions_pos[NOTIFY_MAX_ACTIONS];	// Action buttons, relative to the window
+	ImVec2				actions_size[NOTIFY_MAX_ACTIONS];
+	ImVec2				media_pos;							// Image or custom drawing, relative to the window
+	ImVec2				media_size;							// Scaled, 0 without
+};
+
+struct ImGuiToastSpan
+{
+	int					end;		// Content offset the run stops at, it starts where the previous one stopped
+	ImU32				color;		// 0 for the text color
+	bool				emphasis;	// Drawn twice 1px apart, the toasts font has no bold face
+};
+
+class ImGuiToast;
+
+namespace ImGui
+{
+	NOTIFY_INLINE ImGuiNotifyClockFn notify_clock = NULL;	// Set with SetNotificationClock(), NULL for std::chrono::steady_clock
+
+	NOTIFY_INLINE ImGuiToastHandle InsertNotification(const ImGuiToast& toast);
+	NOTIFY_INLINE bool UpdateNotification(ImGuiToastHandle handle, const char* format, ...);
+}
+
 class ImGuiToast
 {
+	friend ImGuiToastHandle ImGui::InsertNotification(const ImGuiToast& toast);
+	friend bool ImGui::UpdateNotification(ImGuiToastHandle handle, const char* format, ...);
+
 private:
+	ImGuiToastHandle handle = 0;
 	ImGuiToastType	type = ImGuiToastType_None;
+	ImGuiToastPriority priority = ImGuiToastPriority_Auto;
 	char			title[NOTIFY_MAX_MSG_LENGTH];
 	char			content[NOTIFY_MAX_MSG_LENGTH];
 	int				dismiss_time = NOTIFY_DEFAULT_DISMISS;
 	uint64_t		creation_time = 0;
+	uint64_t		pause_time = 0;										// Tick count the timer was paused at, 0 while it runs
+	uint64_t		timestamp = 0;										// Wall clock (ms since epoch) at creation, for the history
+	ImGuiToastPos	position = NOTIFY_DEFAULT_POS;
+	const std::atomic<float>* progress_source = NULL;	// Written by the caller (any thread), read once per frame
+	float			progress = -1.f;					// Last value read from progress_source, < 0 without progress bar
+	ImGuiToastLayout layouts[2];						// Computed by RenderNotifications(), most recent first
+	ImGuiToastAction actions[NOTIFY_MAX_ACTIONS];
+	int				actions_count = 0;
+	ImVec2			media_size;							// Image or custom drawing below the content (unscaled), 0 without
+	ImTextureID		image = ImTextureID();
+	ImVec2			image_uv0, image_uv1;
+	ImGuiToastDrawFn draw_fn = NULL;
+	unsigned char	draw_data[NOTIFY_DRAW_DATA_SIZE];	// Copy of the state captured by set_draw_callback()
+	bool			markup = false;
+	ImGuiToastSpan	spans[NOTIFY_MAX_SPANS];			// Parsed from the content when it is set, 0 for plain text
+	int				spans_count = 0;
 
 private:
 	// Setters
 
-	NOTIFY_INLINE auto set_title(const char* format, va_list args) { vsnprintf(this->title, sizeof(this->title), format, args); }
+	NOTIFY_INLINE auto set_title(const char* format, va_list args) { vsnprintf(this->title, sizeof(this->title), format, args); this->layouts[0].key = this->layouts[1].key = 0; }
+
+	NOTIFY_INLINE auto set_content(const char* format, va_list args) { vsnprintf(this->content, sizeof(this->content), format, args); parse_markup(); this->layouts[0].key = this->layouts[1].key = 0; }
+
+	NOTIFY_INLINE auto set_handle(ImGuiToastHandle handle) -> void { this->handle = handle; }
+
+	/// <summary>
+	/// Color of a {...} markup tag: {/}, {#RRGGBB}, {#RRGGBBAA} or a type name
+	/// </summary>
+	NOTIFY_INLINE static auto parse_markup_color(const char* begin, const char* end, ImU32* color) -> bool
+	{
+		static const char* const names[] = { "success", "warning", "error", "info" };
+		static const ImGuiToastType types[] = { ImGuiToastType_Success, ImGuiToastType_Warning, ImGuiToastType_Error, ImGuiToastType_Info };
+		const size_t length = (size_t)(end - begin);
+
+		if (length == 1 && *begin == '/')
+		{
+			*color = 0;
+			return true;
+		}
+		for (int n = 0; n < IM_ARRAYSIZE(names); n++)
+		{
+			if (strlen(names[n]) == length && !strncmp(begin, names[n], length))
+			{
+				*color = ImGui::ColorConvertFloat4ToU32(get_color(types[n]));
+				return true;
+			}
+		}
+		if (*begin != '#' || (length != 7 && length != 9))
+			return false;
+
+		ImU32 rgba = 0;
+		for (const char* c = begin + 1; c < end; c++)
+		{
+			const int digit = *c >= '0' && *c <= '9' ? *c - '0' : *c >= 'a' && *c <= 'f' ? *c - 'a' + 10 : *c >= 'A' && *c <= 'F' ? *c - 'A' + 10 : -1;
+			if (digit < 0)
+				return false;
+			rgba = (rgba << 4) | (ImU32)digit;
+		}
+		if (length == 7)
+			rgba = (rgba << 8) | 0xFF;
+		*color = IM_COL32(rgba >> 24, (rgba >> 16) & 0xFF, (rgba >> 8) & 0xFF, rgba & 0xFF);
+		return true;
+	}
+
+	/// <summary>
+	/// Strip the markup from the freshly formatted content and record the styled runs (done by set_content): RenderNotifications() only walks the spans
+	/// Only ever called on formatted text, stripped text would lose its escapes if parsed again
+	/// </summary>
+	NOTIFY_INLINE auto parse_markup() -> void
+	{
+		this->spans_count = 0;
+		if (!this->markup)
+			return;
+
+		ImU32 color = 0;
+		bool emphasis = false;
+		char* dst = this->content; // Markup only ever shrinks the text
+		const auto close_run = [&]()
+		{
+			const int end = (int)(dst - this->content);
+			ImGuiToastSpan* last = this->spans_count ? &this->spans[this->spans_count - 1] : NULL;
+			if (last && last->color == color && last->emphasis == emphasis)
+				last->end = end;
+			else if (end > (last ? last->end : 0))
+				this->spans[this->spans_count++] = { end, color, emphasis };
+		};
+		const auto set_style = [&](ImU32 new_color, bool new_emphasis)
+		{
+			// The last span is kept for the tail of the text
+			if (this->spans_count >= NOTIFY_MAX_SPANS - 1)
+				return;
+			close_run();
+			color = new_color;
+			emphasis = new_emphasis;
+		};
+
+		for (const char* src = this->content; *src;)
+		{
+			const char* close = src[0] == '{' ? strchr(src, '}') : NULL;
+			ImU32 new_color;
+			if (src[0] == '\\' && (src[1] == '*' || src[1] == '{' || src[1] == '\\'))
+			{
+				*dst++ = src[1];
+				src += 2;
+			}
+			else if (src[0] == '*' && src[1] == '*')
+			{
+				set_style(color, !emphasis);
+				src += 2;
+			}
+			else if (close && parse_markup_color(src + 1, close, &new_color))
+			{
+				set_style(new_color, emphasis);
+				src = close + 1;
+			}
+			else
+			{
+				*dst++ = *src++;
+			}
+		}
+		*dst = 0;
+		close_run();
 
-	NOTIFY_INLINE auto set_content(const char* format, va_list args) { vsnprintf(this->content, sizeof(this->content), format, args); }
+		// Nothing styled after all, rendered as plain text
+		if (this->spans_count == 1 && !this->spans[0].color && !this->spans[0].emphasis)
+			this->spans_count = 0;
+	}
 
 public:
 
@@ -83,11 +337,156 @@ public:
 
 	NOTIFY_INLINE auto set_content(const char* format, ...) -> void { NOTIFY_FORMAT(this->set_content, format); }
 
-	NOTIFY_INLINE auto set_type(const ImGuiToastType& type) -> void { IM_ASSERT(type < ImGuiToastType_COUNT); this->type = type; };
+	/// <summary>
+	/// Parse lightweight markup in the content: **emphasis**, {#RRGGBB}color{/} (or {#RRGGBBAA}), {success}, {warning}, {error} and {info} for the type colors,
+	/// a backslash escapes '*', '{' and itself. Icons need no markup, ICON_FA_* strings are glyphs of the merged font (e.g "Saved " ICON_FA_CHECK)
+	/// Applies to the contents set from now on (set_content, UpdateNotification), each is parsed once and the markup stripped from it
+	/// </summary>
+	NOTIFY_INLINE auto set_markup(bool markup) -> void { this->markup = markup; }
+
+	NOTIFY_INLINE auto set_type(const ImGuiToastType& type) -> void { IM_ASSERT(type < ImGuiToastType_COUNT); this->type = type; this->layouts[0].key = this->layouts[1].key = 0; };
+
+	/// <summary>
+	/// Place the toast in another stack of the viewport (each position stacks independently)
+	/// </summary>
+	NOTIFY_INLINE auto set_position(const ImGuiToastPos& position) -> void { IM_ASSERT(position >= 0 && position < ImGuiToastPos_COUNT); this->position = position; }
+
+	/// <summary>
+	/// Cache the window size computed for a layout key (done by RenderNotifications)
+	/// Two keys are kept, so a toast going back and forth between two scales or viewports isn't measured again
+	/// </summary>
+	NOTIFY_INLINE auto set_layout(const ImGuiToastLayout& layout) -> void
+	{
+		this->layouts[1] = this->layouts[0];
+		this->layouts[0] = layout;
+	}
+
+	/// <summary>
+	/// Show a thumbnail below the content, e.g a screenshot of what triggered the toast
+	/// </summary>
+	/// <param name="size">at scale 1, scaled like the rest of the toast</param>
+	NOTIFY_INLINE auto set_image(ImTextureID texture, const ImVec2& size, const ImVec2& uv0 = ImVec2(0, 0), const ImVec2& uv1 = ImVec2(1, 1)) -> void
+	{
+		this->image = texture;
+		this->image_uv0 = uv0;
+		this->image_uv1 = uv1;
+		this->draw_fn = NULL;
+		this->media_size = size;
+		this->layouts[0].key = this->layouts[1].key = 0;
+	}
+
+	/// <summary>
+	/// Draw something of your own below the content (e.g a sparkline of the metric that raised an alert), straight into the draw list of the toast
+	/// The callback gets the rectangle laid out for it and the toast opacity, to multiply its colors alpha with
+	/// </summary>
+	/// <param name="size">at scale 1, scaled like the rest of the toast</param>
+	/// <param name="user_data">state the callback receives, copied into the toast (up to NOTIFY_DRAW_DATA_SIZE bytes)</param>
+	NOTIFY_INLINE auto set_draw_callback(ImGuiToastDrawFn fn, const ImVec2& size, const void* user_data = NULL, size_t user_data_size = 0) -> void
+	{
+		IM_ASSERT(fn && user_data_size <= NOTIFY_DRAW_DATA_SIZE && "Captured state too large, raise NOTIFY_DRAW_DATA_SIZE");
+		this->draw_fn = fn;
+		memset(this->draw_data, 0, sizeof(this->draw_data));
+		if (user_data && user_data_size <= NOTIFY_DRAW_DATA_SIZE)
+			memcpy(this->draw_data, user_data, user_data_size);
+		this->media_size = size;
+		this->layouts[0].key = this->layouts[1].key = 0;
+	}
+
+	/// <summary>
+	/// Add a button, clicking it dismisses the toast and queues the callback (see SetNotificationExecutor). Must be added before InsertNotification()
+	/// </summary>
+	/// <param name="user_data">state the callback receives, copied into the toast (up to NOTIFY_ACTION_DATA_SIZE bytes)</param>
+	/// <returns>false if the toast already has NOTIFY_MAX_ACTIONS buttons</returns>
+	NOTIFY_INLINE auto add_action(const char* label, ImGuiToastActionFn fn, const void* user_data = NULL, size_t user_data_size = 0) -> bool
+	{
+		IM_ASSERT(fn && user_data_size <= NOTIFY_ACTION_DATA_SIZE && "Captured state too large, raise NOTIFY_ACTION_DATA_SIZE");
+		if (this->actions_count >= NOTIFY_MAX_ACTIONS || user_data_size > NOTIFY_ACTION_DATA_SIZE)
+			return false;
+
+		ImGuiToastAction& action = this->actions[this->actions_count++];
+		snprintf(action.label, sizeof(action.label), "%s", label);
+		action.fn = fn;
+		memset(action.user_data, 0, sizeof(action.user_data));
+		if (user_data_size)
+			memcpy(action.user_data, user_data, user_data_size);
+		this->layouts[0].key = this->layouts[1].key = 0;
+		return true;
+	}
+
+	/// <summary>
+	/// Override the priority derived from the type, must be set before InsertNotification()
+	/// </summary>
+	NOTIFY_INLINE auto set_priority(const ImGuiToastPriority& priority) -> void { IM_ASSERT(priority < ImGuiToastPriority_COUNT); this->priority = priority; }
+
+	/// <summary>
+	/// Turn this toast into a progress toast: kept alive while the value is below 1, dismissed once it reaches 1
+	/// Worker threads only need to store the value, e.g progress.store(0.42f, std::memory_order_relaxed)
+	/// </summary>
+	/// <param name="source">caller-owned, must stay alive until the toast expired</param>
+	NOTIFY_INLINE auto set_progress(const std::atomic<float>* source) -> void { this->progress_source = source; this->progress = source ? 0.f : -1.f; }
+
+	/// <summary>
+	/// Read the progress source, call once per frame (done by RenderNotifications)
+	/// </summary>
+	NOTIFY_INLINE auto update_progress() -> void
+	{
+		if (!this->progress_source)
+			return;
+
+		this->progress = this->progress_source->load(std::memory_order_relaxed);
+		if (this->progress < 1.f)
+		{
+			keep_alive();
+			return;
+		}
+
+		// Done: the source is never read again
+		this->progress = 1.f;
+		this->progress_source = NULL;
+		dismiss();
+	}
+
+	/// <summary>
+	/// Restart the dismiss timer, a toast that is fading out becomes fully visible again
+	/// </summary>
+	NOTIFY_INLINE auto keep_alive() -> void
+	{
+		// Just inside the Wait phase (the fade in ends at NOTIFY_FADE_IN_OUT_TIME included)
+		if (get_phase() != ImGuiToastPhase_FadeIn)
+			this->creation_time = get_time() - NOTIFY_FADE_IN_OUT_TIME - 1;
+	}
+
+	/// <summary>
+	/// Start fading out now, regardless of the dismiss time
+	/// </summary>
+	NOTIFY_INLINE auto dismiss() -> void
+	{
+		resume();
+		if (get_phase() < ImGuiToastPhase_FadeOut)
+			this->creation_time = get_tick_count() - NOTIFY_FADE_IN_OUT_TIME - this->dismiss_time - 1;
+	}
+
+	/// <summary>
+	/// Stop the timer, the toast stays in its current phase until resume() (done by RenderNotifications while the mouse is over it)
+	/// </summary>
+	NOTIFY_INLINE auto pause() -> void
+	{
+		if (!this->pause_time)
+			this->pause_time = (std::max)(get_tick_count(), 1ull);
+	}
+
+	NOTIFY_INLINE auto resume() -> void
+	{
+		if (this->pause_time)
+			this->creation_time += get_tick_count() - this->pause_time;
+		this->pause_time = 0;
+	}
 
 public:
 	// Getters
 
+	NOTIFY_INLINE auto get_handle() -> const ImGuiToastHandle { return this->handle; };
+
 	NOTIFY_INLINE auto get_title() -> char* { return this->title; };
 
 	NOTIFY_INLINE auto get_default_title() -> const char*
@@ -116,10 +515,30 @@ public:
 
 	NOTIFY_INLINE auto get_type() -> const ImGuiToastType& { return this->type; };
 
-	NOTIFY_INLINE auto get_color() -> const ImVec4
+	NOTIFY_INLINE auto get_priority() const -> const ImGuiToastPriority
 	{
+		if (this->priority != ImGuiToastPriority_Auto)
+			return this->priority;
+
 		switch (this->type)
 		{
+		case ImGuiToastType_Error:
+			return ImGuiToastPriority_Critical;
+		case ImGuiToastType_Warning:
+			return ImGuiToastPriority_High;
+		case ImGuiToastType_Success:
+			return ImGuiToastPriority_Normal;
+		default:
+			return ImGuiToastPriority_Low;
+		}
+	}
+
+	NOTIFY_INLINE auto get_color() -> const ImVec4 { return get_color(this->type); }
+
+	NOTIFY_INLINE static auto get_color(ImGuiToastType type) -> const ImVec4
+	{
+		switch (type)
+		{
 		case ImGuiToastType_None:
 			return { 255, 255, 255, 255 }; // White
 		case ImGuiToastType_Success:
@@ -156,7 +575,54 @@ public:
 
 	NOTIFY_INLINE auto get_content() -> char* { return this->content; };
 
-	NOTIFY_INLINE auto get_elapsed_time() { return get_tick_count() - this->creation_time; }
+	NOTIFY_INLINE auto get_position() const -> const ImGuiToastPos { return this->position; };
+
+	NOTIFY_INLINE auto get_progress() -> const float { return this->progress; };
+
+	NOTIFY_INLINE auto get_timestamp() -> const uint64_t { return this->timestamp; };
+
+	NOTIFY_INLINE auto get_dismiss_time() -> const int { return this->dismiss_time; };
+
+	/// <summary>
+	/// Layout cached for this layout key, NULL if it must be computed again (text, type, actions, fonts or style changed)
+	/// </summary>
+	NOTIFY_INLINE auto get_layout(ImU64 key) const -> const ImGuiToastLayout*
+	{
+		for (const ImGuiToastLayout& layout : this->layouts)
+			if (layout.key != 0 && layout.key == key)
+				return &layout;
+		return NULL;
+	}
+
+	NOTIFY_INLINE auto get_actions_count() const -> const int { return this->actions_count; }
+
+	NOTIFY_INLINE auto get_media_size() const -> const ImVec2& { return this->media_size; }
+
+	NOTIFY_INLINE auto get_spans_count() const -> const int { return this->spans_count; }
+
+	NOTIFY_INLINE auto get_span(int index) const -> const ImGuiToastSpan& { IM_ASSERT(index >= 0 && index < this->spans_count); return this->spans[index]; }
+
+	/// <summary>
+	/// Draw the image or run the draw callback in this rectangle (done by RenderNotifications)
+	/// </summary>
+	NOTIFY_INLINE auto draw_media(ImDrawList* draw_list, const ImVec2& min, const ImVec2& max, float opacity) -> void
+	{
+		if (this->draw_fn)
+			this->draw_fn(draw_list, min, max, opacity, this->draw_data);
+		else
+			draw_list->AddImage(this->image, min, max, this->image_uv0, this->image_uv1, IM_COL32(255, 255, 255, (int)(opacity * 255.f + 0.5f)));
+	}
+
+	NOTIFY_INLINE auto get_action(int index) const -> const ImGuiToastAction& { IM_ASSERT(index >= 0 && index < this->actions_count); return this->actions[index]; }
+
+	NOTIFY_INLINE auto is_paused() const -> const bool { return this->pause_time != 0; }
+
+	/// <summary>
+	/// Clock of the toast timer: the tick count, frozen while paused
+	/// </summary>
+	NOTIFY_INLINE auto get_time() const -> const unsigned long long { return this->pause_time ? this->pause_time : get_tick_count(); }
+
+	NOTIFY_INLINE auto get_elapsed_time() { return get_time() - this->creation_time; }
 
 	NOTIFY_INLINE auto get_phase() -> const ImGuiToastPhase
 	{
@@ -199,6 +665,9 @@ public:
 
 	NOTIFY_INLINE static auto get_tick_count() -> const unsigned long long
 	{
+		if (ImGui::notify_clock)
+			return ImGui::notify_clock();
+
 		using namespace std::chrono;
 		return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 	}
@@ -213,6 +682,7 @@ public:
 		this->type = type;
 		this->dismiss_time = dismiss_time;
 		this->creation_time = get_tick_count();
+		this->timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
 		memset(this->title, 0, sizeof(this->title));
 		memset(this->content, 0, sizeof(this->content));
@@ -226,141 +696,2773 @@ public:
 namespace ImGui
 {
 	NOTIFY_INLINE std::vector<ImGuiToast> notifications;
+	NOTIFY_INLINE bool notify_replaying = false;	// ReplayNotificationCapture() is running: no history, journal or capture side effects
+	NOTIFY_INLINE ImGuiViewport* notify_viewport = NULL;	// Set with SetNotificationViewport(), NULL for the main viewport
 
 	/// <summary>
-	/// Insert a new toast in the list
+	/// Show the toasts on another viewport, NULL for the main one. Toasts are placed in its work area (menu bars excluded)
+	/// Only the main viewport exists on the 'master' branch of Dear ImGui, the docking branch adds one per platform window
 	/// </summary>
-	NOTIFY_INLINE void InsertNotification(const ImGuiToast& toast)
+	NOTIFY_INLINE void SetNotificationViewport(ImGuiViewport* viewport)
 	{
-		notifications.push_back(toast);
+		notify_viewport = viewport;
 	}
 
 	/// <summary>
-	/// Remove a toast from the list by its index
+	/// Viewport the toasts are placed, sized and cached for
 	/// </summary>
-	/// <param name="index">index of the toast to remove</param>
-	NOTIFY_INLINE void RemoveNotification(int index)
+	NOTIFY_INLINE ImGuiViewport* NotifyGetViewport()
 	{
-		notifications.erase(notifications.begin() + index);
+		return notify_viewport ? notify_viewport : GetMainViewport();
 	}
 
+	NOTIFY_INLINE float notify_scale = 0.f;	// Set with SetNotificationScale(), 0 to follow io.FontGlobalScale
+
 	/// <summary>
-	/// Render toasts, call at the end of your rendering!
+	/// Scale the toasts by another factor than io.FontGlobalScale, e.g the DPI scale of the monitor showing the notification viewport
+	/// Text, paddings and the window padding, spacing and rounding of toasts are scaled, no font needs to be rebuilt. 0 to follow io.FontGlobalScale again
 	/// </summary>
-	NOTIFY_INLINE void RenderNotifications()
+	NOTIFY_INLINE void SetNotificationScale(float scale)
 	{
-		const auto vp_size = GetMainViewport()->Size;
-
-		float height = 0.f;
-
-		for (auto i = 0; i < notifications.size(); i++)
-		{
-			auto* current_toast = &notifications[i];
+		IM_ASSERT(scale >= 0.f);
+		notify_scale = scale;
+	}
 
-			// Remove toast if expired
-			if (current_toast->get_phase() == ImGuiToastPhase_Expired)
-			{
-				RemoveNotification(i);
-				continue;
-			}
+	/// <summary>
+	/// Pixel sizes of the toasts at the current scale, computed once per RenderNotifications()
+	/// </summary>
+	struct ImGuiNotifyMetrics
+	{
+		float		scale = 1.f;				// notify_scale, or io.FontGlobalScale when 0
+		float		font_scale = 1.f;			// Toast windows font scale, on top of io.FontGlobalScale
+		float		font_size = 0.f;			// Text height in toast windows
+		ImVec2		padding;					// NOTIFY_PADDING_X/Y
+		float		padding_message_y = 0.f;	// NOTIFY_PADDING_MESSAGE_Y
+		float		separator_offset = 0.f;		// Between the title and the content
+		float		progress_bar_height = 0.f;	// NOTIFY_PROGRESS_BAR_HEIGHT
+		ImVec2		window_padding;				// Style sizes pushed for toast windows
+		ImVec2		item_spacing;
+		float		window_rounding = 0.f;
+		ImVec2		frame_padding;				// Action buttons
+		float		frame_rounding = 0.f;
+	};
 
-			// Get icon, title and other data
-			const auto icon = current_toast->get_icon();
-			const auto title = current_toast->get_title();
-			const auto content = current_toast->get_content();
-			const auto default_title = current_toast->get_default_title();
-			const auto opacity = current_toast->get_fade_percent(); // Get opacity based of the current phase
+	NOTIFY_INLINE ImGuiNotifyMetrics notify_metrics;
 
-			// Window rendering
-			auto text_color = current_toast->get_color();
-			text_color.w = opacity;
+	/// <summary>
+	/// Drive every toast timer from another clock (e.g a simulated one for deterministic replays), NULL to restore std::chrono::steady_clock
+	/// </summary>
+	NOTIFY_INLINE void SetNotificationClock(ImGuiNotifyClockFn clock)
+	{
+		notify_clock = clock;
+	}
 
-			// Generate new unique name for this toast
-			char window_name[50]{};
-			snprintf(window_name, sizeof(window_name), "##TOAST%d", i);
+	struct ImGuiToastSlot
+	{
+		int			index = -1;		// Index in notifications, -1 when free
+		ImU16		generation = 0;	// Bumped when the slot is freed, so stale handles stop resolving
+	};
 
-			//PushStyleColor(ImGuiCol_Text, text_color);
-			SetNextWindowBgAlpha(opacity);
-			SetNextWindowPos(ImVec2(vp_size.x - NOTIFY_PADDING_X, vp_size.y - NOTIFY_PADDING_Y - height), ImGuiCond_Always, ImVec2(1.0f, 1.0f));
-			Begin(window_name, NULL, NOTIFY_TOAST_FLAGS);
+	NOTIFY_INLINE std::vector<ImGuiToastSlot> notify_slots;		// Handle slot -> toast index
+	NOTIFY_INLINE std::vector<int> notify_free_slots;
 
-			// Here we render the toast content
-			{
-				PushTextWrapPos(vp_size.x / 3.f); // We want to support multi-line text, this will wrap the text after 1/3 of the screen width
+	struct ImGuiNotifySpring
+	{
+		float		offset = 0.f;		// Animated distance from the anchor of the stack
+		float		velocity = 0.f;
+		float		target = 0.f;		// Distance the toast is laid out at
+		bool		placed = false;		// Set by the first layout, new toasts appear in place
+	};
 
-				bool was_title_rendered = false;
+	NOTIFY_INLINE std::vector<ImGuiNotifySpring> notify_springs;	// By handle slot: stays put while toasts are inserted and removed around it
+	NOTIFY_INLINE bool notify_springs_moving = false;				// A spring isn't at rest, the next NotifyUpdateSprings() has work to do
 
-				// If an icon is set
-				if (!NOTIFY_NULL_OR_EMPTY(icon))
-				{
-					//Text(icon); // Render icon text
-					TextColored(text_color, icon);
-					was_title_rendered = true;
-				}
+	struct ImGuiNotifyStats
+	{
+		int			live = 0;					// Toasts in the list
+		int			visible = 0;				// Toast windows at least partly inside the viewport
+		int			pending = 0;				// Messages waiting for the next drain (log batches, shared memory ring)
+		float		inserts_per_second = 0.f;	// Over the last second
+		float		drops_per_second = 0.f;		// Toasts dropped or evicted because NOTIFY_MAX_TOASTS were alive
+		ImU64		inserts_total = 0;
+		ImU64		drops_total = 0;
+		size_t		text_bytes_used = 0;		// Titles and contents of the live toasts
+		size_t		text_bytes_reserved = 0;	// Title and content buffers of the list capacity
+		double		drain_ms = 0.0;				// Shared memory and log drains of the last RenderNotifications()
+		double		render_ms = 0.0;			// Last RenderNotifications(), drains included
+		int			vertices = 0;				// Emitted by the toast windows last frame
+		int			indices = 0;
+		int			windows = 0;				// Toast windows submitted last frame, transparent and off-screen toasts are culled
+		int			windows_created = 0;		// Distinct "##TOAST%d" windows ever submitted, Dear ImGui never frees them
+	};
 
-				// If a title is set
-				if (!NOTIFY_NULL_OR_EMPTY(title))
-				{
-					// If a title and an icon is set, we want to render on same line
-					if (!NOTIFY_NULL_OR_EMPTY(icon))
-						SameLine();
+	NOTIFY_INLINE ImGuiNotifyStats notify_stats;
+	NOTIFY_INLINE unsigned long long notify_stats_window_start = 0;	// Rates are measured over 1s windows
+	NOTIFY_INLINE ImU64 notify_stats_window_inserts = 0;
+	NOTIFY_INLINE ImU64 notify_stats_window_drops = 0;
 
-					Text(title); // Render title text
-					was_title_rendered = true;
-				}
-				else if (!NOTIFY_NULL_OR_EMPTY(default_title))
-				{
-					if (!NOTIFY_NULL_OR_EMPTY(icon))
-						SameLine();
+	/// <summary>
+	/// Counters of the toast pipeline, refreshed by RenderNotifications()
+	/// </summary>
+	NOTIFY_INLINE const ImGuiNotifyStats& GetNotificationStats()
+	{
+		return notify_stats;
+	}
 
-					Text(default_title); // Render default title text (ImGuiToastType_Success -> "Success", etc...)
-					was_title_rendered = true;
-				}
+	struct ImGuiNotifyHistoryRecord
+	{
+		uint64_t		timestamp;	// ImGuiToast::get_timestamp()
+		int				title;		// Index in notify_history_strings, -1 if empty
+		int				content;	// Index in notify_history_strings, -1 if empty
+		ImGuiToastType	type;
+	};
 
-				// In case ANYTHING was rendered in the top, we want to add a small padding so the text (or icon) looks centered vertically
-				if (was_title_rendered && !NOTIFY_NULL_OR_EMPTY(content))
-				{
-					SetCursorPosY(GetCursorPosY() + 5.f); // Must be a better way to do this!!!!
-				}
+	struct ImGuiNotifyHistoryString
+	{
+		std::string		text;
+		int				refs = 0;	// Records using this string, recycled at 0
+	};
 
-				// If a content is set
-				if (!NOTIFY_NULL_OR_EMPTY(content))
-				{
-					if (was_title_rendered)
-					{
-#ifdef NOTIFY_USE_SEPARATOR
-						Separator();
-#endif
-					}
+	NOTIFY_INLINE std::vector<ImGuiNotifyHistoryRecord> notify_history;			// Ring buffer of NOTIFY_HISTORY_SIZE records
+	NOTIFY_INLINE int notify_history_head = 0;										// Next record to write
+	NOTIFY_INLINE int notify_history_count = 0;
+	NOTIFY_INLINE ImU64 notify_history_total = 0;									// Records ever added: the last notify_history_count of them are kept
+	NOTIFY_INLINE std::vector<ImGuiNotifyHistoryString> notify_history_strings;	// Interned titles and contents, repeated toasts share one copy
+	NOTIFY_INLINE std::unordered_map<std::string, int> notify_history_string_ids;
+	NOTIFY_INLINE std::vector<int> notify_history_free_strings;
 
-					Text(content); // Render content text
-				}
+	/// <summary>
+	/// State of ShowNotificationHistory(). Rows are numbered like the records were added (journal: record index),
+	/// new records are inserted in place and overwritten ones removed, the rows are only built again when the filter, the sort order or the source changed
+	/// </summary>
+	struct ImGuiNotifyHistoryView
+	{
+		ImGuiTextFilter		filter;
+		std::vector<ImU64>	rows;					// Filtered and sorted
+		ImU64				rows_first = 0;			// Oldest record kept when the rows were last updated
+		ImU64				rows_end = 0;			// Records added when the rows were last updated
+		bool				rows_dirty = true;
+		bool				from_journal = false;
+		int					sort_column = -1;		// -1 for the order records were added in
+		bool				sort_descending = false;
+		std::string			filter_text;
+	};
 
-				PopTextWrapPos();
-			}
+	NOTIFY_INLINE ImGuiNotifyHistoryView notify_history_view;
 
-			// Save height for next toasts
-			height += GetWindowHeight() + NOTIFY_PADDING_MESSAGE_Y;
+	NOTIFY_INLINE std::vector<ImU32> notify_icons_used((ICON_MAX_FA - ICON_MIN_FA + 32) / 32);	// 1 bit per Font Awesome codepoint
+	NOTIFY_INLINE std::vector<ImWchar> notify_icons_ranges;										// Glyph ranges of the merged icon fonts (NOTIFY_USE_DYNAMIC_ICONS)
+	NOTIFY_INLINE bool notify_icons_dirty = false;													// An icon was requested since the last atlas build
+
+	/// <summary>
+	/// Mark an icon as used, with NOTIFY_USE_DYNAMIC_ICONS it is added to the atlas on the next UpdateNotificationIcons()
+	/// </summary>
+	NOTIFY_INLINE void RequestNotificationIcon(unsigned int codepoint)
+	{
+		if (codepoint < ICON_MIN_FA || codepoint > ICON_MAX_FA)
+			return;
+
+		const unsigned int bit = codepoint - ICON_MIN_FA;
+		if (notify_icons_used[bit / 32] & (1u << (bit % 32)))
+			return;
+
+		notify_icons_used[bit / 32] |= 1u << (bit % 32);
+		notify_icons_dirty = true;
+	}
+
+	/// <summary>
+	/// Request every icon found in an UTF-8 string (e.g. a toast content containing ICON_FA_* glyphs)
+	/// </summary>
+	NOTIFY_INLINE void RequestNotificationIcons(const char* text)
+	{
+		if (!text)
+			return;
+
+		// Font Awesome lives in the Private Use Area, always encoded with 3 bytes (0xEF 0x80..0xA5 0x80..0xBF)
+		for (const unsigned char* c = (const unsigned char*)text; *c; c++)
+		{
+			if ((c[0] & 0xF0) == 0xE0 && (c[1] & 0xC0) == 0x80 && (c[2] & 0xC0) == 0x80)
+			{
+				RequestNotificationIcon(((c[0] & 0x0Fu) << 12) | ((c[1] & 0x3Fu) << 6) | (c[2] & 0x3Fu));
+				c += 2;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Glyph ranges merged by MergeIconsWithLatestFont(): every used icon with NOTIFY_USE_DYNAMIC_ICONS, else the whole Font Awesome range
+	/// </summary>
+	NOTIFY_INLINE const ImWchar* GetNotificationIconRanges()
+	{
+#ifdef NOTIFY_USE_DYNAMIC_ICONS
+		// Icons of the built-in toast types are always needed
+		RequestNotificationIcons(ICON_FA_CHECK_CIRCLE ICON_FA_EXCLAMATION_TRIANGLE ICON_FA_TIMES_CIRCLE ICON_FA_INFO_CIRCLE);
+
+		notify_icons_ranges.clear();
+		for (unsigned int codepoint = ICON_MIN_FA; codepoint <= ICON_MAX_FA; codepoint++)
+		{
+			const unsigned int bit = codepoint - ICON_MIN_FA;
+			if (!(notify_icons_used[bit / 32] & (1u << (bit % 32))))
+				continue;
+
+			// Extend the last range when contiguous, else open a new one
+			if (!notify_icons_ranges.empty() && notify_icons_ranges.back() == codepoint - 1)
+				notify_icons_ranges.back() = (ImWchar)codepoint;
+			else
+				notify_icons_ranges.insert(notify_icons_ranges.end(), { (ImWchar)codepoint, (ImWchar)codepoint });
+		}
+		notify_icons_ranges.push_back(0);
+		notify_icons_dirty = false;
+		return notify_icons_ranges.data();
+#else
+		static const ImWchar icons_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
+		return icons_ranges;
+#endif
+	}
+
+	/// <summary>
+	/// With NOTIFY_USE_DYNAMIC_ICONS, rebuild the font atlas when toasts requested icons that were never rasterized
+	/// Call before NewFrame(), the atlas is locked during the frame. Until then, missing icons render as the fallback glyph
+	/// </summary>
+	/// <returns>true if the atlas was rebuilt: the whole font texture must be uploaded again by the backend</returns>
+	NOTIFY_INLINE bool UpdateNotificationIcons()
+	{
+#ifdef NOTIFY_USE_DYNAMIC_ICONS
+		if (!notify_icons_dirty)
+			return false;
+
+		ImFontAtlas* atlas = GetIO().Fonts;
+		IM_ASSERT(!atlas->Locked && "UpdateNotificationIcons() must be called before NewFrame()!");
+
+		// Every merged size shares the same ranges, the vector may have been reallocated
+		const ImWchar* ranges = GetNotificationIconRanges();
+		for (ImFontConfig& cfg : atlas->ConfigData)
+			if (!strcmp(cfg.Name, NOTIFY_ICONS_FONT_NAME))
+				cfg.GlyphRanges = ranges;
+
+		atlas->Build();
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	NOTIFY_INLINE int NotifyInternString(const char* text)
+	{
+		if (NOTIFY_NULL_OR_EMPTY(text))
+			return -1;
+
+		int id;
+		const auto it = notify_history_string_ids.find(text);
+		if (it != notify_history_string_ids.end())
+		{
+			id = it->second;
+		}
+		else
+		{
+			if (!notify_history_free_strings.empty())
+			{
+				id = notify_history_free_strings.back();
+				notify_history_free_strings.pop_back();
+			}
+			else
+			{
+				id = (int)notify_history_strings.size();
+				notify_history_strings.push_back({});
+			}
+			notify_history_strings[id].text = text;
+			notify_history_string_ids.emplace(notify_history_strings[id].text, id);
+		}
+
+		notify_history_strings[id].refs++;
+		return id;
+	}
+
+	NOTIFY_INLINE void NotifyReleaseString(int id)
+	{
+		if (id < 0 || --notify_history_strings[id].refs > 0)
+			return;
+
+		notify_history_string_ids.erase(notify_history_strings[id].text);
+		std::string().swap(notify_history_strings[id].text);
+		notify_history_free_strings.push_back(id);
+	}
+
+	NOTIFY_INLINE const char* GetNotificationHistoryString(int id)
+	{
+		return id >= 0 ? notify_history_strings[id].text.c_str() : "";
+	}
+
+	/// <summary>
+	/// Record a toast in the history, the oldest record is overwritten when full (done when a toast is removed)
+	/// </summary>
+	NOTIFY_INLINE void AddNotificationHistory(ImGuiToast& toast)
+	{
+		if (NOTIFY_HISTORY_SIZE <= 0 || notify_replaying)
+			return;
+
+		if (notify_history.empty())
+			notify_history.resize(NOTIFY_HISTORY_SIZE);
+
+		ImGuiNotifyHistoryRecord& record = notify_history[notify_history_head];
+		if (notify_history_count == NOTIFY_HISTORY_SIZE)
+		{
+			NotifyReleaseString(record.title);
+			NotifyReleaseString(record.content);
+		}
+		else
+		{
+			notify_history_count++;
+		}
+
+		record.timestamp = toast.get_timestamp();
+		record.title = NotifyInternString(toast.get_default_title());
+		record.content = NotifyInternString(toast.get_content());
+		record.type = toast.get_type();
+
+		notify_history_head = (notify_history_head + 1) % NOTIFY_HISTORY_SIZE;
+		notify_history_total++;
+	}
+
+	/// <summary>
+	/// FNV-1a hash, used to key caches on their inputs
+	/// </summary>
+	NOTIFY_INLINE ImU64 NotifyHash(const void* data, size_t size, ImU64 seed = 14695981039346656037ULL)
+	{
+		const unsigned char* bytes = (const unsigned char*)data;
+		ImU64 hash = seed;
+		for (size_t i = 0; i < size; i++)
+			hash = (hash ^ bytes[i]) * 1099511628211ULL;
+		return hash;
+	}
+
+	NOTIFY_INLINE FILE* NotifyFileOpen(const char* filename, const char* mode)
+	{
+#ifdef _MSC_VER
+		FILE* f = NULL;
+		return fopen_s(&f, filename, mode) == 0 ? f : NULL;
+#else
+		return fopen(filename, mode);
+#endif
+	}
+
+#ifdef NOTIFY_USE_TRACE
+	struct ImGuiNotifyTraceEvent
+	{
+		const char*	name;		// Zone name, must be a string literal
+		ImU64		begin;		// steady_clock (ns)
+		ImU64		end;
+	};
+
+	/// <summary>
+	/// Zones of one thread. Only the owner writes, dumps read what was published through head.
+	/// Never freed, so zones of threads that exited can still be dumped
+	/// </summary>
+	struct ImGuiNotifyTraceBuffer
+	{
+		ImGuiNotifyTraceEvent	events[NOTIFY_TRACE_EVENTS];
+		std::atomic<ImU64>		head{ 0 };		// Zones ever recorded, events[head % NOTIFY_TRACE_EVENTS] is the next one
+		int						thread_id = 0;
+		ImGuiNotifyTraceBuffer*	next = NULL;
+	};
+
+	NOTIFY_INLINE std::atomic<ImGuiNotifyTraceBuffer*> notify_trace_buffers{ NULL };	// Lock-free list, buffers are only ever pushed
+	NOTIFY_INLINE std::atomic<int> notify_trace_threads{ 0 };
+
+	NOTIFY_INLINE ImU64 NotifyTraceNow()
+	{
+		return (ImU64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	NOTIFY_INLINE ImGuiNotifyTraceBuffer* NotifyTraceThreadBuffer()
+	{
+		thread_local ImGuiNotifyTraceBuffer* buffer = NULL;
+		if (!buffer)
+		{
+			buffer = new ImGuiNotifyTraceBuffer();
+			buffer->thread_id = ++notify_trace_threads;
+			buffer->next = notify_trace_buffers.load(std::memory_order_relaxed);
+			while (!notify_trace_buffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+		return buffer;
+	}
+
+	/// <summary>
+	/// Records its lifetime, use through NOTIFY_TRACE("name")
+	/// </summary>
+	struct ImGuiNotifyTraceZone
+	{
+		const char*	name;
+		ImU64		begin;
+
+		ImGuiNotifyTraceZone(const char* name) : name(name), begin(NotifyTraceNow()) {}
+
+		~ImGuiNotifyTraceZone()
+		{
+			ImGuiNotifyTraceBuffer* buffer = NotifyTraceThreadBuffer();
+			const ImU64 head = buffer->head.load(std::memory_order_relaxed);
+			buffer->events[head % NOTIFY_TRACE_EVENTS] = { this->name, this->begin, NotifyTraceNow() };
+			buffer->head.store(head + 1, std::memory_order_release);
+		}
+	};
+
+	/// <summary>
+	/// Write the recorded zones as Chrome trace events, to open in Perfetto or chrome://tracing
+	/// Timestamps come from std::chrono::steady_clock, so they line up with other traces of the same clock
+	/// Can run while other threads record, zones overwritten during the dump are skipped
+	/// </summary>
+	NOTIFY_INLINE bool SaveNotificationTrace(const char* filename)
+	{
+		FILE* f = NotifyFileOpen(filename, "wb");
+		if (!f)
+			return false;
+
+		fputs("{\"traceEvents\":[\n", f);
+		bool first = true;
+		std::vector<ImGuiNotifyTraceEvent> events;
+		for (ImGuiNotifyTraceBuffer* buffer = notify_trace_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next)
+		{
+			const ImU64 head = buffer->head.load(std::memory_order_acquire);
+			const ImU64 tail = head > NOTIFY_TRACE_EVENTS ? head - NOTIFY_TRACE_EVENTS : 0;
+			events.clear();
+			for (ImU64 n = tail; n < head; n++)
+				events.push_back(buffer->events[n % NOTIFY_TRACE_EVENTS]);
+
+			// The owner may have wrapped around meanwhile: drop the slots it reused, or is writing
+			const ImU64 head_after = buffer->head.load(std::memory_order_acquire);
+			const ImU64 valid = head_after + 1 > NOTIFY_TRACE_EVENTS ? head_after + 1 - NOTIFY_TRACE_EVENTS : 0;
+
+			fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"notify %d\"}}", first ? "" : ",\n", buffer->thread_id, buffer->thread_id);
+			first = false;
+			for (ImU64 n = (std::max)(tail, valid); n < head; n++)
+			{
+				const ImGuiNotifyTraceEvent& event = events[(size_t)(n - tail)];
+				fprintf(f, ",\n{\"name\":\"%s\",\"cat\":\"notify\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", event.name, buffer->thread_id, event.begin / 1000.0, (event.end - event.begin) / 1000.0);
+			}
+		}
+		fputs("\n]}\n", f);
+		fclose(f);
+		return true;
+	}
+#endif
+
+#ifdef NOTIFY_USE_JOURNAL
+	// Journal files (little-endian, append-only):
+	// - <path>.idx: ImGuiNotifyJournalHeader, then one ImGuiNotifyJournalRecord per toast
+	// - <path>.str: ImGuiNotifyJournalHeader, then the NUL-terminated strings records point to (deduplicated within a session)
+	struct ImGuiNotifyJournalHeader
+	{
+		char		magic[4];		// "NFJI" or "NFJS"
+		ImU32		version;		// NOTIFY_JOURNAL_VERSION
+	};
+
+	struct ImGuiNotifyJournalRecord
+	{
+		ImU64		timestamp;		// ImGuiToast::get_timestamp()
+		ImU64		title;			// Offset in the .str file, 0 if empty (the header is never a string)
+		ImU64		content;
+		ImS32		type;
+		ImS32		dismiss_time;
+	};
+
+	NOTIFY_INLINE void* NotifyMapFile(const char* filename, size_t* out_size)
+	{
+		void* view = NULL;
+		*out_size = 0;
+#ifdef _WIN32
+		HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+			return NULL;
+
+		LARGE_INTEGER size = {};
+		if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+		{
+			HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping)
+			{
+				view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				CloseHandle(mapping); // The view keeps the mapping alive
+			}
+		}
+		CloseHandle(file);
+		if (view)
+			*out_size = (size_t)size.QuadPart;
+#else
+		const int fd = open(filename, O_RDONLY);
+		if (fd < 0)
+			return NULL;
+
+		struct stat st = {};
+		if (fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			if (view == MAP_FAILED)
+				view = NULL;
+		}
+		close(fd);
+		if (view)
+			*out_size = (size_t)st.st_size;
+#endif
+		return view;
+	}
+
+	NOTIFY_INLINE void NotifyUnmapFile(void* view, size_t size)
+	{
+		if (!view)
+			return;
+#ifdef _WIN32
+		IM_UNUSED(size);
+		UnmapViewOfFile(view);
+#else
+		munmap(view, size);
+#endif
+	}
+
+	/// <summary>
+	/// Cut a file that isn't mapped to size bytes
+	/// </summary>
+	NOTIFY_INLINE bool NotifyTruncateFile(const char* filename, ImU64 size)
+	{
+#ifdef _WIN32
+		HANDLE file = CreateFileA(filename, GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER distance = {};
+		distance.QuadPart = (LONGLONG)size;
+		const bool truncated = SetFilePointerEx(file, distance, NULL, FILE_BEGIN) && SetEndOfFile(file);
+		CloseHandle(file);
+		return truncated;
+#else
+		return truncate(filename, (off_t)size) == 0;
+#endif
+	}
+
+	/// <summary>
+	/// Append-only journal: the UI thread only queues toasts, a background thread writes and flushes them in batches
+	/// The journal left by previous sessions is memory-mapped read-only, pages are only loaded when browsed
+	/// </summary>
+	class ImGuiNotifyJournal
+	{
+	private:
+		struct Entry
+		{
+			ImU64		timestamp;
+			ImS32		type;
+			ImS32		dismiss_time;
+			std::string	title;
+			std::string	content;
+		};
+
+		std::thread					thread;
+		std::mutex					mutex;
+		std::condition_variable		wake;
+		std::vector<Entry>			pending;	// Queued by the UI thread, swapped out by the writer
+		bool						stop = false;
+		FILE*						idx_file = NULL;
+		FILE*						str_file = NULL;
+
+		void*						idx_view = NULL;
+		size_t						idx_view_size = 0;
+		void*						str_view = NULL;
+		size_t						str_view_size = 0;
+		const ImGuiNotifyJournalRecord* records = NULL;
+		int							records_count = 0;
+		size_t						strings_size = 0;	// Up to the last NUL, a string cut by a crash is never read
+
+	private:
+		NOTIFY_INLINE static auto file_size(FILE* f) -> ImU64
+		{
+			fseek(f, 0, SEEK_END);
+#ifdef _MSC_VER
+			return (ImU64)_ftelli64(f);
+#else
+			return (ImU64)ftello(f);
+#endif
+		}
+
+		NOTIFY_INLINE static auto header_matches(const void* view, size_t size, const char* magic) -> bool
+		{
+			const ImGuiNotifyJournalHeader* header = (const ImGuiNotifyJournalHeader*)view;
+			return size >= sizeof(*header) && !memcmp(header->magic, magic, 4) && header->version == NOTIFY_JOURNAL_VERSION;
+		}
+
+		NOTIFY_INLINE static auto open_for_append(const std::string& filename, const char* magic) -> FILE*
+		{
+			FILE* f = ImGui::NotifyFileOpen(filename.c_str(), "ab");
+			if (f && file_size(f) == 0)
+			{
+				ImGuiNotifyJournalHeader header = {};
+				memcpy(header.magic, magic, 4);
+				header.version = NOTIFY_JOURNAL_VERSION;
+				fwrite(&header, sizeof(header), 1, f);
+				fflush(f);
+			}
+			return f;
+		}
+
+		NOTIFY_INLINE auto run() -> void
+		{
+			std::vector<Entry> batch;
+			std::vector<ImGuiNotifyJournalRecord> batch_records;
+			std::unordered_map<std::string, ImU64> offsets;
+			ImU64 str_end = file_size(this->str_file);
+
+			auto write_string = [&](const std::string& text) -> ImU64
+			{
+				if (text.empty())
+					return 0;
+
+				const auto it = offsets.find(text);
+				if (it != offsets.end())
+					return it->second;
+
+				if (offsets.size() >= 65536) // Bounds the memory of long sessions, strings are only written twice
+					offsets.clear();
+
+				const ImU64 offset = str_end;
+				fwrite(text.c_str(), 1, text.size() + 1, this->str_file);
+				str_end += text.size() + 1;
+				offsets.emplace(text, offset);
+				return offset;
+			};
+
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock(this->mutex);
+					this->wake.wait(lock, [this] { return this->stop || !this->pending.empty(); });
+					if (this->pending.empty())
+						return;
+					batch.swap(this->pending);
+				}
+
+				batch_records.clear();
+				for (const Entry& entry : batch)
+					batch_records.push_back({ entry.timestamp, write_string(entry.title), write_string(entry.content), entry.type, entry.dismiss_time });
+
+				// Strings reach the disk before the records pointing to them
+				fflush(this->str_file);
+				fwrite(batch_records.data(), sizeof(ImGuiNotifyJournalRecord), batch_records.size(), this->idx_file);
+				fflush(this->idx_file);
+				batch.clear();
+			}
+		}
+
+	public:
+		/// <summary>
+		/// Map what previous sessions wrote to path.idx/path.str, then start appending to them
+		/// </summary>
+		/// <returns>false if the files can't be opened or were written with another NOTIFY_JOURNAL_VERSION</returns>
+		NOTIFY_INLINE auto open(const char* path) -> bool
+		{
+			close();
+
+			const std::string idx_filename = std::string(path) + ".idx";
+			const std::string str_filename = std::string(path) + ".str";
+
+			this->idx_view = ImGui::NotifyMapFile(idx_filename.c_str(), &this->idx_view_size);
+			this->str_view = ImGui::NotifyMapFile(str_filename.c_str(), &this->str_view_size);
+			if ((this->idx_view && !header_matches(this->idx_view, this->idx_view_size, "NFJI")) || (this->str_view && !header_matches(this->str_view, this->str_view_size, "NFJS")))
+			{
+				close();
+				return false;
+			}
+
+			// A crash while writing can leave a partial record at the end of the index: cut it, records appended from now on must stay aligned
+			// (Windows can't truncate a mapped file, it is mapped again afterwards)
+			if (this->idx_view && (this->idx_view_size - sizeof(ImGuiNotifyJournalHeader)) % sizeof(ImGuiNotifyJournalRecord) != 0)
+			{
+				const size_t records_size = (this->idx_view_size - sizeof(ImGuiNotifyJournalHeader)) / sizeof(ImGuiNotifyJournalRecord) * sizeof(ImGuiNotifyJournalRecord);
+				ImGui::NotifyUnmapFile(this->idx_view, this->idx_view_size);
+				this->idx_view = NULL;
+				this->idx_view_size = 0;
+				if (!ImGui::NotifyTruncateFile(idx_filename.c_str(), sizeof(ImGuiNotifyJournalHeader) + records_size))
+				{
+					close();
+					return false;
+				}
+				this->idx_view = ImGui::NotifyMapFile(idx_filename.c_str(), &this->idx_view_size);
+			}
+
+			if (this->idx_view)
+			{
+				this->records = (const ImGuiNotifyJournalRecord*)((const char*)this->idx_view + sizeof(ImGuiNotifyJournalHeader));
+				this->records_count = (int)((this->idx_view_size - sizeof(ImGuiNotifyJournalHeader)) / sizeof(ImGuiNotifyJournalRecord));
+			}
+			if (this->str_view)
+			{
+				const char* strings = (const char*)this->str_view;
+				this->strings_size = this->str_view_size;
+				while (this->strings_size > sizeof(ImGuiNotifyJournalHeader) && strings[this->strings_size - 1] != 0)
+					this->strings_size--;
+			}
+
+			this->idx_file = open_for_append(idx_filename, "NFJI");
+			this->str_file = open_for_append(str_filename, "NFJS");
+			if (!this->idx_file || !this->str_file)
+			{
+				close();
+				return false;
+			}
+
+			this->stop = false;
+			this->thread = std::thread(&ImGuiNotifyJournal::run, this);
+			return true;
+		}
+
+		/// <summary>
+		/// Write what is still queued, stop the writer and unmap previous sessions
+		/// </summary>
+		NOTIFY_INLINE auto close() -> void
+		{
+			if (this->thread.joinable())
+			{
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->stop = true;
+				}
+				this->wake.notify_one();
+				this->thread.join();
+			}
+
+			if (this->idx_file) fclose(this->idx_file);
+			if (this->str_file) fclose(this->str_file);
+			this->idx_file = this->str_file = NULL;
+
+			ImGui::NotifyUnmapFile(this->idx_view, this->idx_view_size);
+			ImGui::NotifyUnmapFile(this->str_view, this->str_view_size);
+			this->idx_view = this->str_view = NULL;
+			this->idx_view_size = this->str_view_size = this->strings_size = 0;
+			this->records = NULL;
+			this->records_count = 0;
+		}
+
+		/// <summary>
+		/// Queue a toast, never blocks on I/O
+		/// </summary>
+		NOTIFY_INLINE auto push(ImGuiToast& toast) -> void
+		{
+			if (!this->thread.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->pending.push_back({ toast.get_timestamp(), toast.get_type(), toast.get_dismiss_time(), toast.get_default_title() ? toast.get_default_title() : "", toast.get_content() });
+			}
+			this->wake.notify_one();
+		}
+
+		NOTIFY_INLINE auto is_open() -> bool { return this->thread.joinable(); }
+
+		NOTIFY_INLINE auto get_records_count() -> int { return this->records_count; }
+
+		NOTIFY_INLINE auto get_record(int index) -> const ImGuiNotifyJournalRecord& { return this->records[index]; }
+
+		NOTIFY_INLINE auto get_string(ImU64 offset) -> const char* { return (offset >= sizeof(ImGuiNotifyJournalHeader) && offset < this->strings_size) ? (const char*)this->str_view + offset : ""; }
+
+		~ImGuiNotifyJournal() { close(); }
+	};
+
+	NOTIFY_INLINE ImGuiNotifyJournal notify_journal;
+
+	/// <summary>
+	/// Journal every inserted toast to path.idx/path.str, and make previous sessions browsable in ShowNotificationHistory()
+	/// </summary>
+	NOTIFY_INLINE bool OpenNotificationJournal(const char* path)
+	{
+		return notify_journal.open(path);
+	}
+
+	NOTIFY_INLINE void CloseNotificationJournal()
+	{
+		notify_journal.close();
+	}
+#endif
+
+	struct ImGuiNotifyHistoryEntry
+	{
+		uint64_t		timestamp;
+		ImGuiToastType	type;
+		const char*		title;
+		const char*		content;
+	};
+
+	/// <summary>
+	/// A record of the session history (index in notify_history), or of the journal mapped by OpenNotificationJournal()
+	/// </summary>
+	NOTIFY_INLINE ImGuiNotifyHistoryEntry GetNotificationHistoryEntry(bool from_journal, int index)
+	{
+#ifdef NOTIFY_USE_JOURNAL
+		if (from_journal)
+		{
+			const ImGuiNotifyJournalRecord& record = notify_journal.get_record(index);
+			return { record.timestamp, (ImGuiToastType)record.type, notify_journal.get_string(record.title), notify_journal.get_string(record.content) };
+		}
+#else
+		IM_UNUSED(from_journal);
+#endif
+		const ImGuiNotifyHistoryRecord& record = notify_history[index];
+		return { record.timestamp, record.type, GetNotificationHistoryString(record.title), GetNotificationHistoryString(record.content) };
+	}
+
+	NOTIFY_INLINE void ClearNotificationHistory()
+	{
+		notify_history.clear();
+		notify_history_head = 0;
+		notify_history_count = 0;
+		notify_history_strings.clear();
+		notify_history_string_ids.clear();
+		notify_history_free_strings.clear();
+	}
+
+	// Capture files: ImGuiNotifyCaptureHeader, then ImGuiNotifyCaptureEvent each followed by payload_size bytes:
+	// - ImGuiNotifyCaptureEvent_Insert: ImS32 type, dismiss time, priority, ImU32 title length, content length, then both strings (no NUL)
+	// - ImGuiNotifyCaptureEvent_Frame: float viewport width, height (recorded when RenderNotifications() starts)
+	enum ImGuiNotifyCaptureEvent_
+	{
+		ImGuiNotifyCaptureEvent_Insert = 1,
+		ImGuiNotifyCaptureEvent_Frame = 2
+	};
+
+	struct ImGuiNotifyCaptureHeader
+	{
+		char		magic[4];		// "NFCP"
+		ImU32		version;
+	};
+
+	struct ImGuiNotifyCaptureEvent
+	{
+		ImU32		kind;			// ImGuiNotifyCaptureEvent_
+		ImU32		payload_size;
+		ImU64		time;			// ImGuiToast::get_tick_count() when recorded
+	};
+
+	NOTIFY_INLINE FILE* notify_capture_file = NULL;
+
+	/// <summary>
+	/// Record every InsertNotification() call and frame boundary to a file, to replay it with ReplayNotificationCapture()
+	/// </summary>
+	NOTIFY_INLINE bool BeginNotificationCapture(const char* filename)
+	{
+		if (notify_capture_file)
+			fclose(notify_capture_file);
+
+		notify_capture_file = NotifyFileOpen(filename, "wb");
+		if (!notify_capture_file)
+			return false;
+
+		const ImGuiNotifyCaptureHeader header = { { 'N', 'F', 'C', 'P' }, 1 };
+		fwrite(&header, sizeof(header), 1, notify_capture_file);
+		return true;
+	}
+
+	NOTIFY_INLINE void EndNotificationCapture()
+	{
+		if (notify_capture_file)
+			fclose(notify_capture_file);
+		notify_capture_file = NULL;
+	}
+
+	NOTIFY_INLINE void NotifyCaptureEvent(ImU32 kind, const void* payload, size_t payload_size, const void* extra = NULL, size_t extra_size = 0)
+	{
+		if (!notify_capture_file || notify_replaying)
+			return;
+
+		const ImGuiNotifyCaptureEvent event = { kind, (ImU32)(payload_size + extra_size), ImGuiToast::get_tick_count() };
+		fwrite(&event, sizeof(event), 1, notify_capture_file);
+		fwrite(payload, 1, payload_size, notify_capture_file);
+		if (extra_size)
+			fwrite(extra, 1, extra_size, notify_capture_file);
+	}
+
+	/// <summary>
+	/// Remove a toast from the list by its index, it is kept in the history
+	/// </summary>
+	/// <param name="index">index of the toast to remove</param>
+	NOTIFY_INLINE void RemoveNotification(int index)
+	{
+		AddNotificationHistory(notifications[index]);
+
+		// Free the slot, then fix up the slots of the toasts shifted by the erase
+		const int slot = (int)(notifications[index].get_handle() & 0xFFFF) - 1;
+		notify_slots[slot].index = -1;
+		notify_slots[slot].generation++;
+		notify_free_slots.push_back(slot);
+		notify_springs[slot] = {};
+
+		notifications.erase(notifications.begin() + index);
+
+		for (int i = index; i < (int)notifications.size(); i++)
+			notify_slots[(notifications[i].get_handle() & 0xFFFF) - 1].index = i;
+	}
+
+	/// <summary>
+	/// Insert a new toast in the list, ordered by priority: higher priorities are rendered closest to the corner
+	/// When NOTIFY_MAX_TOASTS are alive, the oldest toast of the lowest priority is evicted to make room
+	/// The list is a sorted vector, not a heap: finding the evictee and the position is O(log n),
+	/// but the erase/insert shift and the slot fix-ups are O(n), bounded by NOTIFY_MAX_TOASTS
+	/// </summary>
+	/// <returns>handle to update or dismiss the toast later, it stops resolving once the toast expired. 0 if every alive toast has a higher priority</returns>
+	NOTIFY_INLINE ImGuiToastHandle InsertNotification(const ImGuiToast& toast)
+	{
+		NOTIFY_TRACE("Insert");
+
+		// notifications stays sorted by priority (highest first), then by insertion order.
+		// Each priority is a contiguous run, so both the evictee and the insert position are binary searches.
+		// Shifting the vector and fixing up the slots afterwards stays linear in the number of alive toasts
+		const ImGuiToastPriority priority = toast.get_priority();
+
+		if (notify_capture_file)
+		{
+			ImGuiToast& captured = const_cast<ImGuiToast&>(toast); // Getters aren't const
+			const char* title = captured.get_title();
+			const char* content = captured.get_content();
+			const ImS32 fields[5] = { captured.get_type(), captured.get_dismiss_time(), priority, (ImS32)strlen(title), (ImS32)strlen(content) };
+			std::string strings = std::string(title) + content;
+			NotifyCaptureEvent(ImGuiNotifyCaptureEvent_Insert, fields, sizeof(fields), strings.data(), strings.size());
+		}
+
+		if (notifications.size() >= NOTIFY_MAX_TOASTS)
+		{
+			const ImGuiToastPriority lowest = notifications.back().get_priority();
+			if (priority < lowest)
+			{
+				// Dropped, but still recorded so it can be found in the history
+				ImGuiToast dropped = toast;
+				AddNotificationHistory(dropped);
+				notify_stats.drops_total++;
+				return 0;
+			}
+
+			notify_stats.drops_total++;
+			const auto evictee = std::lower_bound(notifications.begin(), notifications.end(), lowest, [](const ImGuiToast& t, ImGuiToastPriority p) { return t.get_priority() > p; });
+			RemoveNotification((int)(evictee - notifications.begin()));
+		}
+
+		const auto position = std::upper_bound(notifications.begin(), notifications.end(), priority, [](ImGuiToastPriority p, const ImGuiToast& t) { return p > t.get_priority(); });
+		const int index = (int)(position - notifications.begin());
+
+		int slot;
+		if (!notify_free_slots.empty())
+		{
+			slot = notify_free_slots.back();
+			notify_free_slots.pop_back();
+		}
+		else
+		{
+			IM_ASSERT(notify_slots.size() < 0xFFFF && "Too many toasts alive!");
+			slot = (int)notify_slots.size();
+			notify_slots.push_back({});
+			notify_springs.push_back({});
+		}
+
+		const ImGuiToastHandle handle = ((ImGuiToastHandle)notify_slots[slot].generation << 16) | (ImGuiToastHandle)(slot + 1);
+		notify_slots[slot].index = index;
+
+		notifications.insert(position, toast);
+		notifications[index].set_handle(handle);
+		notify_stats.inserts_total++;
+
+		// Fix up the slots of the toasts shifted by the insertion
+		for (int i = index + 1; i < (int)notifications.size(); i++)
+			notify_slots[(notifications[i].get_handle() & 0xFFFF) - 1].index = i;
+
+#ifdef NOTIFY_USE_DYNAMIC_ICONS
+		RequestNotificationIcons(notifications[index].get_title());
+		RequestNotificationIcons(notifications[index].get_content());
+#endif
+
+#ifdef NOTIFY_USE_JOURNAL
+		if (!notify_replaying)
+			notify_journal.push(notifications[index]);
+#endif
+
+		return handle;
+	}
+
+	/// <summary>
+	/// Resolve a handle returned by InsertNotification(), in O(1)
+	/// </summary>
+	/// <returns>the toast, or NULL if it expired or was removed (the pointer is only valid until the next insertion or removal)</returns>
+	NOTIFY_INLINE ImGuiToast* GetNotification(ImGuiToastHandle handle)
+	{
+		const int slot = (int)(handle & 0xFFFF) - 1;
+		if (slot < 0 || slot >= (int)notify_slots.size())
+			return NULL;
+
+		const ImGuiToastSlot& entry = notify_slots[slot];
+		if (entry.index < 0 || entry.generation != (ImU16)(handle >> 16))
+			return NULL;
+
+		return &notifications[entry.index];
+	}
+
+	/// <summary>
+	/// Replace the content of a toast in place (e.g "Uploading 42%"), the toast is kept alive for another dismiss time
+	/// </summary>
+	/// <returns>false if the toast expired</returns>
+	NOTIFY_INLINE bool UpdateNotification(ImGuiToastHandle handle, const char* format, ...)
+	{
+		ImGuiToast* toast = GetNotification(handle);
+		if (!toast)
+			return false;
+
+		va_list args;
+		va_start(args, format);
+		toast->set_content(format, args);
+		va_end(args);
+
+		toast->keep_alive();
+
+#ifdef NOTIFY_USE_DYNAMIC_ICONS
+		RequestNotificationIcons(toast->get_content());
+#endif
+		return true;
+	}
+
+	/// <summary>
+	/// Start fading out a toast now, instead of waiting for its dismiss time
+	/// </summary>
+	/// <returns>false if the toast already expired</returns>
+	NOTIFY_INLINE bool DismissNotification(ImGuiToastHandle handle)
+	{
+		ImGuiToast* toast = GetNotification(handle);
+		if (!toast)
+			return false;
+
+		toast->dismiss();
+		return true;
+	}
+
+#ifdef NOTIFY_USE_SHARED_MEMORY
+	NOTIFY_INLINE ImGuiNotifyShmRing* notify_shm_ring = NULL;
+	NOTIFY_INLINE std::string notify_shm_name;
+
+	/// <summary>
+	/// Create the ring other processes post to with ImGuiNotifyShm_Open() + ImGuiNotifyShm_Post(), it is drained by RenderNotifications()
+	/// </summary>
+	/// <param name="name">"/name" on POSIX (see shm_open), "Local\\name" or "Global\\name" on Windows</param>
+	NOTIFY_INLINE bool OpenNotificationSharedMemory(const char* name)
+	{
+		IM_ASSERT(!notify_shm_ring && "Shared memory ring already opened!");
+		notify_shm_ring = ImGuiNotifyShm_Create(name);
+		if (notify_shm_ring)
+			notify_shm_name = name;
+		return notify_shm_ring != NULL;
+	}
+
+	NOTIFY_INLINE void CloseNotificationSharedMemory()
+	{
+		ImGuiNotifyShm_Close(notify_shm_ring);
+		ImGuiNotifyShm_Unlink(notify_shm_name.c_str());
+		notify_shm_ring = NULL;
+		notify_shm_name.clear();
+	}
+
+	/// <summary>
+	/// Insert every toast posted since the last call, records are read in place and released right away
+	/// </summary>
+	NOTIFY_INLINE void DrainNotificationSharedMemory()
+	{
+		if (!notify_shm_ring)
+			return;
+
+		NOTIFY_TRACE("Drain shared memory");
+
+		// Bounded, so producers posting faster than we drain can't stall the frame
+		for (int n = 0; n < IMGUI_NOTIFY_SHM_SLOTS; n++)
+		{
+			const ImGuiNotifyShmRecord* record = ImGuiNotifyShm_Front(notify_shm_ring);
+			if (!record)
+				break;
+
+			const ImGuiToastType type = (record->type >= 0 && record->type < ImGuiToastType_COUNT) ? record->type : ImGuiToastType_None;
+			ImGuiToast toast(type, record->dismiss_time > 0 ? record->dismiss_time : NOTIFY_DEFAULT_DISMISS);
+			toast.set_title("%.*s", IMGUI_NOTIFY_SHM_TITLE_SIZE - 1, record->title);
+			toast.set_content("%.*s", IMGUI_NOTIFY_SHM_CONTENT_SIZE - 1, record->content);
+			ImGuiNotifyShm_PopFront(notify_shm_ring);
+
+			InsertNotification(toast);
+		}
+	}
+#endif
+
+	struct ImGuiNotifyLogCategory
+	{
+		std::string			name;
+		ImGuiNotifyLogLevel	min_level = NOTIFY_LOG_MIN_LEVEL;
+		int					sample_every = 1;		// Keep 1 message out of N
+		unsigned int		sample_counter = 0;
+
+		// Messages of the current frame, summarized in one toast by DrainNotificationLog()
+		int					batch_count = 0;
+		ImGuiNotifyLogLevel	batch_level = ImGuiNotifyLogLevel_Trace;
+		bool				batch_claimed = false;	// The first message of the frame is being formatted, the next ones are only counted
+		bool				batch_ready = false;	// batch_message was set, until then the drain leaves the batch alone
+		std::string			batch_message;
+	};
+
+	NOTIFY_INLINE std::mutex notify_log_mutex;
+	NOTIFY_INLINE std::vector<ImGuiNotifyLogCategory> notify_log_categories;	// Few categories, searched linearly
+	NOTIFY_INLINE ImGuiToastType notify_log_level_types[ImGuiNotifyLogLevel_COUNT] = { ImGuiToastType_Info, ImGuiToastType_Info, ImGuiToastType_Info, ImGuiToastType_Warning, ImGuiToastType_Error, ImGuiToastType_Error };
+
+	NOTIFY_INLINE ImGuiNotifyLogCategory& NotifyFindLogCategory(const char* category)
+	{
+		if (!category)
+			category = "";
+
+		for (ImGuiNotifyLogCategory& entry : notify_log_categories)
+			if (entry.name == category)
+				return entry;
+
+		notify_log_categories.push_back({});
+		notify_log_categories.back().name = category;
+		return notify_log_categories.back();
+	}
+
+	/// <summary>
+	/// Messages of a category below this level are dropped before being formatted (default: NOTIFY_LOG_MIN_LEVEL)
+	/// </summary>
+	NOTIFY_INLINE void SetNotificationLogLevel(const char* category, ImGuiNotifyLogLevel min_level)
+	{
+		std::lock_guard<std::mutex> lock(notify_log_mutex);
+		NotifyFindLogCategory(category).min_level = min_level;
+	}
+
+	/// <summary>
+	/// Only keep 1 message out of keep_one_every for a high-rate category, the others are dropped before being formatted
+	/// </summary>
+	NOTIFY_INLINE void SetNotificationLogSampling(const char* category, int keep_one_every)
+	{
+		std::lock_guard<std::mutex> lock(notify_log_mutex);
+		NotifyFindLogCategory(category).sample_every = keep_one_every > 1 ? keep_one_every : 1;
+	}
+
+	/// <summary>
+	/// Toast type used for a log level (e.g to show ImGuiNotifyLogLevel_Info messages as ImGuiToastType_Success)
+	/// </summary>
+	NOTIFY_INLINE void SetNotificationLogLevelType(ImGuiNotifyLogLevel level, ImGuiToastType type)
+	{
+		IM_ASSERT(level >= 0 && level < ImGuiNotifyLogLevel_COUNT && type < ImGuiToastType_COUNT);
+		std::lock_guard<std::mutex> lock(notify_log_mutex);
+		notify_log_level_types[level] = type;
+	}
+
+	/// <summary>
+	/// Count a message against its category (level filter, sampling, per-frame batch), from any thread
+	/// </summary>
+	/// <returns>true if the caller must format it and pass it to LogNotificationMessage(), false if it was dropped or only counted</returns>
+	NOTIFY_INLINE bool ShouldLogNotification(ImGuiNotifyLogLevel level, const char* category)
+	{
+		std::lock_guard<std::mutex> lock(notify_log_mutex);
+		ImGuiNotifyLogCategory& entry = NotifyFindLogCategory(category);
+
+		if (level < entry.min_level)
+			return false;
+		if (entry.sample_every > 1 && (entry.sample_counter++ % (unsigned int)entry.sample_every) != 0)
+			return false;
+
+		entry.batch_count++;
+		if (level > entry.batch_level)
+			entry.batch_level = level;
+
+		if (entry.batch_claimed)
+			return false;
+
+		entry.batch_claimed = true;
+		return true;
+	}
+
+	/// <summary>
+	/// Set the text of the batch claimed by ShouldLogNotification()
+	/// </summary>
+	NOTIFY_INLINE void LogNotificationMessage(const char* category, const char* message)
+	{
+		std::lock_guard<std::mutex> lock(notify_log_mutex);
+		ImGuiNotifyLogCategory& entry = NotifyFindLogCategory(category);
+		entry.batch_message = message ? message : "";
+		entry.batch_ready = true;
+	}
+
+	/// <summary>
+	/// Log sink callback: pass it (or call it from) your logging library, messages are already formatted
+	/// </summary>
+	NOTIFY_INLINE void LogNotification(ImGuiNotifyLogLevel level, const char* category, const char* message)
+	{
+		if (ShouldLogNotification(level, category))
+			LogNotificationMessage(category, message);
+	}
+
+	NOTIFY_INLINE void NotifyLogFormatV(const char* category, const char* format, va_list args)
+	{
+		char message[NOTIFY_MAX_MSG_LENGTH];
+		vsnprintf(message, sizeof(message), format, args);
+		LogNotificationMessage(category, message);
+	}
+
+	/// <summary>
+	/// Format the message of a batch claimed by ShouldLogNotification(), used by NOTIFY_LOG()
+	/// </summary>
+	NOTIFY_INLINE void NotifyLogFormat(const char* category, const char* format, ...)
+	{
+		va_list args;
+		va_start(args, format);
+		NotifyLogFormatV(category, format, args);
+		va_end(args);
+	}
+
+	/// <summary>
+	/// Format a log message, only if it isn't dropped. Prefer NOTIFY_LOG(), which doesn't even evaluate the arguments then
+	/// </summary>
+	NOTIFY_INLINE void LogNotificationf(ImGuiNotifyLogLevel level, const char* category, const char* format, ...)
+	{
+		if (!ShouldLogNotification(level, category))
+			return;
+
+		va_list args;
+		va_start(args, format);
+		NotifyLogFormatV(category, format, args);
+		va_end(args);
+	}
+
+	/// <summary>
+	/// Turn the messages logged since the last call into toasts: one per category, summarizing how many were batched (done by RenderNotifications)
+	/// </summary>
+	NOTIFY_INLINE void DrainNotificationLog()
+	{
+		NOTIFY_TRACE("Drain log");
+
+		std::vector<ImGuiToast> toasts;
+		{
+			std::lock_guard<std::mutex> lock(notify_log_mutex);
+			for (ImGuiNotifyLogCategory& entry : notify_log_categories)
+			{
+				// A batch claimed by another thread that is still formatting its message is drained next time
+				if (entry.batch_count == 0 || (entry.batch_claimed && !entry.batch_ready))
+					continue;
+
+				ImGuiToast toast(notify_log_level_types[entry.batch_level]);
+				if (!entry.name.empty())
+					toast.set_title("%s", entry.name.c_str());
+				if (entry.batch_count == 1)
+					toast.set_content("%s", entry.batch_message.c_str());
+				else
+					toast.set_content("%s\n(+%d more)", entry.batch_message.c_str(), entry.batch_count - 1);
+				toasts.push_back(toast);
+
+				entry.batch_count = 0;
+				entry.batch_level = ImGuiNotifyLogLevel_Trace;
+				entry.batch_claimed = false;
+				entry.batch_ready = false;
+				entry.batch_message.clear();
+			}
+		}
+
+		for (const ImGuiToast& toast : toasts)
+			InsertNotification(toast);
+	}
+
+	NOTIFY_INLINE ImU64 notify_fingerprint = 0;
+
+	/// <summary>
+	/// Cheap hash of what a toast window emitted: counts, commands (clip rects, textures) and a sample of its vertices.
+	/// Every vertex moves with the window and changes color with the fade, so a few of them are enough to notice
+	/// </summary>
+	NOTIFY_INLINE ImU64 NotifyHashToastDrawList(const ImDrawList* draw_list, ImU64 seed)
+	{
+		const int counts[3] = { draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->CmdBuffer.Size };
+		ImU64 hash = NotifyHash(counts, sizeof(counts), seed);
+		for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+		{
+			hash = NotifyHash(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+			hash = NotifyHash(&cmd.TextureId, sizeof(cmd.TextureId), hash);
+			hash = NotifyHash(&cmd.ElemCount, sizeof(cmd.ElemCount), hash);
+		}
+
+		// 16 evenly spaced vertices, and the last 4 (the progress bar, when there is one)
+		const int vtx_count = draw_list->VtxBuffer.Size;
+		const int step = vtx_count > 16 ? vtx_count / 16 : 1;
+		for (int n = 0; n < vtx_count; n += step)
+			hash = NotifyHash(&draw_list->VtxBuffer[n], sizeof(ImDrawVert), hash);
+		for (int n = vtx_count > 4 ? vtx_count - 4 : 0; n < vtx_count; n++)
+			hash = NotifyHash(&draw_list->VtxBuffer[n], sizeof(ImDrawVert), hash);
+		return hash;
+	}
+
+	/// <summary>
+	/// Fingerprint of the toasts drawn by the last RenderNotifications(). When it didn't change, neither did the toast geometry,
+	/// e.g to skip uploading and presenting while every toast waits (combine it with the state of the rest of your UI)
+	/// </summary>
+	NOTIFY_INLINE ImU64 GetNotificationsFingerprint()
+	{
+		return notify_fingerprint;
+	}
+
+	/// <summary>
+	/// Messages received but not turned into toasts yet
+	/// </summary>
+	NOTIFY_INLINE int NotifyCountPending()
+	{
+		int pending = 0;
+#ifdef NOTIFY_USE_SHARED_MEMORY
+		if (notify_shm_ring)
+			pending += (int)(ImGuiNotifyShm_LoadAcquire(&notify_shm_ring->enqueue_pos) - notify_shm_ring->dequeue_pos);
+#endif
+		std::lock_guard<std::mutex> lock(notify_log_mutex);
+		for (const ImGuiNotifyLogCategory& entry : notify_log_categories)
+			pending += entry.batch_count;
+		return pending;
+	}
+
+	NOTIFY_INLINE void UpdateNotificationStats(int windows, int visible, int vertices, int indices, std::chrono::steady_clock::time_point render_start, std::chrono::steady_clock::time_point drain_end)
+	{
+		ImGuiNotifyStats& stats = notify_stats;
+		stats.live = (int)notifications.size();
+		stats.visible = visible;
+		stats.pending = NotifyCountPending();
+		stats.vertices = vertices;
+		stats.indices = indices;
+		stats.windows = windows;
+
+		stats.text_bytes_used = 0;
+		for (auto& toast : notifications)
+			stats.text_bytes_used += strlen(toast.get_title()) + strlen(toast.get_content());
+		stats.text_bytes_reserved = notifications.capacity() * NOTIFY_MAX_MSG_LENGTH * 2;
+
+		const auto now = ImGuiToast::get_tick_count();
+		if (notify_stats_window_start == 0 || now < notify_stats_window_start)
+		{
+			notify_stats_window_start = now;
+			notify_stats_window_inserts = stats.inserts_total;
+			notify_stats_window_drops = stats.drops_total;
+		}
+		else if (now - notify_stats_window_start >= 1000)
+		{
+			const float seconds = (now - notify_stats_window_start) / 1000.f;
+			stats.inserts_per_second = (stats.inserts_total - notify_stats_window_inserts) / seconds;
+			stats.drops_per_second = (stats.drops_total - notify_stats_window_drops) / seconds;
+			notify_stats_window_start = now;
+			notify_stats_window_inserts = stats.inserts_total;
+			notify_stats_window_drops = stats.drops_total;
+		}
+
+		const auto render_end = std::chrono::steady_clock::now();
+		stats.drain_ms = std::chrono::duration<double, std::milli>(drain_end - render_start).count();
+		stats.render_ms = std::chrono::duration<double, std::milli>(render_end - render_start).count();
+	}
+
+	/// <summary>
+	/// Scale the metrics of the toasts, text sizes follow through the font scale of the toast windows
+	/// </summary>
+	NOTIFY_INLINE void NotifyUpdateMetrics()
+	{
+		const ImGuiIO& io = GetIO();
+		const ImGuiStyle& style = GetStyle();
+		const ImFont* font = GetFont();
+		ImGuiNotifyMetrics& m = notify_metrics;
+
+		// io.FontGlobalScale already scales the text (and only the text), an explicit scale replaces it for toasts
+		m.scale = notify_scale > 0.f ? notify_scale : io.FontGlobalScale;
+		m.font_scale = m.scale / io.FontGlobalScale;
+		m.font_size = (std::max)(1.0f, io.FontGlobalScale * font->FontSize * font->Scale) * m.font_scale;
+
+		m.padding = ImVec2((float)(int)(NOTIFY_PADDING_X * m.scale), (float)(int)(NOTIFY_PADDING_Y * m.scale));
+		m.padding_message_y = (float)(int)(NOTIFY_PADDING_MESSAGE_Y * m.scale);
+		m.separator_offset = (float)(int)(5.f * m.scale);
+		m.progress_bar_height = (std::max)(1.f, (float)(int)(NOTIFY_PROGRESS_BAR_HEIGHT * m.scale));
+
+		// Style sizes only follow the explicit scale, like ImGuiStyle::ScaleAllSizes() would (the rest of the UI is styled for io.FontGlobalScale)
+		const auto scale_style = [&](float size) { return m.font_scale == 1.f ? size : (float)(int)(size * m.font_scale); };
+		m.window_padding = ImVec2(scale_style(style.WindowPadding.x), scale_style(style.WindowPadding.y));
+		m.item_spacing = ImVec2(scale_style(style.ItemSpacing.x), scale_style(style.ItemSpacing.y));
+		m.window_rounding = scale_style(style.WindowRounding);
+		m.frame_padding = ImVec2(scale_style(style.FramePadding.x), scale_style(style.FramePadding.y));
+		m.frame_rounding = scale_style(style.FrameRounding);
+	}
+
+	/// <summary>
+	/// Window size and action buttons of a toast, computed the way Dear ImGui lays out what RenderNotifications() submits (ItemSize/SameLine rules, AlwaysAutoResize),
+	/// so toasts can be stacked, culled and hit tested without submitting anything
+	/// </summary>
+	NOTIFY_INLINE ImGuiToastLayout NotifyCalcToastLayout(ImGuiToast& toast, float wrap_pos_x)
+	{
+		ImGuiToastLayout layout;
+		const ImGuiStyle& style = GetStyle();
+		const ImGuiNotifyMetrics& m = notify_metrics;
+		const auto icon = toast.get_icon();
+		const auto title = !NOTIFY_NULL_OR_EMPTY(toast.get_title()) ? toast.get_title() : toast.get_default_title();
+		const auto content = toast.get_content();
+
+		// Window-local cursor, as ImGuiWindow::DC
+		ImVec2 cursor = m.window_padding, prev_line = cursor, max_pos = cursor;
+		float line_height = 0.f, prev_line_height = 0.f;
+		const auto item = [&](const ImVec2& size)
+		{
+			const float height = (std::max)(line_height, size.y);
+			prev_line = ImVec2(cursor.x + size.x, cursor.y);
+			cursor = ImVec2(m.window_padding.x, (float)(int)(cursor.y + height + m.item_spacing.y));
+			max_pos = ImVec2((std::max)(max_pos.x, prev_line.x), (std::max)(max_pos.y, cursor.y - m.item_spacing.y));
+			prev_line_height = height;
+			line_height = 0.f;
+		};
+		const auto text = [&](const char* str) { item(CalcTextSize(str, NULL, false, (std::max)(wrap_pos_x - cursor.x, 1.0f), m.font_size)); };
+		const auto same_line = [&]()
+		{
+			cursor = ImVec2(prev_line.x + m.item_spacing.x, prev_line.y);
+			line_height = prev_line_height;
+		};
+
+		bool was_title_rendered = false;
+		if (!NOTIFY_NULL_OR_EMPTY(icon))
+		{
+			text(icon);
+			was_title_rendered = true;
+		}
+		if (!NOTIFY_NULL_OR_EMPTY(title))
+		{
+			if (!NOTIFY_NULL_OR_EMPTY(icon))
+				same_line();
+			text(title);
+			was_title_rendered = true;
+		}
+		if (!NOTIFY_NULL_OR_EMPTY(content))
+		{
+			if (was_title_rendered)
+			{
+				cursor.y += m.separator_offset;
+				max_pos.y = (std::max)(max_pos.y, cursor.y);
+#ifdef NOTIFY_USE_SEPARATOR
+				item(ImVec2(0.f, 0.f));
+#endif
+			}
+			text(content);
+		}
+
+		// Image or custom drawing
+		if (toast.get_media_size().x > 0.f && toast.get_media_size().y > 0.f)
+		{
+			layout.media_pos = cursor;
+			layout.media_size = ImVec2((float)(int)(toast.get_media_size().x * m.scale), (float)(int)(toast.get_media_size().y * m.scale));
+			item(layout.media_size);
+		}
+
+		// Action buttons on one row
+		for (int n = 0; n < toast.get_actions_count(); n++)
+		{
+			if (n > 0)
+				same_line();
+			const ImVec2 label_size = CalcTextSize(toast.get_action(n).label, NULL, false, -1.0f, m.font_size);
+			layout.actions_pos[n] = cursor;
+			layout.actions_size[n] = ImVec2(label_size.x + m.frame_padding.x * 2.f, label_size.y + m.frame_padding.y * 2.f);
+			item(layout.actions_size[n]);
+		}
+
+		const ImVec2 content_size((float)(int)(max_pos.x - m.window_padding.x), (float)(int)(max_pos.y - m.window_padding.y));
+		const ImVec2 viewport_size = NotifyGetViewport()->Size;
+		const ImVec2 max_size((std::max)(style.WindowMinSize.x, viewport_size.x - style.DisplaySafeAreaPadding.x * 2.f), (std::max)(style.WindowMinSize.y, viewport_size.y - style.DisplaySafeAreaPadding.y * 2.f));
+		layout.size = ImVec2((std::min)((std::max)(content_size.x + m.window_padding.x * 2.f, style.WindowMinSize.x), max_size.x), (std::min)((std::max)(content_size.y + m.window_padding.y * 2.f, style.WindowMinSize.y), max_size.y));
+		return layout;
+	}
+
+	/// <summary>
+	/// Submit a content parsed by ImGuiToast::set_markup(), breaking lines where TextUnformatted() would under the same wrap position (same walk as ImFont::RenderText),
+	/// so NotifyCalcToastLayout() measures it as plain text and cached layouts stay valid
+	/// </summary>
+	NOTIFY_INLINE void NotifyRenderMarkup(ImGuiToast& toast, float wrap_pos_x)
+	{
+		const char* text = toast.get_content();
+		const char* text_end = text + strlen(text);
+		const ImVec2 pos = GetCursorScreenPos();
+		const float wrap_width = (std::max)(GetWindowPos().x + wrap_pos_x - pos.x, 1.0f);
+		ImFont* font = GetFont();
+		const float font_size = GetFontSize();
+		ImDrawList* draw_list = GetWindowDrawList();
+
+		float x = pos.x, y = pos.y;
+		const char* run = text;
+		int span = 0;
+		const auto draw_run = [&](const char* end)
+		{
+			if (run < end)
+			{
+				const ImGuiToastSpan& style = toast.get_span(span);
+				const ImU32 color = style.color ? GetColorU32(style.color) : GetColorU32(ImGuiCol_Text);
+				draw_list->AddText(font, font_size, ImVec2(x, y), color, run, end);
+				if (style.emphasis)
+					draw_list->AddText(font, font_size, ImVec2(x + 1.f, y), color, run, end);
+				x += font->CalcTextSizeA(font_size, FLT_MAX, 0.f, run, end).x;
+			}
+			run = end;
+		};
+
+		// A wrapped line ends where CalcWordWrapPositionA() says, '\n' starts a new line without computing another end
+		const char* line_end = NULL;
+		const char* s = text;
+		while (s < text_end)
+		{
+			if (!line_end)
+			{
+				line_end = font->CalcWordWrapPositionA(font_size / font->FontSize, s, text_end, wrap_width);
+				if (line_end == s)
+					line_end++;
+			}
+			if (s >= line_end)
+			{
+				draw_run(s);
+				x = pos.x;
+				y += font_size;
+				line_end = NULL;
+
+				// Wrapping skips upcoming blanks, and one line feed
+				while (s < text_end && (*s == ' ' || *s == '\t'))
+					s++;
+				if (s < text_end && *s == '\n')
+					s++;
+				run = s;
+				continue;
+			}
+			if (s - text >= toast.get_span(span).end)
+			{
+				draw_run(s);
+				span++;
+				continue;
+			}
+			if (*s == '\n')
+			{
+				draw_run(s);
+				x = pos.x;
+				y += font_size;
+				run = ++s;
+				continue;
+			}
+
+			// Spans end on markup, never inside a UTF-8 sequence
+			const unsigned char c = (unsigned char)*s;
+			s = (std::min)(s + (c < 0x80 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : 4), text_end);
+		}
+		draw_run(s);
+
+		Dummy(CalcTextSize(text, text_end, false, wrap_width));
+	}
+
+	/// <summary>
+	/// Everything NotifyCalcToastLayout() depends on besides the toast itself
+	/// </summary>
+	NOTIFY_INLINE ImU64 NotifyCalcLayoutKey(float wrap_pos_x)
+	{
+		struct
+		{
+			ImFont*	font;
+			float	font_size;
+			float	scale;
+			float	wrap_pos_x;
+			float	separator_offset;
+			ImVec2	padding, spacing, frame_padding, min_size, safe_area, viewport;
+		} key = {}; // No padding between the members, the key is hashed as bytes
+
+		const ImGuiStyle& style = GetStyle();
+		key.font = GetFont();
+		key.font_size = notify_metrics.font_size;
+		key.scale = notify_metrics.scale;
+		key.wrap_pos_x = wrap_pos_x;
+		key.separator_offset = notify_metrics.separator_offset;
+		key.padding = notify_metrics.window_padding;
+		key.spacing = notify_metrics.item_spacing;
+		key.frame_padding = notify_metrics.frame_padding;
+		key.min_size = style.WindowMinSize;
+		key.safe_area = style.DisplaySafeAreaPadding;
+		key.viewport = NotifyGetViewport()->Size;
+		const ImU64 hash = NotifyHash(&key, sizeof(key));
+		return hash ? hash : 1;
+	}
+
+	/// <summary>
+	/// A clicked action button, its callback is run by an executor
+	/// </summary>
+	struct ImGuiNotifyActionJob
+	{
+		ImGuiToastActionFn	fn;
+		ImGuiToastHandle	toast;
+		int					action;
+		unsigned char		user_data[NOTIFY_ACTION_DATA_SIZE];
+
+		NOTIFY_INLINE auto run() -> void { this->fn(this->toast, this->action, this->user_data); }
+	};
+
+	typedef void (*ImGuiNotifyExecutorFn)(const ImGuiNotifyActionJob& job, void* user_data);
+
+	/// <summary>
+	/// Built-in executor: one worker thread, started on the first action, runs the callbacks in click order
+	/// </summary>
+	class ImGuiNotifyExecutor
+	{
+	private:
+		std::thread							thread;
+		std::mutex							mutex;
+		std::condition_variable				wake;
+		std::vector<ImGuiNotifyActionJob>	pending;	// Queued by the UI thread, swapped out by the worker
+		bool								stop = false;
+
+		NOTIFY_INLINE auto run() -> void
+		{
+			std::vector<ImGuiNotifyActionJob> batch;
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock(this->mutex);
+					this->wake.wait(lock, [this] { return this->stop || !this->pending.empty(); });
+					if (this->pending.empty())
+						return;
+					batch.swap(this->pending);
+				}
+
+				for (ImGuiNotifyActionJob& job : batch)
+					job.run();
+				batch.clear();
+			}
+		}
+
+	public:
+		/// <summary>
+		/// Queue a callback, never waits for the ones running
+		/// </summary>
+		NOTIFY_INLINE auto push(const ImGuiNotifyActionJob& job) -> void
+		{
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->pending.push_back(job);
+				if (!this->thread.joinable())
+				{
+					this->stop = false;
+					this->thread = std::thread(&ImGuiNotifyExecutor::run, this);
+				}
+			}
+			this->wake.notify_one();
+		}
+
+		/// <summary>
+		/// Run what is still queued, then stop the worker
+		/// </summary>
+		NOTIFY_INLINE auto close() -> void
+		{
+			if (!this->thread.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->stop = true;
+			}
+			this->wake.notify_one();
+			this->thread.join();
+		}
+
+		~ImGuiNotifyExecutor() { close(); }
+	};
+
+	NOTIFY_INLINE ImGuiNotifyExecutor notify_executor;
+	NOTIFY_INLINE ImGuiNotifyExecutorFn notify_executor_fn = NULL;	// Set with SetNotificationExecutor(), NULL for notify_executor
+	NOTIFY_INLINE void* notify_executor_user_data = NULL;
+
+	/// <summary>
+	/// Run action callbacks with your own executor (e.g a job system) instead of the built-in worker thread
+	/// fn is called on the UI thread for every clicked action: copy the job, and call job.run() later from any thread
+	/// </summary>
+	/// <param name="fn">NULL for the built-in worker thread</param>
+	NOTIFY_INLINE void SetNotificationExecutor(ImGuiNotifyExecutorFn fn, void* user_data = NULL)
+	{
+		notify_executor_fn = fn;
+		notify_executor_user_data = user_data;
+	}
+
+	NOTIFY_INLINE void NotifyDispatchAction(ImGuiToast& toast, int action)
+	{
+		ImGuiNotifyActionJob job;
+		job.fn = toast.get_action(action).fn;
+		job.toast = toast.get_handle();
+		job.action = action;
+		memcpy(job.user_data, toast.get_action(action).user_data, sizeof(job.user_data));
+
+		if (notify_executor_fn)
+			notify_executor_fn(job, notify_executor_user_data);
+		else
+			notify_executor.push(job);
+	}
+
+	struct ImGuiNotifyHitRect
+	{
+		ImVec2				min;
+		ImGuiToastLayout	layout;		// Window size and action buttons
+		ImGuiToastHandle	handle;
+		bool				hovered;	// IsWindowHovered() of the toast window: not covered by another window, popup or active item
+	};
+
+	NOTIFY_INLINE std::vector<ImGuiNotifyHitRect> notify_hit_rects;	// Toasts submitted by the last RenderNotifications()
+	NOTIFY_INLINE ImGuiToastHandle notify_hovered = 0;					// Toast under the mouse, see GetHoveredNotification()
+	NOTIFY_INLINE int notify_hovered_action = -1;						// Action button of notify_hovered under the mouse, -1 if none
+	NOTIFY_INLINE ImGuiToastHandle notify_paused = 0;					// Toast paused by the hover, resumed once the mouse leaves it
+
+	/// <summary>
+	/// Toast under the mouse in the last RenderNotifications(), 0 if none
+	/// </summary>
+	NOTIFY_INLINE ImGuiToastHandle GetHoveredNotification()
+	{
+		return notify_hovered;
+	}
+
+	/// <summary>
+	/// Test the mouse against the rectangles of the toasts drawn this frame, in one pass. Only the toast window Dear ImGui routes the mouse to
+	/// can be hit: toast windows take mouse inputs, so the click they take never reaches the widgets underneath
+	/// </summary>
+	NOTIFY_INLINE void NotifyHitTest()
+	{
+		const ImGuiIO& io = GetIO();
+		const auto contains = [&](const ImVec2& min, const ImVec2& size) { return io.MousePos.x >= min.x && io.MousePos.y >= min.y && io.MousePos.x < min.x + size.x && io.MousePos.y < min.y + size.y; };
+		notify_hovered = 0;
+		notify_hovered_action = -1;
+		if (IsMousePosValid(&io.MousePos))
+		{
+			for (const ImGuiNotifyHitRect& rect : notify_hit_rects)
+			{
+				if (!rect.hovered || !contains(rect.min, rect.layout.size))
+					continue;
+
+				notify_hovered = rect.handle;
+				for (int n = 0; n < NOTIFY_MAX_ACTIONS; n++)
+					if (contains(ImVec2(rect.min.x + rect.layout.actions_pos[n].x, rect.min.y + rect.layout.actions_pos[n].y), rect.layout.actions_size[n]))
+						notify_hovered_action = n;
+				break;
+			}
+		}
+
+		if (notify_paused && notify_paused != notify_hovered)
+		{
+			if (ImGuiToast* toast = GetNotification(notify_paused))
+				toast->resume();
+			notify_paused = 0;
+		}
+
+		ImGuiToast* toast = notify_hovered ? GetNotification(notify_hovered) : NULL;
+		if (!toast)
+			return;
+
+		if (IsMouseClicked(ImGuiMouseButton_Left))
+		{
+			// Only queued here, a slow callback never stalls the frame
+			if (notify_hovered_action >= 0 && notify_hovered_action < toast->get_actions_count())
+				NotifyDispatchAction(*toast, notify_hovered_action);
+			toast->dismiss();
+			notify_paused = 0;
+		}
+		else if (toast->get_phase() == ImGuiToastPhase_Wait)
+		{
+			// Fading in toasts become fully visible first, fading out ones (dismissed or not) are left to expire
+			toast->pause();
+			notify_paused = notify_hovered;
+		}
+	}
+
+	/// <summary>
+	/// Move every toast toward its place in the stack with a critically damped spring, in one pass over the springs
+	/// The spring is solved exactly over dt, so the motion doesn't depend on the frame rate
+	/// </summary>
+	NOTIFY_INLINE void NotifyUpdateSprings(float dt)
+	{
+		if (!notify_springs_moving)
+			return;
+
+		NOTIFY_TRACE("Springs");
+		const float omega = 6000.f / (std::max)(NOTIFY_REFLOW_TIME, 1); // ~98% of the distance covered after NOTIFY_REFLOW_TIME
+		const float decay = expf(-omega * dt);
+
+		bool moving = false;
+		for (ImGuiNotifySpring& spring : notify_springs)
+		{
+			const float x = spring.offset - spring.target;
+			if (x == 0.f && spring.velocity == 0.f)
+				continue;
+
+			const float impulse = (spring.velocity + omega * x) * dt;
+			const float next_x = (x + impulse) * decay;
+			spring.velocity = (spring.velocity - omega * impulse) * decay;
+			if (fabsf(next_x) < 0.1f && fabsf(spring.velocity) < 1.f)
+			{
+				spring.offset = spring.target;
+				spring.velocity = 0.f;
+				continue;
+			}
+			spring.offset = spring.target + next_x;
+			moving = true;
+		}
+		notify_springs_moving = moving;
+	}
+
+	/// <summary>
+	/// Render toasts, call at the end of your rendering!
+	/// </summary>
+	NOTIFY_INLINE void RenderNotifications()
+	{
+		NOTIFY_TRACE("RenderNotifications");
+
+		const auto render_start = std::chrono::steady_clock::now();
+		const auto vp_size = GetMainViewport()->Size;
+
+		if (notify_capture_file)
+			NotifyCaptureEvent(ImGuiNotifyCaptureEvent_Frame, &vp_size, sizeof(vp_size));
+
+#ifdef NOTIFY_USE_SHARED_MEMORY
+		if (!notify_replaying)
+			DrainNotificationSharedMemory();
+#endif
+		if (!notify_replaying)
+			DrainNotificationLog();
+
+		const auto drain_end = std::chrono::steady_clock::now();
+
+		NotifyUpdateMetrics();
+		const ImGuiNotifyMetrics& metrics = notify_metrics;
+
+		// Toasts are placed in the work area of the target viewport, one stack per position
+		const ImGuiViewport* viewport = NotifyGetViewport();
+		const ImVec2 work_min(viewport->WorkPos.x + metrics.padding.x, viewport->WorkPos.y + metrics.padding.y);
+		const ImVec2 work_max(viewport->WorkPos.x + viewport->WorkSize.x - metrics.padding.x, viewport->WorkPos.y + viewport->WorkSize.y - metrics.padding.y);
+		const ImVec2 work_center((work_min.x + work_max.x) * 0.5f, (work_min.y + work_max.y) * 0.5f);
+		float heights[ImGuiToastPos_COUNT] = {};
+		float center_top = 0.f; // The center stack grows downward from its first toast, centered in the work area
+		bool center_placed = false;
+
+		int windows = 0, visible = 0, vertices = 0, indices = 0;
+		ImU64 fingerprint = NotifyHash(&vp_size, sizeof(vp_size));
+		fingerprint = NotifyHash(&viewport->WorkPos, sizeof(viewport->WorkPos), fingerprint);
+		fingerprint = NotifyHash(&viewport->WorkSize, sizeof(viewport->WorkSize), fingerprint);
+
+		const float wrap_pos_x = viewport->WorkSize.x / 3.f; // We want to support multi-line text, this will wrap the text after 1/3 of the screen width
+		const ImU64 layout_key = NotifyCalcLayoutKey(wrap_pos_x);
+
+		PushStyleVar(ImGuiStyleVar_WindowPadding, metrics.window_padding);
+		PushStyleVar(ImGuiStyleVar_ItemSpacing, metrics.item_spacing);
+		PushStyleVar(ImGuiStyleVar_WindowRounding, metrics.window_rounding);
+
+		// Lay the stacks out first, the toasts then slide toward their place
+		for (auto i = 0; i < notifications.size(); i++)
+		{
+			auto* current_toast = &notifications[i];
+
+			ImGuiToastPhase phase;
+			{
+				NOTIFY_TRACE("Phase");
+				current_toast->update_progress();
+				phase = current_toast->get_phase();
+			}
+
+			// Remove toast if expired
+			if (phase == ImGuiToastPhase_Expired)
+			{
+				NOTIFY_TRACE("Expiry");
+				RemoveNotification(i--); // The next toast moved to i, it must be laid out this frame too
+				continue;
+			}
+
+			// Size from the layout cache, only computed again when the text, fonts or style changed
+			const ImGuiToastLayout* layout = current_toast->get_layout(layout_key);
+			if (!layout)
+			{
+				NOTIFY_TRACE("Layout");
+				ImGuiToastLayout computed = NotifyCalcToastLayout(*current_toast, wrap_pos_x);
+				computed.key = layout_key;
+				current_toast->set_layout(computed);
+				layout = current_toast->get_layout(layout_key);
+			}
+			const ImVec2 size = layout->size;
+
+			// Distance from the anchor of its stack, toasts that jumped there (new, or without reflow animation) don't move
+			float& height = heights[current_toast->get_position()];
+			ImGuiNotifySpring& spring = notify_springs[(current_toast->get_handle() & 0xFFFF) - 1];
+			spring.target = height;
+			if (!spring.placed || NOTIFY_REFLOW_TIME <= 0)
+			{
+				spring.offset = height;
+				spring.velocity = 0.f;
+				spring.placed = true;
+			}
+			else if (spring.offset != spring.target || spring.velocity != 0.f)
+			{
+				notify_springs_moving = true;
+			}
+			height += size.y + metrics.padding_message_y;
+		}
+
+		NotifyUpdateSprings(GetIO().DeltaTime);
+
+		notify_hit_rects.resize(0);
+		for (auto i = 0; i < notifications.size(); i++)
+		{
+			auto* current_toast = &notifications[i];
+
+			const auto opacity = current_toast->get_fade_percent(); // Get opacity based of the current phase
+
+			const ImGuiToastLayout& layout = *current_toast->get_layout(layout_key);
+			const ImVec2 size = layout.size;
+
+			// Top of the window in its stack: top stacks grow downward, bottom stacks upward
+			const ImGuiToastPos position = current_toast->get_position();
+			const float height = notify_springs[(current_toast->get_handle() & 0xFFFF) - 1].offset;
+			float top;
+			switch (position)
+			{
+			case ImGuiToastPos_TopLeft:
+			case ImGuiToastPos_TopCenter:
+			case ImGuiToastPos_TopRight:
+				top = work_min.y + height;
+				break;
+			case ImGuiToastPos_Center:
+				if (!center_placed)
+					center_top = work_center.y - size.y * 0.5f;
+				center_placed = true;
+				top = center_top + height;
+				break;
+			default:
+				top = work_max.y - height - size.y;
+				break;
+			}
+			const float left = position == ImGuiToastPos_TopLeft || position == ImGuiToastPos_BottomLeft ? work_min.x :
+				position == ImGuiToastPos_TopRight || position == ImGuiToastPos_BottomRight ? work_max.x - size.x : work_center.x - size.x * 0.5f;
+
+			// Cull toasts that wouldn't show a single pixel: every color is faded by opacity (rounds to alpha 0 below 0.5/255),
+			// or the stack already left the viewport. They still took their room in the stack
+			if (opacity < 0.5f / 255.f || top + size.y <= viewport->Pos.y || top >= viewport->Pos.y + viewport->Size.y)
+				continue;
+
+			const ImVec2 window_min((float)(int)left, (float)(int)top);
+			notify_hit_rects.push_back({ window_min, layout, current_toast->get_handle(), false });
+
+			// Get icon, title and other data
+			const auto icon = current_toast->get_icon();
+			const auto title = current_toast->get_title();
+			const auto content = current_toast->get_content();
+			const auto default_title = current_toast->get_default_title();
+
+			// Window rendering
+			auto text_color = current_toast->get_color();
+			text_color.w = opacity;
+
+			// Generate new unique name for this toast
+			char window_name[50]{};
+			snprintf(window_name, sizeof(window_name), "##TOAST%d", i);
+
+			// The whole toast fades, background included (SetNextWindowBgAlpha is multiplied by the style alpha)
+			PushStyleVar(ImGuiStyleVar_Alpha, GetStyle().Alpha * opacity);
+			SetNextWindowBgAlpha(1.f);
+			SetNextWindowPos(window_min, ImGuiCond_Always);
+			SetNextWindowSize(size);
+#ifdef NOTIFY_USE_MOUSE
+			// Mouse inputs on, so the hover routing of Dear ImGui gives the clicks over a toast to the toast alone
+			// A clicked toast takes the focus like any window, it goes back to the previous one once the toast window is gone
+			Begin(window_name, NULL, (NOTIFY_TOAST_FLAGS | ImGuiWindowFlags_NoMove) & ~ImGuiWindowFlags_NoMouseInputs);
+			notify_hit_rects.back().hovered = IsWindowHovered();
+#else
+			Begin(window_name, NULL, NOTIFY_TOAST_FLAGS);
+#endif
+			SetWindowFontScale(metrics.font_scale);
+
+			// Here we render the toast content
+			{
+				NOTIFY_TRACE("Draw");
+				PushTextWrapPos(wrap_pos_x);
+
+				bool was_title_rendered = false;
+
+				// If an icon is set
+				if (!NOTIFY_NULL_OR_EMPTY(icon))
+				{
+					// Render icon text, faded by the style alpha
+					PushStyleColor(ImGuiCol_Text, ImVec4(text_color.x, text_color.y, text_color.z, 1.f));
+					TextUnformatted(icon);
+					PopStyleColor();
+					was_title_rendered = true;
+				}
+
+				// If a title is set
+				if (!NOTIFY_NULL_OR_EMPTY(title))
+				{
+					// If a title and an icon is set, we want to render on same line
+					if (!NOTIFY_NULL_OR_EMPTY(icon))
+						SameLine();
+
+					TextUnformatted(title); // Render title text (already formatted by set_title)
+					was_title_rendered = true;
+				}
+				else if (!NOTIFY_NULL_OR_EMPTY(default_title))
+				{
+					if (!NOTIFY_NULL_OR_EMPTY(icon))
+						SameLine();
+
+					TextUnformatted(default_title); // Render default title text (ImGuiToastType_Success -> "Success", etc...)
+					was_title_rendered = true;
+				}
+
+				// In case ANYTHING was rendered in the top, we want to add a small padding so the text (or icon) looks centered vertically
+				if (was_title_rendered && !NOTIFY_NULL_OR_EMPTY(content))
+				{
+					SetCursorPosY(GetCursorPosY() + metrics.separator_offset); // Must be a better way to do this!!!!
+				}
+
+				// If a content is set
+				if (!NOTIFY_NULL_OR_EMPTY(content))
+				{
+					if (was_title_rendered)
+					{
+#ifdef NOTIFY_USE_SEPARATOR
+						Separator();
+#endif
+					}
+
+					if (current_toast->get_spans_count())
+						NotifyRenderMarkup(*current_toast, wrap_pos_x); // Styled runs (parsed by set_content)
+					else
+						TextUnformatted(content); // Render content text (already formatted by set_content)
+				}
+
+				PopTextWrapPos();
+
+				// Image or custom drawing, in the toast draw list: no draw command callback, nothing for the backend to flush
+				if (layout.media_size.x > 0.f)
+				{
+					Dummy(layout.media_size);
+					const ImVec2 media_min(window_min.x + layout.media_pos.x, window_min.y + layout.media_pos.y);
+					current_toast->draw_media(GetWindowDrawList(), media_min, ImVec2(media_min.x + layout.media_size.x, media_min.y + layout.media_size.y), GetStyle().Alpha);
+				}
+
+				// Action buttons, drawn where the layout put them (the window has no inputs, the hit test tells which one is hovered)
+				for (int n = 0; n < current_toast->get_actions_count(); n++)
+				{
+					if (n > 0)
+						SameLine();
+					Dummy(layout.actions_size[n]);
+
+					const ImVec2 button_min(window_min.x + layout.actions_pos[n].x, window_min.y + layout.actions_pos[n].y);
+					const ImVec2 button_max(button_min.x + layout.actions_size[n].x, button_min.y + layout.actions_size[n].y);
+					const bool hovered = notify_hovered == current_toast->get_handle() && notify_hovered_action == n;
+					ImDrawList* draw_list = GetWindowDrawList();
+					draw_list->AddRectFilled(button_min, button_max, GetColorU32(hovered ? ImGuiCol_ButtonHovered : ImGuiCol_Button), metrics.frame_rounding);
+					draw_list->AddText(ImVec2(button_min.x + metrics.frame_padding.x, button_min.y + metrics.frame_padding.y), GetColorU32(ImGuiCol_Text), current_toast->get_action(n).label);
+				}
+			}
+
+			// Progress bar along the bottom edge, inside the rounded corners
+			const auto progress = current_toast->get_progress();
+			if (progress >= 0.f)
+			{
+				NOTIFY_TRACE("Draw progress");
+				const auto window_pos = GetWindowPos();
+				const auto window_size = GetWindowSize();
+				const auto inset = metrics.window_rounding;
+				const ImVec2 bar_min(window_pos.x + inset, window_pos.y + window_size.y - metrics.progress_bar_height);
+				const ImVec2 bar_max(bar_min.x + (window_size.x - inset * 2.f) * progress, window_pos.y + window_size.y);
+				GetWindowDrawList()->AddRectFilled(bar_min, bar_max, ColorConvertFloat4ToU32(text_color));
+			}
+
+			// Stats, read before End() while the draw list is still the toast's
+			windows++;
+			if (GetWindowPos().y < viewport->Pos.y + viewport->Size.y && GetWindowPos().y + GetWindowHeight() > viewport->Pos.y)
+				visible++;
+			vertices += GetWindowDrawList()->VtxBuffer.Size;
+			indices += GetWindowDrawList()->IdxBuffer.Size;
+			notify_stats.windows_created = (std::max)(notify_stats.windows_created, i + 1);
+			fingerprint = NotifyHashToastDrawList(GetWindowDrawList(), fingerprint);
 
 			// End
 			End();
+			PopStyleVar();
+		}
+
+		PopStyleVar(3);
+
+#ifdef NOTIFY_USE_MOUSE
+		NotifyHitTest();
+#endif
+
+		notify_fingerprint = fingerprint;
+		UpdateNotificationStats(windows, visible, vertices, indices, render_start, drain_end);
+	}
+
+	struct ImGuiNotifyReplayFrame
+	{
+		ImU64		time;			// Clock of the captured frame (ms)
+		int			toasts;			// Toasts alive at the end of the frame
+		double		cpu_ms;			// NewFrame() + RenderNotifications() + Render()
+		ImU64		checksum;		// Hash of the draw data (vertices, indices, commands)
+	};
+
+	NOTIFY_INLINE unsigned long long notify_replay_time = 0;
+
+	NOTIFY_INLINE unsigned long long NotifyReplayClock()
+	{
+		return notify_replay_time;
+	}
+
+	/// <summary>
+	/// Hash everything the backend would draw, to compare replays between builds
+	/// </summary>
+	NOTIFY_INLINE ImU64 NotifyHashDrawData(const ImDrawData* draw_data)
+	{
+		ImU64 hash = NotifyHash(&draw_data->DisplaySize, sizeof(draw_data->DisplaySize));
+		for (int n = 0; n < draw_data->CmdListsCount; n++)
+		{
+			const ImDrawList* cmd_list = draw_data->CmdLists[n];
+			hash = NotifyHash(cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.size_in_bytes(), hash);
+			hash = NotifyHash(cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.size_in_bytes(), hash);
+			for (const ImDrawCmd& cmd : cmd_list->CmdBuffer)
+			{
+				hash = NotifyHash(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+				hash = NotifyHash(&cmd.TextureId, sizeof(cmd.TextureId), hash);
+				hash = NotifyHash(&cmd.VtxOffset, sizeof(cmd.VtxOffset), hash);
+				hash = NotifyHash(&cmd.IdxOffset, sizeof(cmd.IdxOffset), hash);
+				hash = NotifyHash(&cmd.ElemCount, sizeof(cmd.ElemCount), hash);
+			}
+		}
+		return hash;
+	}
+
+	/// <summary>
+	/// Feed a capture written by BeginNotificationCapture() to a headless context, under a clock that follows the captured timestamps
+	/// The live toasts are set aside meanwhile. Same capture and fonts produce the same checksums, so it doubles as a regression test
+	/// </summary>
+	/// <param name="shared_font_atlas">fonts to render with, NULL for the ones of the current context (or the default font without context)</param>
+	/// <returns>false if the file is missing or isn't a capture</returns>
+	NOTIFY_INLINE bool ReplayNotificationCapture(const char* filename, std::vector<ImGuiNotifyReplayFrame>* out_frames, ImFontAtlas* shared_font_atlas = NULL)
+	{
+		FILE* f = NotifyFileOpen(filename, "rb");
+		if (!f)
+			return false;
+
+		ImGuiNotifyCaptureHeader header = {};
+		if (fread(&header, sizeof(header), 1, f) != 1 || memcmp(header.magic, "NFCP", 4) || header.version != 1)
+		{
+			fclose(f);
+			return false;
+		}
+
+		ImGuiContext* prev_ctx = GetCurrentContext();
+		if (!shared_font_atlas && prev_ctx)
+			shared_font_atlas = GetIO().Fonts;
+
+		ImGuiContext* ctx = CreateContext(shared_font_atlas);
+		SetCurrentContext(ctx);
+		ImGuiIO& io = GetIO();
+		io.IniFilename = NULL;
+		io.LogFilename = NULL;
+		if (!io.Fonts->IsBuilt())
+		{
+			unsigned char* pixels;
+			io.Fonts->GetTexDataAsAlpha8(&pixels, NULL, NULL);
+		}
+
+		// Set the live toasts aside, they come back untouched
+		std::vector<ImGuiToast> saved_notifications;
+		std::vector<ImGuiToastSlot> saved_slots;
+		std::vector<int> saved_free_slots;
+		saved_notifications.swap(notifications);
+		saved_slots.swap(notify_slots);
+		saved_free_slots.swap(notify_free_slots);
+		std::vector<ImGuiNotifySpring> saved_springs;
+		saved_springs.swap(notify_springs);
+		std::vector<ImGuiNotifyHitRect> saved_hit_rects;
+		saved_hit_rects.swap(notify_hit_rects);
+		const ImGuiToastHandle saved_hovered = notify_hovered;
+		const int saved_hovered_action = notify_hovered_action;
+		const ImGuiToastHandle saved_paused = notify_paused;
+		notify_hovered = notify_paused = 0;
+		notify_hovered_action = -1;
+		ImGuiViewport* saved_viewport = notify_viewport;
+		notify_viewport = NULL; // Belongs to the live context
+		const ImGuiNotifyClockFn saved_clock = notify_clock;
+		notify_clock = NotifyReplayClock;
+		notify_replaying = true;
+
+		ImU64 prev_frame_time = 0;
+		std::vector<char> payload;
+		ImGuiNotifyCaptureEvent event = {};
+		while (fread(&event, sizeof(event), 1, f) == 1)
+		{
+			payload.resize(event.payload_size);
+			if (event.payload_size && fread(payload.data(), 1, event.payload_size, f) != event.payload_size)
+				break;
+
+			notify_replay_time = event.time;
+
+			if (event.kind == ImGuiNotifyCaptureEvent_Insert && event.payload_size >= sizeof(ImS32) * 5)
+			{
+				ImS32 fields[5];
+				memcpy(fields, payload.data(), sizeof(fields));
+				if (fields[0] < 0 || fields[0] >= ImGuiToastType_COUNT || fields[3] < 0 || fields[4] < 0 || sizeof(fields) + (size_t)fields[3] + (size_t)fields[4] > payload.size())
+					continue;
+
+				const std::string title(payload.data() + sizeof(fields), (size_t)fields[3]);
+				const std::string content(payload.data() + sizeof(fields) + fields[3], (size_t)fields[4]);
+				ImGuiToast toast(fields[0], fields[1]);
+				toast.set_priority(fields[2]);
+				toast.set_title("%s", title.c_str());
+				toast.set_content("%s", content.c_str());
+				InsertNotification(toast);
+			}
+			else if (event.kind == ImGuiNotifyCaptureEvent_Frame && event.payload_size >= sizeof(ImVec2))
+			{
+				memcpy(&io.DisplaySize, payload.data(), sizeof(ImVec2));
+				io.DeltaTime = (prev_frame_time && event.time > prev_frame_time) ? (float)(event.time - prev_frame_time) / 1000.f : 1.f / 60.f;
+				prev_frame_time = event.time;
+
+				const auto start = std::chrono::steady_clock::now();
+				NewFrame();
+				RenderNotifications();
+				Render();
+				const double cpu_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+				if (out_frames)
+					out_frames->push_back({ event.time, (int)notifications.size(), cpu_ms, NotifyHashDrawData(GetDrawData()) });
+			}
+		}
+		fclose(f);
+
+		notify_replaying = false;
+		notify_clock = saved_clock;
+		notifications.swap(saved_notifications);
+		notify_slots.swap(saved_slots);
+		notify_free_slots.swap(saved_free_slots);
+		notify_springs.swap(saved_springs);
+		notify_hit_rects.swap(saved_hit_rects);
+		notify_hovered = saved_hovered;
+		notify_hovered_action = saved_hovered_action;
+		notify_paused = saved_paused;
+		notify_viewport = saved_viewport;
+
+		DestroyContext(ctx);
+		SetCurrentContext(prev_ctx);
+		return true;
+	}
+
+	/// <summary>
+	/// Window listing the toasts that left the screen (expired, dismissed, evicted or dropped), newest first
+	/// With NOTIFY_USE_JOURNAL, the toasts of previous sessions can be browsed too (see OpenNotificationJournal())
+	/// Rows are only filtered and sorted again when the filter or the sort order changed (new records are inserted in place), and only visible rows are submitted
+	/// </summary>
+	NOTIFY_INLINE void ShowNotificationHistory(bool* p_open = NULL)
+	{
+		SetNextWindowSize(ImVec2(600.f, 400.f), ImGuiCond_FirstUseEver);
+		if (!Begin("Notification history", p_open))
+		{
+			End();
+			return;
+		}
+
+		ImGuiNotifyHistoryView& view = notify_history_view;
+
+		// Records first..end-1 of the source are kept
+		ImU64 end = notify_history_total;
+		ImU64 first = end - (ImU64)notify_history_count;
+#ifdef NOTIFY_USE_JOURNAL
+		if (notify_journal.get_records_count() > 0)
+		{
+			if (RadioButton("This session", !view.from_journal) && view.from_journal)
+				view.from_journal = false, view.rows_dirty = true;
+			SameLine();
+			if (RadioButton("Previous sessions", view.from_journal) && !view.from_journal)
+				view.from_journal = true, view.rows_dirty = true;
+			SameLine();
+		}
+		else if (view.from_journal)
+		{
+			view.from_journal = false;
+			view.rows_dirty = true;
+		}
+
+		if (view.from_journal)
+		{
+			first = 0;
+			end = (ImU64)notify_journal.get_records_count();
+		}
+#endif
+		const bool from_journal = view.from_journal;
+		const auto get_entry = [from_journal](ImU64 record)
+		{
+			const int index = from_journal ? (int)record : (int)((notify_history_head + NOTIFY_HISTORY_SIZE - (int)(notify_history_total - record) % NOTIFY_HISTORY_SIZE) % NOTIFY_HISTORY_SIZE);
+			return GetNotificationHistoryEntry(from_journal, index);
+		};
+
+		if (!view.from_journal && Button("Clear"))
+			ClearNotificationHistory();
+		SameLine();
+		if (view.filter.Draw("Filter (inc,-exc)"))
+			view.rows_dirty = true;
+		SameLine();
+		Text("%d/%d", (int)view.rows.size(), (int)(end - first));
+
+		const ImGuiTableFlags flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable;
+		if (BeginTable("##history", 4, flags))
+		{
+			TableSetupScrollFreeze(0, 1);
+			TableSetupColumn("Time", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed);
+			TableSetupColumn("Type", ImGuiTableColumnFlags_WidthFixed);
+			TableSetupColumn("Title", ImGuiTableColumnFlags_WidthFixed);
+			TableSetupColumn("Content", ImGuiTableColumnFlags_WidthStretch);
+			TableHeadersRow();
+
+			ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs();
+			if (sort_specs && sort_specs->SpecsDirty)
+			{
+				view.sort_column = sort_specs->SpecsCount > 0 ? sort_specs->Specs[0].ColumnIndex : -1;
+				view.sort_descending = sort_specs->SpecsCount > 0 && sort_specs->Specs[0].SortDirection == ImGuiSortDirection_Descending;
+				sort_specs->SpecsDirty = false;
+				view.rows_dirty = true;
+			}
+
+			// Sort key order, records with equal keys stay in the order they were added in
+			const int column = view.sort_column;
+			const bool descending = view.sort_descending;
+			const auto less = [&get_entry, column, descending](ImU64 a, ImU64 b)
+			{
+				if (column < 0)
+					return false;
+				const ImGuiNotifyHistoryEntry ea = get_entry(descending ? b : a);
+				const ImGuiNotifyHistoryEntry eb = get_entry(descending ? a : b);
+				switch (column)
+				{
+				case 0: return ea.timestamp < eb.timestamp;
+				case 1: return ea.type < eb.type;
+				case 2: return strcmp(ea.title, eb.title) < 0;
+				default: return strcmp(ea.content, eb.content) < 0;
+				}
+			};
+			const auto pass_filter = [&view, &get_entry](ImU64 record)
+			{
+				if (!view.filter.IsActive())
+					return true;
+				const ImGuiNotifyHistoryEntry entry = get_entry(record);
+				view.filter_text.assign(entry.title).append("\n").append(entry.content);
+				return view.filter.PassFilter(view.filter_text.c_str(), view.filter_text.c_str() + view.filter_text.size());
+			};
+
+			if (view.rows_dirty)
+			{
+				view.rows.clear();
+				for (ImU64 record = first; record < end; record++)
+					if (pass_filter(record))
+						view.rows.push_back(record);
+				std::stable_sort(view.rows.begin(), view.rows.end(), less);
+				view.rows_dirty = false;
+			}
+			else if (view.rows_first != first || view.rows_end != end)
+			{
+				// Overwritten (or cleared) records leave, new ones are inserted after the rows that don't sort after them
+				if (first > view.rows_first)
+					view.rows.erase(std::remove_if(view.rows.begin(), view.rows.end(), [first](ImU64 record) { return record < first; }), view.rows.end());
+				for (ImU64 record = (std::max)(view.rows_end, first); record < end; record++)
+					if (pass_filter(record))
+						view.rows.insert(std::upper_bound(view.rows.begin(), view.rows.end(), record, less), record);
+			}
+			view.rows_first = first;
+			view.rows_end = end;
+
+			static const char* type_names[] = { "None", "Success", "Warning", "Error", "Info" };
+
+			// Rows must all have the same height for the clipper: multi-line contents only show their first line
+			ImGuiListClipper clipper;
+			clipper.Begin((int)view.rows.size());
+			while (clipper.Step())
+			{
+				for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+				{
+					const ImGuiNotifyHistoryEntry entry = get_entry(view.rows[row]);
+					const time_t seconds = (time_t)(entry.timestamp / 1000);
+					tm local = {};
+#ifdef _MSC_VER
+					localtime_s(&local, &seconds);
+#else
+					localtime_r(&seconds, &local);
+#endif
+
+					TableNextRow();
+					TableNextColumn();
+					if (from_journal)
+						Text("%04d-%02d-%02d %02d:%02d:%02d", local.tm_year + 1900, local.tm_mon + 1, local.tm_mday, local.tm_hour, local.tm_min, local.tm_sec);
+					else
+						Text("%02d:%02d:%02d.%03d", local.tm_hour, local.tm_min, local.tm_sec, (int)(entry.timestamp % 1000));
+					TableNextColumn();
+					TextUnformatted(entry.type >= 0 && entry.type < IM_ARRAYSIZE(type_names) ? type_names[entry.type] : "?");
+					TableNextColumn();
+					TextUnformatted(entry.title, strchr(entry.title, '\n'));
+					TableNextColumn();
+					TextUnformatted(entry.content, strchr(entry.content, '\n'));
+				}
+			}
+
+			EndTable();
+		}
+
+		End();
+	}
+
+	/// <summary>
+	/// Tree node with GetNotificationStats() and the live toasts, for the Metrics/Debugger window (see ShowMetricsWindowWithNotifications) or your own tools
+	/// </summary>
+	NOTIFY_INLINE void DebugNodeNotifications()
+	{
+		const ImGuiNotifyStats& stats = notify_stats;
+		if (!TreeNode("Notifications", "Notifications (%d live, %d visible)", stats.live, stats.visible))
+			return;
+
+		BulletText("Pending: %d", stats.pending);
+		BulletText("Inserts: %.1f/s (%llu total), drops: %.1f/s (%llu total)", stats.inserts_per_second, (unsigned long long)stats.inserts_total, stats.drops_per_second, (unsigned long long)stats.drops_total);
+		BulletText("Text: %d bytes used, %d bytes reserved", (int)stats.text_bytes_used, (int)stats.text_bytes_reserved);
+		BulletText("Time: %.3f ms render, %.3f ms drain", stats.render_ms, stats.drain_ms);
+		BulletText("Draw: %d vertices, %d indices", stats.vertices, stats.indices);
+		BulletText("Windows: %d submitted, %d created", stats.windows, stats.windows_created);
+
+		if (TreeNode("Toasts", "Toasts (%d)", (int)notifications.size()))
+		{
+			static const char* phase_names[] = { "FadeIn", "Wait", "FadeOut", "Expired" };
+			for (int i = 0; i < (int)notifications.size(); i++)
+			{
+				ImGuiToast& toast = notifications[i];
+				const ImGuiToastPhase phase = toast.get_phase();
+				BulletText("##TOAST%d: handle 0x%08X, priority %d, %s%s, %llu ms, \"%.32s\"", i, toast.get_handle(), toast.get_priority(), phase >= 0 && phase < IM_ARRAYSIZE(phase_names) ? phase_names[phase] : "?", toast.is_paused() ? " (paused)" : "", (unsigned long long)toast.get_elapsed_time(), toast.get_content());
+			}
+			TreePop();
 		}
+
+		TreePop();
+	}
+
+	/// <summary>
+	/// ShowMetricsWindow() with a DebugNodeNotifications() node appended at the bottom
+	/// </summary>
+	NOTIFY_INLINE void ShowMetricsWindowWithNotifications(bool* p_open = NULL)
+	{
+		ShowMetricsWindow(p_open);
+		if (p_open && !*p_open)
+			return;
+
+		// Same name: appends to the window ShowMetricsWindow() just submitted
+		if (Begin("Dear ImGui Metrics/Debugger", p_open))
+			DebugNodeNotifications();
+		End();
 	}
 
 	/// <summary>
 	/// Adds font-awesome font, must be called ONCE on initialization
-	/// <param name="FontDataOwnedByAtlas">Fonts are loaded from read-only memory, should be set to false!</param>
+	/// With NOTIFY_USE_COMPRESSED_FONT, the font is decompressed once into memory owned by the atlas and shared by every merged size
+	/// <param name="FontDataOwnedByAtlas">Fonts are loaded from read-only memory, should be set to false! (ignored with NOTIFY_USE_COMPRESSED_FONT)</param>
 	/// </summary>
 	NOTIFY_INLINE void MergeIconsWithLatestFont(float font_size, bool FontDataOwnedByAtlas = false)
 	{
-		static const ImWchar icons_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
+		const ImWchar* icons_ranges = GetNotificationIconRanges();
+
+		ImFontAtlas* atlas = GetIO().Fonts;
 
 		ImFontConfig icons_config;
 		icons_config.MergeMode = true;
 		icons_config.PixelSnapH = true;
 		icons_config.FontDataOwnedByAtlas = FontDataOwnedByAtlas;
+		snprintf(icons_config.Name, sizeof(icons_config.Name), "%s", NOTIFY_ICONS_FONT_NAME);
+
+#ifdef NOTIFY_USE_COMPRESSED_FONT
+		// Reuse the buffer decompressed by a previous merge, its config stays the only owner so ClearInputData() frees it once
+		const ImFontConfig* owner = NULL;
+		for (const ImFontConfig& cfg : atlas->ConfigData)
+			if (!owner && cfg.FontData && cfg.FontDataOwnedByAtlas && !strcmp(cfg.Name, NOTIFY_ICONS_FONT_NAME))
+				owner = &cfg;
+
+		if (owner)
+		{
+			icons_config.FontDataOwnedByAtlas = true; // Prevents AddFont() from making its own copy...
+			atlas->AddFontFromMemoryTTF(owner->FontData, owner->FontDataSize, font_size, &icons_config, icons_ranges);
+			atlas->ConfigData.back().FontDataOwnedByAtlas = false; // ...but the buffer still belongs to the first config
+		}
+		else
+		{
+			atlas->AddFontFromMemoryCompressedTTF(fa_solid_900_compressed_data, fa_solid_900_compressed_size, font_size, &icons_config, icons_ranges);
+		}
+#else
+		atlas->AddFontFromMemoryTTF((void*)fa_solid_900, sizeof(fa_solid_900), font_size, &icons_config, icons_ranges);
+#endif
+
+		// Sizes merged earlier must not keep pointing to ranges that were regenerated since
+		for (ImFontConfig& cfg : atlas->ConfigData)
+			if (!strcmp(cfg.Name, NOTIFY_ICONS_FONT_NAME))
+				cfg.GlyphRanges = icons_ranges;
+	}
+
+	struct ImGuiNotifyAtlasCacheHeader
+	{
+		char		magic[4];
+		int			version;
+		ImU64		key;
+		int			tex_width;
+		int			tex_height;
+		ImVec2		tex_uv_white_pixel;
+		int			fonts_count;
+		int			custom_rects_count;
+		int			pack_id_mouse_cursors;
+		int			pack_id_lines;
+	};
+
+	struct ImGuiNotifyAtlasCacheFont
+	{
+		int			config_data_index;
+		int			config_data_count;
+		float		font_size;
+		float		ascent;
+		float		descent;
+		float		fallback_advance_x;
+		int			metrics_total_surface;
+		ImWchar		fallback_char;
+		ImWchar		ellipsis_char;
+		int			glyphs_count;
+		int			index_count;
+		ImU8		used_4k_pages_map[sizeof(ImFont::Used4kPagesMap)];
+	};
+
+	/// <summary>
+	/// Hash every input of ImFontAtlas::Build(): font blobs, sizes, ranges, configs and custom rects
+	/// </summary>
+	NOTIFY_INLINE ImU64 CalcFontAtlasCacheKey(ImFontAtlas* atlas)
+	{
+		const int layout[] = { IMGUI_VERSION_NUM, NOTIFY_ATLAS_CACHE_VERSION, (int)sizeof(void*), (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), (int)sizeof(ImFontAtlasCustomRect) };
+		ImU64 key = NotifyHash(layout, sizeof(layout));
+
+		const int atlas_inputs[] = { atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding, (int)atlas->FontBuilderFlags, atlas->Fonts.Size, atlas->ConfigData.Size, atlas->PackIdMouseCursors, atlas->PackIdLines };
+		key = NotifyHash(atlas_inputs, sizeof(atlas_inputs), key);
+
+		// Merged icon fonts share a single buffer (see MergeIconsWithLatestFont), only hash it once
+		std::vector<std::pair<const void*, ImU64>> blob_hashes;
+
+		for (const ImFontConfig& cfg : atlas->ConfigData)
+		{
+			ImU64 blob_hash = 0;
+			for (const auto& blob : blob_hashes)
+				if (blob.first == cfg.FontData)
+					blob_hash = blob.second;
+
+			if (!blob_hash)
+			{
+				blob_hash = NotifyHash(cfg.FontData, (size_t)cfg.FontDataSize);
+				blob_hashes.push_back({ cfg.FontData, blob_hash });
+			}
+
+			int dst_index = 0;
+			while (dst_index < atlas->Fonts.Size && atlas->Fonts[dst_index] != cfg.DstFont)
+				dst_index++;
+
+			const int cfg_ints[] = { cfg.FontDataSize, cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH, cfg.MergeMode, (int)cfg.FontBuilderFlags, (int)cfg.EllipsisChar, dst_index };
+			const float cfg_floats[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply };
+			key = NotifyHash(&blob_hash, sizeof(blob_hash), key);
+			key = NotifyHash(cfg_ints, sizeof(cfg_ints), key);
+			key = NotifyHash(cfg_floats, sizeof(cfg_floats), key);
+
+			const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+			size_t ranges_count = 0;
+			while (ranges[ranges_count])
+				ranges_count++;
+			key = NotifyHash(ranges, ranges_count * sizeof(ImWchar), key);
+		}
+
+		for (const ImFontAtlasCustomRect& rect : atlas->CustomRects)
+		{
+			int font_index = -1;
+			for (int n = 0; n < atlas->Fonts.Size && rect.Font; n++)
+				if (atlas->Fonts[n] == rect.Font)
+					font_index = n;
+
+			const float rect_inputs[] = { (float)rect.Width, (float)rect.Height, (float)rect.GlyphID, rect.GlyphAdvanceX, rect.GlyphOffset.x, rect.GlyphOffset.y, (float)font_index };
+			key = NotifyHash(rect_inputs, sizeof(rect_inputs), key);
+		}
+
+		return key;
+	}
+
+	/// <summary>
+	/// Write a built atlas (alpha8 texture, glyph tables and custom rects) to a cache file
+	/// </summary>
+	NOTIFY_INLINE bool SaveFontAtlasCache(ImFontAtlas* atlas, const char* filename, ImU64 key)
+	{
+		if (!atlas->TexPixelsAlpha8)
+			return false;
+
+		FILE* f = NotifyFileOpen(filename, "wb");
+		if (!f)
+			return false;
+
+		ImGuiNotifyAtlasCacheHeader header = {};
+		memcpy(header.magic, "NFAC", 4);
+		header.version = NOTIFY_ATLAS_CACHE_VERSION;
+		header.key = key;
+		header.tex_width = atlas->TexWidth;
+		header.tex_height = atlas->TexHeight;
+		header.tex_uv_white_pixel = atlas->TexUvWhitePixel;
+		header.fonts_count = atlas->Fonts.Size;
+		header.custom_rects_count = atlas->CustomRects.Size;
+		header.pack_id_mouse_cursors = atlas->PackIdMouseCursors;
+		header.pack_id_lines = atlas->PackIdLines;
+
+		bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+		ok &= fwrite(atlas->TexUvLines, sizeof(atlas->TexUvLines), 1, f) == 1;
+
+		for (const ImFontAtlasCustomRect& rect : atlas->CustomRects)
+		{
+			int font_index = -1;
+			for (int n = 0; n < atlas->Fonts.Size && rect.Font; n++)
+				if (atlas->Fonts[n] == rect.Font)
+					font_index = n;
+
+			ImFontAtlasCustomRect stored = rect;
+			stored.Font = NULL;
+			ok &= fwrite(&stored, sizeof(stored), 1, f) == 1;
+			ok &= fwrite(&font_index, sizeof(font_index), 1, f) == 1;
+		}
+
+		for (const ImFont* font : atlas->Fonts)
+		{
+			ImGuiNotifyAtlasCacheFont stored = {};
+			stored.config_data_index = font->ConfigData ? (int)(font->ConfigData - atlas->ConfigData.Data) : -1;
+			stored.config_data_count = font->ConfigDataCount;
+			stored.font_size = font->FontSize;
+			stored.ascent = font->Ascent;
+			stored.descent = font->Descent;
+			stored.fallback_advance_x = font->FallbackAdvanceX;
+			stored.metrics_total_surface = font->MetricsTotalSurface;
+			stored.fallback_char = font->FallbackChar;
+			stored.ellipsis_char = font->EllipsisChar;
+			stored.glyphs_count = font->Glyphs.Size;
+			stored.index_count = font->IndexLookup.Size;
+			memcpy(stored.used_4k_pages_map, font->Used4kPagesMap, sizeof(stored.used_4k_pages_map));
+
+			ok &= fwrite(&stored, sizeof(stored), 1, f) == 1;
+			ok &= fwrite(font->Glyphs.Data, sizeof(ImFontGlyph), (size_t)font->Glyphs.Size, f) == (size_t)font->Glyphs.Size;
+			ok &= fwrite(font->IndexAdvanceX.Data, sizeof(float), (size_t)font->IndexAdvanceX.Size, f) == (size_t)font->IndexAdvanceX.Size;
+			ok &= fwrite(font->IndexLookup.Data, sizeof(ImWchar), (size_t)font->IndexLookup.Size, f) == (size_t)font->IndexLookup.Size;
+		}
+
+		const size_t tex_size = (size_t)atlas->TexWidth * (size_t)atlas->TexHeight;
+		ok &= fwrite(atlas->TexPixelsAlpha8, 1, tex_size, f) == tex_size;
+
+		fclose(f);
+
+		// Never leave a truncated file behind, it would be rejected on every startup
+		if (!ok)
+			remove(filename);
+
+		return ok;
+	}
+
+	/// <summary>
+	/// Restore an atlas written by SaveFontAtlasCache(), data is read straight into the memory the atlas owns
+	/// </summary>
+	/// <returns>false if the file is missing, stale (other key) or truncated</returns>
+	NOTIFY_INLINE bool LoadFontAtlasCache(ImFontAtlas* atlas, const char* filename, ImU64 key)
+	{
+		FILE* f = NotifyFileOpen(filename, "rb");
+		if (!f)
+			return false;
+
+		ImGuiNotifyAtlasCacheHeader header = {};
+		bool ok = fread(&header, sizeof(header), 1, f) == 1;
+		ok = ok && !memcmp(header.magic, "NFAC", 4) && header.version == NOTIFY_ATLAS_CACHE_VERSION && header.key == key;
+		ok = ok && header.fonts_count == atlas->Fonts.Size && header.tex_width > 0 && header.tex_height > 0;
+		if (!ok)
+		{
+			fclose(f);
+			return false;
+		}
+
+		ok &= fread(atlas->TexUvLines, sizeof(atlas->TexUvLines), 1, f) == 1;
+
+		atlas->CustomRects.resize(header.custom_rects_count);
+		for (ImFontAtlasCustomRect& rect : atlas->CustomRects)
+		{
+			int font_index = -1;
+			ok &= fread(&rect, sizeof(rect), 1, f) == 1;
+			ok &= fread(&font_index, sizeof(font_index), 1, f) == 1;
+			rect.Font = (font_index >= 0 && font_index < atlas->Fonts.Size) ? atlas->Fonts[font_index] : NULL;
+		}
+		atlas->PackIdMouseCursors = header.pack_id_mouse_cursors;
+		atlas->PackIdLines = header.pack_id_lines;
+
+		for (ImFont* font : atlas->Fonts)
+		{
+			ImGuiNotifyAtlasCacheFont stored = {};
+			ok = ok && fread(&stored, sizeof(stored), 1, f) == 1;
+			ok = ok && stored.config_data_index >= 0 && stored.config_data_index < atlas->ConfigData.Size;
+			if (!ok)
+				break;
+
+			font->ClearOutputData();
+			font->ContainerAtlas = atlas;
+			font->ConfigData = &atlas->ConfigData[stored.config_data_index];
+			font->ConfigDataCount = (short)stored.config_data_count;
+			font->FontSize = stored.font_size;
+			font->Ascent = stored.ascent;
+			font->Descent = stored.descent;
+			font->MetricsTotalSurface = stored.metrics_total_surface;
+			font->FallbackChar = stored.fallback_char;
+			font->EllipsisChar = stored.ellipsis_char;
+			memcpy(font->Used4kPagesMap, stored.used_4k_pages_map, sizeof(font->Used4kPagesMap));
+
+			font->Glyphs.resize(stored.glyphs_count);
+			font->IndexAdvanceX.resize(stored.index_count);
+			font->IndexLookup.resize(stored.index_count);
+			ok &= fread(font->Glyphs.Data, sizeof(ImFontGlyph), (size_t)stored.glyphs_count, f) == (size_t)stored.glyphs_count;
+			ok &= fread(font->IndexAdvanceX.Data, sizeof(float), (size_t)stored.index_count, f) == (size_t)stored.index_count;
+			ok &= fread(font->IndexLookup.Data, sizeof(ImWchar), (size_t)stored.index_count, f) == (size_t)stored.index_count;
+
+			// Lookup tables are restored as-is, no need for BuildLookupTable()
+			font->FallbackGlyph = font->FindGlyphNoFallback(font->FallbackChar);
+			font->FallbackAdvanceX = stored.fallback_advance_x;
+			font->DirtyLookupTables = false;
+		}
+
+		atlas->ClearTexData();
+		if (ok)
+		{
+			const size_t tex_size = (size_t)header.tex_width * (size_t)header.tex_height;
+			atlas->TexID = (ImTextureID)NULL;
+			atlas->TexWidth = header.tex_width;
+			atlas->TexHeight = header.tex_height;
+			atlas->TexUvScale = ImVec2(1.0f / header.tex_width, 1.0f / header.tex_height);
+			atlas->TexUvWhitePixel = header.tex_uv_white_pixel;
+			atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_size);
+			ok = fread(atlas->TexPixelsAlpha8, 1, tex_size, f) == tex_size;
+			if (!ok)
+				atlas->ClearTexData();
+		}
+
+		fclose(f);
+		return ok;
+	}
+
+	/// <summary>
+	/// Build the font atlas, or restore it from a cache file written by a previous build with identical inputs (skips rasterization)
+	/// Call after adding your fonts (and MergeIconsWithLatestFont), before the backend uploads the font texture
+	/// </summary>
+	/// <returns>true if the atlas was restored from the cache</returns>
+	NOTIFY_INLINE bool BuildFontAtlasCached(const char* filename, ImFontAtlas* atlas = NULL)
+	{
+		if (!atlas)
+			atlas = GetIO().Fonts;
+
+		IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+
+		if (atlas->ConfigData.empty())
+			atlas->AddFontDefault();
+
+		const ImU64 key = CalcFontAtlasCacheKey(atlas);
+
+		if (LoadFontAtlasCache(atlas, filename, key))
+			return true;
 
-		GetIO().Fonts->AddFontFromMemoryTTF((void*)fa_solid_900, sizeof(fa_solid_900), font_size, &icons_config, icons_ranges);
+		// Cache miss (or truncated file): a regular build resets every font and custom rect we may have touched
+		atlas->Build();
+		SaveFontAtlasCache(atlas, filename, key);
+		return false;
 	}
 }
 
@@ -0,0 +1,226 @@
+// imgui-notify by patrickcjk
+// https://github.com/patrickcjk/imgui-notify
+
+// Shared memory ring to raise toasts from other processes of the same host.
+// Plain C, no Dear ImGui dependency: producers only need this file.
+// - The UI process creates the ring (ImGui::OpenNotificationSharedMemory() with NOTIFY_USE_SHARED_MEMORY) and drains it in RenderNotifications()
+// - Producers open it by name and post fixed-size records, many producers can post concurrently (bounded MPSC queue, one sequence per slot)
+// - Posting never blocks and makes no syscall: ImGuiNotifyShm_Post() returns 0 when the ring is full
+
+#ifndef IMGUI_NOTIFY_SHM
+#define IMGUI_NOTIFY_SHM
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX						// imgui_notify.h calls std::min/std::max
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define IMGUI_NOTIFY_SHM_MAGIC			0x4D48534Eu	// "NSHM"
+#define IMGUI_NOTIFY_SHM_VERSION		1
+#define IMGUI_NOTIFY_SHM_SLOTS			256			// Must be a power of 2
+#define IMGUI_NOTIFY_SHM_TITLE_SIZE		128
+#define IMGUI_NOTIFY_SHM_CONTENT_SIZE	512
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ImGuiNotifyShmRecord
+{
+	volatile uint32_t	sequence;		// == position: free for the producer claiming it, == position + 1: ready for the consumer
+	int32_t				type;			// ImGuiToastType
+	int32_t				dismiss_time;	// ms, <= 0 for the default
+	uint32_t			reserved;
+	char				title[IMGUI_NOTIFY_SHM_TITLE_SIZE];
+	char				content[IMGUI_NOTIFY_SHM_CONTENT_SIZE];
+} ImGuiNotifyShmRecord;
+
+typedef struct ImGuiNotifyShmRing
+{
+	volatile uint32_t	magic;			// Written last by the creator, producers refuse rings that aren't initialized
+	uint32_t			version;
+	uint32_t			slots_count;
+	uint32_t			record_size;
+	uint8_t				pad0[64 - 4 * sizeof(uint32_t)];
+	volatile uint32_t	enqueue_pos;	// Shared by producers, on its own cache line
+	uint8_t				pad1[64 - sizeof(uint32_t)];
+	volatile uint32_t	dequeue_pos;	// Only touched by the consumer
+	uint8_t				pad2[64 - sizeof(uint32_t)];
+	ImGuiNotifyShmRecord records[IMGUI_NOTIFY_SHM_SLOTS];
+} ImGuiNotifyShmRing;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+static inline uint32_t ImGuiNotifyShm_LoadAcquire(volatile uint32_t* p)					{ return (uint32_t)_InterlockedOr((volatile long*)p, 0); }
+static inline void ImGuiNotifyShm_StoreRelease(volatile uint32_t* p, uint32_t v)			{ _InterlockedExchange((volatile long*)p, (long)v); }
+static inline int ImGuiNotifyShm_CompareExchange(volatile uint32_t* p, uint32_t expected, uint32_t desired) { return (uint32_t)_InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == expected; }
+#else
+static inline uint32_t ImGuiNotifyShm_LoadAcquire(volatile uint32_t* p)					{ return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void ImGuiNotifyShm_StoreRelease(volatile uint32_t* p, uint32_t v)			{ __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline int ImGuiNotifyShm_CompareExchange(volatile uint32_t* p, uint32_t expected, uint32_t desired) { return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED); }
+#endif
+
+static inline ImGuiNotifyShmRing* ImGuiNotifyShm_Map(const char* name, int create)
+{
+	void* view = NULL;
+#ifdef _WIN32
+	HANDLE mapping = create ? CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, (DWORD)sizeof(ImGuiNotifyShmRing), name) : OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+	if (!mapping)
+		return NULL;
+	view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(ImGuiNotifyShmRing));
+	CloseHandle(mapping); // The view keeps the mapping alive
+#else
+	const int fd = shm_open(name, create ? (O_CREAT | O_RDWR) : O_RDWR, 0600);
+	if (fd < 0)
+		return NULL;
+	if (create && ftruncate(fd, (off_t)sizeof(ImGuiNotifyShmRing)) != 0)
+	{
+		close(fd);
+		return NULL;
+	}
+	view = mmap(NULL, sizeof(ImGuiNotifyShmRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+		view = NULL;
+#endif
+	return (ImGuiNotifyShmRing*)view;
+}
+
+/// <summary>
+/// Create (or reset) the ring, done by the process that shows the toasts
+/// </summary>
+/// <param name="name">"/name" on POSIX (see shm_open), "Local\\name" or "Global\\name" on Windows</param>
+static inline ImGuiNotifyShmRing* ImGuiNotifyShm_Create(const char* name)
+{
+	ImGuiNotifyShmRing* ring = ImGuiNotifyShm_Map(name, 1);
+	if (!ring)
+		return NULL;
+
+	ring->magic = 0;
+	ring->version = IMGUI_NOTIFY_SHM_VERSION;
+	ring->slots_count = IMGUI_NOTIFY_SHM_SLOTS;
+	ring->record_size = (uint32_t)sizeof(ImGuiNotifyShmRecord);
+	ring->enqueue_pos = 0;
+	ring->dequeue_pos = 0;
+	for (uint32_t n = 0; n < IMGUI_NOTIFY_SHM_SLOTS; n++)
+		ring->records[n].sequence = n;
+	ImGuiNotifyShm_StoreRelease(&ring->magic, IMGUI_NOTIFY_SHM_MAGIC);
+	return ring;
+}
+
+/// <summary>
+/// Open a ring created by the UI process, done by producers
+/// </summary>
+/// <returns>NULL if it doesn't exist yet, or was created with another layout</returns>
+static inline ImGuiNotifyShmRing* ImGuiNotifyShm_Open(const char* name)
+{
+	ImGuiNotifyShmRing* ring = ImGuiNotifyShm_Map(name, 0);
+	if (ring && (ImGuiNotifyShm_LoadAcquire(&ring->magic) != IMGUI_NOTIFY_SHM_MAGIC || ring->version != IMGUI_NOTIFY_SHM_VERSION || ring->slots_count != IMGUI_NOTIFY_SHM_SLOTS || ring->record_size != sizeof(ImGuiNotifyShmRecord)))
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(ring);
+#else
+		munmap(ring, sizeof(ImGuiNotifyShmRing));
+#endif
+		ring = NULL;
+	}
+	return ring;
+}
+
+static inline void ImGuiNotifyShm_Close(ImGuiNotifyShmRing* ring)
+{
+	if (!ring)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(ring);
+#else
+	munmap(ring, sizeof(ImGuiNotifyShmRing));
+#endif
+}
+
+/// <summary>
+/// Remove the name (POSIX only, Windows frees the ring with its last view)
+/// </summary>
+static inline void ImGuiNotifyShm_Unlink(const char* name)
+{
+#ifdef _WIN32
+	(void)name;
+#else
+	shm_unlink(name);
+#endif
+}
+
+static inline void ImGuiNotifyShm_CopyString(char* dst, size_t dst_size, const char* src)
+{
+	size_t n = 0;
+	while (src && n + 1 < dst_size && src[n])
+	{
+		dst[n] = src[n];
+		n++;
+	}
+	dst[n] = 0;
+}
+
+/// <summary>
+/// Post a toast, safe from any number of threads and processes. Strings are truncated to fit the record
+/// </summary>
+/// <returns>0 if the ring is full (the UI didn't drain it yet)</returns>
+static inline int ImGuiNotifyShm_Post(ImGuiNotifyShmRing* ring, int type, int dismiss_time, const char* title, const char* content)
+{
+	ImGuiNotifyShmRecord* record;
+	uint32_t pos = ImGuiNotifyShm_LoadAcquire(&ring->enqueue_pos);
+	for (;;)
+	{
+		record = &ring->records[pos & (IMGUI_NOTIFY_SHM_SLOTS - 1)];
+		const int32_t diff = (int32_t)(ImGuiNotifyShm_LoadAcquire(&record->sequence) - pos);
+		if (diff == 0 && ImGuiNotifyShm_CompareExchange(&ring->enqueue_pos, pos, pos + 1))
+			break;
+		if (diff < 0)
+			return 0;
+		pos = ImGuiNotifyShm_LoadAcquire(&ring->enqueue_pos);
+	}
+
+	record->type = type;
+	record->dismiss_time = dismiss_time;
+	ImGuiNotifyShm_CopyString(record->title, sizeof(record->title), title);
+	ImGuiNotifyShm_CopyString(record->content, sizeof(record->content), content);
+	ImGuiNotifyShm_StoreRelease(&record->sequence, pos + 1);
+	return 1;
+}
+
+/// <summary>
+/// Next record posted, read in place by the single consumer. NULL when the ring is empty
+/// </summary>
+static inline const ImGuiNotifyShmRecord* ImGuiNotifyShm_Front(ImGuiNotifyShmRing* ring)
+{
+	const uint32_t pos = ring->dequeue_pos;
+	ImGuiNotifyShmRecord* record = &ring->records[pos & (IMGUI_NOTIFY_SHM_SLOTS - 1)];
+	return ImGuiNotifyShm_LoadAcquire(&record->sequence) == pos + 1 ? record : NULL;
+}
+
+/// <summary>
+/// Give the record returned by ImGuiNotifyShm_Front() back to the producers
+/// </summary>
+static inline void ImGuiNotifyShm_PopFront(ImGuiNotifyShmRing* ring)
+{
+	const uint32_t pos = ring->dequeue_pos;
+	ImGuiNotifyShm_StoreRelease(&ring->records[pos & (IMGUI_NOTIFY_SHM_SLOTS - 1)].sequence, pos + IMGUI_NOTIFY_SHM_SLOTS);
+	ring->dequeue_pos = pos + 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif